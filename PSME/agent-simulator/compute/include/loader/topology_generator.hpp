@@ -0,0 +1,154 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file topology_generator.hpp
+ * @brief Synthetic topology generator
+ * */
+
+#pragma once
+
+#include "agent-framework/module/enum/common.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace json {
+class Value;
+}
+
+namespace agent {
+namespace compute {
+namespace loader {
+
+/*!
+ * @brief Sizes of the generated topology and rates of generated events.
+ *
+ * Read from the "generator" section of the configuration, e.g.:
+ * "generator" : {
+ *     "enabled" : true,
+ *     "managers" : 128, "systems" : 4,
+ *     "processors" : 2, "memory" : 16, "networkInterfaces" : 2, "drives" : 4,
+ *     "statusChangesPerSecond" : 10, "hotPlugsPerSecond" : 0.5,
+ *     "seed" : 0
+ * }
+ */
+struct TopologyOptions {
+    bool enabled{false};
+    /*! Sleds, each has its own manager and chassis */
+    std::uint32_t managers{16};
+    /*! Systems per manager */
+    std::uint32_t systems{4};
+    /*! Children of each system (drives are in the sled's chassis) */
+    std::uint32_t processors{2};
+    std::uint32_t memory{16};
+    std::uint32_t network_interfaces{2};
+    std::uint32_t storage_controllers{1};
+    std::uint32_t drives{4};
+    /*! Health changes of random components, 0 disables them */
+    double status_changes_per_second{0.0};
+    /*! Extractions and insertions of random sleds, 0 disables them */
+    double hot_plugs_per_second{0.0};
+    /*! Seed of the generator, 0 for a random one */
+    std::uint32_t seed{0};
+
+    /*!
+     * @brief Read options from the configuration
+     * @param[in] configuration Agent's configuration
+     * @return Options, defaults for those not given
+     */
+    static TopologyOptions from_configuration(const json::Value& configuration);
+};
+
+
+/*!
+ * @brief Generator of a large compute topology.
+ *
+ * Stands in for a full rack of sleds: generate() fills the model with managers,
+ * chassis, systems and their children. When started, a thread changes health
+ * of random components and extracts/inserts random sleds at configured rates,
+ * sending Update/Remove/Add events as the compute agent does.
+ */
+class TopologyGenerator final {
+public:
+    /*!
+     * @brief Constructor
+     * @param[in] options Sizes and event rates
+     */
+    explicit TopologyGenerator(const TopologyOptions& options);
+
+    /*! @brief Destructor, stops the thread */
+    ~TopologyGenerator();
+
+    TopologyGenerator(const TopologyGenerator&) = delete;
+    TopologyGenerator& operator=(const TopologyGenerator&) = delete;
+
+    /*! @brief Add all sleds to the model */
+    void generate();
+
+    /*! @brief Start thread generating events */
+    void start();
+
+    /*! @brief Stop thread generating events */
+    void stop();
+
+private:
+    using Component = agent_framework::model::enums::Component;
+    using Health = agent_framework::model::enums::Health;
+
+    /*! @brief Generated component with functions changing its health and removing it */
+    struct Entry {
+        Component type;
+        std::string uuid;
+        std::string parent;
+        void (*set_health)(const std::string& uuid, Health health);
+        void (*remove)(const std::string& uuid);
+    };
+
+    /*! @brief Sled: manager with its chassis, systems and their children */
+    struct Sled {
+        bool present{false};
+        std::string manager{};
+        std::vector<Entry> components{};
+    };
+
+    template <typename T>
+    void add(T&& component, Component type, Sled& sled);
+
+    void add_sled(std::size_t index);
+    void remove_sled(std::size_t index);
+    void change_status();
+    void hot_plug();
+    void m_task();
+
+    TopologyOptions m_options;
+    std::mt19937 m_random{};
+    std::vector<Sled> m_sleds{};
+    std::uint64_t m_serial{0};
+    std::thread m_thread{};
+    std::atomic<bool> m_running{false};
+};
+
+}
+}
+}
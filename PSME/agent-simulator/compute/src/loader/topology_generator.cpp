@@ -0,0 +1,397 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file topology_generator.cpp
+ * @brief Synthetic topology generator
+ * */
+
+#include "loader/topology_generator.hpp"
+#include "agent-framework/eventing/event_data.hpp"
+#include "agent-framework/eventing/events_queue.hpp"
+#include "agent-framework/logger_ext.hpp"
+#include "agent-framework/module/compute_components.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "json/json.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+using namespace agent::compute::loader;
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+using namespace agent_framework::eventing;
+
+namespace {
+
+std::uint32_t read_count(const json::Value& section, const char* name, std::uint32_t default_value) {
+    return section.is_member(name) && section[name].is_uint() ? section[name].as_uint() : default_value;
+}
+
+
+double read_rate(const json::Value& section, const char* name, double default_value) {
+    return section.is_member(name) && section[name].is_number() ?
+        std::max(0.0, section[name].as_double()) : default_value;
+}
+
+
+void send_event(const std::string& component, const std::string& parent, enums::Component type,
+                Notification notification) {
+    EventData edat{};
+    edat.set_parent(parent);
+    edat.set_component(component);
+    edat.set_type(type);
+    edat.set_notification(notification);
+    EventsQueue::get_instance()->push_back(edat);
+}
+
+
+attribute::FruInfo make_fru_info(const std::string& model, std::uint64_t serial) {
+    attribute::FruInfo fru_info{};
+    fru_info.set_manufacturer(std::string{"Intel Corporation"});
+    fru_info.set_model_number(model);
+    std::ostringstream serial_number{};
+    serial_number << "SIM" << std::setw(10) << std::setfill('0') << serial;
+    fru_info.set_serial_number(serial_number.str());
+    return fru_info;
+}
+
+
+std::string make_mac_address(std::uint64_t serial) {
+    std::ostringstream mac{};
+    // locally administered addresses
+    mac << "02" << std::hex << std::setfill('0');
+    for (int shift = 32; shift >= 0; shift -= 8) {
+        mac << ":" << std::setw(2) << ((serial >> shift) & 0xff);
+    }
+    return mac.str();
+}
+
+
+template <typename T>
+void set_component_health(const std::string& uuid, enums::Health health) {
+    auto& manager = get_manager<T>();
+    if (manager.entry_exists(uuid)) {
+        manager.get_entry_reference(uuid)->set_status(attribute::Status{enums::State::Enabled, health});
+    }
+}
+
+
+template <typename T>
+void remove_component(const std::string& uuid) {
+    get_manager<T>().remove_entry(uuid);
+}
+
+}
+
+
+TopologyOptions TopologyOptions::from_configuration(const json::Value& configuration) {
+    TopologyOptions options{};
+    if (!configuration.is_member("generator")) {
+        return options;
+    }
+    const auto& section = configuration["generator"];
+    options.enabled = section.is_member("enabled") && section["enabled"].is_boolean() && section["enabled"].as_bool();
+    options.managers = read_count(section, "managers", options.managers);
+    options.systems = read_count(section, "systems", options.systems);
+    options.processors = read_count(section, "processors", options.processors);
+    options.memory = read_count(section, "memory", options.memory);
+    options.network_interfaces = read_count(section, "networkInterfaces", options.network_interfaces);
+    options.storage_controllers = read_count(section, "storageControllers", options.storage_controllers);
+    options.drives = read_count(section, "drives", options.drives);
+    options.status_changes_per_second = read_rate(section, "statusChangesPerSecond",
+                                                  options.status_changes_per_second);
+    options.hot_plugs_per_second = read_rate(section, "hotPlugsPerSecond", options.hot_plugs_per_second);
+    options.seed = read_count(section, "seed", options.seed);
+    return options;
+}
+
+
+TopologyGenerator::TopologyGenerator(const TopologyOptions& options) :
+    m_options{options}, m_random{0 != options.seed ? options.seed : std::random_device{}()} {}
+
+
+TopologyGenerator::~TopologyGenerator() {
+    stop();
+}
+
+
+void TopologyGenerator::generate() {
+    m_sleds.resize(m_options.managers);
+    for (std::size_t index = 0; index < m_sleds.size(); ++index) {
+        add_sled(index);
+    }
+    log_info(GET_LOGGER("discovery"), "Generated " << m_options.managers << " managers with "
+        << m_options.systems << " systems each.");
+}
+
+
+void TopologyGenerator::start() {
+    if (!m_running && (m_options.status_changes_per_second > 0.0 || m_options.hot_plugs_per_second > 0.0)) {
+        m_running = true;
+        m_thread = std::thread(&TopologyGenerator::m_task, this);
+    }
+}
+
+
+void TopologyGenerator::stop() {
+    if (m_running) {
+        m_running = false;
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+}
+
+
+template <typename T>
+void TopologyGenerator::add(T&& component, Component type, Sled& sled) {
+    sled.components.push_back(Entry{type, component.get_uuid(), component.get_parent_uuid(),
+                                    &set_component_health<T>, &remove_component<T>});
+    get_manager<T>().add_entry(std::forward<T>(component));
+}
+
+
+void TopologyGenerator::add_sled(std::size_t index) {
+    auto& sled = m_sleds[index];
+    sled.components.clear();
+    const attribute::Status status{enums::State::Enabled, enums::Health::OK};
+
+    Manager manager{};
+    manager.set_status(status);
+    manager.set_manager_type(enums::ManagerInfoType::BMC);
+    manager.set_manager_model(std::string{"Simulated BMC"});
+    manager.set_firmware_version(std::string{"1.0"});
+    manager.set_ipv4_address("10.1." + std::to_string(index / 250) + "." + std::to_string(index % 250 + 1));
+    manager.add_collection(attribute::Collection(
+        enums::CollectionName::Chassis, enums::CollectionType::Chassis, ""));
+    manager.add_collection(attribute::Collection(
+        enums::CollectionName::Systems, enums::CollectionType::Systems, ""));
+    sled.manager = manager.get_uuid();
+
+    Chassis chassis{sled.manager};
+    chassis.set_status(status);
+    chassis.set_type(enums::ChassisType::Module);
+    chassis.set_size(1);
+    chassis.set_location_offset(static_cast<std::uint32_t>(index));
+    chassis.set_parent_id("1");
+    chassis.set_fru_info(make_fru_info("Simulated sled", ++m_serial));
+    chassis.add_collection(attribute::Collection(
+        enums::CollectionName::Drives, enums::CollectionType::Drives, ""));
+    const auto chassis_uuid = chassis.get_uuid();
+
+    add(std::move(manager), Component::Manager, sled);
+    add(std::move(chassis), Component::Chassis, sled);
+
+    for (std::uint32_t drive_index = 0; drive_index < m_options.drives; ++drive_index) {
+        Drive drive{chassis_uuid};
+        drive.set_status(status);
+        drive.set_interface(enums::StorageProtocol::SATA);
+        drive.set_type(0 == drive_index % 2 ? enums::DriveType::SSD : enums::DriveType::HDD);
+        drive.set_capacity_gb(0 == drive_index % 2 ? 480.0 : 2000.0);
+        drive.set_physical_id(std::to_string(drive_index) + ".0.0");
+        drive.set_fru_info(make_fru_info("Simulated drive", ++m_serial));
+        add(std::move(drive), Component::Drive, sled);
+    }
+
+    for (std::uint32_t system_index = 0; system_index < m_options.systems; ++system_index) {
+        System system{sled.manager};
+        system.set_status(status);
+        system.set_guid(System{}.get_uuid());
+        system.set_bios_version(std::string{"SE5C610.86B.01.01.0001"});
+        system.set_chassis(chassis_uuid);
+        system.set_fru_info(make_fru_info("Simulated system", ++m_serial));
+        system.add_collection(attribute::Collection(
+            enums::CollectionName::StorageSubsystems, enums::CollectionType::StorageSubsystems, ""));
+        system.add_collection(attribute::Collection(
+            enums::CollectionName::NetworkInterfaces, enums::CollectionType::NetworkInterfaces, ""));
+        system.add_collection(attribute::Collection(
+            enums::CollectionName::Memory, enums::CollectionType::Memory, ""));
+        system.add_collection(attribute::Collection(
+            enums::CollectionName::Processors, enums::CollectionType::Processors, ""));
+        const auto system_uuid = system.get_uuid();
+        add(std::move(system), Component::System, sled);
+
+        for (std::uint32_t socket = 0; socket < m_options.processors; ++socket) {
+            Processor processor{system_uuid};
+            processor.set_status(status);
+            processor.set_manufacturer(std::string{"Intel Corporation"});
+            processor.set_processor_type(enums::ProcessorType::CPU);
+            processor.set_processor_architecture(enums::ProcessorArchitecture::x86);
+            processor.set_model(enums::ProcessorModel::E5);
+            processor.set_model_name(std::string{"Intel(R) Xeon(R) CPU E5-2699 v4 @ 2.20GHz"});
+            processor.set_socket("CPU" + std::to_string(socket));
+            processor.set_total_cores(22);
+            processor.set_enabled_cores(22);
+            processor.set_total_threads(44);
+            processor.set_enabled_threads(44);
+            processor.set_max_speed_mhz(3600);
+            add(std::move(processor), Component::Processor, sled);
+        }
+
+        for (std::uint32_t slot = 0; slot < m_options.memory; ++slot) {
+            Memory memory{system_uuid};
+            memory.set_status(status);
+            memory.set_device_locator("DIMM_" + std::string(1, static_cast<char>('A' + slot % 8))
+                                      + std::to_string(slot / 8 + 1));
+            memory.set_capacity_mb(16384);
+            memory.set_operating_speed_mhz(2400);
+            memory.set_fru_info(make_fru_info("Simulated DIMM", ++m_serial));
+            attribute::Region region{};
+            region.set_region_id("1");
+            region.set_memory_type(enums::MemoryClass::Volatile);
+            region.set_offset_mb(0);
+            region.set_size_mb(16384);
+            memory.add_region(std::move(region));
+            add(std::move(memory), Component::Memory, sled);
+        }
+
+        for (std::uint32_t port = 0; port < m_options.network_interfaces; ++port) {
+            NetworkInterface interface{system_uuid};
+            interface.set_status(status);
+            interface.set_frame_size(1500);
+            interface.set_speed_mbps(10000);
+            interface.set_full_duplex(true);
+            interface.set_autosense(false);
+            const auto mac_address = make_mac_address(++m_serial);
+            interface.set_mac_address(mac_address);
+            interface.set_factory_mac_address(mac_address);
+            add(std::move(interface), Component::NetworkInterface, sled);
+        }
+
+        if (0 != m_options.storage_controllers) {
+            StorageSubsystem storage{system_uuid};
+            storage.set_status(status);
+            storage.add_collection(attribute::Collection(
+                enums::CollectionName::StorageControllers, enums::CollectionType::StorageControllers, ""));
+            storage.add_collection(attribute::Collection(
+                enums::CollectionName::Drives, enums::CollectionType::Drives, ""));
+            const auto storage_uuid = storage.get_uuid();
+            add(std::move(storage), Component::StorageSubsystem, sled);
+
+            for (std::uint32_t controller_index = 0; controller_index < m_options.storage_controllers;
+                 ++controller_index) {
+                StorageController controller{storage_uuid};
+                controller.set_status(status);
+                controller.add_supported_device_protocol(enums::StorageProtocol::SATA);
+                controller.set_physical_id("1f." + std::to_string(controller_index + 2));
+                controller.set_fru_info(make_fru_info("Simulated storage controller", ++m_serial));
+                add(std::move(controller), Component::StorageController, sled);
+            }
+        }
+    }
+    sled.present = true;
+}
+
+
+void TopologyGenerator::remove_sled(std::size_t index) {
+    auto& sled = m_sleds[index];
+    // children are added after their parents
+    for (auto it = sled.components.crbegin(); it != sled.components.crend(); ++it) {
+        it->remove(it->uuid);
+    }
+    sled.components.clear();
+    sled.present = false;
+}
+
+
+void TopologyGenerator::change_status() {
+    std::vector<std::size_t> present{};
+    for (std::size_t index = 0; index < m_sleds.size(); ++index) {
+        if (m_sleds[index].present && !m_sleds[index].components.empty()) {
+            present.push_back(index);
+        }
+    }
+    if (present.empty()) {
+        return;
+    }
+    const auto& sled = m_sleds[present[std::uniform_int_distribution<std::size_t>{0, present.size() - 1}(m_random)]];
+    const auto& entry = sled.components[
+        std::uniform_int_distribution<std::size_t>{0, sled.components.size() - 1}(m_random)];
+
+    // mostly healthy, as in a real rack
+    const auto draw = std::uniform_int_distribution<int>{0, 99}(m_random);
+    const Health health = draw < 80 ? Health::OK : (draw < 95 ? Health::Warning : Health::Critical);
+    entry.set_health(entry.uuid, health);
+    send_event(entry.uuid, entry.parent, entry.type, Notification::Update);
+    log_debug(GET_LOGGER("discovery"), "Health of " << entry.type << " " << entry.uuid
+        << " set to " << health.to_string());
+}
+
+
+void TopologyGenerator::hot_plug() {
+    if (m_sleds.empty()) {
+        return;
+    }
+    const auto index = std::uniform_int_distribution<std::size_t>{0, m_sleds.size() - 1}(m_random);
+    if (m_sleds[index].present) {
+        const auto manager = m_sleds[index].manager;
+        remove_sled(index);
+        send_event(manager, "", Component::Manager, Notification::Remove);
+        log_info(GET_LOGGER("discovery"), "Sled " << index << " extracted.");
+    }
+    else {
+        add_sled(index);
+        send_event(m_sleds[index].manager, "", Component::Manager, Notification::Add);
+        log_info(GET_LOGGER("discovery"), "Sled " << index << " inserted.");
+    }
+}
+
+
+void TopologyGenerator::m_task() {
+    using Clock = std::chrono::steady_clock;
+    using Period = std::chrono::duration<double>;
+
+    log_debug(GET_LOGGER("discovery"), "Topology generator thread started.");
+    const auto status_period = Period{m_options.status_changes_per_second > 0.0 ?
+                                      1.0 / m_options.status_changes_per_second : 0.0};
+    const auto hot_plug_period = Period{m_options.hot_plugs_per_second > 0.0 ?
+                                        1.0 / m_options.hot_plugs_per_second : 0.0};
+    const auto start = Clock::now();
+    auto next_status = start + std::chrono::duration_cast<Clock::duration>(status_period);
+    auto next_hot_plug = start + std::chrono::duration_cast<Clock::duration>(hot_plug_period);
+    // with an idle rate the thread still wakes up to notice stop()
+    const auto max_sleep = std::chrono::milliseconds(100);
+
+    while (m_running) {
+        const auto now = Clock::now();
+        if (status_period.count() > 0.0 && now >= next_status) {
+            change_status();
+            next_status += std::chrono::duration_cast<Clock::duration>(status_period);
+            continue;
+        }
+        if (hot_plug_period.count() > 0.0 && now >= next_hot_plug) {
+            hot_plug();
+            next_hot_plug += std::chrono::duration_cast<Clock::duration>(hot_plug_period);
+            continue;
+        }
+        auto wake_up = now + max_sleep;
+        if (status_period.count() > 0.0) {
+            wake_up = std::min(wake_up, next_status);
+        }
+        if (hot_plug_period.count() > 0.0) {
+            wake_up = std::min(wake_up, next_hot_plug);
+        }
+        std::this_thread::sleep_until(wake_up);
+    }
+    log_debug(GET_LOGGER("discovery"), "Topology generator thread stopped.");
+}
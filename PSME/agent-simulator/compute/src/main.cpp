@@ -37,6 +37,7 @@
 
 #include "asset_configuration/asset_configuration.hpp"
 #include "loader/compute_loader.hpp"
+#include "loader/topology_generator.hpp"
 
 #include "configuration/configuration.hpp"
 #include "configuration/configuration_validator.hpp"
@@ -52,6 +53,8 @@ using namespace agent_framework;
 using namespace agent_framework::generic;
 using namespace logger_cpp;
 using namespace configuration;
+using agent::compute::loader::TopologyGenerator;
+using agent::compute::loader::TopologyOptions;
 
 using agent::generic::DEFAULT_CONFIGURATION;
 using agent::generic::DEFAULT_VALIDATOR_JSON;
@@ -77,26 +80,34 @@ int main(int argc, const char *argv[]) {
     LoggerFactory::set_main_logger_name("agent");
     log_info(GET_LOGGER("compute-agent"), "Running Generic Agent...\n");
 
-    /*  Reading asset configuration from xml*/
-    auto& asset = agent::AssetConfiguration::get_instance();
-    try {
-        asset.read_configuration(configuration);
-    } catch (const json::Value::Exception& e) {
-        log_error(GET_LOGGER("compute-agent"),
-                "Cannot read asset configuration " << e.what());
-    } catch (const xmlpp::exception& e) {
-        log_error(GET_LOGGER("compute-agent"),
-                "Cannot read asset configuration " << e.what());
-        agent::AssetConfiguration::cleanup();
-        Configuration::cleanup();
-        LoggerFactory::cleanup();
-        return -1;
+    /* Generated topology replaces the asset configuration */
+    const auto topology_options = TopologyOptions::from_configuration(configuration);
+    TopologyGenerator topology_generator{topology_options};
+    if (topology_options.enabled) {
+        topology_generator.generate();
     }
+    else {
+        /*  Reading asset configuration from xml*/
+        auto& asset = agent::AssetConfiguration::get_instance();
+        try {
+            asset.read_configuration(configuration);
+        } catch (const json::Value::Exception& e) {
+            log_error(GET_LOGGER("compute-agent"),
+                    "Cannot read asset configuration " << e.what());
+        } catch (const xmlpp::exception& e) {
+            log_error(GET_LOGGER("compute-agent"),
+                    "Cannot read asset configuration " << e.what());
+            agent::AssetConfiguration::cleanup();
+            Configuration::cleanup();
+            LoggerFactory::cleanup();
+            return -1;
+        }
 
-    ::agent::compute::loader::ComputeLoader module_loader{};
-    if (!module_loader.load(asset.get_drawer())) {
-        std::cerr << "Invalid asset configuration" << std::endl;
-        return -2;
+        ::agent::compute::loader::ComputeLoader module_loader{};
+        if (!module_loader.load(asset.get_drawer())) {
+            std::cerr << "Invalid asset configuration" << std::endl;
+            return -2;
+        }
     }
 
     try {
@@ -127,12 +138,16 @@ int main(int argc, const char *argv[]) {
         ::agent_framework::eventing::EventsQueue::get_instance()->push_back(edat);
     }
 
+    /* Status changes and hot-plugs of the generated topology */
+    topology_generator.start();
+
     /* Stop the program and wait for interrupt */
     wait_for_interrupt();
 
     log_info(GET_LOGGER("compute-agent"), "Stopping Generic Agent...\n");
 
     /* Cleanup */
+    topology_generator.stop();
     server.stop();
     amc_connection.stop();
     event_dispatcher.stop();
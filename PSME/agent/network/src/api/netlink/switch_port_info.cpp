@@ -46,6 +46,7 @@
 #include "api/lldp/port_desc_tlv.hpp"
 #include "api/lldp/exceptions/api_error.hpp"
 
+#include <memory>
 #include <sstream>
 #include <net/if.h>
 
@@ -334,12 +335,18 @@ SwitchPortInfo::PortList SwitchPortInfo::get_port_members() const {
     SysFs sysfs{};
     PortList members{};
     try {
+        /* query all ports at once */
+        std::vector<std::unique_ptr<PortMessage>> port_msgs{};
+        NlMessage::Messages messages{};
         for (const auto& port : sysfs.get_port_list()) {
-            PortMessage port_msg{port};
-            port_msg.send();
-            if (port_msg.is_member()
-                && port_msg.get_master() == get_port_identifier()) {
-                members.push_back(port);
+            port_msgs.emplace_back(new PortMessage{port});
+            messages.push_back(port_msgs.back().get());
+        }
+        NlMessage::send(messages);
+        for (const auto& port_msg : port_msgs) {
+            if (port_msg->is_member()
+                && port_msg->get_master() == get_port_identifier()) {
+                members.push_back(port_msg->get_ifname());
             }
         }
     }
@@ -118,22 +118,22 @@ namespace {
         /* add port into network manager */
         auto network_components = NetworkComponents::get_instance();
         auto& port_manager = network_components->get_port_manager();
-        EthernetSwitchPort port_model{switch_uuid};
-        port_model.add_collection({CollectionName::Vlans,
-                                  CollectionType::EthernetSwitchPortVlans, ""});
-        port_model.add_collection({CollectionName::PortAcls,
-                                  CollectionType::Acls, ""});
-        port_model.add_collection({CollectionName::StaticMacs,
-                                  CollectionType::StaticMacs, ""});
-        port_model.set_link_technology(LinkTechnology::Ethernet);
-        port_model.set_port_class(PortClass::Physical);
-        port_model.set_port_type(is_mesh_port(port_identifier) ?
-                                PortType::MeshPort : PortType::Upstream);
-        port_model.set_port_mode(PortMode::Unknown);
-        port_model.set_port_identifier(port_identifier);
-        port_model.set_vlan_enable(true);
-        port_model.set_status({State::Enabled, Health::OK});
-        port_manager.add_entry(port_model);
+        const auto port_type = is_mesh_port(port_identifier) ? PortType::MeshPort : PortType::Upstream;
+        /* port is filled in place, the manager is locked until it is done */
+        auto port_model = port_manager.emplace_entry(switch_uuid);
+        port_model->add_collection({CollectionName::Vlans,
+                                   CollectionType::EthernetSwitchPortVlans, ""});
+        port_model->add_collection({CollectionName::PortAcls,
+                                   CollectionType::Acls, ""});
+        port_model->add_collection({CollectionName::StaticMacs,
+                                   CollectionType::StaticMacs, ""});
+        port_model->set_link_technology(LinkTechnology::Ethernet);
+        port_model->set_port_class(PortClass::Physical);
+        port_model->set_port_type(port_type);
+        port_model->set_port_mode(PortMode::Unknown);
+        port_model->set_port_identifier(port_identifier);
+        port_model->set_vlan_enable(true);
+        port_model->set_status({State::Enabled, Health::OK});
     }
 
     static void discover_switch_ports(const string& switch_uuid) {
@@ -0,0 +1,120 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nl_socket_pool_test.cpp
+ *
+ * @brief Netlink socket pool tests
+ * */
+
+#include "gtest/gtest.h"
+
+#include "api/netlink/port_message.hpp"
+#include "netlink/nl_socket_pool.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace netlink_base;
+using namespace agent::network::api::netlink;
+
+namespace {
+
+constexpr const char LOOPBACK[] = "lo";
+
+std::size_t get_idle_route_sockets() {
+    return NlSocketPool::get_instance().get_idle_count(NETLINK_ROUTE);
+}
+
+}
+
+class NlSocketPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        NlSocketPool::get_instance().clear();
+    }
+
+    void TearDown() override {
+        NlSocketPool::get_instance().clear();
+    }
+
+    virtual ~NlSocketPoolTest();
+};
+
+NlSocketPoolTest::~NlSocketPoolTest() { }
+
+TEST_F(NlSocketPoolTest, SocketIsReused) {
+    auto sock = NlSocketPool::get_instance().acquire(NETLINK_ROUTE);
+    auto raw = sock.get();
+    sock.reset();
+    ASSERT_EQ(1, get_idle_route_sockets());
+
+    sock = NlSocketPool::get_instance().acquire(NETLINK_ROUTE);
+    ASSERT_EQ(raw, sock.get());
+    ASSERT_EQ(0, get_idle_route_sockets());
+}
+
+TEST_F(NlSocketPoolTest, DiscardedSocketIsNotReturned) {
+    auto sock = NlSocketPool::get_instance().acquire(NETLINK_ROUTE);
+    NlSocketPool::discard(sock);
+    ASSERT_EQ(nullptr, sock.get());
+    ASSERT_EQ(0, get_idle_route_sockets());
+}
+
+TEST_F(NlSocketPoolTest, IdleSocketsAreLimited) {
+    std::vector<NlSocket> socks{};
+    for (std::size_t i = 0; i < NlSocketPool::MAX_IDLE_SOCKETS + 2; ++i) {
+        socks.emplace_back(NlSocketPool::get_instance().acquire(NETLINK_ROUTE));
+    }
+    socks.clear();
+    ASSERT_EQ(NlSocketPool::MAX_IDLE_SOCKETS, get_idle_route_sockets());
+}
+
+TEST_F(NlSocketPoolTest, MessagesReuseSocket) {
+    for (int i = 0; i < 3; ++i) {
+        PortMessage msg{LOOPBACK};
+        msg.send();
+        ASSERT_FALSE(msg.is_member());
+    }
+    /* a single socket is used, acks are consumed with the replies */
+    ASSERT_EQ(1, get_idle_route_sockets());
+}
+
+TEST_F(NlSocketPoolTest, FailedMessageDiscardsSocket) {
+    PortMessage msg{"no-such-port"};
+    ASSERT_ANY_THROW(msg.send());
+    ASSERT_EQ(0, get_idle_route_sockets());
+}
+
+TEST_F(NlSocketPoolTest, PipelinedMessages) {
+    std::vector<std::unique_ptr<PortMessage>> port_msgs{};
+    NlMessage::Messages messages{};
+    for (int i = 0; i < 16; ++i) {
+        port_msgs.emplace_back(new PortMessage{LOOPBACK});
+        messages.push_back(port_msgs.back().get());
+    }
+    NlMessage::send(messages);
+    port_msgs.clear();
+
+    /* socket is still usable */
+    PortMessage msg{LOOPBACK};
+    msg.send();
+    ASSERT_FALSE(msg.is_member());
+}
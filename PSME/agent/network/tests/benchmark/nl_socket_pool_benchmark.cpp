@@ -0,0 +1,147 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nl_socket_pool_benchmark.cpp
+ *
+ * @brief Netlink message throughput benchmark.
+ *
+ * RTM_GETLINK messages of a network interface are sent with a new socket
+ * for each message, with sockets taken from the pool and pipelined over a
+ * single pooled socket.
+ *
+ * Usage: psme-network-netlink-benchmark [--messages=N] [--interface=NAME]
+ * */
+
+#include "api/netlink/port_message.hpp"
+#include "netlink/nl_socket_pool.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace netlink_base;
+using namespace agent::network::api::netlink;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    unsigned messages{1000};
+    std::string interface{"lo"};
+};
+
+/*! Time of all messages sent by the function */
+template <typename F>
+double measure_ms(F function) {
+    const auto start = Clock::now();
+    function();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = arg.substr(eq + 1);
+        if ("--messages" == name) {
+            options.messages = static_cast<unsigned>(std::stoul(value));
+        }
+        else if ("--interface" == name) {
+            options.interface = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.messages || options.interface.empty()) {
+        throw std::invalid_argument("Invalid number of messages or interface");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--messages=1000] [--interface=lo]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        auto& pool = NlSocketPool::get_instance();
+        pool.clear();
+
+        const auto unpooled_ms = measure_ms([&options, &pool]() {
+            for (unsigned i = 0; i < options.messages; ++i) {
+                PortMessage msg{options.interface};
+                msg.send();
+                pool.clear();
+            }
+        });
+
+        const auto pooled_ms = measure_ms([&options]() {
+            for (unsigned i = 0; i < options.messages; ++i) {
+                PortMessage msg{options.interface};
+                msg.send();
+            }
+        });
+
+        const auto pipelined_ms = measure_ms([&options]() {
+            std::vector<std::unique_ptr<PortMessage>> port_msgs{};
+            NlMessage::Messages messages{};
+            for (unsigned i = 0; i < options.messages; ++i) {
+                port_msgs.emplace_back(new PortMessage{options.interface});
+                messages.push_back(port_msgs.back().get());
+            }
+            NlMessage::send(messages);
+        });
+        pool.clear();
+
+        std::cout << options.messages << " RTM_GETLINK messages of " << options.interface << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "New socket each:  " << std::setw(10) << unpooled_ms << " ms" << std::endl;
+        std::cout << "Pooled:           " << std::setw(10) << pooled_ms << " ms" << std::endl;
+        std::cout << "Pipelined:        " << std::setw(10) << pipelined_ms << " ms" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file binding_cache.hpp
+ * @brief Cache of the port and partition bindings read from the PCIe switches
+ * */
+
+#pragma once
+
+#include "gas/mrpc/port_binding_info.hpp"
+#include "gas/mrpc/partition_binding_info.hpp"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*! Agent namespace */
+namespace agent {
+/*! PNC namespace */
+namespace pnc {
+/*! GAS namespace */
+namespace gas {
+
+/*!
+ * @brief Snapshots of the PortBindingInfo and PartitionBindingInfo results of each switch (identified by its
+ * memory path, all switches share the access interface). Entries are valid until they are older than the max age
+ * or the bindings of the switch are invalidated. Each invalidation starts a new generation of the switch, results
+ * of the MRPC commands issued in an older generation or during a binding change are not stored.
+ * */
+class BindingCache {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Generation = std::uint64_t;
+
+    /*! Default max age of the entries */
+    static constexpr std::chrono::seconds::rep DEFAULT_MAX_AGE_SEC = 20;
+
+
+    /*! Ports and partitions whose cached bindings differ from the bindings read from the switch */
+    struct Mismatches {
+        std::vector<std::uint8_t> ports{};
+        std::vector<std::uint8_t> partitions{};
+
+        bool empty() const {
+            return ports.empty() && partitions.empty();
+        }
+    };
+
+
+    /*!
+     * @brief Binding change of a switch, its bindings are invalidated when the change starts and ends
+     * and nothing is cached in the meantime
+     * */
+    class Change final {
+    public:
+        /*!
+         * @brief Starts the binding change
+         * @param[in] cache Binding cache
+         * @param[in] memory_path Memory path of the switch
+         * */
+        Change(BindingCache& cache, const std::string& memory_path);
+
+
+        Change(const Change&) = delete;
+
+
+        Change& operator=(const Change&) = delete;
+
+
+        /*! Ends the binding change */
+        ~Change();
+
+    private:
+        BindingCache& m_cache;
+        const std::string m_memory_path;
+    };
+
+
+    /*! Default constructor */
+    BindingCache() {}
+
+
+    BindingCache(const BindingCache&) = delete;
+
+
+    BindingCache& operator=(const BindingCache&) = delete;
+
+
+    /*!
+     * @brief Sets max age of the entries, zero max age disables the cache
+     * @param[in] max_age Max age of the entries
+     * */
+    void set_max_age(Clock::duration max_age);
+
+
+    /*!
+     * @brief Gets max age of the entries
+     * @return Max age of the entries
+     * */
+    Clock::duration get_max_age() const;
+
+
+    /*!
+     * @brief Gets current generation of the bindings of the switch, read it before issuing the MRPC command
+     * whose result is to be stored
+     * @param[in] memory_path Memory path of the switch
+     * @return Generation of the bindings
+     * */
+    Generation get_generation(const std::string& memory_path) const;
+
+
+    /*!
+     * @brief Gets cached binding of a port as a result of the PortBindingInfo command
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] phy_port_id Physical id of the port
+     * @param[out] pbi Filled in with a single binding entry
+     * @return True if a valid entry was found
+     * */
+    bool get_port_binding_info(const std::string& memory_path, std::uint8_t phy_port_id,
+                               mrpc::PortBindingInfo& pbi) const;
+
+
+    /*!
+     * @brief Gets cached result of the PartitionBindingInfo command
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] partition_id Id of the partition
+     * @param[out] pbi Filled in with the cached result
+     * @return True if a valid entry was found
+     * */
+    bool get_partition_binding_info(const std::string& memory_path, std::uint8_t partition_id,
+                                    mrpc::PartitionBindingInfo& pbi) const;
+
+
+    /*!
+     * @brief Stores bindings of the ports returned by the PortBindingInfo command
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] generation Generation read before the command was issued
+     * @param[in] pbi Result of the command
+     * */
+    void update(const std::string& memory_path, Generation generation, const mrpc::PortBindingInfo& pbi);
+
+
+    /*!
+     * @brief Stores result of the PartitionBindingInfo command
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] generation Generation read before the command was issued
+     * @param[in] pbi Result of the command
+     * */
+    void update(const std::string& memory_path, Generation generation, const mrpc::PartitionBindingInfo& pbi);
+
+
+    /*!
+     * @brief Compares cached bindings of the switch with the bindings of all ports read from the switch.
+     * Partitions are checked against the ports bound to them.
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] all_ports Result of the PortBindingInfo command issued for all ports
+     * @return Ports and partitions with stale entries
+     * */
+    Mismatches check_consistency(const std::string& memory_path, const mrpc::PortBindingInfo& all_ports) const;
+
+
+    /*!
+     * @brief Replaces cached bindings of the switch with the bindings of all ports read from the switch,
+     * partitions not consistent with them are dropped
+     * @param[in] memory_path Memory path of the switch
+     * @param[in] generation Generation read before the command was issued
+     * @param[in] all_ports Result of the PortBindingInfo command issued for all ports
+     * @return Ports and partitions whose entries were stale
+     * */
+    Mismatches revalidate(const std::string& memory_path, Generation generation,
+                          const mrpc::PortBindingInfo& all_ports);
+
+
+    /*!
+     * @brief Drops all entries of the switch and starts a new generation
+     * @param[in] memory_path Memory path of the switch
+     * */
+    void invalidate(const std::string& memory_path);
+
+
+    /*! Drops entries of all switches */
+    void clear();
+
+private:
+    struct PortBinding {
+        std::uint8_t partition_id{NO_PORT_ASSIGNED};
+        std::uint8_t logical_bridge_id{NO_PORT_ASSIGNED};
+        std::uint8_t state_operation_result{};
+        Clock::time_point timestamp{};
+    };
+
+    struct PartitionBinding {
+        PartitionBinding(const mrpc::PartitionBindingInfo& binding_info, const Clock::time_point& time) :
+            info{binding_info}, timestamp{time} {}
+
+        mrpc::PartitionBindingInfo info;
+        Clock::time_point timestamp;
+    };
+
+    struct SwitchBindings {
+        Generation generation{};
+        unsigned changes{};
+        std::map<std::uint8_t, PortBinding> ports{};
+        std::map<std::uint8_t, PartitionBinding> partitions{};
+    };
+
+    void change(const std::string& memory_path, bool is_started);
+
+
+    bool is_valid(const Clock::time_point& timestamp) const;
+
+
+    void store_ports(SwitchBindings& bindings, const mrpc::PortBindingInfo& pbi);
+
+
+    Mismatches find_mismatches(const SwitchBindings& bindings, const mrpc::PortBindingInfo& all_ports) const;
+
+
+    mutable std::mutex m_mutex{};
+    Clock::duration m_max_age{std::chrono::seconds{DEFAULT_MAX_AGE_SEC}};
+    std::map<std::string, SwitchBindings> m_switches{};
+};
+
+}
+}
+}
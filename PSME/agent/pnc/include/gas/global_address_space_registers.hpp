@@ -32,6 +32,7 @@
 #include "access_interface_factory.hpp"
 
 #include <memory>
+#include <string>
 #include <mutex>
 
 /*! Agent namespace */
@@ -60,6 +61,15 @@ public:
     GlobalAddressSpaceRegisters(AccessInterface* iface) : m_iface(iface) {}
 
 
+    /*!
+     * @brief Constructor initializing interface of a switch
+     * @param[in] iface Access Interface to be used
+     * @param[in] memory_path Path to the memory file of the switch
+     */
+    GlobalAddressSpaceRegisters(AccessInterface* iface, const std::string& memory_path) :
+        m_iface(iface), m_memory_path(memory_path) {}
+
+
     /*! Copy constructor */
     GlobalAddressSpaceRegisters(const GlobalAddressSpaceRegisters&) = default;
 
@@ -87,6 +97,15 @@ public:
     }
 
 
+    /*!
+     * @brief Returns path to the memory file of the switch, the interface is shared by all switches
+     * @return Memory path, empty if not known
+     */
+    const std::string& get_memory_path() const {
+        return m_memory_path;
+    }
+
+
     /*!
      * @brief Gets default GAS instance using AccessInterfaceFactory
      * @param[in] path Path to the memory file
@@ -127,6 +146,7 @@ public:
 private:
 
     AccessInterface* m_iface{nullptr};
+    std::string m_memory_path{};
 
 
     template<typename T>
@@ -0,0 +1,182 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nvme/drive_telemetry.hpp
+ * @brief Batched and cached collection of NVMe drive SMART, VPD and firmware version
+ * */
+
+#pragma once
+
+#include "nvme/smart.hpp"
+#include "nvme/vital_product_data.hpp"
+#include "nvme/fw_version.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*! Agent namespace */
+namespace agent {
+/*! PNC namespace */
+namespace pnc {
+/*! NVMe namespace */
+namespace nvme {
+
+/*! Location of the drive management interface on the TWI bus */
+struct DriveLocation {
+    gas::PM85X6TwiPort port;
+    gas::PCA9548TwiExpanderChannel channel;
+
+    bool operator<(const DriveLocation& rhs) const {
+        return port < rhs.port || (port == rhs.port && channel < rhs.channel);
+    }
+};
+
+/*! SMART, VPD and firmware version of a drive read in one TWI session */
+class DriveTelemetry {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /*!
+     * @brief Constructor
+     * @param platform Platform the drive is connected to
+     * */
+    explicit DriveTelemetry(agent_framework::model::enums::PlatformType platform) :
+        smart{platform}, vpd{platform}, firmware_version{platform}, m_platform{platform} {}
+
+    /*!
+     * @brief Gets platform the drive is connected to
+     * @return Platform type
+     * */
+    agent_framework::model::enums::PlatformType get_platform() const {
+        return m_platform;
+    }
+
+    /*!
+     * @brief Checks if any of the structures was read
+     * @return True if SMART, VPD or firmware version is valid
+     * */
+    bool is_valid() const {
+        return is_smart_valid || is_vpd_valid || is_firmware_version_valid;
+    }
+
+    /*!
+     * @brief Checks if SMART data is not older than given age
+     * @param max_age Maximal age of the data
+     * @param now Current time
+     * @return True if SMART data may be used without reading the drive
+     * */
+    bool is_fresh(Clock::duration max_age, Clock::time_point now = Clock::now()) const {
+        return is_smart_valid && now - collected_at <= max_age;
+    }
+
+    Smart smart;
+    VitalProductData vpd;
+    FirmwareVersion firmware_version;
+    bool is_smart_valid{false};
+    bool is_vpd_valid{false};
+    bool is_firmware_version_valid{false};
+    /*! Time of the last SMART read */
+    Clock::time_point collected_at{};
+
+private:
+    agent_framework::model::enums::PlatformType m_platform;
+};
+
+/*!
+ * @brief Collects telemetry of NVMe drives over the TWI bus of the switch.
+ *
+ * Expander channel of the drive is selected once per session and SMART with
+ * firmware version are read in a single transaction. VPD does not change while
+ * the drive is present and is read only when the drive is collected.
+ * Each TWI port is a separate bus: sessions on the same port are serialized
+ * (selected channel is shared state of the bus), different ports are refreshed
+ * concurrently.
+ * */
+class DriveTelemetryCollector final {
+public:
+    using Clock = DriveTelemetry::Clock;
+
+    /*! Default age of cached data, matches the port monitor interval */
+    static constexpr std::chrono::seconds DEFAULT_MAX_AGE{10};
+
+    /*!
+     * @brief Constructor
+     * @param max_age Maximal age of cached SMART data returned by get()
+     * */
+    explicit DriveTelemetryCollector(Clock::duration max_age = DEFAULT_MAX_AGE) : m_max_age(max_age) {}
+
+    DriveTelemetryCollector(const DriveTelemetryCollector&) = delete;
+    DriveTelemetryCollector& operator=(const DriveTelemetryCollector&) = delete;
+
+    /*!
+     * @brief Sets maximal age of cached SMART data
+     * @param max_age Maximal age of cached data
+     * */
+    void set_max_age(Clock::duration max_age);
+
+    /*!
+     * @brief Reads SMART, VPD and firmware version of the drive and caches them
+     * @param i2c Interface used to access the TWI bus
+     * @param location Location of the drive
+     * @param[in,out] telemetry Telemetry of the drive, platform selects the expander
+     * */
+    void collect(const i2c::I2cAccessInterfacePtr i2c, const DriveLocation& location, DriveTelemetry& telemetry);
+
+    /*!
+     * @brief Gets cached telemetry of the drive
+     *
+     * SMART data older than maximal age is read again, drives not collected yet are collected.
+     * @param i2c Interface used to access the TWI bus
+     * @param location Location of the drive
+     * @param[in,out] telemetry Telemetry of the drive, platform selects the expander
+     * */
+    void get(const i2c::I2cAccessInterfacePtr i2c, const DriveLocation& location, DriveTelemetry& telemetry);
+
+    /*!
+     * @brief Reads SMART data of all collected drives, drives on different TWI ports concurrently
+     * @param i2c Interface used to access the TWI bus
+     * */
+    void refresh(const i2c::I2cAccessInterfacePtr i2c);
+
+    /*!
+     * @brief Removes cached telemetry of the drive, e.g. after the drive was removed
+     * @param location Location of the drive
+     * */
+    void invalidate(const DriveLocation& location);
+
+private:
+    std::mutex& get_port_mutex(gas::PM85X6TwiPort port);
+    void read(const i2c::I2cAccessInterfacePtr i2c, const DriveLocation& location, DriveTelemetry& telemetry,
+              bool read_vpd);
+    void store(const DriveLocation& location, const DriveTelemetry& telemetry);
+
+    Clock::duration m_max_age;
+    std::mutex m_mutex{};
+    std::map<DriveLocation, DriveTelemetry> m_cache{};
+    std::map<gas::PM85X6TwiPort, std::unique_ptr<std::mutex>> m_port_mutexes{};
+};
+
+using DriveTelemetryCollectorPtr = std::shared_ptr<DriveTelemetryCollector>;
+
+}
+}
+}
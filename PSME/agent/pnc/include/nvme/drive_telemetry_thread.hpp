@@ -0,0 +1,75 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nvme/drive_telemetry_thread.hpp
+ * @brief Periodic refresh of cached NVMe drive telemetry
+ * */
+
+#pragma once
+
+#include "nvme/drive_telemetry.hpp"
+#include "agent-framework/threading/thread.hpp"
+
+#include <chrono>
+
+namespace json { class Value; }
+
+/*! Agent namespace */
+namespace agent {
+/*! PNC namespace */
+namespace pnc {
+/*! NVMe namespace */
+namespace nvme {
+
+/*!
+ * @brief DriveTelemetryThread periodically refreshes SMART data of all discovered drives.
+ *
+ * Drive status updates of the port monitor use the cached data instead of
+ * reading the drives on their own.
+ * */
+class DriveTelemetryThread final : public agent_framework::threading::Thread {
+public:
+    /*! Default interval between two refreshes (in seconds) */
+    static constexpr std::chrono::seconds::rep DEFAULT_INTERVAL_SEC = 10;
+
+    /*!
+     * @brief Create thread configured by the optional "driveTelemetry" section of agent configuration
+     *
+     * Recognized properties are "refreshInterval" and "maxAge", both expressed
+     * in seconds. Cached data expires after two refresh intervals by default.
+     *
+     * @param[in] collector Collector caching telemetry of the drives
+     * @param[in] configuration Agent configuration
+     * */
+    DriveTelemetryThread(DriveTelemetryCollectorPtr collector, const json::Value& configuration);
+
+    /*! @brief Destructor */
+    ~DriveTelemetryThread();
+
+    /*! @brief Refresh thread loop */
+    void execute() override;
+
+private:
+    DriveTelemetryCollectorPtr m_collector;
+    std::chrono::seconds m_interval{DEFAULT_INTERVAL_SEC};
+};
+
+}
+}
+}
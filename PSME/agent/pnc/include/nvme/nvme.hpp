@@ -116,7 +116,9 @@ struct nvme_id_ctrl {
     uint8_t apsta;
     uint16_t wctemp;
     uint16_t cctemp;
-    uint8_t rsvd270[242];
+    uint8_t rsvd270[58];
+    uint32_t sanicap;
+    uint8_t rsvd332[180];
     uint8_t sqes;
     uint8_t cqes;
     uint8_t rsvd514[2];
@@ -192,6 +194,48 @@ enum nvme_admin_opcode {
     nvme_admin_format_nvm = 0x80,
     nvme_admin_security_send = 0x81,
     nvme_admin_security_recv = 0x82,
+    nvme_admin_sanitize = 0x84,
+};
+
+/*! Sanitize capabilities of the controller (SANICAP) */
+enum SanitizeCapabilities : std::uint32_t {
+    SANITIZE_CRYPTO_ERASE_SUPPORTED = 0x00000001,
+    SANITIZE_BLOCK_ERASE_SUPPORTED = 0x00000002,
+    SANITIZE_OVERWRITE_SUPPORTED = 0x00000004
+};
+
+/*! Sanitize action on bits 2:0 of sanitize command dword10 */
+enum class SanitizeAction : std::uint32_t {
+    EXIT_FAILURE_MODE = 0x00000001,
+    BLOCK_ERASE = 0x00000002,
+    OVERWRITE = 0x00000003,
+    CRYPTO_ERASE = 0x00000004
+};
+
+/*! Status of the most recent sanitize operation on bits 2:0 of SSTAT */
+enum class SanitizeStatus : std::uint16_t {
+    NEVER_SANITIZED = 0x0000,
+    COMPLETED = 0x0001,
+    IN_PROGRESS = 0x0002,
+    FAILED = 0x0003,
+    COMPLETED_NO_DEALLOCATE = 0x0004
+};
+
+/*! Sanitize status log page identifier */
+static constexpr uint8_t SANITIZE_STATUS_LOG_ID = 0x81;
+
+/*! Mask of the sanitize status in SSTAT */
+static constexpr uint16_t SANITIZE_STATUS_MASK = 0x0007;
+
+/*! NVMEe sanitize status log page structure */
+struct nvme_sanitize_log {
+    uint16_t sprog;
+    uint16_t sstat;
+    uint32_t scdw10;
+    uint32_t eto;
+    uint32_t etbe;
+    uint32_t etce;
+    uint8_t rsvd20[492];
 };
 
 /*! NVMEe identify command structure */
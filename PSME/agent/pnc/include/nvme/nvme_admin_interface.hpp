@@ -0,0 +1,80 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nvme_admin_interface.hpp
+ * @brief Interface used to submit NVMe admin commands to a drive
+ * */
+
+#pragma once
+
+extern "C" {
+#include <linux/nvme_ioctl.h>
+}
+
+#include <string>
+
+/*! Agent namespace */
+namespace agent {
+/*! PNC namespace */
+namespace pnc {
+/*! NVMe namespace */
+namespace nvme {
+
+/*! Access interface to the admin queue of an NVMe controller */
+class NvmeAdminInterface {
+public:
+    /*! Default constructor */
+    NvmeAdminInterface() = default;
+
+    NvmeAdminInterface(const NvmeAdminInterface&) = delete;
+    NvmeAdminInterface& operator=(const NvmeAdminInterface&) = delete;
+
+    /*!
+     * @brief Submits admin command and waits for its completion
+     * @param[in,out] cmd Admin command, data buffer and result of the command
+     * @throw std::runtime_error if the command cannot be submitted or completes with an error
+     * */
+    virtual void submit(struct nvme_admin_cmd& cmd) = 0;
+
+    virtual ~NvmeAdminInterface();
+};
+
+/*! Admin interface of the drive character or block device, commands are submitted by ioctl */
+class IoctlNvmeAdminInterface final : public NvmeAdminInterface {
+public:
+    /*!
+     * @brief Opens the device
+     * @param device_path Path to the device in the OS
+     * @throw std::runtime_error if the device cannot be opened
+     * */
+    explicit IoctlNvmeAdminInterface(const std::string& device_path);
+
+    /*! Closes the device */
+    ~IoctlNvmeAdminInterface();
+
+    void submit(struct nvme_admin_cmd& cmd) override;
+
+private:
+    std::string m_device_path;
+    int m_device_file{-1};
+};
+
+}
+}
+}
@@ -26,6 +26,14 @@
 
 
 #include "nvme/nvme.hpp"
+#include "nvme/nvme_admin_interface.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace json { class Value; }
 
 /*! Agent namespace */
 namespace agent {
@@ -34,12 +42,62 @@ namespace pnc {
 /*! NVMe namespace */
 namespace nvme {
 
+/*! Secure erase settings */
+struct EraseSettings {
+    /*! Interval of polling the sanitize status */
+    std::chrono::milliseconds poll_interval;
+    /*! Maximal duration of the erase */
+    std::chrono::seconds timeout;
+    /*! Maximal number of drives erased at the same time */
+    std::size_t max_concurrent_erases;
+};
+
+/*! Command used to erase the drive */
+enum class EraseMethod {
+    SANITIZE_CRYPTO_ERASE,
+    SANITIZE_BLOCK_ERASE,
+    FORMAT_USER_DATA_ERASE
+};
+
+/*! Progress callback, called with percent of completed work */
+using EraseProgressCallback = std::function<void(std::uint32_t)>;
+
+/*!
+ * @brief Get default secure erase settings
+ * @return Default settings
+ * */
+EraseSettings get_default_erase_settings();
+
+/*!
+ * @brief Read settings from the "secureErase" section of agent configuration
+ *
+ * Recognized properties are "maxConcurrentErases", "pollInterval" and "timeout"
+ * (both in seconds). Missing properties keep their default values.
+ *
+ * @param[in] configuration Agent configuration
+ * @return Secure erase settings
+ * */
+EraseSettings load_erase_settings(const json::Value& configuration);
+
 /*!
  * @brief Secure erase of nvme drive
  *
- * @param device_path path to the device in the OS
+ * Sanitize (crypto erase if supported, block erase otherwise) is started
+ * and the sanitize status log is polled to report progress. Drives not
+ * supporting sanitize are formatted with user data erase.
+ *
+ * Sanitize cannot be aborted: a cancelled erase stops waiting for the
+ * drive, the drive finishes the operation on its own.
+ *
+ * @param device Admin interface of the drive
+ * @param settings Secure erase settings
+ * @param progress Progress callback, may be empty
+ * @param cancelled Cancellation flag
+ * @return Command used to erase the drive
+ * @throw std::runtime_error if the drive was not erased
  * */
-void secure_erase(const std::string& device_path);
+EraseMethod secure_erase(NvmeAdminInterface& device, const EraseSettings& settings,
+                         const EraseProgressCallback& progress, const std::atomic<bool>& cancelled);
 
 
 /*!
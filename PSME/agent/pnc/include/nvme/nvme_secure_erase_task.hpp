@@ -40,8 +40,9 @@ public:
     /*!
      * @brief Constructor
      * @param[in] drive_uuid drive to be erased
+     * @param[in] task_uuid UUID of the task resource to report progress to
      * */
-    explicit NvmeSecureEraseTask(const std::string& drive_uuid);
+    explicit NvmeSecureEraseTask(const std::string& drive_uuid, const std::string& task_uuid = {});
 
 
     /*! @brief Starts erasing */
@@ -50,6 +51,7 @@ public:
 
 private:
     std::string m_drive_uuid{};
+    std::string m_task_uuid{};
 
 
     std::string get_drive_uuid() const;
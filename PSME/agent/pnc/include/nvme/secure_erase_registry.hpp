@@ -0,0 +1,125 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nvme/secure_erase_registry.hpp
+ * @brief Limits the number of concurrent secure erases and allows to cancel them
+ * */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/*! Agent namespace */
+namespace agent {
+/*! PNC namespace */
+namespace pnc {
+/*! NVMe namespace */
+namespace nvme {
+
+/*!
+ * @brief Registry of drives being erased.
+ *
+ * Each erase takes a slot, erases above the limit wait for a free slot.
+ * Erases are cancelled per drive, both waiting and running ones.
+ * */
+class SecureEraseRegistry final {
+    using CancelFlag = std::shared_ptr<std::atomic<bool>>;
+
+public:
+    /*! Erase slot, released when destroyed */
+    class Slot final {
+    public:
+        Slot(Slot&& other);
+        ~Slot();
+
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot& operator=(Slot&&) = delete;
+
+        /*!
+         * @brief Gets cancellation flag of the erase
+         * @return Flag set when the erase is cancelled
+         * */
+        const std::atomic<bool>& get_cancel_flag() const {
+            return *m_cancelled;
+        }
+
+    private:
+        friend class SecureEraseRegistry;
+        Slot(SecureEraseRegistry& registry, const std::string& drive_uuid, CancelFlag cancelled);
+
+        SecureEraseRegistry* m_registry;
+        std::string m_drive_uuid;
+        CancelFlag m_cancelled;
+    };
+
+    /*!
+     * @brief Gets registry of the agent, limit is read from the configuration
+     * @return Registry instance
+     * */
+    static SecureEraseRegistry& get_instance();
+
+    /*!
+     * @brief Constructor
+     * @param max_concurrent_erases Maximal number of drives erased at the same time
+     * */
+    explicit SecureEraseRegistry(std::size_t max_concurrent_erases);
+
+    SecureEraseRegistry(const SecureEraseRegistry&) = delete;
+    SecureEraseRegistry& operator=(const SecureEraseRegistry&) = delete;
+
+    /*!
+     * @brief Waits for a free slot and registers the erase of the drive
+     * @param drive_uuid Drive to be erased
+     * @return Erase slot
+     * @throw std::runtime_error if the drive is already being erased or the erase was cancelled while waiting
+     * */
+    Slot acquire(const std::string& drive_uuid);
+
+    /*!
+     * @brief Cancels erase of the drive
+     * @param drive_uuid Erased drive
+     * @return True if the drive was being erased
+     * */
+    bool cancel(const std::string& drive_uuid);
+
+    /*!
+     * @brief Gets number of running erases
+     * @return Number of taken slots
+     * */
+    std::size_t get_running_count() const;
+
+private:
+    void release(const std::string& drive_uuid);
+
+    const std::size_t m_max_concurrent_erases;
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_slot_released{};
+    std::size_t m_running{0};
+    std::map<std::string, CancelFlag> m_erases{};
+};
+
+}
+}
+}
@@ -0,0 +1,93 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file state_machine/port_update_scheduler.hpp
+ * @brief Runs updates of port state managers concurrently
+ * */
+
+#pragma once
+
+#include "agent-framework/threading/threadpool.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace agent {
+namespace pnc {
+namespace state_machine {
+
+/*!
+ * @brief Runs updates of ports on a bounded pool of threads.
+ *
+ * Updates of one port are serialized: the port is not scheduled again until its previous update
+ * is finished. Slow transitions of one port (binding, waiting for sysfs, discovery) do not delay
+ * other ports then.
+ * */
+class PortUpdateScheduler final {
+public:
+    /*! Update of a single port */
+    using Update = std::function<void()>;
+
+    /*!
+     * @brief Constructor
+     * @param[in] max_workers Maximum number of concurrently updated ports
+     * */
+    explicit PortUpdateScheduler(std::size_t max_workers);
+
+    /*! @brief Destructor, waits for running updates, pending updates are dropped */
+    ~PortUpdateScheduler();
+
+    PortUpdateScheduler(const PortUpdateScheduler&) = delete;
+    PortUpdateScheduler& operator=(const PortUpdateScheduler&) = delete;
+
+    /*!
+     * @brief Schedules update of a port
+     * @param[in] port_uuid Uuid of the port
+     * @param[in] update Update to be run, exceptions are logged
+     * @return False if previous update of the port is not finished, the update is not scheduled then
+     * */
+    bool schedule(const std::string& port_uuid, Update update);
+
+    /*!
+     * @brief Checks if update of a port is scheduled or running
+     * @param[in] port_uuid Uuid of the port
+     * @return True if the port is being updated
+     * */
+    bool is_busy(const std::string& port_uuid) const;
+
+    /*! @brief Waits until all scheduled updates are finished */
+    void wait_all();
+
+private:
+    void run(const std::string& port_uuid, const Update& update);
+
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    std::set<std::string> m_busy_ports{};
+
+    /* destroyed first, running updates use the members above */
+    agent_framework::threading::Threadpool m_pool;
+};
+
+}
+}
+}
@@ -27,6 +27,10 @@
 
 #include "libsysfs.h"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace agent {
 namespace pnc {
 namespace sysfs {
@@ -66,8 +70,22 @@ public:
      * */
     virtual bool unbind_nvme_driver(const SysfsId& id) const;
 
+    /*!
+     * @brief Gets names of all PCI devices on the path of a sysfs device
+     * @param[in] path Resolved path of the device,
+     *                 e.g. /sys/devices/pci0000:00/0000:00:03.0/0000:05:00.0/nvme/nvme0/nvme0n1
+     * @return Names of the PCI devices, e.g. 0000:00:03.0 and 0000:05:00.0
+     * */
+    static std::vector<std::string> get_pci_devices_on_path(const std::string& path);
+
 private:
 
+    /*! Names of block devices (drives) below a PCI device, indexed by the PCI device name */
+    using BlockDevices = std::unordered_map<std::string, std::vector<std::string>>;
+
+    /* walks block device class once, each block device is assigned to all PCI devices on its path */
+    BlockDevices get_block_devices() const;
+
     /* checks if the sys_device has a path that has a part mathing 'path' parameter */
     bool is_path_matched(sysfs_device* sys_device, const std::string& path) const;
 
@@ -75,7 +93,8 @@ private:
     void update_drive_info(const std::string& drive_name, RawSysfsDevice& device) const;
 
     /* updates pci device drives (if present), result is stored in provided device reference */
-    void update_pci_device_drives(sysfs_device* sys_device, RawSysfsDevice& device) const;
+    void update_pci_device_drives(sysfs_device* sys_device, const BlockDevices& block_devices,
+                                  RawSysfsDevice& device) const;
 
     /* used to check if given device is a virtual function, result is stored in provided device reference */
     void update_pci_device_virtual(sysfs_device* sys_device, RawSysfsDevice& device) const;
@@ -87,7 +106,8 @@ private:
     bool update_pci_device_ids(sysfs_device* sys_device, RawSysfsDevice& device) const;
 
     /* updates all information about the device, result is stored in provided device reference */
-    bool update_pci_device(sysfs_device* sys_device, RawSysfsDevice& device) const;
+    bool update_pci_device(sysfs_device* sys_device, const BlockDevices& block_devices,
+                           RawSysfsDevice& device) const;
 };
 
 }
@@ -0,0 +1,190 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file sysfs/uevent_listener.hpp
+ * @brief Listener of kernel uevents used to wait for sysfs updates
+ * */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace agent {
+namespace pnc {
+namespace sysfs {
+
+/*! Kernel object event */
+struct Uevent {
+    /*! Action: add, remove, change, bind, unbind... */
+    std::string action{};
+    /*! Path of the device relative to /sys, e.g. /devices/pci0000:00/0000:00:03.0 */
+    std::string devpath{};
+    /*! Subsystem: pci, block, nvme... */
+    std::string subsystem{};
+    /*! Device type, e.g. disk or partition for block devices */
+    std::string devtype{};
+
+    /*!
+     * @brief Parses kernel uevent message: "action@devpath" followed by KEY=VALUE strings
+     * @param[in] buffer Message, strings are separated by NUL characters
+     * @param[in] length Message length
+     * @return Parsed event, empty action if message is not a kernel uevent
+     * */
+    static Uevent parse(const char* buffer, std::size_t length);
+};
+
+
+/*!
+ * @brief Listener of kernel uevents (NETLINK_KOBJECT_UEVENT).
+ *
+ * Lets threads wait for specific device events (e.g. block device of a bound drive added)
+ * instead of sleeping for a fixed time. If the netlink socket cannot be opened, waiting
+ * times out, which is the old fixed delay.
+ * */
+class UeventListener final {
+public:
+    /*! Event filter */
+    using Predicate = std::function<bool(const Uevent&)>;
+
+    /*! Expected event, has to be registered before the action causing the event */
+    class Expectation {
+    public:
+        /*!
+         * @brief Constructor
+         * @param[in] predicate Filter of the expected event
+         * */
+        explicit Expectation(Predicate predicate) : m_predicate(std::move(predicate)) {}
+
+    private:
+        friend class UeventListener;
+        Predicate m_predicate;
+        bool m_fulfilled{false};
+    };
+
+    /*! Expectation pointer */
+    using ExpectationPtr = std::shared_ptr<Expectation>;
+
+    /*! @brief Constructor */
+    UeventListener() = default;
+
+    /*! @brief Destructor, stops the listener */
+    ~UeventListener();
+
+    UeventListener(const UeventListener&) = delete;
+    UeventListener& operator=(const UeventListener&) = delete;
+
+    /*!
+     * @brief Gets listener used by the agent
+     * @return Listener instance
+     * */
+    static UeventListener& get_instance();
+
+    /*! @brief Opens netlink socket and starts listening thread */
+    void start();
+
+    /*!
+     * @brief Starts listening thread reading events from given datagram socket
+     * @param[in] socket Socket descriptor, taken over by the listener (used by tests)
+     * */
+    void start(int socket);
+
+    /*! @brief Stops listening thread */
+    void stop();
+
+    /*!
+     * @brief Checks if the listener receives events
+     * @return True if listening thread is running
+     * */
+    bool is_running() const {
+        return m_is_running;
+    }
+
+    /*!
+     * @brief Registers expected event
+     * @param[in] predicate Filter of the expected event
+     * @return Expectation to be waited for
+     * */
+    ExpectationPtr expect(Predicate predicate);
+
+    /*!
+     * @brief Waits for the expected event
+     * @param[in] expectation Registered expectation
+     * @param[in] timeout Maximum wait time
+     * @return True if the event was received, false on timeout
+     * */
+    bool wait_for(const ExpectationPtr& expectation, std::chrono::milliseconds timeout);
+
+    /*!
+     * @brief Delivers event to registered expectations
+     * @param[in] event Received or injected event
+     * */
+    void dispatch(const Uevent& event);
+
+    /*!
+     * @brief Creates filter of events of devices below given sysfs path
+     * @param[in] action Event action
+     * @param[in] subsystem Event subsystem
+     * @param[in] devpath Device path relative to /sys, devpath of the event has to start with it
+     * @return Event filter
+     * */
+    static Predicate matches(const std::string& action, const std::string& subsystem, const std::string& devpath);
+
+    /*!
+     * @brief Gets devpath of a device
+     * @param[in] sysfs_path Path of the device in sysfs, e.g. /sys/devices/pci0000:00/0000:00:03.0
+     * @return Path relative to /sys
+     * */
+    static std::string get_devpath(const std::string& sysfs_path);
+
+    /*!
+     * @brief Gets devpath prefix of devices below switch downstream bridge
+     * @param[in] switch_bridge_path Sysfs path of the switch upstream bridge
+     * @param[in] bus_num Secondary bus number of the switch upstream bridge
+     * @param[in] device_num Device number of the downstream bridge
+     * @return Prefix of devpaths, matching all functions of the bridge
+     * */
+    static std::string get_bridge_devpath(const std::string& switch_bridge_path, std::uint8_t bus_num,
+                                          std::uint8_t device_num);
+
+private:
+    void task();
+    void close_descriptors();
+
+    int m_socket{-1};
+    int m_shutdown_fd[2] = {-1, -1};
+    std::thread m_thread{};
+    std::atomic<bool> m_is_running{false};
+
+    std::mutex m_mutex{};
+    std::condition_variable m_condition{};
+    std::list<std::weak_ptr<Expectation>> m_expectations{};
+};
+
+}
+}
+}
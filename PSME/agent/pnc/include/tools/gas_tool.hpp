@@ -29,14 +29,19 @@
 
 
 #include "gas/global_address_space_registers.hpp"
+#include "gas/binding_cache.hpp"
 #include "gas/mrpc/port_binding_info.hpp"
 #include "gas/mrpc/partition_binding_info.hpp"
 #include "gas/mrpc/bind_port.hpp"
 #include "gas/mrpc/unbind_port.hpp"
 #include "gas/mrpc/link_status_retrieve.hpp"
 
+#include <mutex>
 
 
+
+namespace json { class Value; }
+
 namespace agent {
 namespace pnc {
 namespace tools {
@@ -63,6 +68,34 @@ public:
     virtual ~GasTool();
 
 
+    /*! Lock of the binding arbiter */
+    using BindingLock = std::unique_lock<std::mutex>;
+
+
+    /*!
+     * @brief Locks the binding arbiter. Single MRPC commands are serialized by the GAS, but choosing
+     * an available bridge and binding a port to it has to be done under this lock, as other ports
+     * may be bound concurrently.
+     * @return Lock of the arbiter, released when destroyed
+     * */
+    static BindingLock lock_bindings();
+
+
+    /*!
+     * @brief Gets cache of the port and partition bindings shared by all GasTool instances. It is invalidated
+     * by bind_to_partition and unbind_from_partition and revalidated by revalidate_binding_cache.
+     * @return Binding cache
+     * */
+    static gas::BindingCache& get_binding_cache();
+
+
+    /*!
+     * @brief Sets max age of the cached bindings from the "bindingCache" configuration section
+     * @param[in] configuration Agent configuration
+     * */
+    static void configure_binding_cache(const json::Value& configuration);
+
+
     /*!
      * @brief Reads configuration space registers for an upstream port in the partition
      * @param[in] partition_id Id of the partition
@@ -103,6 +136,37 @@ public:
         const gas::GlobalAddressSpaceRegisters& gas, uint8_t zone_id) const;
 
 
+    /*!
+     * @brief Gets port binding info from the binding cache, the command is performed only if the cached
+     * binding is missing or expired. Not to be used to check binding results.
+     * @param[in] gas Global Address Space Registers reference
+     * @param[in] port_id physical id of the queried port
+     * @return Port binding info with a single entry
+     * */
+    virtual gas::mrpc::PortBindingInfo get_cached_port_binding_info(const gas::GlobalAddressSpaceRegisters& gas,
+                                                                    uint8_t port_id) const;
+
+
+    /*!
+     * @brief Gets partition binding info from the binding cache, the command is performed only if the cached
+     * binding is missing or expired
+     * @param[in] gas Global Address Space Registers reference
+     * @param[in] zone_id id of the partition/zone on the pcie switch
+     * @return Partition binding info
+     * */
+    virtual gas::mrpc::PartitionBindingInfo get_cached_partition_binding_info(
+        const gas::GlobalAddressSpaceRegisters& gas, uint8_t zone_id) const;
+
+
+    /*!
+     * @brief Reads bindings of all ports and checks the binding cache against them. Stale entries are logged
+     * and dropped, cached port bindings are replaced with the read ones.
+     * @param[in] gas Global Address Space Registers reference
+     * @return Port binding info of all ports
+     * */
+    virtual gas::mrpc::PortBindingInfo revalidate_binding_cache(const gas::GlobalAddressSpaceRegisters& gas) const;
+
+
     /*!
      * @brief Retrieves physical port id based on the logical bridge number
      * @param[in] gas Global Address Space Registers reference
@@ -239,6 +303,10 @@ public:
      * */
     virtual void check_port_binding_result(const gas::GlobalAddressSpaceRegisters& gas, uint8_t partition_id,
                                            uint8_t bridge_id) const;
+
+private:
+    static std::mutex m_binding_mutex;
+    static gas::BindingCache m_binding_cache;
 };
 
 using GasToolPtr = std::shared_ptr<GasTool>;
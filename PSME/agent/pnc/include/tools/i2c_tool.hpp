@@ -33,6 +33,7 @@
 #include "nvme/vital_product_data.hpp"
 #include "nvme/smart.hpp"
 #include "nvme/fw_version.hpp"
+#include "nvme/drive_telemetry.hpp"
 
 namespace agent {
 namespace pnc {
@@ -45,9 +46,12 @@ public:
     /*! Default constructor */
     I2cTool() {}
 
-    /*! Enable copy */
-    I2cTool(const I2cTool&){}
-    I2cTool& operator=(const I2cTool&) {return *this;}
+    /*! Enable copy, copies share cached drive telemetry */
+    I2cTool(const I2cTool& rhs) : m_drive_telemetry{rhs.m_drive_telemetry} {}
+    I2cTool& operator=(const I2cTool& rhs) {
+        m_drive_telemetry = rhs.m_drive_telemetry;
+        return *this;
+    }
 
     /*! Default desctructor */
     virtual ~I2cTool();
@@ -91,12 +95,48 @@ public:
      * */
     virtual bool get_firmware_version(nvme::FirmwareVersion& fw, const agent_framework::model::Port& port) const;
 
+    /*!
+     * @brief Reads smart, vital product data and firmware version on the provided port in one session
+     * @param[in,out] telemetry Reference to the object to be filled with read data
+     * @param[in] port Downstream port used to read the drive
+     * @return True if any of the structures was read
+     * */
+    virtual bool get_drive_telemetry(nvme::DriveTelemetry& telemetry, const agent_framework::model::Port& port) const;
+
+    /*!
+     * @brief Gets drive telemetry cached by the last read on the provided port
+     *
+     * Smart data older than the maximal age of the cache is read again.
+     * @param[in,out] telemetry Reference to the object to be filled with cached data
+     * @param[in] port Downstream port used to read the drive
+     * @return True if smart data is valid
+     * */
+    virtual bool get_cached_drive_telemetry(nvme::DriveTelemetry& telemetry,
+        const agent_framework::model::Port& port) const;
+
+    /*!
+     * @brief Removes cached telemetry of the drive on the provided port
+     * @param[in] port Downstream port of the removed drive
+     * */
+    virtual void invalidate_drive_telemetry(const agent_framework::model::Port& port) const;
+
+    /*!
+     * @brief Gets collector caching telemetry of the drives
+     * @return Drive telemetry collector
+     * */
+    const nvme::DriveTelemetryCollectorPtr& get_drive_telemetry_collector() const {
+        return m_drive_telemetry;
+    }
+
     /*!
      * @brief Reads FRU Eeprom data.
      * @param fru_eeprom Refernce to the object to be filled with read data
      * @return True if successful
      */
     bool get_fru_eeprom(FruEeprom& fru_eeprom) const;
+
+private:
+    nvme::DriveTelemetryCollectorPtr m_drive_telemetry{std::make_shared<nvme::DriveTelemetryCollector>()};
 };
 
 using I2cToolPtr = std::shared_ptr<I2cTool>;
@@ -26,6 +26,7 @@
 
 
 
+#include<map>
 #include<string>
 
 
@@ -34,6 +35,19 @@ namespace agent {
 namespace pnc {
 namespace helpers {
 
+/*! Map of resource UUIDs before tree stabilization to UUIDs after tree stabilization */
+using UuidMap = std::map<std::string, std::string>;
+
+
+/*!
+ * Update all relations in the model involving resources renamed by tree stabilization.
+ * Each manager holding a relation is walked once, regardless of the number of renamed resources.
+ *
+ * @param uuids Map of resource UUIDs before tree stabilization to UUIDs after tree stabilization
+ * */
+void update_relations(const UuidMap& uuids);
+
+
 /*!
  * Update all relations in the model involving PCIe switch
  *
@@ -29,8 +29,11 @@
 
 
 #include "agent-framework/tree_stability/tree_stabilizer.hpp"
+#include "agent-framework/module/model/model_pnc.hpp"
+#include "tree_stability/helpers/update_relations.hpp"
 
 #include <string>
+#include <vector>
 
 
 
@@ -39,6 +42,10 @@ namespace pnc {
 
 /*!
  * @brief Tree stability managing class for pnc agent.
+ *
+ * Resources already stabilized with the same unique key keep their persistent UUIDs, the UUIDs are not
+ * generated again. UUIDs changed by the stabilization are collected and renamed in the relations
+ * in one batch per stabilized subtree.
  * */
 class PncTreeStabilizer : public agent_framework::TreeStabilizer {
 public:
@@ -164,6 +171,45 @@ public:
      * @return Storage subsystem persistent UUID.
      * */
     const std::string stabilize_storage_subsystem(const std::string& subsystem_uuid) const;
+
+
+private:
+    template<typename T>
+    const std::string stabilize_resource(const std::string& resource_uuid,
+                                         agent_framework::module::GenericManager<T>& manager,
+                                         const std::string& unique_key,
+                                         helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_pcie_device(const std::string& device_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_pcie_function(const std::string& function_uuid,
+                                              const agent_framework::model::PcieDevice& parent_device,
+                                              helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_chassis(const std::string& chassis_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_drive(const std::string& drive_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_fabric(const std::string& fabric_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_pcie_switch(const std::string& switch_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_port(const std::string& port_uuid,
+                                     const agent_framework::model::Switch& parent_switch,
+                                     helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_pcie_zone(const std::string& zone_uuid,
+                                          const agent_framework::model::Switch& parent_switch,
+                                          helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_pcie_endpoint(const std::string& endpoint_uuid,
+                                              const std::vector<agent_framework::model::Port>& endpoint_ports,
+                                              helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_system(const std::string& system_uuid, helpers::UuidMap& uuids) const;
+
+    const std::string stabilize_storage_subsystem(const std::string& subsystem_uuid,
+                                                  helpers::UuidMap& uuids) const;
 };
 
 }
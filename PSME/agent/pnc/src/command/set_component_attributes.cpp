@@ -33,6 +33,7 @@
 #include "nvme/nvme_secure_erase_task.hpp"
 #include "tools/toolset.hpp"
 #include "gas/global_address_space_registers.hpp"
+#include "sysfs/uevent_listener.hpp"
 
 
 
@@ -46,10 +47,11 @@ using namespace agent_framework::model::requests::validation;
 using namespace agent::pnc::nvme;
 using namespace agent::pnc::tools;
 using namespace agent::pnc::gas;
+using namespace agent::pnc::sysfs;
 
 namespace {
 
-/*! NVMe Drive detection delay after binding, seconds */
+/*! Maximum NVMe Drive detection time after binding, seconds */
 static constexpr uint32_t DRIVE_DETECTION_DELAY_SEC = 10;
 
 
@@ -72,9 +74,11 @@ void securely_erase(const std::string& drive_uuid, SetComponentAttributes::Respo
 
     Toolset tools = Toolset::get();
     GlobalAddressSpaceRegisters gas{};
+    std::string switch_devpath{};
     try {
         Switch sw = get_manager<Switch>().get_entry(tools.model_tool->get_switch_for_drive_uuid(drive_uuid));
         gas = GlobalAddressSpaceRegisters::get_default(sw.get_memory_path());
+        switch_devpath = UeventListener::get_devpath(sw.get_bridge_path());
     }
     catch (const std::exception& e) {
         throw exceptions::PncError(std::string{"Secure drive erase failed: "} + e.what());
@@ -93,8 +97,12 @@ void securely_erase(const std::string& drive_uuid, SetComponentAttributes::Respo
 
     task_creator.add_subtask(std::bind(std::mem_fn(&GasTool::bind_drive_to_mgmt_partition), *tools.gas_tool,
                                        tools.model_tool, gas, drive_uuid));
-    task_creator.add_subtask([]() { std::this_thread::sleep_for(std::chrono::seconds(DRIVE_DETECTION_DELAY_SEC)); });
-    task_creator.add_subtask(NvmeSecureEraseTask{drive_uuid});
+    // bridge is chosen by the binding subtask, so any block device of the switch is awaited
+    auto drive_added = UeventListener::get_instance().expect(UeventListener::matches("add", "block", switch_devpath));
+    task_creator.add_subtask([drive_added]() {
+        UeventListener::get_instance().wait_for(drive_added, std::chrono::seconds(DRIVE_DETECTION_DELAY_SEC));
+    });
+    task_creator.add_subtask(NvmeSecureEraseTask{drive_uuid, task_creator.get_task_resource().get_uuid()});
 
     task_creator.add_callback(action::Task::CallbackType::Exception,
                               std::bind(std::mem_fn(&GasTool::unbind_drive_from_mgmt_partition), *tools.gas_tool,
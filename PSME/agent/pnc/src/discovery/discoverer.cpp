@@ -192,9 +192,6 @@ Drive Discoverer::discover_oob_drive(const std::string& chassis_uuid, const Tool
         const std::string& port_uuid) const {
     auto builder = m_factory->init_builder(m_factory->get_drive_builder(), chassis_uuid);
 
-    bool smart_failed = false;
-    bool vpd_failed = false;
-    bool fw_failed = false;
     Port port{};
     try {
         port = get_manager<Port>().get_entry(port_uuid);
@@ -205,36 +202,31 @@ Drive Discoverer::discover_oob_drive(const std::string& chassis_uuid, const Tool
         log_error("pnc-discovery", "Cannot access downstream port of a drive");
     }
 
-    Smart smart(m_platform);
-    if (tools.i2c_tool->get_smart(smart, port)) {
-        builder->update_smart(tools, smart);
+    // SMART, VPD and firmware version are read in one session on the TWI bus
+    DriveTelemetry telemetry{m_platform};
+    if (!tools.i2c_tool->get_drive_telemetry(telemetry, port)) {
+        PncDiscoveryExceptionDriveNotFound dnf{};
+        dnf.drive = builder->build();
+        throw dnf;
+    }
+
+    if (telemetry.is_smart_valid) {
+        builder->update_smart(tools, telemetry.smart);
     }
     else {
         log_warning(GET_LOGGER("pnc-discovery"), "Cannot read drive SMART data");
-        smart_failed = true;
     }
-    VitalProductData vpd{m_platform};
-    if (tools.i2c_tool->get_vpd(vpd, port)) {
-        builder->update_vpd(vpd);
+    if (telemetry.is_vpd_valid) {
+        builder->update_vpd(telemetry.vpd);
     }
     else {
         log_error(GET_LOGGER("pnc-discovery"), "Cannot read drive VPD data.");
-        vpd_failed = true;
     }
-
-    FirmwareVersion fw{m_platform};
-    if (tools.i2c_tool->get_firmware_version(fw, port)) {
-        builder->update_firmware_version(fw);
+    if (telemetry.is_firmware_version_valid) {
+        builder->update_firmware_version(telemetry.firmware_version);
     }
     else {
         log_error(GET_LOGGER("pnc-discovery"), "Cannot read drive Firmware version data");
-        fw_failed = true;
-    }
-
-    if (vpd_failed && smart_failed && fw_failed) {
-        PncDiscoveryExceptionDriveNotFound dnf{};
-        dnf.drive = builder->build();
-        throw dnf;
     }
 
     return builder->build();
@@ -38,6 +38,8 @@
 #include "gas/mrpc/unbind_port.hpp"
 #include "nvme/vital_product_data.hpp"
 #include "nvme/smart.hpp"
+#include "nvme/drive_telemetry.hpp"
+#include "nvme/secure_erase_registry.hpp"
 #include "seeprom.hpp"
 #include "cable_id.hpp"
 #include "configuration/configuration.hpp"
@@ -91,27 +93,24 @@ std::string log_and_remove(const std::string& uuid) {
  * This is a helper function that adds the resource to the model and logs it, Returns resource uuid
  * */
 template <typename RESOURCE>
-std::string log_and_add(const RESOURCE& resource) {
-    using RAW_TYPE = typename std::remove_reference<RESOURCE>::type;
+std::string log_and_add(RESOURCE&& resource) {
+    using RAW_TYPE = typename std::decay<RESOURCE>::type;
     std::string uuid = resource.get_uuid();
     enums::Component component = RAW_TYPE::get_component();
     log_info(GET_LOGGER("pnc-discovery"), component.to_string() << " found");
     log_debug(GET_LOGGER("pnc-discovery"), component.to_string() << " uuid: " << uuid);
-    get_manager<RAW_TYPE>().add_entry(resource);
+    get_manager<RAW_TYPE>().emplace_entry(std::forward<RESOURCE>(resource));
     return uuid;
 }
 
 /*!
- * This is a helper function that updates the resource in the model and logs it. Returns resource uuid
+ * This is a helper function that updates the resource in place in the model and logs it
  * */
-template <typename RESOURCE>
-std::string log_and_update(const RESOURCE& resource) {
-    using RAW_TYPE = typename std::remove_reference<RESOURCE>::type;
-    std::string uuid = resource.get_uuid();
-    enums::Component component = RAW_TYPE::get_component();
+template <typename RESOURCE, typename MODIFIER>
+void log_and_update(const std::string& uuid, MODIFIER&& modifier) {
+    enums::Component component = RESOURCE::get_component();
+    get_manager<RESOURCE>().modify_entry(uuid, std::forward<MODIFIER>(modifier));
     log_debug(GET_LOGGER("pnc-discovery"), component.to_string() << " with uuid: " + uuid << " has been updated");
-    get_manager<RAW_TYPE>().get_entry_reference(resource.get_uuid()).get_raw_ref() = resource;
-    return uuid;
 }
 
 }
@@ -201,8 +200,9 @@ void DiscoveryManager::discovery(const std::string&) {
         std::string system_uuid = log_and_add<System>(m_discoverer->discover_system(manager_uuid, chassis_uuid));
         log_and_add(m_discoverer->discover_storage_subsystem(system_uuid));
 
-        log_and_update<Chassis>(m_discoverer->discover_chassis(m_tools,
-                                                               get_manager<Chassis>().get_entry(chassis_uuid)));
+        // chassis discovery reads the FRU, the manager is not locked for it
+        Chassis chassis = m_discoverer->discover_chassis(m_tools, get_manager<Chassis>().get_entry(chassis_uuid));
+        log_and_update<Chassis>(chassis_uuid, [&chassis](Chassis& entry) { entry = std::move(chassis); });
 
         SysfsDecoder decoder = SysfsDecoder::make_instance(SysfsReader{});
         auto sysfs_switches = decoder.get_switches();
@@ -391,18 +391,18 @@ void DiscoveryManager::sysfs_device_discovery(const std::string& dsp_port_uuid,
     PcieDevice device = m_discoverer->discover_pcie_device(manager_uuid, chassis_uuid, sysfs_device);
     std::vector<SysfsFunction> sysfs_functions = decoder.get_functions(sysfs_device);
 
-    log_and_add(device);
+    const std::string device_uuid = log_and_add(std::move(device));
     for (const auto& sysfs_function : sysfs_functions) {
-        PcieFunction function = m_discoverer->discover_pcie_function(device.get_uuid(), dsp_port_uuid, sysfs_function);
+        PcieFunction function = m_discoverer->discover_pcie_function(device_uuid, dsp_port_uuid, sysfs_function);
         if (!drive_uuid.empty()) {
             get_m2m_manager<Drive, PcieFunction>().add_entry(drive_uuid, function.get_uuid());
             function.set_functional_device(drive_uuid);
         }
-        log_and_add(function);
+        log_and_add(std::move(function));
     }
 
     m_tools.model_tool->send_event(manager_uuid,
-        ::agent::pnc::PncTreeStabilizer().stabilize_pcie_device(device.get_uuid()),
+        ::agent::pnc::PncTreeStabilizer().stabilize_pcie_device(device_uuid),
         enums::Component::PcieDevice, Notification::Add);
 }
 
@@ -424,24 +424,27 @@ void DiscoveryManager::sysfs_drive_discovery(const std::string drive_uuid,
         if (sysfs_drives.size() > 1) {
             log_warning(GET_LOGGER("pnc-discovery"), "More than one sysfs drive found! Taking the first one.");
         }
-        Drive drive = get_manager<Drive>().get_entry(drive_uuid);
-        drive = m_discoverer->discover_ib_drive(drive, sysfs_device, sysfs_drives.front());
-        log_and_update(drive);
+        std::string parent_uuid{};
+        log_and_update<Drive>(drive_uuid, [&](Drive& drive) {
+            drive = m_discoverer->discover_ib_drive(drive, sysfs_device, sysfs_drives.front());
+            parent_uuid = drive.get_parent_uuid();
+        });
 
         // send update event for drive
-        m_tools.model_tool->send_event(drive.get_parent_uuid(), drive_uuid, enums::Component::Drive,
-            Notification::Update);
+        m_tools.model_tool->send_event(parent_uuid, drive_uuid, enums::Component::Drive, Notification::Update);
     }
 }
 
 void DiscoveryManager::critical_state_drive_discovery(const std::string& drive_uuid) const {
     log_debug(GET_LOGGER("pnc-discovery"), "Drive is visible via VPD/Smart but not in the sysfs = " << drive_uuid);
     log_error(GET_LOGGER("pnc-discovery"), "Drive was detected but no pcie devices are present!");
-    Drive drive = get_manager<Drive>().get_entry(drive_uuid);
-    drive = m_discoverer->discover_no_sysfs_ib_drive(drive);
-    log_and_update(drive);
+    std::string parent_uuid{};
+    log_and_update<Drive>(drive_uuid, [&](Drive& drive) {
+        drive = m_discoverer->discover_no_sysfs_ib_drive(drive);
+        parent_uuid = drive.get_parent_uuid();
+    });
     // send update event for drive
-    m_tools.model_tool->send_event(drive.get_parent_uuid(), drive_uuid,
+    m_tools.model_tool->send_event(parent_uuid, drive_uuid,
         enums::Component::Drive, Notification::Update);
 }
 
@@ -457,10 +460,11 @@ bool DiscoveryManager::update_drive_status(const std::string& port_uuid, const s
             << "), twi_port = " << unsigned(port.get_twi_port())
             << ", twi_channel = " << unsigned(port.get_twi_channel()));
 
-        Smart smart{chassis.get_platform()};
-        if (m_tools.i2c_tool->get_smart(smart, port)) {
-            attribute::Status status = m_tools.map_tool->get_status_from_smart(smart);
-            int media_life_left = 100 - smart.fields.percentage_drive_life_used;
+        // refreshed in the background by the drive telemetry thread
+        DriveTelemetry telemetry{chassis.get_platform()};
+        if (m_tools.i2c_tool->get_cached_drive_telemetry(telemetry, port)) {
+            attribute::Status status = m_tools.map_tool->get_status_from_smart(telemetry.smart);
+            int media_life_left = 100 - telemetry.smart.fields.percentage_drive_life_used;
             log_debug(GET_LOGGER("pnc-discovery"), "Updating drive...");
             m_tools.model_tool->update_drive_status(drive_uuid, status, media_life_left);
         }
@@ -506,7 +510,14 @@ bool DiscoveryManager::remove_devices_on_port(const GlobalAddressSpaceRegisters&
         std::vector<std::string> function_uuids = m_tools.model_tool->get_functions_by_dsp_port_uuid(port_uuid);
         degenerate_endpoints_by_drive_uuids(gas, drive_uuids);
         remove_pcie_devices_by_function_uuids(function_uuids);
+        for (const auto& drive_uuid : drive_uuids) {
+            if (SecureEraseRegistry::get_instance().cancel(drive_uuid)) {
+                log_warning(GET_LOGGER("pnc-discovery"), "Secure erase of removed drive " << drive_uuid
+                    << " cancelled.");
+            }
+        }
         remove_drives_by_uuids(drive_uuids);
+        m_tools.i2c_tool->invalidate_drive_telemetry(get_manager<Port>().get_entry(port_uuid));
 
     }
     catch (const std::exception& e) {
@@ -0,0 +1,263 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file binding_cache.cpp
+ * @brief Cache of the port and partition bindings read from the PCIe switches
+ * */
+
+#include "gas/binding_cache.hpp"
+
+#include <algorithm>
+
+using namespace agent::pnc::gas;
+using namespace agent::pnc::gas::mrpc;
+
+constexpr std::chrono::seconds::rep BindingCache::DEFAULT_MAX_AGE_SEC;
+
+namespace {
+
+/*! Partition and logical bridge of a port */
+using PortLocation = std::pair<std::uint8_t, std::uint8_t>;
+
+std::map<std::uint8_t, PortLocation> get_port_locations(const PortBindingInfo& pbi) {
+    std::map<std::uint8_t, PortLocation> locations{};
+    const auto count = std::min(pbi.output.fields.info_count, PM85X6_PHY_PORTS_NUMBER);
+    for (std::uint8_t entry = 0; entry < count; ++entry) {
+        const auto& binding = pbi.output.fields.port_binding_info[entry];
+        locations[binding.phy_port_id] = PortLocation{binding.partition_id, binding.logical_bridge_id};
+    }
+    return locations;
+}
+
+}
+
+BindingCache::Change::Change(BindingCache& cache, const std::string& memory_path) :
+    m_cache(cache), m_memory_path(memory_path) {
+    m_cache.change(m_memory_path, true);
+}
+
+BindingCache::Change::~Change() {
+    m_cache.change(m_memory_path, false);
+}
+
+void BindingCache::set_max_age(Clock::duration max_age) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_max_age = max_age;
+}
+
+BindingCache::Clock::duration BindingCache::get_max_age() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_max_age;
+}
+
+BindingCache::Generation BindingCache::get_generation(const std::string& memory_path) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_switches.find(memory_path);
+    return m_switches.end() != it ? it->second.generation : Generation{};
+}
+
+bool BindingCache::get_port_binding_info(const std::string& memory_path, std::uint8_t phy_port_id,
+                                         PortBindingInfo& pbi) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_switches.find(memory_path);
+    if (m_switches.end() == it) {
+        return false;
+    }
+    const auto port = it->second.ports.find(phy_port_id);
+    if (it->second.ports.end() == port || !is_valid(port->second.timestamp)) {
+        return false;
+    }
+    pbi.input.fields.phy_port_id = phy_port_id;
+    pbi.output.fields.ret_value = PortPartitionP2PBindingReturnValue::COMMAND_SUCCEED;
+    pbi.output.fields.info_count = 1;
+    pbi.output.fields.port_binding_info[0].phy_port_id = phy_port_id;
+    pbi.output.fields.port_binding_info[0].partition_id = port->second.partition_id;
+    pbi.output.fields.port_binding_info[0].logical_bridge_id = port->second.logical_bridge_id;
+    pbi.output.fields.port_binding_info[0].state_operation_result = port->second.state_operation_result;
+    return true;
+}
+
+bool BindingCache::get_partition_binding_info(const std::string& memory_path, std::uint8_t partition_id,
+                                              PartitionBindingInfo& pbi) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_switches.find(memory_path);
+    if (m_switches.end() == it) {
+        return false;
+    }
+    const auto partition = it->second.partitions.find(partition_id);
+    if (it->second.partitions.end() == partition || !is_valid(partition->second.timestamp)) {
+        return false;
+    }
+    pbi = partition->second.info;
+    return true;
+}
+
+void BindingCache::update(const std::string& memory_path, Generation generation, const PortBindingInfo& pbi) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& bindings = m_switches[memory_path];
+    if (generation == bindings.generation && 0 == bindings.changes) {
+        store_ports(bindings, pbi);
+    }
+}
+
+void BindingCache::update(const std::string& memory_path, Generation generation, const PartitionBindingInfo& pbi) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& bindings = m_switches[memory_path];
+    if (generation == bindings.generation && 0 == bindings.changes
+        && PortPartitionP2PBindingReturnValue::COMMAND_SUCCEED == pbi.output.fields.ret_value) {
+        PartitionBinding binding{pbi, Clock::now()};
+        const auto it = bindings.partitions.find(pbi.input.fields.partition_id);
+        if (bindings.partitions.end() != it) {
+            it->second = binding;
+        }
+        else {
+            bindings.partitions.emplace(pbi.input.fields.partition_id, binding);
+        }
+    }
+}
+
+BindingCache::Mismatches BindingCache::check_consistency(const std::string& memory_path,
+                                                         const PortBindingInfo& all_ports) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_switches.find(memory_path);
+    if (m_switches.end() == it) {
+        return Mismatches{};
+    }
+    return find_mismatches(it->second, all_ports);
+}
+
+BindingCache::Mismatches BindingCache::revalidate(const std::string& memory_path, Generation generation,
+                                                  const PortBindingInfo& all_ports) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& bindings = m_switches[memory_path];
+    auto mismatches = find_mismatches(bindings, all_ports);
+    // bindings were changed while the ports were read, entries are refreshed by the next revalidation
+    if (generation != bindings.generation || 0 != bindings.changes) {
+        return mismatches;
+    }
+    for (const auto partition_id : mismatches.partitions) {
+        bindings.partitions.erase(partition_id);
+    }
+    bindings.ports.clear();
+    store_ports(bindings, all_ports);
+    return mismatches;
+}
+
+void BindingCache::invalidate(const std::string& memory_path) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& bindings = m_switches[memory_path];
+    bindings.ports.clear();
+    bindings.partitions.clear();
+    ++bindings.generation;
+}
+
+void BindingCache::clear() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto& bindings : m_switches) {
+        bindings.second.ports.clear();
+        bindings.second.partitions.clear();
+        ++bindings.second.generation;
+    }
+}
+
+void BindingCache::change(const std::string& memory_path, bool is_started) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& bindings = m_switches[memory_path];
+    if (is_started) {
+        ++bindings.changes;
+    }
+    else if (0 != bindings.changes) {
+        --bindings.changes;
+    }
+    bindings.ports.clear();
+    bindings.partitions.clear();
+    ++bindings.generation;
+}
+
+bool BindingCache::is_valid(const Clock::time_point& timestamp) const {
+    return Clock::now() - timestamp < m_max_age;
+}
+
+void BindingCache::store_ports(SwitchBindings& bindings, const PortBindingInfo& pbi) {
+    if (PortPartitionP2PBindingReturnValue::COMMAND_SUCCEED != pbi.output.fields.ret_value) {
+        return;
+    }
+    const auto now = Clock::now();
+    const auto count = std::min(pbi.output.fields.info_count, PM85X6_PHY_PORTS_NUMBER);
+    std::map<std::uint8_t, unsigned> occurrences{};
+    for (std::uint8_t entry = 0; entry < count; ++entry) {
+        ++occurrences[pbi.output.fields.port_binding_info[entry].phy_port_id];
+    }
+    for (std::uint8_t entry = 0; entry < count; ++entry) {
+        const auto& binding = pbi.output.fields.port_binding_info[entry];
+        // ports bound to many partitions are not cached, their bindings are always read from the switch
+        if (1 != occurrences[binding.phy_port_id]) {
+            bindings.ports.erase(binding.phy_port_id);
+            continue;
+        }
+        auto& port = bindings.ports[binding.phy_port_id];
+        port.partition_id = binding.partition_id;
+        port.logical_bridge_id = binding.logical_bridge_id;
+        port.state_operation_result = binding.state_operation_result;
+        port.timestamp = now;
+    }
+}
+
+BindingCache::Mismatches BindingCache::find_mismatches(const SwitchBindings& bindings,
+                                                       const PortBindingInfo& all_ports) const {
+    Mismatches mismatches{};
+    const auto locations = get_port_locations(all_ports);
+
+    for (const auto& port : bindings.ports) {
+        const auto location = locations.find(port.first);
+        if (locations.end() == location
+            || PortLocation{port.second.partition_id, port.second.logical_bridge_id} != location->second) {
+            mismatches.ports.push_back(port.first);
+        }
+    }
+
+    for (const auto& partition : bindings.partitions) {
+        const auto& fields = partition.second.info.output.fields;
+        const auto bridge_count = std::min(fields.logical_bridge_count, PM85X6_PHY_PORTS_NUMBER);
+        bool is_consistent{true};
+        // each port assigned to a bridge of the partition is bound to that bridge
+        for (std::uint8_t bridge = 0; bridge < bridge_count; ++bridge) {
+            const auto phy_port_id = fields.partition_binding_info[bridge].phy_port_id;
+            if (NO_PORT_ASSIGNED == phy_port_id) {
+                continue;
+            }
+            const auto location = locations.find(phy_port_id);
+            if (locations.end() == location || PortLocation{partition.first, bridge} != location->second) {
+                is_consistent = false;
+            }
+        }
+        // and each port bound to the partition is assigned to its bridge
+        for (const auto& location : locations) {
+            if (partition.first == location.second.first
+                && (location.second.second >= bridge_count
+                    || location.first != fields.partition_binding_info[location.second.second].phy_port_id)) {
+                is_consistent = false;
+            }
+        }
+        if (!is_consistent) {
+            mismatches.partitions.push_back(partition.first);
+        }
+    }
+    return mismatches;
+}
@@ -143,7 +143,7 @@ GlobalAddressSpaceRegisters GlobalAddressSpaceRegisters::get_default(const std::
         AccessInterfaceFactory aif{};
         AccessInterface* iface = aif.get_interface();
         iface->init(path);
-        gas.init(iface);
+        gas = GlobalAddressSpaceRegisters{iface, path};
     }
     catch (const std::exception& e) {
         throw std::runtime_error(std::string{"Cannot initialize PCIe interface: "} + e.what());
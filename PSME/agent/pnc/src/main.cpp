@@ -30,6 +30,7 @@
 
 #include "agent-framework/eventing/events_queue.hpp"
 #include "agent-framework/command-ref/command_server.hpp"
+#include "agent-framework/action/task_cleaner.hpp"
 
 #include "discovery/discovery_manager.hpp"
 #include "loader/pnc_loader.hpp"
@@ -38,6 +39,8 @@
 #include "configuration/configuration_validator.hpp"
 #include "default_configuration.hpp"
 #include "port_monitor_thread.hpp"
+#include "nvme/drive_telemetry_thread.hpp"
+#include "sysfs/uevent_listener.hpp"
 
 #include <jsonrpccpp/server/connectors/httpserver.h>
 
@@ -108,6 +111,7 @@ int main(int argc, const char* argv[]) {
     event_dispatcher.start();
 
     auto tools = Toolset::get();
+    GasTool::configure_binding_cache(configuration);
     DiscoveryManager dm = DiscoveryManager::create(tools);
     try {
         dm.discovery("");
@@ -128,6 +132,9 @@ int main(int argc, const char* argv[]) {
         log_error(GET_LOGGER("pnc-discovery"), "Discovery FAILED: " << e.what());
     }
 
+    /* Listen for kernel events, port state workers wait for them after (un)binding */
+    agent::pnc::sysfs::UeventListener::get_instance().start();
+
     /* Start Port Monitor Thread */
     PortMonitorThread::PortMonitorThreadUniquePtr port_monitor_thread;
     auto switches = ::agent_framework::module::PncComponents::get_instance()->get_switch_manager().get_keys();
@@ -141,6 +148,11 @@ int main(int argc, const char* argv[]) {
         std::this_thread::sleep_for(std::chrono::seconds(::DISCOVERY_SLEEP_TIME_SECONDS));
     }
 
+    /* Refresh telemetry of the discovered drives in the background */
+    agent::pnc::nvme::DriveTelemetryThread drive_telemetry_thread{
+        tools.i2c_tool->get_drive_telemetry_collector(), configuration};
+    drive_telemetry_thread.start();
+
     /* Create command server */
     jsonrpc::HttpServer http_server((int(server_port)));
     agent_framework::command_ref::CommandServer server(http_server);
@@ -160,15 +172,22 @@ int main(int argc, const char* argv[]) {
             ::agent_framework::eventing::Notification::Add);
     }
 
+    /* Start removing outdated tasks */
+    agent_framework::action::TaskCleaner task_cleaner{configuration};
+    task_cleaner.start();
+
     /* Stop the program and wait for interrupt */
     wait_for_interrupt();
 
     log_info(GET_LOGGER("pnc-agent"), "Stopping PSME Pnc Agent...\n");
 
     /* Cleanup */
+    task_cleaner.stop();
+    drive_telemetry_thread.stop();
     server.stop();
     amc_connection.stop();
     event_dispatcher.stop();
+    agent::pnc::sysfs::UeventListener::get_instance().stop();
     Configuration::cleanup();
     LoggerFactory::cleanup();
 
@@ -0,0 +1,204 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file drive_telemetry.cpp
+ * @brief Batched and cached collection of NVMe drive SMART, VPD and firmware version
+ * */
+
+#include "nvme/drive_telemetry.hpp"
+#include <logger/logger_factory.hpp>
+
+#include <cstring>
+#include <future>
+
+using namespace agent::pnc::gas;
+using namespace agent::pnc::i2c;
+using namespace agent::pnc::nvme;
+using agent_framework::model::enums::PlatformType;
+
+namespace {
+
+/*! SMART status followed by the firmware version, read in one transaction */
+constexpr std::uint16_t SMART_BLOCK_SIZE_BYTES =
+    FirmwareVersion::FW_VERSION_OFFSET_BYTES + FirmwareVersion::FW_VERSION_SIZE_BYTES;
+
+void select_channel(const I2cAccessInterfacePtr i2c, PlatformType platform, const DriveLocation& location) {
+    PM85X6TwiDeviceAddress address{};
+    if (PlatformType::EDK == platform) {
+        address = PM85X6TwiDeviceAddress::EDK_TWI_EXPANDER;
+    }
+    else if (PlatformType::MF3 == platform) {
+        address = PM85X6TwiDeviceAddress::MF3_TWI_EXPANDER;
+    }
+
+    uint8_t data = uint8_t(location.channel);
+    i2c->write(static_cast<uint8_t>(location.port),
+               static_cast<uint16_t>(address),
+               0,
+               reinterpret_cast<uint8_t*>(&data),
+               sizeof(data));
+}
+
+}
+
+constexpr std::chrono::seconds DriveTelemetryCollector::DEFAULT_MAX_AGE;
+
+void DriveTelemetryCollector::set_max_age(Clock::duration max_age) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_max_age = max_age;
+}
+
+void DriveTelemetryCollector::collect(const I2cAccessInterfacePtr i2c, const DriveLocation& location,
+                                      DriveTelemetry& telemetry) {
+    telemetry = DriveTelemetry{telemetry.get_platform()};
+    read(i2c, location, telemetry, true);
+    if (telemetry.is_valid()) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_cache.erase(location);
+        m_cache.emplace(location, telemetry);
+    }
+    else {
+        invalidate(location);
+    }
+}
+
+void DriveTelemetryCollector::get(const I2cAccessInterfacePtr i2c, const DriveLocation& location,
+                                  DriveTelemetry& telemetry) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const auto it = m_cache.find(location);
+        if (m_cache.end() != it && it->second.get_platform() == telemetry.get_platform()) {
+            telemetry = it->second;
+            if (telemetry.is_fresh(m_max_age)) {
+                return;
+            }
+        }
+        else {
+            telemetry = DriveTelemetry{telemetry.get_platform()};
+        }
+    }
+    if (!telemetry.is_vpd_valid) {
+        collect(i2c, location, telemetry);
+        return;
+    }
+    read(i2c, location, telemetry, false);
+    store(location, telemetry);
+}
+
+void DriveTelemetryCollector::refresh(const I2cAccessInterfacePtr i2c) {
+    using Drives = std::vector<std::pair<DriveLocation, DriveTelemetry>>;
+    std::map<PM85X6TwiPort, Drives> ports{};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        for (const auto& entry : m_cache) {
+            ports[entry.first.port].emplace_back(entry);
+        }
+    }
+
+    std::vector<std::future<void>> sessions{};
+    for (auto& port : ports) {
+        Drives& drives = port.second;
+        sessions.push_back(std::async(std::launch::async, [this, i2c, &drives]() {
+            for (auto& drive : drives) {
+                read(i2c, drive.first, drive.second, false);
+                store(drive.first, drive.second);
+            }
+        }));
+    }
+    for (auto& session : sessions) {
+        session.get();
+    }
+}
+
+void DriveTelemetryCollector::invalidate(const DriveLocation& location) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_cache.erase(location);
+}
+
+std::mutex& DriveTelemetryCollector::get_port_mutex(PM85X6TwiPort port) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto& port_mutex = m_port_mutexes[port];
+    if (!port_mutex) {
+        port_mutex.reset(new std::mutex{});
+    }
+    return *port_mutex;
+}
+
+void DriveTelemetryCollector::read(const I2cAccessInterfacePtr i2c, const DriveLocation& location,
+                                   DriveTelemetry& telemetry, bool read_vpd) {
+    static_assert(sizeof(telemetry.smart.fields) <= FirmwareVersion::FW_VERSION_OFFSET_BYTES,
+                  "SMART status overlaps the firmware version");
+    static_assert(sizeof(telemetry.firmware_version.fields) == FirmwareVersion::FW_VERSION_SIZE_BYTES,
+                  "Invalid size of the firmware version");
+
+    std::lock_guard<std::mutex> lock{get_port_mutex(location.port)};
+    telemetry.is_smart_valid = false;
+    try {
+        select_channel(i2c, telemetry.get_platform(), location);
+    }
+    catch (const std::exception& e) {
+        log_debug(GET_LOGGER("pnc-nvme"), "Cannot select TWI channel " << std::uint32_t(location.channel)
+            << " on TWI port " << std::uint32_t(location.port) << ": " << e.what());
+        return;
+    }
+
+    try {
+        std::uint8_t block[SMART_BLOCK_SIZE_BYTES]{};
+        i2c->read(static_cast<uint8_t>(location.port),
+                  static_cast<uint16_t>(PM85X6TwiDeviceAddress::SMART),
+                  0,
+                  block,
+                  sizeof(block));
+        std::memcpy(&telemetry.smart.fields, block, sizeof(telemetry.smart.fields));
+        std::memcpy(&telemetry.firmware_version.fields, block + FirmwareVersion::FW_VERSION_OFFSET_BYTES,
+                    sizeof(telemetry.firmware_version.fields));
+        telemetry.is_smart_valid = true;
+        telemetry.is_firmware_version_valid = true;
+        telemetry.collected_at = Clock::now();
+    }
+    catch (const std::exception& e) {
+        log_debug(GET_LOGGER("pnc-nvme"), "Cannot read SMART of drive on TWI port "
+            << std::uint32_t(location.port) << " TWI channel " << std::uint32_t(location.channel) << ": " << e.what());
+    }
+
+    if (read_vpd) {
+        try {
+            i2c->read(static_cast<uint8_t>(location.port),
+                      static_cast<uint16_t>(PM85X6TwiDeviceAddress::NVME_VPD),
+                      0,
+                      reinterpret_cast<uint8_t*>(&telemetry.vpd.fields),
+                      VitalProductData::NVME_VPD_STRUCTURE_SIZE_BYTES);
+            telemetry.is_vpd_valid = true;
+        }
+        catch (const std::exception& e) {
+            log_debug(GET_LOGGER("pnc-nvme"), "Cannot read VPD of drive on TWI port "
+                << std::uint32_t(location.port) << " TWI channel " << std::uint32_t(location.channel) << ": "
+                << e.what());
+        }
+    }
+}
+
+void DriveTelemetryCollector::store(const DriveLocation& location, const DriveTelemetry& telemetry) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    // drives invalidated in the meantime are not brought back
+    const auto it = m_cache.find(location);
+    if (m_cache.end() != it) {
+        it->second = telemetry;
+    }
+}
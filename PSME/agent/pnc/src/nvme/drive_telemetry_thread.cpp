@@ -0,0 +1,77 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file drive_telemetry_thread.cpp
+ * @brief Periodic refresh of cached NVMe drive telemetry
+ * */
+
+#include "nvme/drive_telemetry_thread.hpp"
+#include "i2c/i2c_access_interface_factory.hpp"
+#include "json/json.hpp"
+#include <logger/logger_factory.hpp>
+
+#include <thread>
+
+using namespace agent::pnc::nvme;
+using namespace agent::pnc::i2c;
+
+constexpr std::chrono::seconds::rep DriveTelemetryThread::DEFAULT_INTERVAL_SEC;
+
+DriveTelemetryThread::DriveTelemetryThread(DriveTelemetryCollectorPtr collector, const json::Value& configuration) :
+    m_collector{collector} {
+    std::chrono::seconds max_age{2 * m_interval};
+    const auto& telemetry = configuration["driveTelemetry"];
+    if (telemetry.is_object()) {
+        try {
+            if (telemetry["refreshInterval"].is_uint() && 0 != telemetry["refreshInterval"].as_uint()) {
+                m_interval = std::chrono::seconds{telemetry["refreshInterval"].as_uint()};
+                max_age = 2 * m_interval;
+            }
+            if (telemetry["maxAge"].is_uint()) {
+                max_age = std::chrono::seconds{telemetry["maxAge"].as_uint()};
+            }
+        }
+        catch (const json::Value::Exception& e) {
+            log_error(GET_LOGGER("pnc-nvme"), "Cannot parse drive telemetry settings " << e.what());
+        }
+    }
+    m_collector->set_max_age(max_age);
+}
+
+DriveTelemetryThread::~DriveTelemetryThread() {
+    stop();
+}
+
+void DriveTelemetryThread::execute() {
+    auto next_refresh = std::chrono::steady_clock::now() + m_interval;
+    while (is_running()) {
+        // Sleep in short periods to let stop() return quickly
+        std::this_thread::sleep_for(std::chrono::seconds{1});
+        if (std::chrono::steady_clock::now() < next_refresh) {
+            continue;
+        }
+        try {
+            m_collector->refresh(I2cAccessInterfaceFactory::get_instance().get_interface());
+        }
+        catch (const std::exception& e) {
+            log_error(GET_LOGGER("pnc-nvme"), "Cannot refresh drive telemetry: " << e.what());
+        }
+        next_refresh = std::chrono::steady_clock::now() + m_interval;
+    }
+}
@@ -0,0 +1,62 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nvme_admin_interface.cpp
+ * @brief NVMe admin interface implementation
+ * */
+
+extern "C" {
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "nvme/nvme_admin_interface.hpp"
+
+using namespace agent::pnc::nvme;
+
+NvmeAdminInterface::~NvmeAdminInterface() {}
+
+IoctlNvmeAdminInterface::IoctlNvmeAdminInterface(const std::string& device_path) :
+    m_device_path{device_path} {
+    m_device_file = open(device_path.c_str(), O_RDONLY);
+    if (m_device_file < 0) {
+        throw std::runtime_error("Cannot open device " + device_path + ": " + std::strerror(errno));
+    }
+}
+
+IoctlNvmeAdminInterface::~IoctlNvmeAdminInterface() {
+    close(m_device_file);
+}
+
+void IoctlNvmeAdminInterface::submit(struct nvme_admin_cmd& cmd) {
+    const int result = ioctl(m_device_file, NVME_IOCTL_ADMIN_CMD, &cmd);
+    if (result < 0) {
+        throw std::runtime_error("Cannot submit admin command " + std::to_string(unsigned(cmd.opcode))
+            + " to " + m_device_path + ": " + std::strerror(errno));
+    }
+    if (result > 0) {
+        throw std::runtime_error("Admin command " + std::to_string(unsigned(cmd.opcode)) + " failed on "
+            + m_device_path + ", status code: " + std::to_string(result));
+    }
+}
@@ -20,19 +20,13 @@
  * @file nvme_secure_erase.cpp
  * @brief NVMe drive secure erase implementation
  * */
-extern "C" {
-#include <linux/nvme_ioctl.h>
-#include <sys/ioctl.h>
-#include <fcntl.h>
-#include <string.h>
-#include <unistd.h>
-}
-
-
+#include "nvme/nvme_secure_erase.hpp"
+#include "json/json.hpp"
+#include <logger/logger_factory.hpp>
 
+#include <cstring>
 #include <stdexcept>
-
-#include "nvme/nvme_secure_erase.hpp"
+#include <thread>
 
 
 
@@ -41,43 +35,167 @@ using namespace agent::pnc::nvme;
 namespace {
     constexpr uint32_t ERASE_ALL_NAMESPACES = 0xFFFFFFFF;
     constexpr uint32_t DEFAULT_TIMEOUT_MS = 120000;
+    constexpr uint32_t IDENTIFY_CONTROLLER = 0x00000001;
+    constexpr std::size_t DEFAULT_MAX_CONCURRENT_ERASES = 4;
+    /*! Sanitize progress is a numerator of a fraction with 65536 as denominator */
+    constexpr uint32_t SANITIZE_PROGRESS_DENOMINATOR = 65536;
+
+    static_assert(sizeof(nvme_id_ctrl) == 4096, "Invalid size of identify controller structure");
+    static_assert(sizeof(nvme_sanitize_log) == 512, "Invalid size of sanitize status log");
+
+    void identify_controller(NvmeAdminInterface& device, nvme_id_ctrl& controller) {
+        struct nvme_admin_cmd cmd;
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opcode = nvme_admin_identify;
+        cmd.addr = reinterpret_cast<std::uintptr_t>(&controller);
+        cmd.data_len = sizeof(controller);
+        cmd.cdw10 = IDENTIFY_CONTROLLER;
+        device.submit(cmd);
+    }
+
+    void get_sanitize_status(NvmeAdminInterface& device, nvme_sanitize_log& log) {
+        struct nvme_admin_cmd cmd;
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opcode = nvme_admin_get_log_page;
+        cmd.nsid = ERASE_ALL_NAMESPACES;
+        cmd.addr = reinterpret_cast<std::uintptr_t>(&log);
+        cmd.data_len = sizeof(log);
+        // number of dwords to read (zero based) on bits 31:16, log page identifier on bits 7:0
+        cmd.cdw10 = uint32_t((sizeof(log) / sizeof(uint32_t) - 1) << 16) | SANITIZE_STATUS_LOG_ID;
+        device.submit(cmd);
+    }
+
+    void check_cancelled(const std::atomic<bool>& cancelled) {
+        if (cancelled) {
+            throw std::runtime_error("Secure erase cancelled.");
+        }
+    }
+
+    /*! Reports progress only if it changed */
+    class ProgressReporter {
+    public:
+        explicit ProgressReporter(const EraseProgressCallback& callback) : m_callback{callback} {}
+
+        void report(uint32_t percent) {
+            if (m_callback && percent != m_percent) {
+                m_percent = percent;
+                m_callback(percent);
+            }
+        }
+
+    private:
+        const EraseProgressCallback& m_callback;
+        uint32_t m_percent{0};
+    };
+
+    void format(NvmeAdminInterface& device, const EraseSettings& settings) {
+        /* Prepare command struct */
+        struct nvme_admin_cmd cmd;
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opcode = nvme_admin_format_nvm;
+        cmd.nsid = ::ERASE_ALL_NAMESPACES;
+        const auto timeout_ms = std::chrono::duration_cast<std::chrono::milliseconds>(settings.timeout).count();
+        cmd.timeout_ms = timeout_ms > 0 ? uint32_t(timeout_ms) : ::DEFAULT_TIMEOUT_MS;
+        /***************** Command dword10 structure ********************/
+        //  Bit   | Description
+        //  -----------------------
+        //  31:12 | Reserved
+        //  11:09 | Secure Erase Settings
+        //     08 | Protection Information Location
+        //  07:05 | Protection Information
+        //     04 | Metadata Settings
+        //  03:00 | LBA Format
+        //
+        // Protection information settings are currently not supported and thus not set
+        cmd.cdw10 = static_cast<uint32_t>(SecureEraseSettings::USER_DATA_ERASE);
+        device.submit(cmd);
+    }
+
+    void sanitize(NvmeAdminInterface& device, SanitizeAction action, const EraseSettings& settings,
+                  ProgressReporter& progress, const std::atomic<bool>& cancelled) {
+        struct nvme_admin_cmd cmd;
+        memset(&cmd, 0, sizeof(cmd));
+        cmd.opcode = nvme_admin_sanitize;
+        // Sanitize action on bits 2:0, exit failure mode, overwrite and deallocation settings are not set
+        cmd.cdw10 = static_cast<uint32_t>(action);
+        device.submit(cmd);
+
+        const auto deadline = std::chrono::steady_clock::now() + settings.timeout;
+        while (true) {
+            std::this_thread::sleep_for(settings.poll_interval);
+            check_cancelled(cancelled);
+
+            nvme_sanitize_log log{};
+            get_sanitize_status(device, log);
+            switch (SanitizeStatus(log.sstat & SANITIZE_STATUS_MASK)) {
+                case SanitizeStatus::COMPLETED:
+                case SanitizeStatus::COMPLETED_NO_DEALLOCATE:
+                    progress.report(100);
+                    return;
+                case SanitizeStatus::FAILED:
+                    throw std::runtime_error("Sanitize failed.");
+                case SanitizeStatus::IN_PROGRESS:
+                    progress.report(uint32_t(log.sprog) * 100 / SANITIZE_PROGRESS_DENOMINATOR);
+                    break;
+                case SanitizeStatus::NEVER_SANITIZED:
+                default:
+                    break;
+            }
+            if (std::chrono::steady_clock::now() > deadline) {
+                throw std::runtime_error("Sanitize has not completed in " +
+                                         std::to_string(settings.timeout.count()) + " seconds.");
+            }
+        }
+    }
 }
 
-void agent::pnc::nvme::secure_erase(const std::string& device_path) {
+EraseSettings agent::pnc::nvme::get_default_erase_settings() {
+    return EraseSettings{std::chrono::seconds{1}, std::chrono::hours{2}, DEFAULT_MAX_CONCURRENT_ERASES};
+}
 
-    /* Opening device */
-    int device_file = open(device_path.c_str(), O_RDONLY);
-    if (device_file < 0) {
-        throw (std::runtime_error("Cannot open device. Error code: " + std::to_string(device_file)));
+EraseSettings agent::pnc::nvme::load_erase_settings(const json::Value& configuration) {
+    auto settings = get_default_erase_settings();
+    try {
+        const auto& erase = configuration["secureErase"];
+        if (!erase.is_object()) {
+            return settings;
+        }
+        if (erase["maxConcurrentErases"].is_uint() && 0 != erase["maxConcurrentErases"].as_uint()) {
+            settings.max_concurrent_erases = erase["maxConcurrentErases"].as_uint();
+        }
+        if (erase["pollInterval"].is_uint() && 0 != erase["pollInterval"].as_uint()) {
+            settings.poll_interval = std::chrono::seconds{erase["pollInterval"].as_uint()};
+        }
+        if (erase["timeout"].is_uint() && 0 != erase["timeout"].as_uint()) {
+            settings.timeout = std::chrono::seconds{erase["timeout"].as_uint()};
+        }
     }
+    catch (const json::Value::Exception& e) {
+        log_error(GET_LOGGER("pnc-nvme"), "Cannot parse secure erase settings: " << e.what());
+    }
+    return settings;
+}
 
-    /* Prepare command struct */
-    struct nvme_admin_cmd cmd;
-    memset(&cmd, 0, sizeof(cmd));
-    cmd.opcode = nvme_admin_format_nvm;
-    cmd.nsid = ::ERASE_ALL_NAMESPACES;
-    cmd.timeout_ms = ::DEFAULT_TIMEOUT_MS;
-    /***************** Command dword10 structure ********************/
-    //  Bit   | Description
-    //  -----------------------
-    //  31:12 | Reserved
-    //  11:09 | Secure Erase Settings
-    //     08 | Protection Information Location
-    //  07:05 | Protection Information
-    //     04 | Metadata Settings
-    //  03:00 | LBA Format
-    //
-    // Protection information settings are currently not supported and thus not set
-    cmd.cdw10 = static_cast<uint32_t>(SecureEraseSettings::USER_DATA_ERASE);
-
-    /* Ioctl call */
-    int format_error = ioctl(device_file, NVME_IOCTL_ADMIN_CMD, &cmd);
-    if (0 != format_error) {
-        close(device_file);
-        throw (std::runtime_error("Cannot format drive. Error code: " + std::to_string(format_error)));
+EraseMethod agent::pnc::nvme::secure_erase(NvmeAdminInterface& device, const EraseSettings& settings,
+                                           const EraseProgressCallback& progress,
+                                           const std::atomic<bool>& cancelled) {
+    ProgressReporter reporter{progress};
+    check_cancelled(cancelled);
+
+    nvme_id_ctrl controller{};
+    identify_controller(device, controller);
+
+    if (controller.sanicap & SANITIZE_CRYPTO_ERASE_SUPPORTED) {
+        sanitize(device, SanitizeAction::CRYPTO_ERASE, settings, reporter, cancelled);
+        return EraseMethod::SANITIZE_CRYPTO_ERASE;
     }
-    /* Closing device */
-    if (close(device_file) < 0) {
-        throw (std::runtime_error("Cannot close device. Error code: " + std::to_string(device_file)));
+    if (controller.sanicap & SANITIZE_BLOCK_ERASE_SUPPORTED) {
+        sanitize(device, SanitizeAction::BLOCK_ERASE, settings, reporter, cancelled);
+        return EraseMethod::SANITIZE_BLOCK_ERASE;
     }
+
+    log_debug(GET_LOGGER("pnc-nvme"), "Sanitize is not supported by the drive, formatting.");
+    format(device, settings);
+    reporter.report(100);
+    return EraseMethod::FORMAT_USER_DATA_ERASE;
 }
@@ -32,9 +32,12 @@
 #include "gas/mrpc/partition_binding_info.hpp"
 #include "nvme/nvme_secure_erase_task.hpp"
 #include "nvme/nvme_secure_erase.hpp"
+#include "nvme/secure_erase_registry.hpp"
 #include "agent-framework/module/pnc_components.hpp"
 #include "agent-framework/eventing/event_data.hpp"
 #include "agent-framework/eventing/events_queue.hpp"
+#include "agent-framework/action/task_progress.hpp"
+#include "configuration/configuration.hpp"
 #include "sysfs/sysfs_reader.hpp"
 #include "tools/toolset.hpp"
 
@@ -77,8 +80,8 @@ const std::vector<std::string> get_devices(const Toolset& tools, const GlobalAdd
 }
 
 
-NvmeSecureEraseTask::NvmeSecureEraseTask(const std::string& drive_uuid) :
-    m_drive_uuid{drive_uuid} {}
+NvmeSecureEraseTask::NvmeSecureEraseTask(const std::string& drive_uuid, const std::string& task_uuid) :
+    m_drive_uuid{drive_uuid}, m_task_uuid{task_uuid} {}
 
 
 void NvmeSecureEraseTask::operator()() {
@@ -95,7 +98,18 @@ void NvmeSecureEraseTask::operator()() {
         device_path = std::string("/dev/" + device_path);
         log_debug(GET_LOGGER("agent"), "Drive to be erased: " + device_path);
         try {
-            secure_erase(device_path);
+            // waits while other drives are erased, the drive is still bound to the management partition
+            auto slot = SecureEraseRegistry::get_instance().acquire(m_drive_uuid);
+            const auto settings = load_erase_settings(configuration::Configuration::get_instance().to_json());
+            EraseProgressCallback progress{};
+            if (!m_task_uuid.empty()) {
+                const std::string task_uuid = m_task_uuid;
+                progress = [task_uuid](std::uint32_t percent) {
+                    agent_framework::action::update_task_progress(task_uuid, percent);
+                };
+            }
+            IoctlNvmeAdminInterface device{device_path};
+            secure_erase(device, settings, progress, slot.get_cancel_flag());
             set_drive_erased(m_drive_uuid);
             tools.gas_tool->unbind_drive_from_mgmt_partition(tools.model_tool, gas, m_drive_uuid);
         }
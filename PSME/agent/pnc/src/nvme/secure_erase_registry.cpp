@@ -0,0 +1,96 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file secure_erase_registry.cpp
+ * @brief Registry of drives being erased
+ * */
+
+#include "nvme/secure_erase_registry.hpp"
+#include "nvme/nvme_secure_erase.hpp"
+#include "configuration/configuration.hpp"
+
+#include <stdexcept>
+
+using namespace agent::pnc::nvme;
+
+SecureEraseRegistry::Slot::Slot(SecureEraseRegistry& registry, const std::string& drive_uuid,
+                                CancelFlag cancelled) :
+    m_registry{&registry}, m_drive_uuid{drive_uuid}, m_cancelled{cancelled} {}
+
+SecureEraseRegistry::Slot::Slot(Slot&& other) :
+    m_registry{other.m_registry}, m_drive_uuid{std::move(other.m_drive_uuid)},
+    m_cancelled{std::move(other.m_cancelled)} {
+    other.m_registry = nullptr;
+}
+
+SecureEraseRegistry::Slot::~Slot() {
+    if (m_registry) {
+        m_registry->release(m_drive_uuid);
+    }
+}
+
+SecureEraseRegistry& SecureEraseRegistry::get_instance() {
+    static SecureEraseRegistry registry{
+        load_erase_settings(configuration::Configuration::get_instance().to_json()).max_concurrent_erases};
+    return registry;
+}
+
+SecureEraseRegistry::SecureEraseRegistry(std::size_t max_concurrent_erases) :
+    m_max_concurrent_erases{0 == max_concurrent_erases ? 1 : max_concurrent_erases} {}
+
+SecureEraseRegistry::Slot SecureEraseRegistry::acquire(const std::string& drive_uuid) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_erases.count(drive_uuid)) {
+        throw std::runtime_error("Drive " + drive_uuid + " is already being erased.");
+    }
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    m_erases.emplace(drive_uuid, cancelled);
+    m_slot_released.wait(lock, [this, &cancelled]() {
+        return *cancelled || m_running < m_max_concurrent_erases;
+    });
+    if (*cancelled) {
+        m_erases.erase(drive_uuid);
+        throw std::runtime_error("Secure erase cancelled.");
+    }
+    ++m_running;
+    return Slot{*this, drive_uuid, cancelled};
+}
+
+bool SecureEraseRegistry::cancel(const std::string& drive_uuid) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_erases.find(drive_uuid);
+    if (m_erases.end() == it) {
+        return false;
+    }
+    *it->second = true;
+    m_slot_released.notify_all();
+    return true;
+}
+
+std::size_t SecureEraseRegistry::get_running_count() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_running;
+}
+
+void SecureEraseRegistry::release(const std::string& drive_uuid) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    --m_running;
+    m_erases.erase(drive_uuid);
+    m_slot_released.notify_all();
+}
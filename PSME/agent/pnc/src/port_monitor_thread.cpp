@@ -25,6 +25,7 @@
 
 #include "port_monitor_thread.hpp"
 #include "state_machine/port_state_manager.hpp"
+#include "state_machine/port_update_scheduler.hpp"
 #include "gas/mrpc/link_status_retrieve.hpp"
 #include "gas/mrpc/port_binding_info.hpp"
 #include "gas/global_address_space_registers.hpp"
@@ -33,6 +34,7 @@
 #include "discovery/discovery_manager.hpp"
 #include <logger/logger_factory.hpp>
 
+#include <algorithm>
 #include <chrono>
 
 using namespace agent::pnc;
@@ -52,6 +54,9 @@ using PsmVector = std::vector<std::unique_ptr<PortStateManager>>;
 
 namespace {
 
+/*! Maximum number of ports updated concurrently */
+constexpr std::size_t MAX_PORT_UPDATE_WORKERS = 4;
+
 bool get_is_link_up(const Port& port) {
     return port.get_status().get_state() == enums::State::Enabled;
 }
@@ -125,68 +130,86 @@ std::tuple< StringVector, PsmVector> initialize_port_vectors(const DiscoveryMana
 }
 
 uint64_t initialize_dsps(const PsmVector& psms, const DiscoveryManager& dm, const GlobalAddressSpaceRegisters& gas,
-        const Toolset& tools) {
+        const Toolset& tools, PortUpdateScheduler& scheduler) {
     uint64_t presence_mask{0u};
-    auto pbi = tools.gas_tool->get_all_port_binding_info(gas);
+    std::mutex presence_mutex{};
+    auto pbi = tools.gas_tool->revalidate_binding_cache(gas);
     for (auto& psm : psms) {
         auto port_uuid = psm->get_port_uuid();
-        Port port = get_manager<Port>().get_entry(port_uuid);
-        bool is_bound{false};
-        bool is_bound_to_host{false};
-        std::tie(is_bound, is_bound_to_host) =  get_is_bound(gas, pbi, uint8_t(port.get_phys_port_id()));
-        psm->init_binding(is_bound, is_bound_to_host);
-        dm.update_port_status(gas, port_uuid);
-        // model was updated - get new status
-        bool is_link_up = get_is_link_up(get_manager<Port>().get_entry(port_uuid));
-        psm->init_presence(is_link_up);
-        if (is_link_up) {
-            presence_mask |= (1u << port.get_phys_port_id());
-        }
+        // ports are bound and discovered concurrently
+        scheduler.schedule(port_uuid, [&psm, &dm, &presence_mask, &presence_mutex, gas, pbi, port_uuid]() {
+            Port port = get_manager<Port>().get_entry(port_uuid);
+            bool is_bound{false};
+            bool is_bound_to_host{false};
+            std::tie(is_bound, is_bound_to_host) =  get_is_bound(gas, pbi, uint8_t(port.get_phys_port_id()));
+            psm->init_binding(is_bound, is_bound_to_host);
+            dm.update_port_status(gas, port_uuid);
+            // model was updated - get new status
+            bool is_link_up = get_is_link_up(get_manager<Port>().get_entry(port_uuid));
+            psm->init_presence(is_link_up);
+            if (is_link_up) {
+                std::lock_guard<std::mutex> lock{presence_mutex};
+                presence_mask |= (1u << port.get_phys_port_id());
+            }
+        });
     }
+    scheduler.wait_all();
     return presence_mask;
 }
 
+void update_downstream_port(PortStateManager& psm, const DiscoveryManager& dm, const GlobalAddressSpaceRegisters& gas,
+        uint64_t presence_bitmask, const PortBindingInfo& pbi) {
+
+    Port port = get_manager<Port>().get_entry(psm.get_port_uuid());
+    log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: checking port " << port.get_port_id());
+
+    // gather states
+    bool is_device_present = get_is_present(presence_bitmask, port.get_phys_port_id());
+    bool is_drive_present = (is_device_present ? psm.is_device_present() : false);
+    bool is_bound{false};
+    bool is_bound_to_host{false};
+    std::tie(is_bound, is_bound_to_host) =  get_is_bound(gas, pbi, uint8_t(port.get_phys_port_id()));
+    bool is_being_erased =
+        (is_drive_present ?  get_is_being_erased(get_manager<Drive>().get_entry(psm.get_device_uuid())) : false);
+
+    // update state machine
+    psm.update(is_device_present, is_bound, is_bound_to_host, is_being_erased);
+
+    // update status
+    dm.update_port_status(gas, psm.get_port_uuid());
+    if (is_drive_present) {
+        auto drive_ref = get_manager<Drive>().get_entry_reference(psm.get_device_uuid());
+        // we only 'touch' drives that have no state overrides
+        if (!(drive_ref->get_is_being_erased() || drive_ref->get_is_in_warning_state()
+            || drive_ref->get_is_in_critical_discovery_state())) {
+
+            if (is_bound) {
+                // drive is present and bound -> read smart
+                dm.update_drive_status(psm.get_port_uuid(), psm.get_device_uuid());
+            }
+            else {
+                // drive is present and unbound -> set StandbyOffline
+                auto status = drive_ref->get_status();
+                status.set_state(enums::State::StandbyOffline);
+                drive_ref->set_status(status);
+            }
+        }
+    }
+    log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: finished checking port " << port.get_port_id());
+}
+
 void update_downstream_ports(const PsmVector& psms, const DiscoveryManager& dm, const GlobalAddressSpaceRegisters& gas,
-        const Toolset&, uint64_t presence_bitmask, PortBindingInfo pbi) {
+        const Toolset&, uint64_t presence_bitmask, PortBindingInfo pbi, PortUpdateScheduler& scheduler) {
 
     for (auto& psm : psms) {
-
-        Port port = get_manager<Port>().get_entry(psm->get_port_uuid());
-        log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: checking port " << port.get_port_id());
-
-        // gather states
-        bool is_device_present = get_is_present(presence_bitmask, port.get_phys_port_id());
-        bool is_drive_present = (is_device_present ? psm->is_device_present() : false);
-        bool is_bound{false};
-        bool is_bound_to_host{false};
-        std::tie(is_bound, is_bound_to_host) =  get_is_bound(gas, pbi, uint8_t(port.get_phys_port_id()));
-        bool is_being_erased =
-            (is_drive_present ?  get_is_being_erased(get_manager<Drive>().get_entry(psm->get_device_uuid())) : false);
-
-        // update state machine
-        psm->update(is_device_present, is_bound, is_bound_to_host, is_being_erased);
-
-        // update status
-        dm.update_port_status(gas, psm->get_port_uuid());
-        if (is_drive_present) {
-            auto drive_ref = get_manager<Drive>().get_entry_reference(psm->get_device_uuid());
-            // we only 'touch' drives that have no state overrides
-            if (!(drive_ref->get_is_being_erased() || drive_ref->get_is_in_warning_state()
-                || drive_ref->get_is_in_critical_discovery_state())) {
-
-                if (is_bound) {
-                    // drive is present and bound -> read smart
-                    dm.update_drive_status(psm->get_port_uuid(), psm->get_device_uuid());
-                }
-                else {
-                    // drive is present and unbound -> set StandbyOffline
-                    auto status = drive_ref->get_status();
-                    status.set_state(enums::State::StandbyOffline);
-                    drive_ref->set_status(status);
-                }
-            }
+        // port still busy with the previous transition is checked again in the next loop
+        PortStateManager& manager = *psm;
+        if (!scheduler.schedule(psm->get_port_uuid(), [&manager, &dm, gas, presence_bitmask, pbi]() {
+                update_downstream_port(manager, dm, gas, presence_bitmask, pbi);
+            })) {
+            log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: port " << psm->get_port_uuid()
+                << " is busy, skipped");
         }
-        log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: finished checking port " << port.get_port_id());
     }
 }
 
@@ -243,7 +266,10 @@ void PortMonitorThread::task() {
     uint64_t presence_bitmask{};
     PortBindingInfo pbi{gas.get_interface()};
 
-    uint64_t edk_mask = initialize_dsps(dsps, dm, gas, m_tools);
+    // destroyed before the managers and the discovery manager used by the updates
+    PortUpdateScheduler scheduler{std::min(dsps.size(), MAX_PORT_UPDATE_WORKERS)};
+
+    uint64_t edk_mask = initialize_dsps(dsps, dm, gas, m_tools, scheduler);
 
     while (m_is_running) {
         std::unique_lock<std::mutex> lk(m_mutex);
@@ -255,12 +281,16 @@ void PortMonitorThread::task() {
                 // get data
                 gas.read_top();
                 presence_bitmask = get_presence(m_tools, gas, edk_mask);
-                pbi = m_tools.gas_tool->get_all_port_binding_info(gas);
+                // bindings of all ports are read anyway, the binding cache is checked against them
+                pbi = m_tools.gas_tool->revalidate_binding_cache(gas);
                 log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: Presence bitmask: "
                     << std::hex << presence_bitmask << std::dec);
-                // update port data
-                update_downstream_ports(dsps, dm, gas, m_tools, presence_bitmask, pbi);
+                // update port data, downstream ports are updated in the background
+                update_downstream_ports(dsps, dm, gas, m_tools, presence_bitmask, pbi, scheduler);
                 update_upstream_ports(usps, dm, gas, m_tools);
+                if (!m_is_discovery_finished) {
+                    scheduler.wait_all();
+                }
                 log_debug(GET_LOGGER("port-monitor"), "PortMonitorThread: monitor loop finished!");
             }
             catch (std::exception& e) {
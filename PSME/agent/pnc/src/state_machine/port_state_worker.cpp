@@ -24,14 +24,15 @@
 #include "state_machine/port_state_worker.hpp"
 #include "discovery/discovery_manager.hpp"
 #include "gas/global_address_space_registers.hpp"
+#include "sysfs/uevent_listener.hpp"
 
-#include <thread>
 #include <chrono>
 
 using namespace agent::pnc::state_machine;
 using namespace agent::pnc::discovery;
 using namespace agent::pnc::gas;
 using namespace agent::pnc::gas::mrpc;
+using namespace agent::pnc::sysfs;
 using namespace agent_framework::model;
 using namespace agent_framework::module;
 using namespace agent_framework::eventing;
@@ -47,9 +48,18 @@ GlobalAddressSpaceRegisters get_gas(const std::string& switch_uuid) {
     return gas;
 }
 
+/*! Maximum time of waiting for the block device of a bound drive */
 constexpr std::size_t SYSFS_UPDATE_TIME_SEC = 10;
+/*! Maximum time of waiting for removal of an unbound device */
 constexpr std::size_t UNBIND_DISCOVERY_DELAY_SEC = 1;
 
+std::string get_bridge_devpath(const Switch& sw, uint8_t bridge_id) {
+    if (0 == bridge_id) {
+        return UeventListener::get_devpath(sw.get_bridge_path());
+    }
+    return UeventListener::get_bridge_devpath(sw.get_bridge_path(), sw.get_sec_bus_num(), uint8_t(bridge_id - 1));
+}
+
 }
 
 PortStateWorker::~PortStateWorker() {}
@@ -61,7 +71,7 @@ uint8_t PortStateWorker::get_bridge_id(const std::string& switch_uuid, const std
     auto gas = get_gas(switch_uuid);
 
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: checking for bindings...");
-    PortBindingInfo pbi = m_tools.gas_tool->get_port_binding_info(gas, uint8_t(port.get_phys_port_id()));
+    PortBindingInfo pbi = m_tools.gas_tool->get_cached_port_binding_info(gas, uint8_t(port.get_phys_port_id()));
     uint8_t bridge_id = m_tools.gas_tool->get_logical_bridge_for_port(pbi);
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: Bound to bridge " << unsigned(bridge_id));
     return bridge_id;
@@ -81,16 +91,31 @@ uint8_t PortStateWorker::bind_to_host(const std::string& switch_uuid, const std:
 
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: gathering data...");
     Port port = get_manager<Port>().get_entry(port_uuid);
+    Switch sw = get_manager<Switch>().get_entry(switch_uuid);
     auto gas = get_gas(switch_uuid);
 
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: binding to an empty bridge...");
-    PartitionBindingInfo pbi = m_tools.gas_tool->get_partition_binding_info(
-        gas, gas.top.output.fields.current_partition_id);
-    uint8_t bridge_id = m_tools.gas_tool->get_available_bridge_id(pbi);
-    m_tools.gas_tool->bind_to_partition(gas, uint8_t(port.get_phys_port_id()),
-        gas.top.output.fields.current_partition_id, bridge_id);
+    auto& listener = UeventListener::get_instance();
+    UeventListener::ExpectationPtr drive_added{};
+    uint8_t bridge_id{};
+    {
+        // other ports may be bound concurrently, the bridge must not be taken in the meantime
+        auto lock = GasTool::lock_bindings();
+        PartitionBindingInfo pbi = m_tools.gas_tool->get_partition_binding_info(
+            gas, gas.top.output.fields.current_partition_id);
+        bridge_id = m_tools.gas_tool->get_available_bridge_id(pbi);
+
+        // registered before binding, the event may come before bind_to_partition returns
+        drive_added = listener.expect(UeventListener::matches("add", "block", get_bridge_devpath(sw, bridge_id)));
+        m_tools.gas_tool->bind_to_partition(gas, uint8_t(port.get_phys_port_id()),
+            gas.top.output.fields.current_partition_id, bridge_id);
+    }
 
-    std::this_thread::sleep_for(std::chrono::seconds(::SYSFS_UPDATE_TIME_SEC));
+    // wait for system to update sysfs
+    if (!listener.wait_for(drive_added, std::chrono::seconds(::SYSFS_UPDATE_TIME_SEC))) {
+        log_debug(GET_LOGGER("port-state-worker"), "\tAction: no block device event, waited "
+            << ::SYSFS_UPDATE_TIME_SEC << "s");
+    }
 
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: bound to bridge " << unsigned(bridge_id));
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: binding successful");
@@ -104,11 +129,19 @@ void PortStateWorker::unbind_from_host(const std::string& switch_uuid, uint8_t b
     auto gas = get_gas(switch_uuid);
 
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: unbinding...");
-    m_tools.gas_tool->unbind_management_host_driver(sw.get_bridge_path(), bridge_id);
-    m_tools.gas_tool->unbind_from_partition(gas, gas.top.output.fields.current_partition_id, bridge_id);
+    auto& listener = UeventListener::get_instance();
+    auto device_removed = listener.expect(UeventListener::matches("remove", "pci", get_bridge_devpath(sw, bridge_id)));
+    {
+        auto lock = GasTool::lock_bindings();
+        m_tools.gas_tool->unbind_management_host_driver(sw.get_bridge_path(), bridge_id);
+        m_tools.gas_tool->unbind_from_partition(gas, gas.top.output.fields.current_partition_id, bridge_id);
+    }
 
     // wait for system to update sysfs
-    std::this_thread::sleep_for(std::chrono::seconds(UNBIND_DISCOVERY_DELAY_SEC));
+    if (!listener.wait_for(device_removed, std::chrono::seconds(UNBIND_DISCOVERY_DELAY_SEC))) {
+        log_debug(GET_LOGGER("port-state-worker"), "\tAction: no device removal event, waited "
+            << UNBIND_DISCOVERY_DELAY_SEC << "s");
+    }
     log_debug(GET_LOGGER("port-state-worker"), "\tAction: unbinding successful");
 }
 
@@ -0,0 +1,73 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file state_machine/port_update_scheduler.cpp
+ * @brief Implementation of the PortUpdateScheduler
+ * */
+
+#include "state_machine/port_update_scheduler.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <algorithm>
+
+using namespace agent::pnc::state_machine;
+
+PortUpdateScheduler::PortUpdateScheduler(std::size_t max_workers) :
+    m_pool(std::max(max_workers, std::size_t{1})) {}
+
+PortUpdateScheduler::~PortUpdateScheduler() {}
+
+bool PortUpdateScheduler::schedule(const std::string& port_uuid, Update update) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (!m_busy_ports.insert(port_uuid).second) {
+            return false;
+        }
+    }
+    m_pool.run([this, port_uuid, update]() { run(port_uuid, update); });
+    return true;
+}
+
+bool PortUpdateScheduler::is_busy(const std::string& port_uuid) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_busy_ports.count(port_uuid) > 0;
+}
+
+void PortUpdateScheduler::wait_all() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_condition.wait(lock, [this]() { return m_busy_ports.empty(); });
+}
+
+void PortUpdateScheduler::run(const std::string& port_uuid, const Update& update) {
+    try {
+        update();
+    }
+    catch (const std::exception& e) {
+        log_error(GET_LOGGER("port-monitor"), "Update of port " << port_uuid << " FAILED: " << e.what());
+    }
+    catch (...) {
+        log_error(GET_LOGGER("port-monitor"), "Update of port " << port_uuid << " FAILED: unknown error");
+    }
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_busy_ports.erase(port_uuid);
+    }
+    m_condition.notify_all();
+}
@@ -30,6 +30,7 @@
 #include <sstream>
 #include <regex>
 #include <algorithm>
+#include <cctype>
 
 using namespace agent::pnc::sysfs;
 
@@ -42,6 +43,28 @@ namespace {
     const char ATTRIBUTE_UNBIND[] = "unbind";
     const char BUS_NAME[] = "pci";
     const double BLOCK_SIZE = 512.0;
+
+    /* checks if a path component is a PCI device name: dddd:bb:dd.f */
+    bool is_pci_device_name(const std::string& name) {
+        static const char FORMAT[] = "xxxx:xx:xx.x";
+        if (name.size() != sizeof(FORMAT) - 1) {
+            return false;
+        }
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            const bool matches = ('x' == FORMAT[i]) ? (0 != std::isxdigit(static_cast<unsigned char>(name[i])))
+                                                    : (FORMAT[i] == name[i]);
+            if (!matches) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string to_lower(std::string str) {
+        std::transform(str.begin(), str.end(), str.begin(),
+            [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+        return str;
+    }
 }
 
 SysfsReader::~SysfsReader() {}
@@ -66,32 +89,37 @@ void SysfsReader::update_drive_info(const std::string& drive_name, RawSysfsDevic
     }
 }
 
-void SysfsReader::update_pci_device_drives(sysfs_device* sys_device, RawSysfsDevice& device) const {
+std::vector<std::string> SysfsReader::get_pci_devices_on_path(const std::string& path) {
+    std::vector<std::string> pci_devices{};
+    std::size_t begin = 0;
+    while (begin < path.size()) {
+        auto end = path.find('/', begin);
+        if (std::string::npos == end) {
+            end = path.size();
+        }
+        std::string name = path.substr(begin, end - begin);
+        if (is_pci_device_name(name)) {
+            pci_devices.emplace_back(std::move(name));
+        }
+        begin = end + 1;
+    }
+    return pci_devices;
+}
+
+SysfsReader::BlockDevices SysfsReader::get_block_devices() const {
+    BlockDevices block_devices{};
 
     // open block device class
     sysfs_class* block_class = sysfs_open_class(::CLASS_BLOCK);
 
     if (block_class != nullptr) {
 
-        // prepare regexp
-        std::string reg_expr_str_pre = "/sys/devices/pci....:../(?:....:..:..\\../)*";
-        std::string reg_expr_str_post = "/(.*)";
-        std::string reg_expr_str = reg_expr_str_pre + sys_device->name + reg_expr_str_post;
-
-        // check each block device
-        dlist* block_devices = sysfs_get_class_devices(block_class);
+        // path of the class device is resolved, it contains all PCI devices the drive is connected through
+        dlist* class_devices = sysfs_get_class_devices(block_class);
         sysfs_class_device* block_device = 0;
-        dlist_for_each_data(block_devices, block_device, struct sysfs_class_device) {
-
-            // check if this is a device on the bus - look for a specific path pattern
-            static const int NUM_OF_SUB_EXPR = 2;
-            std::string path = block_device->path;
-
-            std::smatch matches{};
-            std::regex_match(path, matches, std::regex(reg_expr_str, std::regex_constants::icase));
-
-            if (NUM_OF_SUB_EXPR == matches.size()) {
-                update_drive_info(block_device->name, device);
+        dlist_for_each_data(class_devices, block_device, struct sysfs_class_device) {
+            for (const auto& pci_device : get_pci_devices_on_path(block_device->path)) {
+                block_devices[pci_device].emplace_back(block_device->name);
             }
         }
         sysfs_close_class(block_class);
@@ -99,6 +127,17 @@ void SysfsReader::update_pci_device_drives(sysfs_device* sys_device, RawSysfsDev
     else {
         log_error(GET_LOGGER("sysfs-reader"), "Cannot open block device class");
     }
+    return block_devices;
+}
+
+void SysfsReader::update_pci_device_drives(sysfs_device* sys_device, const BlockDevices& block_devices,
+                                           RawSysfsDevice& device) const {
+    const auto it = block_devices.find(sys_device->name);
+    if (it != block_devices.end()) {
+        for (const auto& drive_name : it->second) {
+            update_drive_info(drive_name, device);
+        }
+    }
 }
 
 void SysfsReader::update_pci_device_virtual(sysfs_device* sys_device, RawSysfsDevice& device) const {
@@ -130,13 +169,14 @@ bool SysfsReader::update_pci_device_ids(sysfs_device* sys_device, RawSysfsDevice
     return true;
 }
 
-bool SysfsReader::update_pci_device(sysfs_device* sys_device, RawSysfsDevice& device) const {
+bool SysfsReader::update_pci_device(sysfs_device* sys_device, const BlockDevices& block_devices,
+                                    RawSysfsDevice& device) const {
     RawSysfsDevice result{};
     if (sys_device != nullptr && update_pci_device_config(sys_device, result)
                               && update_pci_device_ids(sys_device, result)) {
 
         update_pci_device_virtual(sys_device, result);
-        update_pci_device_drives(sys_device, result);
+        update_pci_device_drives(sys_device, block_devices, result);
         device = result;
         return true;
     }
@@ -151,10 +191,7 @@ bool SysfsReader::is_path_matched(sysfs_device* sys_device, const std::string& p
     if (path.empty()) {
         return true;
     }
-    std::string dev_path = sys_device->path;
-    std::smatch matches{};
-    std::regex_match(dev_path, matches, std::regex(".*" + path + ".*", std::regex_constants::icase));
-    return (matches.size() == 1);
+    return std::string::npos != to_lower(sys_device->path).find(to_lower(path));
 }
 
 std::vector<RawSysfsDevice> SysfsReader::get_raw_sysfs_devices(const std::string& path) const {
@@ -166,12 +203,15 @@ std::vector<RawSysfsDevice> SysfsReader::get_raw_sysfs_devices(const std::string
         // get list of all devices
         struct dlist* sys_devices = sysfs_get_bus_devices(sys_bus);
         if (sys_devices != nullptr) {
+            // block devices are read once, not for each PCI device
+            const auto block_devices = get_block_devices();
+
             // iterate through the list and read data about each drive
             struct sysfs_device* sys_device = nullptr;
             dlist_for_each_data(sys_devices, sys_device, struct sysfs_device) {
                 RawSysfsDevice device{};
                 if (is_path_matched(sys_device, path)) {
-                    if (update_pci_device(sys_device, device)) {
+                    if (update_pci_device(sys_device, block_devices, device)) {
                         devices.emplace_back(device);
                     }
                 }
@@ -206,7 +246,7 @@ std::vector<std::string> SysfsReader::get_drives_for_device(
         str_dev << std::setw(2) << std::setfill('0') << unsigned(bus_num) << ":";
         str_dev << std::setw(2) << std::setfill('0') << unsigned(device_num) << "\\../";
         str_dev << "(?:....:..:..\\../)*(.*)/(\\1.*)/(\\2.*)";
-        std::string regex_str = str_dev.str();
+        const std::regex drive_regex(str_dev.str(), std::regex_constants::icase);
 
         // check each block device
         dlist* block_devices = sysfs_get_class_devices(block_class);
@@ -218,7 +258,7 @@ std::vector<std::string> SysfsReader::get_drives_for_device(
             std::string path = block_device->path;
 
             std::smatch matches{};
-            std::regex_match(path, matches, std::regex(regex_str, std::regex_constants::icase));
+            std::regex_match(path, matches, drive_regex);
             if (NUM_OF_SUB_EXPR == matches.size()) {
                 drives.push_back(matches[3]);
             }
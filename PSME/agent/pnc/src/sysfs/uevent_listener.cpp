@@ -0,0 +1,282 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file sysfs/uevent_listener.cpp
+ * @brief UeventListener implementation
+ * */
+
+#include "sysfs/uevent_listener.hpp"
+
+#include "logger/logger_factory.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <linux/netlink.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+}
+
+using namespace agent::pnc::sysfs;
+
+namespace {
+
+constexpr char SYSFS_ROOT[] = "/sys";
+/*! Multicast group of kernel events, group 2 is used by udev */
+constexpr unsigned KERNEL_EVENTS_GROUP = 1;
+constexpr std::size_t MAX_MESSAGE_SIZE = 8192;
+constexpr int RECEIVE_BUFFER_SIZE = 1024 * 1024;
+
+bool starts_with(const std::string& str, const std::string& prefix) {
+    return 0 == str.compare(0, prefix.size(), prefix);
+}
+
+int open_uevent_socket() {
+    int fd = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if (fd < 0) {
+        return -1;
+    }
+    // events come in bursts when drives are bound, do not drop them
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &RECEIVE_BUFFER_SIZE, sizeof(RECEIVE_BUFFER_SIZE));
+
+    struct sockaddr_nl address{};
+    address.nl_family = AF_NETLINK;
+    address.nl_pid = 0;
+    address.nl_groups = KERNEL_EVENTS_GROUP;
+    if (0 != ::bind(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+}
+
+Uevent Uevent::parse(const char* buffer, std::size_t length) {
+    Uevent event{};
+    const char* end = buffer + length;
+    const char* header_end = static_cast<const char*>(std::memchr(buffer, '\0', length));
+    if (nullptr == header_end) {
+        header_end = end;
+    }
+    const std::string header{buffer, header_end};
+    const auto at = header.find('@');
+    // messages of udev start with "libudev", they are sent to other group
+    if (std::string::npos == at || 0 == at) {
+        return event;
+    }
+    event.action = header.substr(0, at);
+    event.devpath = header.substr(at + 1);
+
+    for (const char* it = header_end; it < end; ) {
+        if ('\0' == *it) {
+            ++it;
+            continue;
+        }
+        const char* next = static_cast<const char*>(std::memchr(it, '\0', std::size_t(end - it)));
+        if (nullptr == next) {
+            next = end;
+        }
+        const std::string entry{it, next};
+        const auto eq = entry.find('=');
+        if (std::string::npos != eq) {
+            const auto key = entry.substr(0, eq);
+            if ("SUBSYSTEM" == key) {
+                event.subsystem = entry.substr(eq + 1);
+            }
+            else if ("DEVTYPE" == key) {
+                event.devtype = entry.substr(eq + 1);
+            }
+        }
+        it = next;
+    }
+    return event;
+}
+
+
+UeventListener::~UeventListener() {
+    stop();
+}
+
+UeventListener& UeventListener::get_instance() {
+    static UeventListener listener{};
+    return listener;
+}
+
+void UeventListener::start() {
+    if (m_is_running) {
+        return;
+    }
+    int fd = open_uevent_socket();
+    if (fd < 0) {
+        log_warning(GET_LOGGER("uevent-listener"), "Cannot open uevent socket: " << std::strerror(errno)
+            << ", fixed delays are used to wait for sysfs updates");
+        return;
+    }
+    start(fd);
+}
+
+void UeventListener::start(int socket) {
+    if (m_is_running) {
+        ::close(socket);
+        return;
+    }
+    if (0 != ::pipe2(m_shutdown_fd, O_CLOEXEC)) {
+        log_warning(GET_LOGGER("uevent-listener"), "Cannot create shutdown pipe: " << std::strerror(errno));
+        ::close(socket);
+        return;
+    }
+    m_socket = socket;
+    m_is_running = true;
+    m_thread = std::thread(&UeventListener::task, this);
+    log_debug(GET_LOGGER("uevent-listener"), "Listening for kernel uevents");
+}
+
+void UeventListener::stop() {
+    if (!m_is_running) {
+        return;
+    }
+    m_is_running = false;
+    const char byte{0};
+    if (::write(m_shutdown_fd[1], &byte, sizeof(byte)) < 0) {
+        log_warning(GET_LOGGER("uevent-listener"), "Cannot notify listener thread: " << std::strerror(errno));
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    close_descriptors();
+}
+
+void UeventListener::close_descriptors() {
+    for (auto* fd : {&m_socket, &m_shutdown_fd[0], &m_shutdown_fd[1]}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void UeventListener::task() {
+    std::vector<char> buffer(MAX_MESSAGE_SIZE);
+    struct pollfd fds[2] = {{m_socket, POLLIN, 0}, {m_shutdown_fd[0], POLLIN, 0}};
+    while (m_is_running) {
+        int count = ::poll(fds, 2, -1);
+        if (count < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            log_error(GET_LOGGER("uevent-listener"), "Polling uevent socket failed: " << std::strerror(errno));
+            break;
+        }
+        if (0 != fds[1].revents) {
+            break;
+        }
+        if (0 == fds[0].revents) {
+            continue;
+        }
+        auto length = ::recv(m_socket, buffer.data(), buffer.size(), MSG_DONTWAIT);
+        if (length < 0) {
+            if (ENOBUFS == errno) {
+                log_warning(GET_LOGGER("uevent-listener"), "Uevents were dropped");
+            }
+            continue;
+        }
+        auto event = Uevent::parse(buffer.data(), std::size_t(length));
+        if (!event.action.empty()) {
+            dispatch(event);
+        }
+    }
+    log_debug(GET_LOGGER("uevent-listener"), "Uevent listener stopped");
+}
+
+UeventListener::ExpectationPtr UeventListener::expect(Predicate predicate) {
+    auto expectation = std::make_shared<Expectation>(std::move(predicate));
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_expectations.emplace_back(expectation);
+    return expectation;
+}
+
+bool UeventListener::wait_for(const ExpectationPtr& expectation, std::chrono::milliseconds timeout) {
+    if (!expectation) {
+        std::this_thread::sleep_for(timeout);
+        return false;
+    }
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_condition.wait_for(lock, timeout, [&expectation]() { return expectation->m_fulfilled; });
+}
+
+void UeventListener::dispatch(const Uevent& event) {
+    log_debug(GET_LOGGER("uevent-listener"), "Uevent: " << event.action << " " << event.subsystem
+        << " " << event.devpath);
+    bool fulfilled{false};
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        for (auto it = m_expectations.begin(); it != m_expectations.end(); ) {
+            auto expectation = it->lock();
+            if (!expectation) {
+                // nobody waits for it any more
+                it = m_expectations.erase(it);
+            }
+            else if (expectation->m_predicate(event)) {
+                expectation->m_fulfilled = true;
+                fulfilled = true;
+                it = m_expectations.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    if (fulfilled) {
+        m_condition.notify_all();
+    }
+}
+
+UeventListener::Predicate UeventListener::matches(const std::string& action, const std::string& subsystem,
+                                                  const std::string& devpath) {
+    return [action, subsystem, devpath](const Uevent& event) {
+        return action == event.action && subsystem == event.subsystem && starts_with(event.devpath, devpath);
+    };
+}
+
+std::string UeventListener::get_devpath(const std::string& sysfs_path) {
+    std::string devpath = starts_with(sysfs_path, SYSFS_ROOT) ? sysfs_path.substr(sizeof(SYSFS_ROOT) - 1)
+                                                             : sysfs_path;
+    while (!devpath.empty() && '/' == devpath.back()) {
+        devpath.pop_back();
+    }
+    return devpath;
+}
+
+std::string UeventListener::get_bridge_devpath(const std::string& switch_bridge_path, std::uint8_t bus_num,
+                                               std::uint8_t device_num) {
+    const auto devpath = get_devpath(switch_bridge_path);
+    // domain of the downstream bridges is the same as domain of the switch: dddd:bb:dd.f
+    const auto name = devpath.substr(devpath.find_last_of('/') + 1);
+    std::stringstream str{};
+    str << devpath << "/" << name.substr(0, name.find(':')) << ":" << std::hex << std::setfill('0')
+        << std::setw(2) << unsigned(bus_num) << ":" << std::setw(2) << unsigned(device_num) << ".";
+    return str.str();
+}
@@ -31,6 +31,7 @@
 #include "agent-framework/module/common_components.hpp"
 #include "agent-framework/module/pnc_components.hpp"
 #include "i2c/gas_i2c_access_interface.hpp"
+#include "json/json.hpp"
 
 #include <chrono>
 #include <thread>
@@ -64,9 +65,38 @@ uint8_t reverse_byte(uint8_t lsb_byte) {
 }
 
 
+std::mutex GasTool::m_binding_mutex{};
+
+
+BindingCache GasTool::m_binding_cache{};
+
+
 GasTool::~GasTool() {}
 
 
+GasTool::BindingLock GasTool::lock_bindings() {
+    return BindingLock{m_binding_mutex};
+}
+
+
+BindingCache& GasTool::get_binding_cache() {
+    return m_binding_cache;
+}
+
+
+void GasTool::configure_binding_cache(const json::Value& configuration) {
+    try {
+        const auto& cache = configuration["bindingCache"];
+        if (cache.is_object() && cache["maxAge"].is_uint()) {
+            m_binding_cache.set_max_age(std::chrono::seconds{cache["maxAge"].as_uint()});
+        }
+    }
+    catch (const json::Value::Exception& e) {
+        log_error(GET_LOGGER("gas-tool"), "Cannot parse binding cache settings: " << e.what());
+    }
+}
+
+
 bool GasTool::read_csr_for_usp_port(std::uint8_t partition_id, GlobalAddressSpaceRegisters& gas) const {
     try {
         // get partition configuration
@@ -116,6 +146,47 @@ PartitionBindingInfo GasTool::get_partition_binding_info(const GlobalAddressSpac
 }
 
 
+PortBindingInfo GasTool::get_cached_port_binding_info(const GlobalAddressSpaceRegisters& gas,
+                                                      uint8_t port_id) const {
+    PortBindingInfo binding_info{gas.get_interface()};
+    if (m_binding_cache.get_port_binding_info(gas.get_memory_path(), port_id, binding_info)) {
+        return binding_info;
+    }
+    const auto generation = m_binding_cache.get_generation(gas.get_memory_path());
+    binding_info = this->get_port_binding_info(gas, port_id);
+    m_binding_cache.update(gas.get_memory_path(), generation, binding_info);
+    return binding_info;
+}
+
+
+PartitionBindingInfo GasTool::get_cached_partition_binding_info(const GlobalAddressSpaceRegisters& gas,
+                                                                uint8_t zone_id) const {
+    PartitionBindingInfo binding_info{gas.get_interface()};
+    if (m_binding_cache.get_partition_binding_info(gas.get_memory_path(), zone_id, binding_info)) {
+        return binding_info;
+    }
+    const auto generation = m_binding_cache.get_generation(gas.get_memory_path());
+    binding_info = this->get_partition_binding_info(gas, zone_id);
+    m_binding_cache.update(gas.get_memory_path(), generation, binding_info);
+    return binding_info;
+}
+
+
+PortBindingInfo GasTool::revalidate_binding_cache(const GlobalAddressSpaceRegisters& gas) const {
+    const auto generation = m_binding_cache.get_generation(gas.get_memory_path());
+    auto binding_info = this->get_all_port_binding_info(gas);
+    const auto mismatches = m_binding_cache.revalidate(gas.get_memory_path(), generation, binding_info);
+    for (const auto port_id : mismatches.ports) {
+        log_warning(GET_LOGGER("gas-tool"), "Cached binding of port " << unsigned(port_id) << " was stale");
+    }
+    for (const auto partition_id : mismatches.partitions) {
+        log_warning(GET_LOGGER("gas-tool"), "Cached bindings of partition " << unsigned(partition_id)
+                                                                            << " were stale");
+    }
+    return binding_info;
+}
+
+
 std::uint8_t GasTool::bridge_num_to_phys_port_id(const GlobalAddressSpaceRegisters& gas,
                                                  const std::uint8_t bridge_num) const {
 
@@ -129,7 +200,7 @@ std::uint8_t GasTool::bridge_num_to_phys_port_id(const GlobalAddressSpaceRegiste
 
     // get 'current partition' (Management partition)
     const std::uint8_t current_partition = gas.top.output.fields.current_partition_id;
-    auto binding_info = this->get_partition_binding_info(gas, current_partition);
+    auto binding_info = this->get_cached_partition_binding_info(gas, current_partition);
 
     return binding_info.output.fields.partition_binding_info[bridge_num + 1].phy_port_id;
 }
@@ -174,6 +245,7 @@ uint8_t GasTool::get_logical_bridge_for_port(const PortBindingInfo& pbi) const {
 
 void GasTool::bind_to_partition(const GlobalAddressSpaceRegisters& gas, uint8_t phys_port_id, uint8_t partition_id,
                                 uint8_t bridge_id) const {
+    BindingCache::Change change{m_binding_cache, gas.get_memory_path()};
     BindPort cmd{gas.get_interface()};
     cmd.input.fields.logical_bridge_id = bridge_id;
     cmd.input.fields.partition_id = partition_id;
@@ -214,6 +286,7 @@ void GasTool::unbind_management_host_driver(const std::string& switch_bridge_pat
 void GasTool::unbind_from_partition(const GlobalAddressSpaceRegisters& gas, uint8_t partition_id,
                                     uint8_t bridge_id) const {
 
+    BindingCache::Change change{m_binding_cache, gas.get_memory_path()};
     auto partition_info = get_partition_binding_info(gas, partition_id);
     auto port_id = partition_info.output.fields.partition_binding_info[bridge_id].phy_port_id;
     UnbindPort unbind_cmd{gas.get_interface()};
@@ -320,17 +393,21 @@ uint64_t GasTool::get_presence_bitmask(const GlobalAddressSpaceRegisters& gas) c
 void GasTool::bind_endpoint_to_zone(const GlobalAddressSpaceRegisters& gas, const std::string& zone_uuid,
                                     const std::string& endpoint_uuid) const {
     auto zone = get_manager<Zone>().get_entry(zone_uuid);
+    auto ports = get_m2m_manager<Endpoint, Port>().get_children(endpoint_uuid);
+    auto lock = lock_bindings();
+    // bindings are changed, they are read from the switch and not from the cache
     PartitionBindingInfo part_bi = this->get_partition_binding_info(gas, zone.get_zone_id());
-    uint8_t free_bridges = get_available_bridges_count(part_bi);
     // throw exception if not enough bridges are available
-    if (free_bridges < get_m2m_manager<Endpoint, Port>().get_children(endpoint_uuid).size()) {
+    if (get_available_bridges_count(part_bi) < ports.size()) {
         THROW(agent_framework::exceptions::PncError, "agent",
               "Not enough empty bridges available in the zone");
     }
-    auto ports = get_m2m_manager<Endpoint, Port>().get_children(endpoint_uuid);
-    for (const auto& port_uuid : ports) {
-        Port port = get_manager<Port>().get_entry(port_uuid);
-        PortBindingInfo port_bi = this->get_port_binding_info(gas, uint8_t(port.get_phys_port_id()));
+    for (auto it = ports.cbegin(); it != ports.cend(); ++it) {
+        Port port = get_manager<Port>().get_entry(*it);
+        // bridges of the zone are changed by each binding
+        if (ports.cbegin() != it) {
+            part_bi = this->get_partition_binding_info(gas, zone.get_zone_id());
+        }
         this->bind_to_partition(gas, uint8_t(port.get_phys_port_id()), zone.get_zone_id(),
                                 this->get_available_bridge_id(part_bi));
     }
@@ -343,6 +420,7 @@ void GasTool::unbind_endpoint_from_zone(const GlobalAddressSpaceRegisters& gas,
     auto ports = get_m2m_manager<Endpoint, Port>().get_children(endpoint_uuid);
     for (const auto& port_uuid : ports) {
         Port port = get_manager<Port>().get_entry(port_uuid);
+        // port may have been rebound by another host since the binding was cached, the bridge is read again
         PortBindingInfo pbi = this->get_port_binding_info(gas, uint8_t(port.get_phys_port_id()));
         this->unbind_from_partition(gas, pbi.output.fields.port_binding_info[0].partition_id,
                                     pbi.output.fields.port_binding_info[0].logical_bridge_id);
@@ -363,6 +441,7 @@ void GasTool::bind_drive_to_mgmt_partition(ModelToolPtr mtool, GlobalAddressSpac
     }
     auto port = get_manager<Port>().get_entry(ports[0]);
 
+    auto lock = lock_bindings();
     PartitionBindingInfo part_bi = this->get_partition_binding_info(gas, gas.top.output.fields.current_partition_id);
     uint8_t bridge_id = this->get_available_bridge_id(part_bi);
 
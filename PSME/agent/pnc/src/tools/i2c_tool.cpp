@@ -108,6 +108,53 @@ bool I2cTool::get_firmware_version(FirmwareVersion& fw, const Port& port) const
     }
 }
 
+namespace {
+
+DriveLocation get_drive_location(const Port& port) {
+    return DriveLocation{static_cast<PM85X6TwiPort>(port.get_twi_port()),
+                         static_cast<PCA9548TwiExpanderChannel>(port.get_twi_channel())};
+}
+
+}
+
+bool I2cTool::get_drive_telemetry(DriveTelemetry& telemetry, const Port& port) const {
+    try {
+        m_drive_telemetry->collect(I2cAccessInterfaceFactory::get_instance().get_interface(),
+            get_drive_location(port), telemetry);
+    }
+    catch (const std::exception& e) {
+        log_debug(GET_LOGGER("i2c-tool"), "Reading telemetry for drive on port " << port.get_port_id() <<
+            " failed: " << e.what());
+        telemetry = DriveTelemetry{telemetry.get_platform()};
+    }
+    if (!telemetry.is_valid()) {
+        log_error(GET_LOGGER("i2c-tool"), "Cannot read telemetry for drive.");
+        return false;
+    }
+    return true;
+}
+
+bool I2cTool::get_cached_drive_telemetry(DriveTelemetry& telemetry, const Port& port) const {
+    try {
+        m_drive_telemetry->get(I2cAccessInterfaceFactory::get_instance().get_interface(),
+            get_drive_location(port), telemetry);
+    }
+    catch (const std::exception& e) {
+        log_debug(GET_LOGGER("i2c-tool"), "Reading Smart for drive on port " << port.get_port_id() <<
+            " failed: " << e.what());
+        telemetry.is_smart_valid = false;
+    }
+    if (!telemetry.is_smart_valid) {
+        log_error(GET_LOGGER("i2c-tool"), "Cannot read Smart for drive.");
+        return false;
+    }
+    return true;
+}
+
+void I2cTool::invalidate_drive_telemetry(const Port& port) const {
+    m_drive_telemetry->invalidate(get_drive_location(port));
+}
+
 bool I2cTool::get_fru_eeprom(FruEeprom& fru_eeprom) const {
     try {
         fru_eeprom.read(I2cAccessInterfaceFactory::get_instance().get_interface());
@@ -201,6 +201,125 @@ void update_pcie_function_in_relations(const std::string& pcie_function_temporar
                                                                              pcie_function_persistent_uuid);
 }
 
+
+namespace {
+
+bool update_uuid(const UuidMap& uuids, std::string& uuid) {
+    const auto it = uuids.find(uuid);
+    if (uuids.end() == it) {
+        return false;
+    }
+    uuid = it->second;
+    return true;
+}
+
+}
+
+
+void update_relations(const UuidMap& uuids) {
+    if (uuids.empty()) {
+        return;
+    }
+
+    PncComponents::get_instance()->get_zone_manager().modify_entries([&uuids](Zone& zone) {
+        std::string switch_uuid = zone.get_switch_uuid();
+        if (update_uuid(uuids, switch_uuid)) {
+            zone.set_switch_uuid(switch_uuid);
+            return true;
+        }
+        return false;
+    });
+
+    PncComponents::get_instance()->get_endpoint_manager().modify_entries([&uuids](Endpoint& endpoint) {
+        Endpoint::ConnectedEntities connected_entities = endpoint.get_connected_entities();
+        bool updated{false};
+        for (auto& connected_entity : connected_entities) {
+            if (!connected_entity.get_entity().has_value()) {
+                continue;
+            }
+            std::string entity = connected_entity.get_entity().value();
+            if (update_uuid(uuids, entity)) {
+                connected_entity.set_entity(entity);
+                updated = true;
+            }
+        }
+        if (updated) {
+            endpoint.set_connected_entities(connected_entities);
+        }
+        return updated;
+    });
+
+    PncComponents::get_instance()->get_pcie_function_manager().modify_entries([&uuids](PcieFunction& function) {
+        bool updated{false};
+        std::string dsp_port_uuid = function.get_dsp_port_uuid();
+        if (update_uuid(uuids, dsp_port_uuid)) {
+            function.set_dsp_port_uuid(dsp_port_uuid);
+            updated = true;
+        }
+        if (function.get_functional_device().has_value()) {
+            std::string functional_device = function.get_functional_device().value();
+            if (update_uuid(uuids, functional_device)) {
+                function.set_functional_device(functional_device);
+                updated = true;
+            }
+        }
+        return updated;
+    });
+
+    CommonComponents::get_instance()->get_drive_manager().modify_entries([&uuids](Drive& drive) {
+        std::vector<std::string> dsp_port_uuids = drive.get_dsp_port_uuids();
+        bool updated{false};
+        for (auto& dsp_port_uuid : dsp_port_uuids) {
+            updated = update_uuid(uuids, dsp_port_uuid) || updated;
+        }
+        if (updated) {
+            drive.set_dsp_port_uuids(dsp_port_uuids);
+        }
+        return updated;
+    });
+
+    PncComponents::get_instance()->get_switch_manager().modify_entries([&uuids](Switch& pcie_switch) {
+        if (!pcie_switch.get_chassis().has_value()) {
+            return false;
+        }
+        std::string chassis_uuid = pcie_switch.get_chassis().value();
+        if (update_uuid(uuids, chassis_uuid)) {
+            pcie_switch.set_chassis(chassis_uuid);
+            return true;
+        }
+        return false;
+    });
+
+    CommonComponents::get_instance()->get_system_manager().modify_entries([&uuids](System& system) {
+        if (!system.get_chassis().has_value()) {
+            return false;
+        }
+        std::string chassis_uuid = system.get_chassis().value();
+        if (update_uuid(uuids, chassis_uuid)) {
+            system.set_chassis(chassis_uuid);
+            return true;
+        }
+        return false;
+    });
+
+    PncComponents::get_instance()->get_pcie_device_manager().modify_entries([&uuids](PcieDevice& device) {
+        if (!device.get_chassis().has_value()) {
+            return false;
+        }
+        std::string chassis_uuid = device.get_chassis().value();
+        if (update_uuid(uuids, chassis_uuid)) {
+            device.set_chassis(chassis_uuid);
+            return true;
+        }
+        return false;
+    });
+
+    PncComponents::get_instance()->get_zone_endpoint_manager().update_uuids(uuids);
+    PncComponents::get_instance()->get_endpoint_port_manager().update_uuids(uuids);
+    PncComponents::get_instance()->get_drive_function_manager().update_uuids(uuids);
+    CommonComponents::get_instance()->get_storage_subsystem_drives_manager().update_uuids(uuids);
+}
+
 }
 }
 }
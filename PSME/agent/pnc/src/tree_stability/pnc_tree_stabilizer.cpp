@@ -31,8 +31,10 @@
 #include "agent-framework/module/common_components.hpp"
 
 #include <algorithm>
+#include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 
@@ -48,7 +50,59 @@ using namespace agent::pnc;
 PncTreeStabilizer::~PncTreeStabilizer() {}
 
 
-const std::string PncTreeStabilizer::stabilize_storage_subsystem(const std::string& in_subsystem_uuid) const {
+namespace {
+
+model::Switch find_switch(const std::vector<model::Switch>& switches, const std::string& switch_uuid) {
+    const auto it = std::find_if(switches.begin(), switches.end(), [&switch_uuid](const model::Switch& pcie_switch) {
+        return pcie_switch.get_uuid() == switch_uuid || pcie_switch.get_temporary_uuid() == switch_uuid;
+    });
+    if (switches.end() != it) {
+        return *it;
+    }
+    return get_manager<model::Switch>().get_entry(switch_uuid);
+}
+
+}
+
+
+template<typename T>
+const std::string PncTreeStabilizer::stabilize_resource(const std::string& resource_uuid,
+                                                        agent_framework::module::GenericManager<T>& manager,
+                                                        const std::string& unique_key,
+                                                        helpers::UuidMap& uuids) const {
+    std::string persistent_uuid{};
+    bool generated{false};
+    {
+        // Key generated from the same attributes as before still gives the same persistent UUID
+        auto resource = manager.get_entry_reference(resource_uuid);
+        if (!resource->has_persistent_uuid() || !resource->get_unique_key().has_value() ||
+            resource->get_unique_key().value() != unique_key) {
+            resource->set_unique_key(unique_key);
+            resource->make_persistent_uuid();
+            generated = true;
+        }
+        persistent_uuid = resource->get_uuid();
+    }
+    if (generated) {
+        log_persistent_uuid_generated(T::get_component().to_string(), resource_uuid, persistent_uuid);
+    }
+    if (persistent_uuid != resource_uuid) {
+        uuids[resource_uuid] = persistent_uuid;
+    }
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_storage_subsystem(const std::string& subsystem_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_storage_subsystem(subsystem_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_storage_subsystem(const std::string& in_subsystem_uuid,
+                                                                 helpers::UuidMap& uuids) const {
     auto& storage_subsystem_manager = get_manager<model::StorageSubsystem>();
     auto subsystem = storage_subsystem_manager.get_entry(in_subsystem_uuid);
     std::string subsystem_uuid{in_subsystem_uuid};
@@ -56,11 +110,8 @@ const std::string PncTreeStabilizer::stabilize_storage_subsystem(const std::stri
     try {
         const std::string& subsystem_unique_key = PncKeyGenerator::generate_key<model::StorageSubsystem>(subsystem);
 
-        subsystem_uuid = stabilize_single_resource(in_subsystem_uuid,
-                                                   storage_subsystem_manager,
-                                                   subsystem_unique_key);
-
-        helpers::update_storage_subsystem_in_relations(in_subsystem_uuid, subsystem_uuid);
+        subsystem_uuid = stabilize_resource(in_subsystem_uuid, storage_subsystem_manager,
+                                            subsystem_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(agent_framework::model::StorageSubsystem::get_component().to_string(), in_subsystem_uuid);
@@ -70,7 +121,16 @@ const std::string PncTreeStabilizer::stabilize_storage_subsystem(const std::stri
 }
 
 
-const std::string PncTreeStabilizer::stabilize_system(const std::string& in_system_uuid) const {
+const std::string PncTreeStabilizer::stabilize_system(const std::string& system_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_system(system_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_system(const std::string& in_system_uuid,
+                                                      helpers::UuidMap& uuids) const {
     auto& system_manager = get_manager<model::System>();
     const auto& system = system_manager.get_entry(in_system_uuid);
     std::string system_uuid{in_system_uuid};
@@ -80,11 +140,10 @@ const std::string PncTreeStabilizer::stabilize_system(const std::string& in_syst
         auto& storage_subsystem_manager = get_manager<model::StorageSubsystem>();
         const auto storage_subsystem_uuid = storage_subsystem_manager.get_keys(in_system_uuid).front();
 
-        system_uuid = stabilize_single_resource(system_uuid, system_manager,
-                                                system_unique_key);
+        system_uuid = stabilize_resource(system_uuid, system_manager, system_unique_key, uuids);
 
         storage_subsystem_manager.get_entry_reference(storage_subsystem_uuid)->set_parent_uuid(system_uuid);
-        stabilize_storage_subsystem(storage_subsystem_uuid);
+        stabilize_storage_subsystem(storage_subsystem_uuid, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(agent_framework::model::System::get_component().to_string(), in_system_uuid);
@@ -94,19 +153,27 @@ const std::string PncTreeStabilizer::stabilize_system(const std::string& in_syst
 }
 
 
-const std::string PncTreeStabilizer::stabilize_pcie_function(const std::string& in_function_uuid) const {
+const std::string PncTreeStabilizer::stabilize_pcie_function(const std::string& function_uuid) const {
+    const auto& function = get_manager<model::PcieFunction>().get_entry(function_uuid);
+    const auto& parent_device = get_manager<model::PcieDevice>().get_entry(function.get_parent_uuid());
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_pcie_function(function_uuid, parent_device, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_pcie_function(const std::string& in_function_uuid,
+                                                             const model::PcieDevice& parent_device,
+                                                             helpers::UuidMap& uuids) const {
     auto& function_manager = get_manager<model::PcieFunction>();
     const auto& function = function_manager.get_entry(in_function_uuid);
-    const auto& parent_device = get_manager<model::PcieDevice>().get_entry(function.get_parent_uuid());
     std::string function_uuid{in_function_uuid};
 
     try {
         const std::string& function_unique_key = PncKeyGenerator::generate_key(function, parent_device);
 
-        function_uuid = stabilize_single_resource(function_uuid, function_manager,
-                                                  function_unique_key);
-
-        helpers::update_pcie_function_in_relations(in_function_uuid, function_uuid);
+        function_uuid = stabilize_resource(function_uuid, function_manager, function_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(agent_framework::model::PcieFunction::get_component().to_string(), in_function_uuid);
@@ -116,7 +183,16 @@ const std::string PncTreeStabilizer::stabilize_pcie_function(const std::string&
 }
 
 
-const std::string PncTreeStabilizer::stabilize_pcie_device(const std::string& in_device_uuid) const {
+const std::string PncTreeStabilizer::stabilize_pcie_device(const std::string& device_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_pcie_device(device_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_pcie_device(const std::string& in_device_uuid,
+                                                           helpers::UuidMap& uuids) const {
     auto& device_manager = get_manager<model::PcieDevice>();
     const auto& device = device_manager.get_entry(in_device_uuid);
     std::string device_uuid{in_device_uuid};
@@ -125,12 +201,11 @@ const std::string PncTreeStabilizer::stabilize_pcie_device(const std::string& in
         const std::string& device_unique_key = PncKeyGenerator::generate_key(device);
         auto& function_manager = get_manager<model::PcieFunction>();
 
-        device_uuid = stabilize_single_resource(device_uuid, device_manager,
-                                                device_unique_key);
+        device_uuid = stabilize_resource(device_uuid, device_manager, device_unique_key, uuids);
 
         for (const auto& function_uuid : function_manager.get_keys(in_device_uuid)) {
             function_manager.get_entry_reference(function_uuid)->set_parent_uuid(device_uuid);
-            stabilize_pcie_function(function_uuid);
+            stabilize_pcie_function(function_uuid, device, uuids);
         }
 
     }
@@ -142,7 +217,16 @@ const std::string PncTreeStabilizer::stabilize_pcie_device(const std::string& in
 }
 
 
-const std::string PncTreeStabilizer::stabilize_drive(const std::string& in_drive_uuid) const {
+const std::string PncTreeStabilizer::stabilize_drive(const std::string& drive_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_drive(drive_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_drive(const std::string& in_drive_uuid,
+                                                     helpers::UuidMap& uuids) const {
     auto& drive_manager = get_manager<model::Drive>();
     const auto& drive = drive_manager.get_entry(in_drive_uuid);
     std::string drive_uuid{in_drive_uuid};
@@ -150,10 +234,7 @@ const std::string PncTreeStabilizer::stabilize_drive(const std::string& in_drive
     try {
         const std::string& drive_unique_key = PncKeyGenerator::generate_key(drive);
 
-        drive_uuid = stabilize_single_resource(drive_uuid, drive_manager,
-                                               drive_unique_key);
-
-        helpers::update_pcie_drive_in_relations(in_drive_uuid, drive_uuid);
+        drive_uuid = stabilize_resource(drive_uuid, drive_manager, drive_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(drive.get_component().to_string(), in_drive_uuid);
@@ -163,7 +244,16 @@ const std::string PncTreeStabilizer::stabilize_drive(const std::string& in_drive
 }
 
 
-const std::string PncTreeStabilizer::stabilize_chassis(const std::string& in_chassis_uuid) const {
+const std::string PncTreeStabilizer::stabilize_chassis(const std::string& chassis_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_chassis(chassis_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_chassis(const std::string& in_chassis_uuid,
+                                                       helpers::UuidMap& uuids) const {
     auto& chassis_manager = get_manager<model::Chassis>();
     const auto& chassis = chassis_manager.get_entry(in_chassis_uuid);
     std::string chassis_uuid{in_chassis_uuid};
@@ -183,14 +273,11 @@ const std::string PncTreeStabilizer::stabilize_chassis(const std::string& in_cha
         const std::string& chassis_unique_key = PncKeyGenerator::generate_key(chassis, pcie_switch);
         auto& drive_manager = get_manager<model::Drive>();
 
-        chassis_uuid = stabilize_single_resource(chassis_uuid, chassis_manager,
-                                                 chassis_unique_key);
-
-        helpers::update_chassis_in_relations(in_chassis_uuid, chassis_uuid);
+        chassis_uuid = stabilize_resource(chassis_uuid, chassis_manager, chassis_unique_key, uuids);
 
         for (const auto& drive_uuid : drive_manager.get_keys(in_chassis_uuid)) {
             drive_manager.get_entry_reference(drive_uuid)->set_parent_uuid(chassis_uuid);
-            stabilize_drive(drive_uuid);
+            stabilize_drive(drive_uuid, uuids);
         }
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
@@ -201,7 +288,16 @@ const std::string PncTreeStabilizer::stabilize_chassis(const std::string& in_cha
 }
 
 
-const std::string PncTreeStabilizer::stabilize_fabric(const std::string& in_fabric_uuid) const {
+const std::string PncTreeStabilizer::stabilize_fabric(const std::string& fabric_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_fabric(fabric_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_fabric(const std::string& in_fabric_uuid,
+                                                      helpers::UuidMap& uuids) const {
     auto& fabric_manager = get_manager<model::Fabric>();
     const auto& fabric = fabric_manager.get_entry(in_fabric_uuid);
     std::string fabric_uuid{in_fabric_uuid};
@@ -209,25 +305,44 @@ const std::string PncTreeStabilizer::stabilize_fabric(const std::string& in_fabr
     try {
         const std::string& fabric_unique_key = PncKeyGenerator::generate_key(fabric);
         auto& switch_manager = get_manager<model::Switch>();
+        auto& ports_manager = get_manager<model::Port>();
         auto& zones_manager = get_manager<model::Zone>();
         auto& endpoints_manager = get_manager<model::Endpoint>();
+        auto& endpoint_port_manager = get_m2m_manager<model::Endpoint, model::Port>();
 
-        fabric_uuid = stabilize_single_resource(fabric_uuid, fabric_manager,
-                                                fabric_unique_key);
+        fabric_uuid = stabilize_resource(fabric_uuid, fabric_manager, fabric_unique_key, uuids);
 
+        std::vector<model::Switch> switches{};
         for (const auto& switch_uuid : switch_manager.get_keys(in_fabric_uuid)) {
             switch_manager.get_entry_reference(switch_uuid)->set_parent_uuid(fabric_uuid);
-            stabilize_pcie_switch(switch_uuid);
+            stabilize_pcie_switch(switch_uuid, uuids);
+            switches.push_back(switch_manager.get_entry(switch_uuid));
         }
 
         for (const auto& zone_uuid : zones_manager.get_keys(in_fabric_uuid)) {
             zones_manager.get_entry_reference(zone_uuid)->set_parent_uuid(fabric_uuid);
-            stabilize_pcie_zone(zone_uuid);
+            stabilize_pcie_zone(zone_uuid, find_switch(switches, zones_manager.get_entry(zone_uuid).get_switch_uuid()),
+                                uuids);
+        }
+
+        // Ports are read once, endpoint keys are generated from the port keys set above
+        std::map<std::string, model::Port> ports{};
+        for (const auto& pcie_switch : switches) {
+            for (const auto& port_uuid : ports_manager.get_keys(pcie_switch.get_uuid())) {
+                auto port = ports_manager.get_entry(port_uuid);
+                ports.emplace(port.get_temporary_uuid(), port);
+                ports.emplace(port_uuid, std::move(port));
+            }
         }
 
         for (const auto& endpoint_uuid : endpoints_manager.get_keys(in_fabric_uuid)) {
             endpoints_manager.get_entry_reference(endpoint_uuid)->set_parent_uuid(fabric_uuid);
-            stabilize_pcie_endpoint(endpoint_uuid);
+            std::vector<model::Port> endpoint_ports{};
+            for (const auto& port_uuid : endpoint_port_manager.get_children(endpoint_uuid)) {
+                const auto it = ports.find(port_uuid);
+                endpoint_ports.push_back(ports.end() != it ? it->second : ports_manager.get_entry(port_uuid));
+            }
+            stabilize_pcie_endpoint(endpoint_uuid, endpoint_ports, uuids);
         }
 
     }
@@ -239,7 +354,16 @@ const std::string PncTreeStabilizer::stabilize_fabric(const std::string& in_fabr
 }
 
 
-const std::string PncTreeStabilizer::stabilize_pcie_switch(const std::string& in_switch_uuid) const {
+const std::string PncTreeStabilizer::stabilize_pcie_switch(const std::string& switch_uuid) const {
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_pcie_switch(switch_uuid, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_pcie_switch(const std::string& in_switch_uuid,
+                                                           helpers::UuidMap& uuids) const {
     auto& switch_manager = get_manager<model::Switch>();
     const auto& pcie_switch = switch_manager.get_entry(in_switch_uuid);
     std::string switch_uuid{in_switch_uuid};
@@ -248,14 +372,11 @@ const std::string PncTreeStabilizer::stabilize_pcie_switch(const std::string& in
         const std::string& switch_unique_key = PncKeyGenerator::generate_key(pcie_switch);
         auto& ports_manager = get_manager<model::Port>();
 
-        switch_uuid = stabilize_single_resource(switch_uuid, switch_manager,
-                                                switch_unique_key);
-
-        helpers::update_pcie_switch_in_relations(in_switch_uuid, switch_uuid);
+        switch_uuid = stabilize_resource(switch_uuid, switch_manager, switch_unique_key, uuids);
 
         for (const auto& port_uuid : ports_manager.get_keys(in_switch_uuid)) {
             ports_manager.get_entry_reference(port_uuid)->set_parent_uuid(switch_uuid);
-            stabilize_port(port_uuid);
+            stabilize_port(port_uuid, pcie_switch, uuids);
         }
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
@@ -266,20 +387,27 @@ const std::string PncTreeStabilizer::stabilize_pcie_switch(const std::string& in
 }
 
 
-const std::string PncTreeStabilizer::stabilize_port(const std::string& in_port_uuid) const {
+const std::string PncTreeStabilizer::stabilize_port(const std::string& port_uuid) const {
+    const auto& port = get_manager<model::Port>().get_entry(port_uuid);
+    const auto& parent_switch = get_manager<model::Switch>().get_entry(port.get_parent_uuid());
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_port(port_uuid, parent_switch, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_port(const std::string& in_port_uuid,
+                                                    const model::Switch& parent_switch,
+                                                    helpers::UuidMap& uuids) const {
     auto& ports_manager = get_manager<model::Port>();
     const auto& port = ports_manager.get_entry(in_port_uuid);
-    const auto& parent_switch = get_manager<model::Switch>().get_entry(port.get_parent_uuid());
     std::string port_uuid{in_port_uuid};
 
     try {
         const auto& port_unique_key = PncKeyGenerator::generate_key(port, parent_switch);
 
-        port_uuid = stabilize_single_resource(port_uuid, ports_manager,
-                                              port_unique_key);
-
-        helpers::update_pcie_port_in_relations(in_port_uuid, port_uuid);
-
+        port_uuid = stabilize_resource(port_uuid, ports_manager, port_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(port.get_component().to_string(), in_port_uuid);
@@ -289,18 +417,27 @@ const std::string PncTreeStabilizer::stabilize_port(const std::string& in_port_u
 }
 
 
-const std::string PncTreeStabilizer::stabilize_pcie_zone(const std::string& in_zone_uuid) const {
+const std::string PncTreeStabilizer::stabilize_pcie_zone(const std::string& zone_uuid) const {
+    const auto& zone = get_manager<model::Zone>().get_entry(zone_uuid);
+    const auto& parent_switch = get_manager<model::Switch>().get_entry(zone.get_switch_uuid());
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_pcie_zone(zone_uuid, parent_switch, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_pcie_zone(const std::string& in_zone_uuid,
+                                                         const model::Switch& parent_switch,
+                                                         helpers::UuidMap& uuids) const {
     auto& zones_manager = get_manager<model::Zone>();
     const auto& zone = zones_manager.get_entry(in_zone_uuid);
-    const auto& parent_switch = get_manager<model::Switch>().get_entry(zone.get_switch_uuid());
     std::string zone_uuid{in_zone_uuid};
 
     try {
         const std::string& zone_unique_key = PncKeyGenerator::generate_key(zone, parent_switch);
 
-        zone_uuid = stabilize_single_resource(zone_uuid, zones_manager, zone_unique_key);
-
-        helpers::update_pcie_zone_in_relations(in_zone_uuid, zone_uuid);
+        zone_uuid = stabilize_resource(zone_uuid, zones_manager, zone_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(zone.get_component().to_string(), in_zone_uuid);
@@ -310,24 +447,32 @@ const std::string PncTreeStabilizer::stabilize_pcie_zone(const std::string& in_z
 }
 
 
-const std::string PncTreeStabilizer::stabilize_pcie_endpoint(const std::string& in_endpoint_uuid) const {
+const std::string PncTreeStabilizer::stabilize_pcie_endpoint(const std::string& endpoint_uuid) const {
+    auto& ports_manager = get_manager<model::Port>();
+    std::vector<model::Port> endpoint_ports{};
+
+    for (const auto& port_uuid : get_m2m_manager<model::Endpoint, model::Port>().get_children(endpoint_uuid)) {
+        endpoint_ports.push_back(ports_manager.get_entry(port_uuid));
+    }
+
+    helpers::UuidMap uuids{};
+    const auto persistent_uuid = stabilize_pcie_endpoint(endpoint_uuid, endpoint_ports, uuids);
+    helpers::update_relations(uuids);
+    return persistent_uuid;
+}
+
+
+const std::string PncTreeStabilizer::stabilize_pcie_endpoint(const std::string& in_endpoint_uuid,
+                                                             const std::vector<model::Port>& endpoint_ports,
+                                                             helpers::UuidMap& uuids) const {
     auto& endpoints_manager = get_manager<model::Endpoint>();
     const auto& endpoint = endpoints_manager.get_entry(in_endpoint_uuid);
     std::string endpoint_uuid{in_endpoint_uuid};
 
     try {
-        auto& ports_manager = get_manager<model::Port>();
-        std::vector<model::Port> endpoint_ports{};
-
-        for (const auto& port_uuid : get_m2m_manager<model::Endpoint, model::Port>().get_children(in_endpoint_uuid)) {
-            endpoint_ports.push_back(ports_manager.get_entry(port_uuid));
-        }
-
         const std::string& endpoint_unique_key = PncKeyGenerator::generate_key(endpoint, endpoint_ports);
 
-        endpoint_uuid = stabilize_single_resource(endpoint_uuid, endpoints_manager, endpoint_unique_key);
-
-        helpers::update_pcie_endpoint_in_relations(in_endpoint_uuid, endpoint_uuid);
+        endpoint_uuid = stabilize_resource(endpoint_uuid, endpoints_manager, endpoint_unique_key, uuids);
     }
     catch (const PncKeyGenerator::KeyValueMissingError&) {
         log_key_value_missing(endpoint.get_component().to_string(), in_endpoint_uuid);
@@ -343,6 +488,7 @@ const std::string PncTreeStabilizer::stabilize(const std::string& in_module_uuid
     auto& module_manager = get_manager<model::Manager>();
     const auto& manager = module_manager.get_entry(in_module_uuid);
     std::string module_uuid{in_module_uuid};
+    helpers::UuidMap uuids{};
 
     try {
         auto& fabrics_manager = get_manager<model::Fabric>();
@@ -359,26 +505,30 @@ const std::string PncTreeStabilizer::stabilize(const std::string& in_module_uuid
         const auto& managed_switch = switch_manager.get_entry(switch_keys.front());
         const std::string& module_unique_key = PncKeyGenerator::generate_key(manager, managed_switch);
 
-        module_uuid = stabilize_single_resource(module_uuid, module_manager, module_unique_key);
+        module_uuid = stabilize_resource(module_uuid, module_manager, module_unique_key, uuids);
 
         for (const auto& chassis_uuid : chassis_manager.get_keys(in_module_uuid)) {
             chassis_manager.get_entry_reference(chassis_uuid)->set_parent_uuid(module_uuid);
-            stabilize_chassis(chassis_uuid);
+            stabilize_chassis(chassis_uuid, uuids);
         }
 
+        // Endpoint keys are generated from connected drives, their UUIDs have to be persistent
+        helpers::update_relations(uuids);
+        uuids.clear();
+
         for (const auto& fabric_uuid : fabrics_manager.get_keys(in_module_uuid)) {
             fabrics_manager.get_entry_reference(fabric_uuid)->set_parent_uuid(module_uuid);
-            stabilize_fabric(fabric_uuid);
+            stabilize_fabric(fabric_uuid, uuids);
         }
 
         for (const auto& system_uuid : systems_manager.get_keys(in_module_uuid)) {
             systems_manager.get_entry_reference(system_uuid)->set_parent_uuid(module_uuid);
-            stabilize_system(system_uuid);
+            stabilize_system(system_uuid, uuids);
         }
 
         for (const auto& device_uuid : devices_manager.get_keys(in_module_uuid)) {
             devices_manager.get_entry_reference(device_uuid)->set_parent_uuid(module_uuid);
-            stabilize_pcie_device(device_uuid);
+            stabilize_pcie_device(device_uuid, uuids);
         }
 
     }
@@ -386,5 +536,7 @@ const std::string PncTreeStabilizer::stabilize(const std::string& in_module_uuid
         log_key_value_missing(agent_framework::model::Manager::get_component().to_string(), in_module_uuid);
     }
 
+    helpers::update_relations(uuids);
+
     return module_uuid;
 }
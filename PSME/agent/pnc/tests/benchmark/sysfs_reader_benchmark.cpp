@@ -0,0 +1,336 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file sysfs_reader_benchmark.cpp
+ *
+ * @brief Benchmark of the PCI device discovery in sysfs.
+ *
+ * A synthetic sysfs tree (root port, switch, downstream bridges, NVMe functions
+ * and their namespaces) is created in a temporary directory and libsysfs is pointed
+ * to it with the SYSFS_PATH variable. Full SysfsReader discovery is timed, as well
+ * as matching of block devices to PCI devices alone: per device regular expressions
+ * (the previous implementation) against the single pass index.
+ *
+ * Usage: psme-pnc-sysfs-benchmark [--functions=N] [--namespaces=N] [--iterations=N]
+ * */
+
+#include "sysfs/sysfs_reader.hpp"
+
+#include <ftw.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace agent::pnc::sysfs;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*! PCI functions per downstream bridge */
+constexpr unsigned FUNCTIONS_PER_BRIDGE = 8;
+constexpr unsigned FIRST_FUNCTION_BUS = 4;
+
+struct Options {
+    unsigned functions{256};
+    unsigned namespaces{256};
+    unsigned iterations{20};
+};
+
+/*! @brief Synthetic sysfs tree, removed in destructor */
+class SyntheticSysfs {
+public:
+    explicit SyntheticSysfs(const Options& options) {
+        char root_template[] = "/tmp/pnc-sysfs-XXXXXX";
+        if (nullptr == ::mkdtemp(root_template)) {
+            throw std::runtime_error("Cannot create temporary directory");
+        }
+        m_root = root_template;
+        try {
+            build(options);
+        }
+        catch (...) {
+            remove();
+            throw;
+        }
+    }
+
+    ~SyntheticSysfs() {
+        remove();
+    }
+
+    SyntheticSysfs(const SyntheticSysfs&) = delete;
+    SyntheticSysfs& operator=(const SyntheticSysfs&) = delete;
+
+    const std::string& get_root() const {
+        return m_root;
+    }
+
+    /*! Names of NVMe functions */
+    const std::vector<std::string>& get_functions() const {
+        return m_functions;
+    }
+
+    /*! Names of all PCI devices (bridges and functions) */
+    const std::vector<std::string>& get_pci_devices() const {
+        return m_pci_devices;
+    }
+
+    /*! Resolved paths of all block devices */
+    const std::vector<std::string>& get_block_paths() const {
+        return m_block_paths;
+    }
+
+private:
+    static std::string pci_name(unsigned bus, unsigned device, unsigned function) {
+        std::stringstream str{};
+        str << "0000:" << std::hex << std::setfill('0') << std::setw(2) << bus << ":"
+            << std::setw(2) << device << "." << function;
+        return str.str();
+    }
+
+    static void make_dir(const std::string& path) {
+        if (0 != ::mkdir(path.c_str(), 0755)) {
+            throw std::runtime_error("Cannot create " + path);
+        }
+    }
+
+    static void write_file(const std::string& path, const std::string& content) {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        if (!file) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }
+
+    static void make_link(const std::string& target, const std::string& path) {
+        if (0 != ::symlink(target.c_str(), path.c_str())) {
+            throw std::runtime_error("Cannot create link " + path);
+        }
+    }
+
+    std::string add_pci_device(const std::string& parent, const std::string& name) {
+        const auto path = parent + "/" + name;
+        make_dir(path);
+        // vendor/device ids, the rest of the configuration space is not decoded by the reader
+        std::string config(RawSysfsDevice::PCI_CONFIGURATION_SPACE_SIZE, '\0');
+        config[0] = '\xf8';
+        config[1] = '\x11';
+        write_file(path + "/config", config);
+        make_link(path, m_root + "/bus/pci/devices/" + name);
+        m_pci_devices.push_back(name);
+        return path;
+    }
+
+    void build(const Options& options) {
+        for (const auto& dir : {"/devices", "/devices/pci0000:00", "/bus", "/bus/pci", "/bus/pci/devices",
+                                "/class", "/class/block"}) {
+            make_dir(m_root + dir);
+        }
+        const auto root_port = add_pci_device(m_root + "/devices/pci0000:00", pci_name(0, 3, 0));
+        const auto upstream_bridge = add_pci_device(root_port, pci_name(2, 0, 0));
+
+        std::vector<std::string> function_paths{};
+        for (unsigned i = 0; i < options.functions; ++i) {
+            const unsigned bridge = i / FUNCTIONS_PER_BRIDGE;
+            const auto bridge_path = upstream_bridge + "/" + pci_name(3, bridge, 0);
+            if (0 == i % FUNCTIONS_PER_BRIDGE) {
+                add_pci_device(upstream_bridge, pci_name(3, bridge, 0));
+            }
+            const auto name = pci_name(FIRST_FUNCTION_BUS + bridge, 0, i % FUNCTIONS_PER_BRIDGE);
+            function_paths.push_back(add_pci_device(bridge_path, name));
+            m_functions.push_back(name);
+            make_dir(function_paths.back() + "/nvme");
+            make_dir(function_paths.back() + "/nvme/nvme" + std::to_string(i));
+        }
+
+        for (unsigned i = 0; i < options.namespaces && !function_paths.empty(); ++i) {
+            const unsigned function = i % options.functions;
+            const auto controller = "nvme" + std::to_string(function);
+            const auto name = controller + "n" + std::to_string(i / options.functions + 1);
+            const auto path = function_paths[function] + "/nvme/" + controller + "/" + name;
+            make_dir(path);
+            write_file(path + "/size", "2048\n");
+            make_link(path, m_root + "/class/block/" + name);
+            m_block_paths.push_back(path);
+        }
+    }
+
+    void remove() {
+        ::nftw(m_root.c_str(), [](const char* path, const struct stat*, int, struct FTW*) {
+            return ::remove(path);
+        }, 16, FTW_DEPTH | FTW_PHYS);
+    }
+
+    std::string m_root{};
+    std::vector<std::string> m_functions{};
+    std::vector<std::string> m_pci_devices{};
+    std::vector<std::string> m_block_paths{};
+};
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--functions" == name) {
+            options.functions = value;
+        }
+        else if ("--namespaces" == name) {
+            options.namespaces = value;
+        }
+        else if ("--iterations" == name) {
+            options.iterations = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.iterations || 0 == options.functions
+        || options.functions > FUNCTIONS_PER_BRIDGE * (0x100 - FIRST_FUNCTION_BUS)) {
+        throw std::invalid_argument("Invalid number of functions or iterations");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--functions=256] [--namespaces=256] [--iterations=20]" << std::endl;
+}
+
+template <typename F>
+double measure_ms(unsigned iterations, F function) {
+    const auto start = Clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        function();
+    }
+    const std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+/*! Matching of the previous implementation: a regular expression per PCI device checked on all block devices */
+std::size_t match_with_regex(const SyntheticSysfs& sysfs) {
+    std::size_t matched{0};
+    for (const auto& pci_device : sysfs.get_pci_devices()) {
+        const std::string expression = sysfs.get_root() + "/devices/pci....:../(?:....:..:..\\../)*"
+            + pci_device + "/(.*)";
+        for (const auto& path : sysfs.get_block_paths()) {
+            std::smatch matches{};
+            std::regex_match(path, matches, std::regex(expression, std::regex_constants::icase));
+            if (2 == matches.size()) {
+                ++matched;
+            }
+        }
+    }
+    return matched;
+}
+
+/*! Matching of the current implementation: block devices indexed by the PCI devices on their paths */
+std::size_t match_with_index(const SyntheticSysfs& sysfs) {
+    std::unordered_map<std::string, std::vector<std::string>> index{};
+    for (const auto& path : sysfs.get_block_paths()) {
+        for (const auto& pci_device : SysfsReader::get_pci_devices_on_path(path)) {
+            index[pci_device].push_back(path);
+        }
+    }
+    std::size_t matched{0};
+    for (const auto& pci_device : sysfs.get_pci_devices()) {
+        const auto it = index.find(pci_device);
+        if (index.end() != it) {
+            matched += it->second.size();
+        }
+    }
+    return matched;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        SyntheticSysfs sysfs{options};
+        if (0 != ::setenv("SYSFS_PATH", sysfs.get_root().c_str(), 1)) {
+            throw std::runtime_error("Cannot set SYSFS_PATH");
+        }
+
+        std::vector<RawSysfsDevice> devices{};
+        const auto discovery_ms = measure_ms(options.iterations, [&devices]() {
+            devices = SysfsReader{}.get_raw_sysfs_devices();
+        });
+        std::size_t drives{0};
+        for (const auto& device : devices) {
+            for (const auto& function : sysfs.get_functions()) {
+                if (function == device.name) {
+                    drives += device.drive_names.size();
+                }
+            }
+        }
+
+        std::size_t regex_matches{0};
+        std::size_t index_matches{0};
+        const auto regex_ms = measure_ms(options.iterations, [&]() { regex_matches = match_with_regex(sysfs); });
+        const auto index_ms = measure_ms(options.iterations, [&]() { index_matches = match_with_index(sysfs); });
+
+        std::cout << "PCI devices: " << sysfs.get_pci_devices().size() << ", functions: " << options.functions
+                  << ", namespaces: " << sysfs.get_block_paths().size() << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "SysfsReader discovery:  " << std::setw(10) << discovery_ms << " ms, devices: "
+                  << devices.size() << ", drives of functions: " << drives << std::endl;
+        std::cout << "Regex matching:         " << std::setw(10) << regex_ms << " ms, matches: "
+                  << regex_matches << std::endl;
+        std::cout << "Single pass matching:   " << std::setw(10) << index_ms << " ms, matches: "
+                  << index_matches << std::endl;
+
+        if (devices.size() != sysfs.get_pci_devices().size() || drives != sysfs.get_block_paths().size()
+            || regex_matches != index_matches) {
+            std::cerr << "Discovered devices do not match the synthetic tree" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
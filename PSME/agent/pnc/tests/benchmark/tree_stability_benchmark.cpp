@@ -0,0 +1,389 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file tree_stability_benchmark.cpp
+ *
+ * @brief Benchmark of the PNC tree stabilization.
+ *
+ * A synthetic switch tree (ports, zones, drives with their endpoints, PCIe devices
+ * and functions, storage subsystem) is added to the model. Stabilization of the fresh
+ * tree and of the already stable tree is timed, as well as renaming of all resources
+ * in the relations: per resource helpers (the previous implementation) against the
+ * single batched rename.
+ *
+ * Usage: psme-pnc-tree-stability-benchmark [--ports=N] [--drives=N] [--iterations=N]
+ * */
+
+#include "tree_stability/pnc_tree_stabilizer.hpp"
+#include "tree_stability/pnc_key_generator.hpp"
+#include "tree_stability/helpers/update_relations.hpp"
+#include "agent-framework/module/pnc_components.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/service_uuid.hpp"
+#include "logger/logger_factory.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace agent::pnc;
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char SERVICE_UUID[] = "e784d192-379c-11e6-bc47-0242ac110002";
+
+struct Options {
+    unsigned ports{96};
+    unsigned drives{96};
+    unsigned iterations{20};
+};
+
+/*! UUIDs of the synthetic tree resources, in the order of creation */
+struct SyntheticTree {
+    std::string manager{};
+    std::string pcie_switch{};
+    std::string chassis{};
+    std::string subsystem{};
+    std::vector<std::string> ports{};
+    std::vector<std::string> zones{};
+    std::vector<std::string> endpoints{};
+    std::vector<std::string> drives{};
+    std::vector<std::string> functions{};
+};
+
+void clear_model() {
+    get_manager<Manager>().clear_entries();
+    get_manager<Fabric>().clear_entries();
+    get_manager<Switch>().clear_entries();
+    get_manager<Port>().clear_entries();
+    get_manager<Zone>().clear_entries();
+    get_manager<Endpoint>().clear_entries();
+    get_manager<Chassis>().clear_entries();
+    get_manager<Drive>().clear_entries();
+    get_manager<System>().clear_entries();
+    get_manager<StorageSubsystem>().clear_entries();
+    get_manager<PcieDevice>().clear_entries();
+    get_manager<PcieFunction>().clear_entries();
+    get_m2m_manager<StorageSubsystem, Drive>().clear_entries();
+    get_m2m_manager<Zone, Endpoint>().clear_entries();
+    get_m2m_manager<Endpoint, Port>().clear_entries();
+    get_m2m_manager<Drive, PcieFunction>().clear_entries();
+}
+
+/*! Adds switch with ports and zones, each of the first drives ports has a drive with its endpoint and function */
+SyntheticTree build_tree(const Options& options) {
+    clear_model();
+    SyntheticTree tree{};
+
+    Manager manager{};
+    Fabric fabric{manager.get_uuid()};
+    Chassis chassis{manager.get_uuid()};
+    Switch pcie_switch{fabric.get_uuid()};
+    pcie_switch.set_fru_info({"switch_serial", "", "", ""});
+    pcie_switch.set_chassis(chassis.get_uuid());
+    System system{manager.get_uuid()};
+    system.set_chassis(chassis.get_uuid());
+    StorageSubsystem subsystem{system.get_uuid()};
+
+    tree.manager = manager.get_uuid();
+    tree.pcie_switch = pcie_switch.get_uuid();
+    tree.chassis = chassis.get_uuid();
+    tree.subsystem = subsystem.get_uuid();
+
+    for (unsigned i = 0; i < options.ports; ++i) {
+        Port port{pcie_switch.get_uuid()};
+        port.set_port_id(std::to_string(i));
+        tree.ports.push_back(port.get_uuid());
+
+        Zone zone{fabric.get_uuid()};
+        zone.set_zone_id(std::uint32_t(i));
+        zone.set_switch_uuid(pcie_switch.get_uuid());
+        tree.zones.push_back(zone.get_uuid());
+
+        if (i < options.drives) {
+            Drive drive{chassis.get_uuid()};
+            drive.set_fru_info({"drive_serial_" + std::to_string(i), "", "", ""});
+            drive.set_dsp_port_uuids({port.get_uuid()});
+            tree.drives.push_back(drive.get_uuid());
+
+            Endpoint endpoint{fabric.get_uuid()};
+            attribute::ConnectedEntity entity{};
+            entity.set_entity(drive.get_uuid());
+            entity.set_entity_role(enums::EntityRole::Target);
+            entity.set_entity_type(enums::EntityType::Drive);
+            endpoint.add_connected_entity(entity);
+            tree.endpoints.push_back(endpoint.get_uuid());
+
+            PcieDevice device{manager.get_uuid()};
+            device.set_fru_info({"device_serial_" + std::to_string(i), "", "", ""});
+            device.set_chassis(chassis.get_uuid());
+            PcieFunction function{device.get_uuid()};
+            function.set_function_id("0");
+            function.set_dsp_port_uuid(port.get_uuid());
+            function.set_functional_device(drive.get_uuid());
+            tree.functions.push_back(function.get_uuid());
+
+            get_m2m_manager<Zone, Endpoint>().add_entry(zone.get_uuid(), endpoint.get_uuid());
+            get_m2m_manager<Endpoint, Port>().add_entry(endpoint.get_uuid(), port.get_uuid());
+            get_m2m_manager<Drive, PcieFunction>().add_entry(drive.get_uuid(), function.get_uuid());
+            get_m2m_manager<StorageSubsystem, Drive>().add_entry(subsystem.get_uuid(), drive.get_uuid());
+
+            get_manager<Drive>().add_entry(std::move(drive));
+            get_manager<Endpoint>().add_entry(std::move(endpoint));
+            get_manager<PcieDevice>().add_entry(std::move(device));
+            get_manager<PcieFunction>().add_entry(std::move(function));
+        }
+
+        get_manager<Port>().add_entry(std::move(port));
+        get_manager<Zone>().add_entry(std::move(zone));
+    }
+
+    get_manager<Manager>().add_entry(std::move(manager));
+    get_manager<Fabric>().add_entry(std::move(fabric));
+    get_manager<Chassis>().add_entry(std::move(chassis));
+    get_manager<Switch>().add_entry(std::move(pcie_switch));
+    get_manager<System>().add_entry(std::move(system));
+    get_manager<StorageSubsystem>().add_entry(std::move(subsystem));
+    return tree;
+}
+
+/*! New UUID for each resource referenced in the relations */
+helpers::UuidMap make_renames(const SyntheticTree& tree) {
+    helpers::UuidMap uuids{};
+    for (const auto& group : {std::vector<std::string>{tree.pcie_switch, tree.chassis, tree.subsystem},
+                              tree.ports, tree.zones, tree.endpoints, tree.drives, tree.functions}) {
+        for (const auto& uuid : group) {
+            uuids[uuid] = "renamed-" + uuid;
+        }
+    }
+    return uuids;
+}
+
+/*! Renaming of the previous implementation: relation helpers called for each renamed resource */
+void rename_per_resource(const SyntheticTree& tree, const helpers::UuidMap& uuids) {
+    helpers::update_chassis_in_relations(tree.chassis, uuids.at(tree.chassis));
+    helpers::update_pcie_switch_in_relations(tree.pcie_switch, uuids.at(tree.pcie_switch));
+    helpers::update_storage_subsystem_in_relations(tree.subsystem, uuids.at(tree.subsystem));
+    for (const auto& uuid : tree.ports) {
+        helpers::update_pcie_port_in_relations(uuid, uuids.at(uuid));
+    }
+    for (const auto& uuid : tree.zones) {
+        helpers::update_pcie_zone_in_relations(uuid, uuids.at(uuid));
+    }
+    for (const auto& uuid : tree.endpoints) {
+        helpers::update_pcie_endpoint_in_relations(uuid, uuids.at(uuid));
+    }
+    for (const auto& uuid : tree.drives) {
+        helpers::update_pcie_drive_in_relations(uuid, uuids.at(uuid));
+    }
+    for (const auto& uuid : tree.functions) {
+        helpers::update_pcie_function_in_relations(uuid, uuids.at(uuid));
+    }
+}
+
+/*! Text of all relations with resources named by their position in the tree, compared for both renaming methods */
+std::string dump_relations(const SyntheticTree& tree, const helpers::UuidMap& uuids) {
+    std::map<std::string, std::string> names{};
+    names[uuids.at(tree.pcie_switch)] = "switch";
+    names[uuids.at(tree.chassis)] = "chassis";
+    for (const auto& group : {std::make_pair("port", &tree.ports), std::make_pair("zone", &tree.zones),
+                              std::make_pair("endpoint", &tree.endpoints), std::make_pair("drive", &tree.drives),
+                              std::make_pair("function", &tree.functions)}) {
+        for (std::size_t i = 0; i < group.second->size(); ++i) {
+            names[uuids.at(group.second->at(i))] = group.first + std::to_string(i);
+        }
+    }
+    const auto name = [&names](const std::string& uuid) {
+        const auto it = names.find(uuid);
+        return names.end() != it ? it->second : "not renamed " + uuid;
+    };
+
+    std::ostringstream dump{};
+    for (const auto& uuid : get_manager<Zone>().get_keys()) {
+        dump << name(get_manager<Zone>().get_entry(uuid).get_switch_uuid()) << ';';
+    }
+    for (const auto& uuid : get_manager<Endpoint>().get_keys()) {
+        const auto endpoint = get_manager<Endpoint>().get_entry(uuid);
+        for (const auto& entity : endpoint.get_connected_entities().get_array()) {
+            dump << name(entity.get_entity().value()) << ';';
+        }
+    }
+    for (const auto& uuid : get_manager<PcieFunction>().get_keys()) {
+        const auto function = get_manager<PcieFunction>().get_entry(uuid);
+        dump << name(function.get_dsp_port_uuid()) << name(function.get_functional_device().value()) << ';';
+    }
+    for (const auto& uuid : get_manager<Drive>().get_keys()) {
+        dump << name(get_manager<Drive>().get_entry(uuid).get_dsp_port_uuids().front()) << ';';
+    }
+    for (const auto& uuid : get_manager<PcieDevice>().get_keys()) {
+        dump << name(get_manager<PcieDevice>().get_entry(uuid).get_chassis().value()) << ';';
+    }
+    dump << name(get_manager<Switch>().get_entry(tree.pcie_switch).get_chassis().value()) << ';';
+    for (const auto& uuid : tree.endpoints) {
+        for (const auto& port : get_m2m_manager<Endpoint, Port>().get_children(uuids.at(uuid))) {
+            dump << name(port) << ';';
+        }
+        for (const auto& zone : get_m2m_manager<Zone, Endpoint>().get_parents(uuids.at(uuid))) {
+            dump << name(zone) << ';';
+        }
+    }
+    for (const auto& uuid : tree.drives) {
+        for (const auto& function : get_m2m_manager<Drive, PcieFunction>().get_children(uuids.at(uuid))) {
+            dump << name(function) << ';';
+        }
+    }
+    std::set<std::string> subsystem_drives{};
+    for (const auto& drive : get_m2m_manager<StorageSubsystem, Drive>().get_children(uuids.at(tree.subsystem))) {
+        subsystem_drives.insert(name(drive));
+    }
+    for (const auto& drive : subsystem_drives) {
+        dump << drive << ';';
+    }
+    return dump.str();
+}
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--ports" == name) {
+            options.ports = value;
+        }
+        else if ("--drives" == name) {
+            options.drives = value;
+        }
+        else if ("--iterations" == name) {
+            options.iterations = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.iterations || 0 == options.ports || options.drives > options.ports) {
+        throw std::invalid_argument("Invalid number of ports, drives or iterations");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--ports=96] [--drives=96] [--iterations=20]" << std::endl;
+}
+
+/*! Average time of the measured function, the tree is built again before each call */
+template <typename P, typename F>
+double measure_ms(unsigned iterations, P prepare, F function) {
+    Clock::duration elapsed{};
+    for (unsigned i = 0; i < iterations; ++i) {
+        prepare();
+        const auto start = Clock::now();
+        function();
+        elapsed += Clock::now() - start;
+    }
+    return std::chrono::duration<double, std::milli>(elapsed).count() / iterations;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        // Persistent UUID of each resource is logged, it would be measured as well
+        auto logger = logger_cpp::LoggerFactory::instance().get_logger(LOGUSR);
+        auto logger_options = logger->get_options();
+        logger_options.set_level(logger_cpp::Level::WARNING);
+        logger->set_options(logger_options);
+
+        agent_framework::generic::ServiceUuid::get_instance()->set_service_uuid(SERVICE_UUID);
+        PncKeyGenerator::set_agent_id("benchmark");
+
+        SyntheticTree tree{};
+        std::string manager_uuid{};
+        const auto stabilization_ms = measure_ms(options.iterations,
+            [&]() { tree = build_tree(options); },
+            [&]() { manager_uuid = PncTreeStabilizer().stabilize(tree.manager); });
+
+        const auto restabilization_ms = measure_ms(options.iterations,
+            []() {},
+            [&]() { PncTreeStabilizer().stabilize(manager_uuid); });
+
+        std::size_t persistent{0};
+        for (const auto& uuid : get_manager<Endpoint>().get_keys()) {
+            persistent += get_manager<Endpoint>().get_entry(uuid).has_persistent_uuid() ? 1 : 0;
+        }
+
+        helpers::UuidMap uuids{};
+        std::string per_resource_dump{};
+        std::string batched_dump{};
+        const auto per_resource_ms = measure_ms(options.iterations,
+            [&]() { tree = build_tree(options); uuids = make_renames(tree); },
+            [&]() { rename_per_resource(tree, uuids); });
+        per_resource_dump = dump_relations(tree, uuids);
+        const auto batched_ms = measure_ms(options.iterations,
+            [&]() { tree = build_tree(options); uuids = make_renames(tree); },
+            [&]() { helpers::update_relations(uuids); });
+        batched_dump = dump_relations(tree, uuids);
+
+        std::cout << "Ports: " << options.ports << ", drives: " << options.drives
+                  << ", renamed resources: " << uuids.size() << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Stabilization:          " << std::setw(10) << stabilization_ms << " ms, persistent endpoints: "
+                  << persistent << std::endl;
+        std::cout << "Stable tree:            " << std::setw(10) << restabilization_ms << " ms" << std::endl;
+        std::cout << "Per resource renaming:  " << std::setw(10) << per_resource_ms << " ms" << std::endl;
+        std::cout << "Batched renaming:       " << std::setw(10) << batched_ms << " ms" << std::endl;
+
+        clear_model();
+        if (persistent != options.drives || per_resource_dump != batched_dump) {
+            std::cerr << "Stabilized tree does not match the synthetic tree" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,358 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ * */
+
+#include "gas/binding_cache.hpp"
+#include "tools/gas_tool.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/module/pnc_components.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+using namespace agent::pnc::gas;
+using namespace agent::pnc::gas::mrpc;
+using agent::pnc::tools::GasTool;
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+
+namespace {
+
+constexpr std::uint8_t MGMT_PARTITION = 0;
+constexpr std::uint8_t ZONE_PARTITION = 1;
+constexpr std::uint8_t BRIDGES = 8;
+const std::vector<std::uint8_t> PORTS{0, 1, 8, 9, 10, 11};
+const std::string MEMORY_PATH = "/sys/bus/pci/devices/0000:05:00.1/resource0";
+const std::string OTHER_MEMORY_PATH = "/sys/bus/pci/devices/0000:0a:00.1/resource0";
+
+/*! GAS memory region of a switch, binding MRPC commands are executed when the command register is written */
+class SimulatedSwitch : public AccessInterface {
+public:
+    SimulatedSwitch() {
+        // upstream ports of the partitions
+        m_partitions[MGMT_PARTITION] = std::vector<std::uint8_t>(BRIDGES, NO_PORT_ASSIGNED);
+        m_partitions[ZONE_PARTITION] = std::vector<std::uint8_t>(BRIDGES, NO_PORT_ASSIGNED);
+        bind(0, MGMT_PARTITION, 0);
+        bind(1, ZONE_PARTITION, 0);
+    }
+
+    void init(const std::string&) override {}
+
+    void deinit() override {}
+
+    void write(uint8_t* data, uint32_t size, uint32_t offset) override {
+        std::memcpy(m_memory.data() + offset, data, size);
+        if (MRPC_COMMAND_REG_OFFSET == offset) {
+            execute();
+        }
+    }
+
+    void read(uint8_t* data, uint32_t size, uint32_t offset) override {
+        std::memcpy(data, m_memory.data() + offset, size);
+    }
+
+    /*! Binds port without the MRPC command, as done by another management host */
+    void bind(std::uint8_t port, std::uint8_t partition, std::uint8_t bridge) {
+        m_partitions[partition][bridge] = port;
+        m_ports[port] = std::make_pair(partition, bridge);
+    }
+
+    /*! Unbinds bridge without the MRPC command, as done by another management host */
+    void unbind(std::uint8_t partition, std::uint8_t bridge) {
+        auto& port = m_partitions[partition][bridge];
+        m_ports.erase(port);
+        port = NO_PORT_ASSIGNED;
+    }
+
+    unsigned binding_info_commands{0};
+    unsigned binding_commands{0};
+
+private:
+    void execute() {
+        const auto* input = m_memory.data() + MRPC_INPUT_DATA_REG_OFFSET;
+        auto* output = m_memory.data() + MRPC_OUTPUT_DATA_REG_OFFSET;
+        auto ret_value = PortPartitionP2PBindingReturnValue::COMMAND_SUCCEED;
+        switch (PortPartitionP2PBindSubCommandCode(input[0])) {
+            case PortPartitionP2PBindSubCommandCode::BIND_PORT:
+                ++binding_commands;
+                if (NO_PORT_ASSIGNED != m_partitions[input[1]][input[2]]) {
+                    ret_value = PortPartitionP2PBindingReturnValue::LOGICAL_BRIDGE_BINDING_INSTANCE_ALREADY_BOUND;
+                }
+                else {
+                    bind(input[3], input[1], input[2]);
+                }
+                break;
+            case PortPartitionP2PBindSubCommandCode::UNBIND_PORT: {
+                ++binding_commands;
+                unbind(input[1], input[2]);
+                break;
+            }
+            case PortPartitionP2PBindSubCommandCode::PORT_BINDING_INFO: {
+                ++binding_info_commands;
+                std::uint8_t count{0};
+                for (const auto port : PORTS) {
+                    if (0xFF == input[1] || port == input[1]) {
+                        const auto it = m_ports.find(port);
+                        const bool is_bound = m_ports.end() != it;
+                        std::uint8_t* entry = output + 4 + 4 * count++;
+                        entry[0] = port;
+                        entry[1] = is_bound ? it->second.first : NO_PORT_ASSIGNED;
+                        entry[2] = is_bound ? it->second.second : NO_PORT_ASSIGNED;
+                        entry[3] = std::uint8_t(std::uint8_t(is_bound ? BindingState::BOUND : BindingState::UNBOUND)
+                                                << 4);
+                    }
+                }
+                output[0] = count;
+                break;
+            }
+            case PortPartitionP2PBindSubCommandCode::PARTITION_BINDING_INFO: {
+                ++binding_info_commands;
+                const auto& bridges = m_partitions[input[1]];
+                output[0] = input[1];
+                output[1] = BRIDGES;
+                for (std::uint8_t bridge = 0; bridge < BRIDGES; ++bridge) {
+                    output[4 + 2 * bridge] = bridges[bridge];
+                    output[5 + 2 * bridge] = std::uint8_t(std::uint8_t(NO_PORT_ASSIGNED == bridges[bridge] ?
+                        BindingState::UNBOUND : BindingState::BOUND) << 4);
+                }
+                break;
+            }
+            default:
+                ret_value = PortPartitionP2PBindingReturnValue::SUB_COMMAND_DOES_NOT_EXIST;
+                break;
+        }
+        m_memory[MRPC_STATUS_REG_OFFSET] = std::uint8_t(CommandStatus::DONE);
+        m_memory[MRPC_COMMAND_RETURN_VALUE_REG_OFFSET] = std::uint8_t(ret_value);
+    }
+
+    std::vector<std::uint8_t> m_memory = std::vector<std::uint8_t>(MRPC_REG_SIZE, 0);
+    std::map<std::uint8_t, std::vector<std::uint8_t>> m_partitions{};
+    std::map<std::uint8_t, std::pair<std::uint8_t, std::uint8_t>> m_ports{};
+};
+
+/*! Access interface shared by the switches as the PCIe interface of the agent is, init() selects the switch */
+class SharedInterface : public AccessInterface {
+public:
+    explicit SharedInterface(const std::map<std::string, AccessInterface*>& switches) : m_switches(switches) {}
+
+    void init(const std::string& path) override {
+        m_current = m_switches.at(path);
+    }
+
+    void deinit() override {}
+
+    void write(uint8_t* data, uint32_t size, uint32_t offset) override {
+        m_current->write(data, size, offset);
+    }
+
+    void read(uint8_t* data, uint32_t size, uint32_t offset) override {
+        m_current->read(data, size, offset);
+    }
+
+private:
+    std::map<std::string, AccessInterface*> m_switches;
+    AccessInterface* m_current{nullptr};
+};
+
+}
+
+class BindingCacheTest : public ::testing::Test {
+protected:
+    void SetUp() {
+        GasTool::get_binding_cache().clear();
+        GasTool::get_binding_cache().set_max_age(std::chrono::seconds{BindingCache::DEFAULT_MAX_AGE_SEC});
+    }
+
+    SimulatedSwitch sw{};
+    GlobalAddressSpaceRegisters gas{&sw, MEMORY_PATH};
+    GasTool gas_tool{};
+};
+
+TEST_F(BindingCacheTest, CachedBindingsSkipMrpc) {
+    auto port = gas_tool.get_cached_port_binding_info(gas, 0);
+    auto partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(2u, sw.binding_info_commands);
+
+    port = gas_tool.get_cached_port_binding_info(gas, 0);
+    partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(2u, sw.binding_info_commands);
+    EXPECT_EQ(MGMT_PARTITION, port.output.fields.port_binding_info[0].partition_id);
+    EXPECT_EQ(0, gas_tool.get_logical_bridge_for_port(port));
+    EXPECT_EQ(1, partition.output.fields.partition_binding_info[0].phy_port_id);
+    EXPECT_EQ(BRIDGES - 1, gas_tool.get_available_bridges_count(partition));
+}
+
+TEST_F(BindingCacheTest, RevalidationCachesAllPorts) {
+    sw.bind(8, MGMT_PARTITION, 1);
+    auto all_ports = gas_tool.revalidate_binding_cache(gas);
+    EXPECT_EQ(PORTS.size(), all_ports.output.fields.info_count);
+    EXPECT_EQ(1u, sw.binding_info_commands);
+
+    for (const auto port_id : PORTS) {
+        EXPECT_EQ(port_id, gas_tool.get_cached_port_binding_info(gas, port_id).output.fields.port_binding_info[0]
+            .phy_port_id);
+    }
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(gas_tool.get_cached_port_binding_info(gas, 8)));
+    EXPECT_EQ(1u, sw.binding_info_commands);
+}
+
+TEST_F(BindingCacheTest, ExpiredBindingsAreReadAgain) {
+    GasTool::get_binding_cache().set_max_age(std::chrono::seconds{0});
+    gas_tool.revalidate_binding_cache(gas);
+    gas_tool.get_cached_port_binding_info(gas, 8);
+    gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(4u, sw.binding_info_commands);
+}
+
+TEST_F(BindingCacheTest, OwnBindingsInvalidateCache) {
+    gas_tool.revalidate_binding_cache(gas);
+    auto partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+
+    gas_tool.bind_to_partition(gas, 8, ZONE_PARTITION, gas_tool.get_available_bridge_id(partition));
+    EXPECT_EQ(1u, sw.binding_commands);
+    partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(8, partition.output.fields.partition_binding_info[1].phy_port_id);
+    EXPECT_EQ(2, gas_tool.get_available_bridge_id(partition));
+    auto port = gas_tool.get_cached_port_binding_info(gas, 8);
+    EXPECT_EQ(ZONE_PARTITION, port.output.fields.port_binding_info[0].partition_id);
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(port));
+
+    gas_tool.unbind_from_partition(gas, ZONE_PARTITION, 1);
+    EXPECT_EQ(2u, sw.binding_commands);
+    partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(NO_PORT_ASSIGNED, partition.output.fields.partition_binding_info[1].phy_port_id);
+    port = gas_tool.get_cached_port_binding_info(gas, 8);
+    EXPECT_EQ(NO_PORT_ASSIGNED, port.output.fields.port_binding_info[0].partition_id);
+    EXPECT_TRUE(GasTool::get_binding_cache().check_consistency(MEMORY_PATH,
+        gas_tool.get_all_port_binding_info(gas)).empty());
+}
+
+TEST_F(BindingCacheTest, ConsistencyCheckFindsExternalBindings) {
+    gas_tool.revalidate_binding_cache(gas);
+    gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    gas_tool.get_cached_partition_binding_info(gas, MGMT_PARTITION);
+    auto& cache = GasTool::get_binding_cache();
+    EXPECT_TRUE(cache.check_consistency(MEMORY_PATH, gas_tool.get_all_port_binding_info(gas)).empty());
+
+    sw.bind(9, ZONE_PARTITION, 3);
+    auto mismatches = cache.check_consistency(MEMORY_PATH, gas_tool.get_all_port_binding_info(gas));
+    EXPECT_EQ(std::vector<std::uint8_t>{9}, mismatches.ports);
+    EXPECT_EQ(std::vector<std::uint8_t>{ZONE_PARTITION}, mismatches.partitions);
+
+    // stale entries are dropped, the management partition is still served from the cache
+    gas_tool.revalidate_binding_cache(gas);
+    const auto commands = sw.binding_info_commands;
+    EXPECT_EQ(3, gas_tool.get_logical_bridge_for_port(gas_tool.get_cached_port_binding_info(gas, 9)));
+    gas_tool.get_cached_partition_binding_info(gas, MGMT_PARTITION);
+    EXPECT_EQ(commands, sw.binding_info_commands);
+    auto partition = gas_tool.get_cached_partition_binding_info(gas, ZONE_PARTITION);
+    EXPECT_EQ(commands + 1, sw.binding_info_commands);
+    EXPECT_EQ(9, partition.output.fields.partition_binding_info[3].phy_port_id);
+    EXPECT_TRUE(cache.check_consistency(MEMORY_PATH, gas_tool.get_all_port_binding_info(gas)).empty());
+}
+
+TEST_F(BindingCacheTest, ResultsReadDuringChangeAreNotStored) {
+    BindingCache cache{};
+    PortBindingInfo pbi{gas.get_interface()};
+    pbi.output.fields.info_count = 1;
+    pbi.output.fields.port_binding_info[0].phy_port_id = 8;
+    pbi.output.fields.port_binding_info[0].partition_id = NO_PORT_ASSIGNED;
+    pbi.output.fields.port_binding_info[0].logical_bridge_id = NO_PORT_ASSIGNED;
+
+    auto generation = cache.get_generation(MEMORY_PATH);
+    {
+        BindingCache::Change change{cache, MEMORY_PATH};
+        cache.update(MEMORY_PATH, generation, pbi);
+        cache.update(MEMORY_PATH, cache.get_generation(MEMORY_PATH), pbi);
+        EXPECT_FALSE(cache.get_port_binding_info(MEMORY_PATH, 8, pbi));
+    }
+    // read started before the change ended
+    cache.update(MEMORY_PATH, generation, pbi);
+    EXPECT_FALSE(cache.get_port_binding_info(MEMORY_PATH, 8, pbi));
+
+    cache.update(MEMORY_PATH, cache.get_generation(MEMORY_PATH), pbi);
+    EXPECT_TRUE(cache.get_port_binding_info(MEMORY_PATH, 8, pbi));
+    EXPECT_FALSE(cache.get_port_binding_info(MEMORY_PATH, 9, pbi));
+
+    cache.invalidate(MEMORY_PATH);
+    EXPECT_FALSE(cache.get_port_binding_info(MEMORY_PATH, 8, pbi));
+}
+
+TEST_F(BindingCacheTest, SwitchesSharingInterfaceAreCachedSeparately) {
+    SimulatedSwitch other_sw{};
+    SharedInterface iface{{{MEMORY_PATH, &sw}, {OTHER_MEMORY_PATH, &other_sw}}};
+    GlobalAddressSpaceRegisters first{&iface, MEMORY_PATH};
+    GlobalAddressSpaceRegisters second{&iface, OTHER_MEMORY_PATH};
+    sw.bind(8, ZONE_PARTITION, 1);
+
+    iface.init(MEMORY_PATH);
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(gas_tool.get_cached_port_binding_info(first, 8)));
+    iface.init(OTHER_MEMORY_PATH);
+    auto port = gas_tool.get_cached_port_binding_info(second, 8);
+    EXPECT_EQ(NO_PORT_ASSIGNED, port.output.fields.port_binding_info[0].partition_id);
+    EXPECT_EQ(1u, other_sw.binding_info_commands);
+
+    // binding on one switch drops only its own entries
+    gas_tool.bind_to_partition(second, 9, ZONE_PARTITION, 2);
+    port = gas_tool.get_cached_port_binding_info(second, 8);
+    EXPECT_EQ(NO_PORT_ASSIGNED, port.output.fields.port_binding_info[0].partition_id);
+    iface.init(MEMORY_PATH);
+    const auto commands = sw.binding_info_commands;
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(gas_tool.get_cached_port_binding_info(first, 8)));
+    EXPECT_EQ(commands, sw.binding_info_commands);
+    EXPECT_EQ(0u, sw.binding_commands);
+}
+
+TEST_F(BindingCacheTest, UnbindingReadsBindingsFromSwitch) {
+    Zone zone{};
+    zone.set_zone_id(ZONE_PARTITION);
+    get_manager<Zone>().add_entry(zone);
+    Port port{};
+    port.set_phys_port_id(8);
+    get_manager<Port>().add_entry(port);
+    Endpoint endpoint{};
+    get_manager<Endpoint>().add_entry(endpoint);
+    get_m2m_manager<Endpoint, Port>().add_entry(endpoint.get_uuid(), port.get_uuid());
+
+    sw.bind(8, ZONE_PARTITION, 1);
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(gas_tool.get_cached_port_binding_info(gas, 8)));
+
+    // another host moves the port to other bridge and binds other port in its place
+    sw.unbind(ZONE_PARTITION, 1);
+    sw.bind(8, ZONE_PARTITION, 2);
+    sw.bind(9, ZONE_PARTITION, 1);
+    gas_tool.unbind_endpoint_from_zone(gas, zone.get_uuid(), endpoint.get_uuid());
+
+    const auto unbound = gas_tool.get_port_binding_info(gas, 8);
+    EXPECT_EQ(NO_PORT_ASSIGNED, unbound.output.fields.port_binding_info[0].partition_id);
+    EXPECT_EQ(1, gas_tool.get_logical_bridge_for_port(gas_tool.get_port_binding_info(gas, 9)));
+
+    get_m2m_manager<Endpoint, Port>().clear_entries();
+    get_manager<Endpoint>().clear_entries();
+    get_manager<Port>().clear_entries();
+    get_manager<Zone>().clear_entries();
+}
@@ -0,0 +1,235 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DriveTelemetryTests
+ * */
+
+#include "nvme/drive_telemetry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace agent::pnc::gas;
+using namespace agent::pnc::i2c;
+using namespace agent::pnc::nvme;
+using agent_framework::model::enums::PlatformType;
+
+namespace {
+
+/*! TWI bus with drives behind expanders, drive data depends on the selected channel */
+class FakeTwiBus : public I2cAccessInterface {
+public:
+    explicit FakeTwiBus(std::chrono::milliseconds latency = std::chrono::milliseconds{0}) : m_latency{latency} {}
+
+    void write(std::uint8_t port, std::uint16_t address, std::uint16_t, std::uint8_t* data, std::uint16_t,
+               bool) const override {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        EXPECT_EQ(PM85X6TwiDeviceAddress::MF3_TWI_EXPANDER, address);
+        ++writes;
+        if (address == failing_address) {
+            throw std::runtime_error("No response");
+        }
+        m_selected[port] = data[0];
+    }
+
+    void read(std::uint8_t port, std::uint16_t address, std::uint16_t offset, std::uint8_t* data,
+              std::uint16_t size, bool) const override {
+        std::uint8_t channel{};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            ++reads;
+            if (address == failing_address) {
+                throw std::runtime_error("No response");
+            }
+            channel = m_selected[port];
+            ++m_active_ports[port];
+            if (m_active_ports[port] > 1) {
+                ++overlapping_sessions;
+            }
+            max_active_ports = std::max(max_active_ports, std::size_t(std::count_if(m_active_ports.begin(),
+                m_active_ports.end(), [](const std::pair<const std::uint8_t, unsigned>& p) { return p.second > 0; })));
+        }
+        std::this_thread::sleep_for(m_latency);
+
+        std::memset(data, 0, size);
+        EXPECT_EQ(0, offset);
+        if (PM85X6TwiDeviceAddress::SMART == address) {
+            // status flags, percentage used and the firmware version
+            data[1] = 0x20;
+            data[4] = channel;
+            if (size >= FirmwareVersion::FW_VERSION_OFFSET_BYTES + FirmwareVersion::FW_VERSION_SIZE_BYTES) {
+                std::memcpy(data + FirmwareVersion::FW_VERSION_OFFSET_BYTES, "FW000001", 8);
+                data[FirmwareVersion::FW_VERSION_OFFSET_BYTES + 7] = std::uint8_t('0' + port);
+            }
+        }
+        else if (PM85X6TwiDeviceAddress::NVME_VPD == address) {
+            data[5] = std::uint8_t('S');
+            data[6] = channel;
+        }
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_selected[port] != channel) {
+            ++channel_switches;
+        }
+        --m_active_ports[port];
+    }
+
+    void reset_counters() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        reads = writes = overlapping_sessions = channel_switches = max_active_ports = 0;
+    }
+
+    mutable std::size_t reads{0};
+    mutable std::size_t writes{0};
+    mutable std::size_t overlapping_sessions{0};
+    mutable std::size_t channel_switches{0};
+    mutable std::size_t max_active_ports{0};
+    std::uint16_t failing_address{0};
+
+private:
+    std::chrono::milliseconds m_latency;
+    mutable std::mutex m_mutex{};
+    mutable std::map<std::uint8_t, std::uint8_t> m_selected{};
+    mutable std::map<std::uint8_t, unsigned> m_active_ports{};
+};
+
+constexpr DriveLocation DRIVE{PM85X6TwiPort::PORT4, PCA9548TwiExpanderChannel::CHANNEL2};
+
+}
+
+TEST(DriveTelemetryTest, CollectReadsDriveInOneSession) {
+    auto bus = std::make_shared<FakeTwiBus>();
+    DriveTelemetryCollector collector{};
+    DriveTelemetry telemetry{PlatformType::MF3};
+
+    collector.collect(bus, DRIVE, telemetry);
+
+    // channel selected once, SMART with firmware version and VPD read
+    EXPECT_EQ(1u, bus->writes);
+    EXPECT_EQ(2u, bus->reads);
+    ASSERT_TRUE(telemetry.is_smart_valid);
+    ASSERT_TRUE(telemetry.is_vpd_valid);
+    ASSERT_TRUE(telemetry.is_firmware_version_valid);
+    EXPECT_TRUE(telemetry.smart.is_drive_functional());
+    EXPECT_EQ(PCA9548TwiExpanderChannel::CHANNEL2, telemetry.smart.fields.percentage_drive_life_used);
+    EXPECT_EQ("FW000004", std::string(reinterpret_cast<const char*>(telemetry.firmware_version.fields.firmware_version),
+        FirmwareVersion::FW_VERSION_SIZE_BYTES));
+    EXPECT_EQ('S', telemetry.vpd.fields.serial_number[0]);
+    EXPECT_EQ(PCA9548TwiExpanderChannel::CHANNEL2, telemetry.vpd.fields.serial_number[1]);
+}
+
+TEST(DriveTelemetryTest, FreshDataIsServedFromCache) {
+    auto bus = std::make_shared<FakeTwiBus>();
+    DriveTelemetryCollector collector{std::chrono::hours{1}};
+    DriveTelemetry collected{PlatformType::MF3};
+    collector.collect(bus, DRIVE, collected);
+    bus->reset_counters();
+
+    DriveTelemetry cached{PlatformType::MF3};
+    collector.get(bus, DRIVE, cached);
+    EXPECT_EQ(0u, bus->writes + bus->reads);
+    EXPECT_TRUE(cached.is_vpd_valid);
+    EXPECT_EQ(collected.collected_at, cached.collected_at);
+
+    // stale SMART data is read again, VPD is kept
+    collector.set_max_age(std::chrono::seconds{0});
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    collector.get(bus, DRIVE, cached);
+    EXPECT_EQ(1u, bus->writes);
+    EXPECT_EQ(1u, bus->reads);
+    EXPECT_TRUE(cached.is_smart_valid);
+    EXPECT_TRUE(cached.is_vpd_valid);
+    EXPECT_LT(collected.collected_at, cached.collected_at);
+}
+
+TEST(DriveTelemetryTest, RefreshRunsTwiPortsConcurrently) {
+    auto bus = std::make_shared<FakeTwiBus>(std::chrono::milliseconds{20});
+    DriveTelemetryCollector collector{};
+    for (const auto port : {PM85X6TwiPort::PORT0, PM85X6TwiPort::PORT1}) {
+        for (const auto channel : {PCA9548TwiExpanderChannel::CHANNEL0, PCA9548TwiExpanderChannel::CHANNEL5,
+                                   PCA9548TwiExpanderChannel::CHANNEL7}) {
+            DriveTelemetry telemetry{PlatformType::MF3};
+            collector.collect(bus, DriveLocation{port, channel}, telemetry);
+        }
+    }
+    bus->reset_counters();
+
+    collector.refresh(bus);
+
+    EXPECT_EQ(6u, bus->writes);
+    EXPECT_EQ(6u, bus->reads);
+    // drives behind the same port do not change the selected channel of each other
+    EXPECT_EQ(0u, bus->overlapping_sessions);
+    EXPECT_EQ(0u, bus->channel_switches);
+    EXPECT_EQ(2u, bus->max_active_ports);
+
+    DriveTelemetry telemetry{PlatformType::MF3};
+    collector.set_max_age(std::chrono::hours{1});
+    collector.get(bus, DriveLocation{PM85X6TwiPort::PORT1, PCA9548TwiExpanderChannel::CHANNEL7}, telemetry);
+    EXPECT_EQ(PCA9548TwiExpanderChannel::CHANNEL7, telemetry.smart.fields.percentage_drive_life_used);
+}
+
+TEST(DriveTelemetryTest, InvalidatedDriveIsCollectedAgain) {
+    auto bus = std::make_shared<FakeTwiBus>();
+    DriveTelemetryCollector collector{std::chrono::hours{1}};
+    DriveTelemetry telemetry{PlatformType::MF3};
+    collector.collect(bus, DRIVE, telemetry);
+    collector.invalidate(DRIVE);
+    bus->reset_counters();
+
+    collector.refresh(bus);
+    EXPECT_EQ(0u, bus->reads);
+
+    collector.get(bus, DRIVE, telemetry);
+    EXPECT_EQ(2u, bus->reads);
+    EXPECT_TRUE(telemetry.is_vpd_valid);
+}
+
+TEST(DriveTelemetryTest, FailedReadsAreReported) {
+    auto bus = std::make_shared<FakeTwiBus>();
+    DriveTelemetryCollector collector{std::chrono::seconds{0}};
+    DriveTelemetry telemetry{PlatformType::MF3};
+
+    bus->failing_address = PM85X6TwiDeviceAddress::SMART;
+    collector.collect(bus, DRIVE, telemetry);
+    EXPECT_FALSE(telemetry.is_smart_valid);
+    EXPECT_FALSE(telemetry.is_firmware_version_valid);
+    EXPECT_TRUE(telemetry.is_vpd_valid);
+
+    bus->failing_address = PM85X6TwiDeviceAddress::NVME_VPD;
+    collector.get(bus, DRIVE, telemetry);
+    EXPECT_TRUE(telemetry.is_smart_valid);
+    EXPECT_TRUE(telemetry.is_vpd_valid);
+
+    bus->failing_address = PM85X6TwiDeviceAddress::MF3_TWI_EXPANDER;
+    bus->reset_counters();
+    DriveTelemetry missing{PlatformType::MF3};
+    collector.collect(bus, DriveLocation{PM85X6TwiPort::PORT8, PCA9548TwiExpanderChannel::CHANNEL0}, missing);
+    EXPECT_FALSE(missing.is_valid());
+    EXPECT_EQ(0u, bus->reads);
+}
@@ -0,0 +1,230 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section SecureEraseTests
+ * */
+
+#include "nvme/nvme_secure_erase.hpp"
+#include "nvme/secure_erase_registry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace agent::pnc::nvme;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*! Controller shim, sanitize runs in the background for the given duration */
+class FakeNvmeController : public NvmeAdminInterface {
+public:
+    FakeNvmeController(std::uint32_t sanicap, std::chrono::milliseconds duration) :
+        m_sanicap{sanicap}, m_duration{duration} {}
+
+    void submit(struct nvme_admin_cmd& cmd) override {
+        ++commands;
+        void* data = reinterpret_cast<void*>(std::uintptr_t(cmd.addr));
+        switch (cmd.opcode) {
+            case nvme_admin_identify: {
+                EXPECT_EQ(sizeof(nvme_id_ctrl), cmd.data_len);
+                nvme_id_ctrl controller{};
+                controller.sanicap = m_sanicap;
+                std::memcpy(data, &controller, sizeof(controller));
+                break;
+            }
+            case nvme_admin_sanitize:
+                sanitize_action = cmd.cdw10 & 0x7;
+                m_started = Clock::now();
+                m_sanitizing = true;
+                break;
+            case nvme_admin_get_log_page: {
+                EXPECT_EQ(SANITIZE_STATUS_LOG_ID, cmd.cdw10 & 0xff);
+                EXPECT_EQ(sizeof(nvme_sanitize_log), ((cmd.cdw10 >> 16) + 1) * 4);
+                nvme_sanitize_log log{};
+                if (m_sanitizing) {
+                    const auto elapsed = Clock::now() - m_started;
+                    if (elapsed >= m_duration) {
+                        log.sprog = 0xffff;
+                        log.sstat = std::uint16_t(fail ? SanitizeStatus::FAILED : SanitizeStatus::COMPLETED);
+                    }
+                    else {
+                        log.sprog = std::uint16_t(65536 * elapsed.count() / Clock::duration(m_duration).count());
+                        log.sstat = std::uint16_t(SanitizeStatus::IN_PROGRESS);
+                    }
+                }
+                std::memcpy(data, &log, sizeof(log));
+                ++status_polls;
+                break;
+            }
+            case nvme_admin_format_nvm:
+                format_cdw10 = cmd.cdw10;
+                format_nsid = cmd.nsid;
+                std::this_thread::sleep_for(m_duration);
+                break;
+            default:
+                throw std::runtime_error("Invalid opcode");
+        }
+    }
+
+    unsigned commands{0};
+    unsigned status_polls{0};
+    std::uint32_t sanitize_action{0};
+    std::uint32_t format_cdw10{0};
+    std::uint32_t format_nsid{0};
+    bool fail{false};
+
+private:
+    std::uint32_t m_sanicap;
+    std::chrono::milliseconds m_duration;
+    Clock::time_point m_started{};
+    bool m_sanitizing{false};
+};
+
+EraseSettings make_settings() {
+    auto settings = get_default_erase_settings();
+    settings.poll_interval = std::chrono::milliseconds{5};
+    settings.timeout = std::chrono::seconds{5};
+    return settings;
+}
+
+}
+
+TEST(SecureEraseTest, SanitizeReportsProgress) {
+    FakeNvmeController controller{SANITIZE_CRYPTO_ERASE_SUPPORTED | SANITIZE_BLOCK_ERASE_SUPPORTED,
+                                  std::chrono::milliseconds{100}};
+    std::vector<std::uint32_t> progress{};
+    std::atomic<bool> cancelled{false};
+
+    const auto method = secure_erase(controller, make_settings(),
+                                     [&progress](std::uint32_t percent) { progress.push_back(percent); }, cancelled);
+
+    EXPECT_EQ(EraseMethod::SANITIZE_CRYPTO_ERASE, method);
+    EXPECT_EQ(std::uint32_t(SanitizeAction::CRYPTO_ERASE), controller.sanitize_action);
+    ASSERT_LT(2u, progress.size());
+    EXPECT_EQ(100u, progress.back());
+    for (std::size_t i = 1; i < progress.size(); ++i) {
+        EXPECT_LT(progress[i - 1], progress[i]);
+    }
+}
+
+TEST(SecureEraseTest, BlockEraseIsUsedWithoutCryptoErase) {
+    FakeNvmeController controller{SANITIZE_BLOCK_ERASE_SUPPORTED | SANITIZE_OVERWRITE_SUPPORTED,
+                                  std::chrono::milliseconds{10}};
+    std::atomic<bool> cancelled{false};
+    EXPECT_EQ(EraseMethod::SANITIZE_BLOCK_ERASE, secure_erase(controller, make_settings(), {}, cancelled));
+    EXPECT_EQ(std::uint32_t(SanitizeAction::BLOCK_ERASE), controller.sanitize_action);
+}
+
+TEST(SecureEraseTest, FormatIsUsedWithoutSanitize) {
+    FakeNvmeController controller{SANITIZE_OVERWRITE_SUPPORTED, std::chrono::milliseconds{10}};
+    std::vector<std::uint32_t> progress{};
+    std::atomic<bool> cancelled{false};
+
+    const auto method = secure_erase(controller, make_settings(),
+                                     [&progress](std::uint32_t percent) { progress.push_back(percent); }, cancelled);
+
+    EXPECT_EQ(EraseMethod::FORMAT_USER_DATA_ERASE, method);
+    EXPECT_EQ(std::uint32_t(SecureEraseSettings::USER_DATA_ERASE), controller.format_cdw10);
+    EXPECT_EQ(0xffffffffu, controller.format_nsid);
+    EXPECT_EQ(0u, controller.status_polls);
+    EXPECT_EQ(std::vector<std::uint32_t>{100}, progress);
+}
+
+TEST(SecureEraseTest, FailedAndUnfinishedSanitizeThrows) {
+    std::atomic<bool> cancelled{false};
+    FakeNvmeController failing{SANITIZE_CRYPTO_ERASE_SUPPORTED, std::chrono::milliseconds{10}};
+    failing.fail = true;
+    EXPECT_THROW(secure_erase(failing, make_settings(), {}, cancelled), std::runtime_error);
+
+    FakeNvmeController slow{SANITIZE_CRYPTO_ERASE_SUPPORTED, std::chrono::milliseconds{10000}};
+    auto settings = make_settings();
+    settings.timeout = std::chrono::seconds{0};
+    EXPECT_THROW(secure_erase(slow, settings, {}, cancelled), std::runtime_error);
+    EXPECT_EQ(1u, slow.status_polls);
+}
+
+TEST(SecureEraseTest, RegistryLimitsConcurrentErases) {
+    SecureEraseRegistry registry{2};
+    std::atomic<unsigned> running{0};
+    std::atomic<unsigned> max_running{0};
+
+    std::vector<std::future<EraseMethod>> erases{};
+    for (const auto& drive : {"drive-1", "drive-2", "drive-3", "drive-4", "drive-5"}) {
+        erases.push_back(std::async(std::launch::async, [&, drive]() {
+            auto slot = registry.acquire(drive);
+            const unsigned now_running = ++running;
+            unsigned expected = max_running;
+            while (now_running > expected && !max_running.compare_exchange_weak(expected, now_running)) {}
+            FakeNvmeController controller{SANITIZE_CRYPTO_ERASE_SUPPORTED, std::chrono::milliseconds{50}};
+            const auto method = secure_erase(controller, make_settings(), {}, slot.get_cancel_flag());
+            --running;
+            return method;
+        }));
+    }
+    for (auto& erase : erases) {
+        EXPECT_EQ(EraseMethod::SANITIZE_CRYPTO_ERASE, erase.get());
+    }
+    EXPECT_EQ(2u, max_running);
+    EXPECT_EQ(0u, registry.get_running_count());
+}
+
+TEST(SecureEraseTest, ErasesAreCancelledPerDrive) {
+    SecureEraseRegistry registry{1};
+    EXPECT_FALSE(registry.cancel("drive-1"));
+
+    auto running = std::async(std::launch::async, [&registry]() {
+        auto slot = registry.acquire("drive-1");
+        FakeNvmeController controller{SANITIZE_CRYPTO_ERASE_SUPPORTED, std::chrono::milliseconds{10000}};
+        secure_erase(controller, make_settings(), {}, slot.get_cancel_flag());
+    });
+    while (0 == registry.get_running_count()) {
+        std::this_thread::yield();
+    }
+    EXPECT_THROW(registry.acquire("drive-1"), std::runtime_error);
+
+    // waits for the slot taken by the first drive
+    auto waiting = std::async(std::launch::async, [&registry]() {
+        auto slot = registry.acquire("drive-2");
+    });
+    auto other = std::async(std::launch::async, [&registry]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        auto slot = registry.acquire("drive-3");
+        FakeNvmeController controller{SANITIZE_BLOCK_ERASE_SUPPORTED, std::chrono::milliseconds{10}};
+        return secure_erase(controller, make_settings(), {}, slot.get_cancel_flag());
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_TRUE(registry.cancel("drive-2"));
+    EXPECT_THROW(waiting.get(), std::runtime_error);
+
+    const auto start = Clock::now();
+    EXPECT_TRUE(registry.cancel("drive-1"));
+    EXPECT_THROW(running.get(), std::runtime_error);
+    EXPECT_GT(std::chrono::seconds{1}, Clock::now() - start);
+
+    EXPECT_EQ(EraseMethod::SANITIZE_BLOCK_ERASE, other.get());
+    EXPECT_EQ(0u, registry.get_running_count());
+}
@@ -0,0 +1,317 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section PortUpdateSchedulerTests
+ * */
+
+#include "state_machine/port_update_scheduler.hpp"
+#include "state_machine/port_state_worker.hpp"
+#include "gas/pcie_access_interface.hpp"
+#include "sysfs/uevent_listener.hpp"
+#include "tools/gas_tool.hpp"
+#include "agent-framework/module/pnc_components.hpp"
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <future>
+#include <map>
+#include <set>
+#include <thread>
+#include <unistd.h>
+
+using namespace agent::pnc::state_machine;
+using namespace agent::pnc::discovery;
+using namespace agent::pnc::sysfs;
+using namespace agent::pnc::tools;
+using namespace agent::pnc::gas;
+using namespace agent::pnc::gas::mrpc;
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+using ::testing::_;
+using ::testing::Invoke;
+
+namespace {
+
+using Ms = std::chrono::milliseconds;
+
+constexpr Ms GAS_LATENCY{20};
+constexpr std::uint8_t BRIDGES = 8;
+constexpr std::uint8_t PORTS = 4;
+constexpr std::uint8_t SEC_BUS_NUM = 5;
+const std::string BRIDGE_PATH = "/sys/devices/pci0000:00/0000:00:03.0";
+
+/*! Event of the block device of a drive below the bridge, sent by the kernel when the drive is enumerated */
+Uevent drive_added(std::uint8_t bridge) {
+    Uevent event{};
+    event.action = "add";
+    event.subsystem = "block";
+    event.devtype = "disk";
+    event.devpath = UeventListener::get_bridge_devpath(BRIDGE_PATH, SEC_BUS_NUM, std::uint8_t(bridge - 1))
+        + "0/nvme/nvme0/nvme0n1";
+    return event;
+}
+
+/*!
+ * GasTool with latencies of MRPC commands, keeps state of the bridges of one partition.
+ * Drives of bound ports are added at once, unless they are held until add_drive() is called.
+ * */
+class MockGasTool : public GasTool {
+public:
+    MockGasTool() {
+        ON_CALL(*this, get_partition_binding_info(_, _)).WillByDefault(Invoke(
+            [](const GlobalAddressSpaceRegisters&, std::uint8_t) {
+                std::this_thread::sleep_for(GAS_LATENCY);
+                return PartitionBindingInfo{nullptr};
+            }));
+        ON_CALL(*this, get_available_bridge_id(_)).WillByDefault(Invoke([this](const PartitionBindingInfo&) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            for (std::uint8_t bridge = 1; bridge < BRIDGES; ++bridge) {
+                if (0 == m_bound.count(bridge)) {
+                    return bridge;
+                }
+            }
+            throw std::runtime_error("No available bridges");
+        }));
+        ON_CALL(*this, bind_to_partition(_, _, _, _)).WillByDefault(Invoke(this, &MockGasTool::bind));
+        ON_CALL(*this, get_presence_bitmask(_)).WillByDefault(Invoke([](const GlobalAddressSpaceRegisters&) {
+            std::this_thread::sleep_for(GAS_LATENCY);
+            return std::uint64_t{0xff};
+        }));
+    }
+
+    MOCK_CONST_METHOD2(get_partition_binding_info, PartitionBindingInfo(const GlobalAddressSpaceRegisters&,
+                                                                        std::uint8_t));
+    MOCK_CONST_METHOD1(get_available_bridge_id, std::uint8_t(const PartitionBindingInfo&));
+    MOCK_CONST_METHOD4(bind_to_partition, void(const GlobalAddressSpaceRegisters&, std::uint8_t, std::uint8_t,
+                                               std::uint8_t));
+    MOCK_CONST_METHOD1(get_presence_bitmask, std::uint64_t(const GlobalAddressSpaceRegisters&));
+
+    /*! Drive of the port is not added after binding until add_drive() is called */
+    void hold_drive(std::uint8_t port) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_held.insert(port);
+    }
+
+    /*! Adds drive of the bound port */
+    void add_drive(std::uint8_t port) {
+        std::uint8_t bridge{};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            bridge = m_ports.at(port);
+        }
+        UeventListener::get_instance().dispatch(drive_added(bridge));
+    }
+
+    /*! Waits until given number of ports is bound */
+    void wait_for_bindings(std::size_t count) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_bound_condition.wait(lock, [this, count]() { return m_ports.size() >= count; });
+    }
+
+private:
+    void bind(const GlobalAddressSpaceRegisters&, std::uint8_t port, std::uint8_t, std::uint8_t bridge) {
+        std::this_thread::sleep_for(GAS_LATENCY);
+        bool held{};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (!m_bound.insert(bridge).second) {
+                throw std::runtime_error("Bridge already bound");
+            }
+            m_ports[port] = bridge;
+            held = 0 != m_held.count(port);
+        }
+        m_bound_condition.notify_all();
+        if (!held) {
+            UeventListener::get_instance().dispatch(drive_added(bridge));
+        }
+    }
+
+    std::mutex m_mutex{};
+    std::condition_variable m_bound_condition{};
+    std::set<std::uint8_t> m_bound{};
+    std::set<std::uint8_t> m_held{};
+    std::map<std::uint8_t, std::uint8_t> m_ports{};
+};
+
+}
+
+/*! Ports of a switch bound by the PortStateWorker, GAS of the switch is a file */
+class PortUpdateSchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() {
+        char file_name[] = "/tmp/pnc-gas-XXXXXX";
+        const int fd = mkstemp(file_name);
+        ASSERT_NE(-1, fd);
+        ASSERT_EQ(0, ftruncate(fd, NTB_MEM_MAPPED_REG_OFFSET));
+        close(fd);
+        memory_path = file_name;
+
+        Switch sw{};
+        sw.set_memory_path(memory_path);
+        sw.set_bridge_path(BRIDGE_PATH);
+        sw.set_sec_bus_num(SEC_BUS_NUM);
+        switch_uuid = sw.get_uuid();
+        get_manager<Switch>().add_entry(sw);
+        for (std::uint8_t phys_port_id = 0; phys_port_id < PORTS; ++phys_port_id) {
+            Port port{switch_uuid};
+            port.set_phys_port_id(phys_port_id);
+            port_uuids.push_back(port.get_uuid());
+            get_manager<Port>().add_entry(port);
+        }
+        toolset.gas_tool = gas_tool;
+    }
+
+    void TearDown() {
+        PcieAccessInterface::get_instance()->deinit();
+        get_manager<Port>().clear_entries();
+        get_manager<Switch>().clear_entries();
+        std::remove(memory_path.c_str());
+    }
+
+    /*! Binds the port as done in the port state machine */
+    std::uint8_t bind(std::uint8_t port) const {
+        PortStateWorker worker{DiscoveryManager{nullptr, toolset}, toolset};
+        return worker.bind_to_host(switch_uuid, port_uuids[port]);
+    }
+
+    std::shared_ptr<::testing::NiceMock<MockGasTool>> gas_tool = std::make_shared<::testing::NiceMock<MockGasTool>>();
+    Toolset toolset{};
+    std::string memory_path{};
+    std::string switch_uuid{};
+    std::vector<std::string> port_uuids{};
+};
+
+TEST_F(PortUpdateSchedulerTest, SlowPortDoesNotDelayOtherPorts) {
+    constexpr std::uint8_t SLOW = 0;
+    constexpr std::uint8_t FAST = 1;
+    PortUpdateScheduler scheduler{2};
+    std::promise<void> fast_port_bound{};
+
+    gas_tool->hold_drive(SLOW);
+    ASSERT_TRUE(scheduler.schedule("slow", [this]() { bind(SLOW); }));
+    gas_tool->wait_for_bindings(1);
+    ASSERT_TRUE(scheduler.schedule("fast", [this, &fast_port_bound]() {
+        bind(FAST);
+        fast_port_bound.set_value();
+    }));
+
+    // drive of the slow port is not added yet, the fast one is bound in the meantime
+    fast_port_bound.get_future().wait();
+    EXPECT_TRUE(scheduler.is_busy("slow"));
+
+    // slow port is serialized, the fast one may be scheduled again
+    EXPECT_FALSE(scheduler.schedule("slow", []() { FAIL() << "Port updated twice at the same time"; }));
+    while (scheduler.is_busy("fast")) {
+        std::this_thread::sleep_for(Ms(1));
+    }
+    EXPECT_TRUE(scheduler.schedule("fast", []() { }));
+
+    gas_tool->add_drive(SLOW);
+    scheduler.wait_all();
+    EXPECT_FALSE(scheduler.is_busy("slow"));
+    EXPECT_TRUE(scheduler.schedule("slow", []() { }));
+    scheduler.wait_all();
+}
+
+TEST_F(PortUpdateSchedulerTest, ConcurrentBindingsUseDistinctBridges) {
+    EXPECT_CALL(*gas_tool, bind_to_partition(_, _, _, _)).Times(PORTS);
+    PortUpdateScheduler scheduler{PORTS};
+
+    std::mutex mutex{};
+    std::set<std::uint8_t> bridges{};
+    std::atomic<unsigned> bound{0};
+    for (std::uint8_t port = 0; port < PORTS; ++port) {
+        gas_tool->hold_drive(port);
+        scheduler.schedule(std::to_string(port), [this, &mutex, &bridges, &bound, port]() {
+            const auto bridge_id = bind(port);
+            ++bound;
+            std::lock_guard<std::mutex> lock{mutex};
+            bridges.insert(bridge_id);
+        });
+    }
+
+    // waiting for sysfs is not serialized by the arbiter, all ports are bound before any drive is added
+    gas_tool->wait_for_bindings(PORTS);
+    EXPECT_EQ(0u, bound.load());
+    for (std::uint8_t port = 0; port < PORTS; ++port) {
+        gas_tool->add_drive(port);
+    }
+    scheduler.wait_all();
+
+    EXPECT_EQ(PORTS, bound.load());
+    EXPECT_EQ(PORTS, bridges.size());
+}
+
+TEST_F(PortUpdateSchedulerTest, NumberOfWorkersIsBounded) {
+    PortUpdateScheduler scheduler{2};
+    std::mutex mutex{};
+    std::condition_variable condition{};
+    unsigned running{0};
+    unsigned max_running{0};
+    std::promise<void> release{};
+    std::shared_future<void> released = release.get_future().share();
+
+    for (unsigned port = 0; port < 6; ++port) {
+        EXPECT_TRUE(scheduler.schedule(std::to_string(port), [&, released]() {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                max_running = std::max(max_running, ++running);
+            }
+            condition.notify_all();
+            released.wait();
+            gas_tool->get_presence_bitmask(GlobalAddressSpaceRegisters{});
+            std::lock_guard<std::mutex> lock{mutex};
+            --running;
+        }));
+    }
+
+    // workers are held until both of them are busy, other ports wait for a free worker
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        condition.wait(lock, [&running]() { return 2 <= running; });
+    }
+    release.set_value();
+    scheduler.wait_all();
+    EXPECT_EQ(2u, max_running);
+}
+
+TEST_F(PortUpdateSchedulerTest, FailedUpdateReleasesPort) {
+    EXPECT_CALL(*gas_tool, get_presence_bitmask(_)).WillOnce(Invoke([](const GlobalAddressSpaceRegisters&) {
+        std::this_thread::sleep_for(GAS_LATENCY);
+        throw std::runtime_error("MRPC failed");
+        return std::uint64_t{0};
+    }));
+    PortUpdateScheduler scheduler{1};
+
+    EXPECT_TRUE(scheduler.schedule("port", [this]() {
+        gas_tool->get_presence_bitmask(GlobalAddressSpaceRegisters{});
+    }));
+    scheduler.wait_all();
+    EXPECT_FALSE(scheduler.is_busy("port"));
+    EXPECT_TRUE(scheduler.schedule("port", []() { }));
+    scheduler.wait_all();
+}
@@ -0,0 +1,102 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file fake_uevent_injector.hpp
+ * @brief Sends kernel formatted uevents to UeventListener
+ * */
+
+#pragma once
+
+#include "sysfs/uevent_listener.hpp"
+
+#include <stdexcept>
+#include <string>
+
+extern "C" {
+#include <sys/socket.h>
+#include <unistd.h>
+}
+
+namespace agent {
+namespace pnc {
+namespace sysfs {
+
+/*! Replaces netlink socket of the listener with a socket pair */
+class FakeUeventInjector final {
+public:
+    /*!
+     * @brief Starts listener reading from the injector
+     * @param[in] listener Listener to be fed with events
+     * */
+    explicit FakeUeventInjector(UeventListener& listener) : m_listener(listener) {
+        int fds[2];
+        if (0 != ::socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, fds)) {
+            throw std::runtime_error("Cannot create socket pair");
+        }
+        m_socket = fds[0];
+        m_listener.start(fds[1]);
+    }
+
+    /*! @brief Stops listener */
+    ~FakeUeventInjector() {
+        m_listener.stop();
+        ::close(m_socket);
+    }
+
+    FakeUeventInjector(const FakeUeventInjector&) = delete;
+    FakeUeventInjector& operator=(const FakeUeventInjector&) = delete;
+
+    /*!
+     * @brief Sends raw message
+     * @param[in] message Message, may contain NUL characters
+     * */
+    void send(const std::string& message) {
+        if (::send(m_socket, message.data(), message.size(), 0) < 0) {
+            throw std::runtime_error("Cannot send uevent");
+        }
+    }
+
+    /*!
+     * @brief Sends event in the kernel format
+     * @param[in] action Event action
+     * @param[in] devpath Device path relative to /sys
+     * @param[in] subsystem Device subsystem
+     * @param[in] devtype Device type, not sent if empty
+     * */
+    void inject(const std::string& action, const std::string& devpath, const std::string& subsystem,
+                const std::string& devtype = {}) {
+        std::string message = action + "@" + devpath + '\0';
+        message += "ACTION=" + action + '\0';
+        message += "DEVPATH=" + devpath + '\0';
+        message += "SUBSYSTEM=" + subsystem + '\0';
+        if (!devtype.empty()) {
+            message += "DEVTYPE=" + devtype + '\0';
+        }
+        message += std::string("SEQNUM=1") + '\0';
+        send(message);
+    }
+
+private:
+    UeventListener& m_listener;
+    int m_socket{-1};
+};
+
+}
+}
+}
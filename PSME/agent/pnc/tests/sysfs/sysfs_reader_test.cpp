@@ -0,0 +1,50 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section SysfsReaderTests
+ * */
+
+#include "sysfs/sysfs_reader.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace agent::pnc::sysfs;
+
+using Names = std::vector<std::string>;
+
+TEST(SysfsReaderTest, PciDevicesOnNamespacePath) {
+    EXPECT_EQ((Names{"0000:00:03.0", "0000:02:00.0", "0000:03:04.0", "0000:05:00.0"}),
+        SysfsReader::get_pci_devices_on_path("/sys/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:04.0/"
+                                             "0000:05:00.0/nvme/nvme0/nvme0n1"));
+}
+
+TEST(SysfsReaderTest, PciDevicesOnPartitionPath) {
+    EXPECT_EQ((Names{"0000:00:1f.2"}),
+        SysfsReader::get_pci_devices_on_path("/sys/devices/pci0000:00/0000:00:1f.2/ata1/host0/target0:0:0/"
+                                             "0:0:0:0/block/sda/sda1"));
+}
+
+TEST(SysfsReaderTest, NoPciDevicesOnVirtualPath) {
+    EXPECT_TRUE(SysfsReader::get_pci_devices_on_path("/sys/devices/virtual/block/loop0").empty());
+    EXPECT_TRUE(SysfsReader::get_pci_devices_on_path("").empty());
+    // names of the other format are skipped
+    EXPECT_TRUE(SysfsReader::get_pci_devices_on_path("/sys/devices/pci0000:00/0000:00:03/00:03.0").empty());
+}
@@ -0,0 +1,132 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section UeventListenerTests
+ * */
+
+#include "sysfs/uevent_listener.hpp"
+#include "fake_uevent_injector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace agent::pnc::sysfs;
+
+namespace {
+
+constexpr const char SWITCH_PATH[] = "/sys/devices/pci0000:00/0000:00:03.0/0000:02:00.0";
+constexpr const char BRIDGE_DEVPATH[] = "/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:04.";
+constexpr const char BLOCK_DEVPATH[] =
+    "/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:04.0/0000:05:00.0/nvme/nvme0/nvme0n1";
+const std::chrono::milliseconds WAIT{2000};
+const std::chrono::milliseconds SHORT_WAIT{50};
+
+}
+
+TEST(UeventListenerTest, ParseKernelMessage) {
+    const std::string message = std::string("add@/devices/virtual/block/loop0") + '\0'
+        + "ACTION=add" + '\0' + "SUBSYSTEM=block" + '\0' + "DEVTYPE=disk" + '\0';
+    const auto event = Uevent::parse(message.data(), message.size());
+    EXPECT_EQ("add", event.action);
+    EXPECT_EQ("/devices/virtual/block/loop0", event.devpath);
+    EXPECT_EQ("block", event.subsystem);
+    EXPECT_EQ("disk", event.devtype);
+}
+
+TEST(UeventListenerTest, ParseInvalidMessage) {
+    const std::string udev_message = std::string("libudev") + '\0' + "SUBSYSTEM=block";
+    EXPECT_TRUE(Uevent::parse(udev_message.data(), udev_message.size()).action.empty());
+    const std::string empty_action = "@/devices";
+    EXPECT_TRUE(Uevent::parse(empty_action.data(), empty_action.size()).action.empty());
+}
+
+TEST(UeventListenerTest, Devpaths) {
+    EXPECT_EQ("/devices/pci0000:00/0000:00:03.0/0000:02:00.0", UeventListener::get_devpath(SWITCH_PATH));
+    EXPECT_EQ("/devices/pci0000:00", UeventListener::get_devpath("/sys/devices/pci0000:00/"));
+    EXPECT_EQ(BRIDGE_DEVPATH, UeventListener::get_bridge_devpath(SWITCH_PATH, 0x03, 0x04));
+    EXPECT_EQ("/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:1a:0b.",
+        UeventListener::get_bridge_devpath(SWITCH_PATH, 0x1a, 0x0b));
+}
+
+TEST(UeventListenerTest, Matches) {
+    const auto predicate = UeventListener::matches("add", "block", BRIDGE_DEVPATH);
+    Uevent event{};
+    event.action = "add";
+    event.devpath = BLOCK_DEVPATH;
+    event.subsystem = "block";
+    EXPECT_TRUE(predicate(event));
+    event.action = "remove";
+    EXPECT_FALSE(predicate(event));
+    event.action = "add";
+    event.subsystem = "nvme";
+    EXPECT_FALSE(predicate(event));
+    event.subsystem = "block";
+    event.devpath = "/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:05.0/nvme0n1";
+    EXPECT_FALSE(predicate(event));
+}
+
+TEST(UeventListenerTest, WaitForInjectedEvent) {
+    UeventListener listener{};
+    FakeUeventInjector injector{listener};
+    ASSERT_TRUE(listener.is_running());
+
+    auto expectation = listener.expect(UeventListener::matches("add", "block", BRIDGE_DEVPATH));
+    std::thread thread([&injector]() {
+        std::this_thread::sleep_for(SHORT_WAIT);
+        injector.inject("add", "/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:04.0", "pci");
+        injector.inject("add", BLOCK_DEVPATH, "block", "disk");
+    });
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(listener.wait_for(expectation, WAIT));
+    EXPECT_GT(WAIT, std::chrono::steady_clock::now() - start);
+    thread.join();
+}
+
+TEST(UeventListenerTest, EventBeforeWait) {
+    UeventListener listener{};
+    FakeUeventInjector injector{listener};
+
+    auto expectation = listener.expect(UeventListener::matches("remove", "pci", BRIDGE_DEVPATH));
+    injector.inject("remove", "/devices/pci0000:00/0000:00:03.0/0000:02:00.0/0000:03:04.0/0000:05:00.0", "pci");
+    // the event is remembered until waiting starts
+    EXPECT_TRUE(listener.wait_for(expectation, WAIT));
+    EXPECT_TRUE(listener.wait_for(expectation, SHORT_WAIT));
+}
+
+TEST(UeventListenerTest, Timeout) {
+    UeventListener listener{};
+    FakeUeventInjector injector{listener};
+
+    auto expectation = listener.expect(UeventListener::matches("add", "block", BRIDGE_DEVPATH));
+    injector.inject("add", "/devices/virtual/block/loop0", "block", "disk");
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(listener.wait_for(expectation, SHORT_WAIT));
+    EXPECT_LE(SHORT_WAIT, std::chrono::steady_clock::now() - start);
+}
+
+TEST(UeventListenerTest, NotStartedListenerTimesOut) {
+    UeventListener listener{};
+    auto expectation = listener.expect(UeventListener::matches("add", "block", BRIDGE_DEVPATH));
+    EXPECT_FALSE(listener.wait_for(expectation, SHORT_WAIT));
+    EXPECT_FALSE(listener.wait_for(nullptr, SHORT_WAIT));
+}
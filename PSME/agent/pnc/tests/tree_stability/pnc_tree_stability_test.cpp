@@ -403,3 +403,36 @@ TEST_F(PncTreeStabilityTest, DryStability) {
     ASSERT_EQ(dry_stabilizer.stabilize(function_2, pcie_device_2), constants::PCIE_FUNCTION_2_PERSISTENT_UUID);
 
 }
+
+
+TEST_F(PncTreeStabilityTest, RestabilizationKeepsPersistentUUIDs) {
+    const auto drive_epoch = get_manager<Drive>().get_current_epoch();
+    const auto endpoint_epoch = get_manager<Endpoint>().get_current_epoch();
+
+    ASSERT_EQ(PncTreeStabilizer().stabilize(constants::MANAGER_PERSISTENT_UUID), constants::MANAGER_PERSISTENT_UUID);
+
+    // Keys did not change, so no resource nor relation was modified
+    ASSERT_EQ(drive_epoch, get_manager<Drive>().get_current_epoch());
+    ASSERT_EQ(endpoint_epoch, get_manager<Endpoint>().get_current_epoch());
+    ASSERT_TRUE(get_manager<Endpoint>().entry_exists(constants::ENDPOINT_1_PERSISTENT_UUID));
+    ASSERT_TRUE(get_manager<Drive>().entry_exists(constants::DRIVE_1_PERSISTENT_UUID));
+    ASSERT_TRUE((get_m2m_manager<Endpoint, Port>().entry_exists(constants::ENDPOINT_1_PERSISTENT_UUID, constants::PORT_1_PERSISTENT_UUID)));
+}
+
+
+TEST_F(PncTreeStabilityTest, ChangedKeyUpdatesRelations) {
+    get_manager<Drive>().get_entry_reference(constants::DRIVE_1_PERSISTENT_UUID)->set_fru_info(
+        {"replaced_drive_serial", "", "", ""});
+
+    const auto drive_uuid = PncTreeStabilizer().stabilize_drive(constants::DRIVE_1_PERSISTENT_UUID);
+    ASSERT_NE(drive_uuid, constants::DRIVE_1_PERSISTENT_UUID);
+    ASSERT_TRUE(get_manager<Drive>().entry_exists(drive_uuid));
+
+    const auto endpoint = get_manager<Endpoint>().get_entry(constants::ENDPOINT_1_PERSISTENT_UUID);
+    ASSERT_EQ(1, endpoint.get_connected_entities().size());
+    ASSERT_EQ(drive_uuid, endpoint.get_connected_entities().get_array().front().get_entity().value());
+
+    ASSERT_TRUE((get_m2m_manager<Drive, PcieFunction>().entry_exists(drive_uuid, constants::PCIE_FUNCTION_1_PERSISTENT_UUID)));
+    ASSERT_FALSE((get_m2m_manager<Drive, PcieFunction>().parent_exists(constants::DRIVE_1_PERSISTENT_UUID)));
+    ASSERT_TRUE((get_m2m_manager<StorageSubsystem, Drive>().entry_exists(constants::STORAGE_SUBSYSTEM_PERSISTENT_UUID, drive_uuid)));
+}
@@ -22,6 +22,10 @@
 #include "agent-framework/threading/thread.hpp"
 #include "hotswap/hotswap_manager.hpp"
 
+#include <map>
+#include <set>
+#include <string>
+
 namespace agent {
 namespace storage {
 
@@ -40,8 +44,15 @@ public:
     ~HotswapWatcher();
 
 private:
-    void handle_hotswap();
-    bool detect_hotswap(int, int);
+    using DeviceNames = std::set<std::string>;
+
+    void handle_hotswap(const DeviceNames&, bool);
+    bool detect_hotswap(int, int, int, DeviceNames&, bool&);
+    void read_disk_links();
+    void update_disk_link(const std::string&, bool, DeviceNames&);
+
+    /*! Kernel device names of watched disk links */
+    std::map<std::string, std::string> m_disk_links{};
 };
 
 }
@@ -26,6 +26,8 @@
 #include <string>
 #include <map>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace agent {
 namespace storage {
@@ -39,6 +41,19 @@ class Response;
 class Manager {
 public:
     using OptionMapper = std::map<std::string, std::string>;
+    using Responses = std::vector<Response>;
+
+    /*! Complete target definition applied with a single batch */
+    struct TargetDefinition {
+        /*! Target id */
+        std::int32_t target_id;
+        /*! Target name */
+        std::string target_name;
+        /*! Bind options, each one is sent as a separate bind request */
+        std::vector<OptionMapper> bindings;
+        /*! Lun id and backing-store path pairs */
+        std::vector<std::pair<std::uint64_t, std::string>> luns;
+    };
 
     Manager() = default;
     /*! Disable copy */
@@ -141,7 +156,37 @@ public:
      */
     Response show_targets() const;
 
+    /*!
+     * @brief Create target with all its bindings and luns
+     *
+     * Target is created first, then bind and create lun requests are
+     * pipelined: all of them are sent to tgtd before any response is read.
+     * When target creation fails, no further requests are sent.
+     *
+     * @param definition Target definition
+     * @return Responses in order: create target, bindings, luns
+     */
+    Responses apply_target(const TargetDefinition& definition) const;
+
 private:
+    /*!
+     * @brief Send request to tgtd and read its response
+     *
+     * Connection is retried when tgtd is not reachable.
+     * Errors are logged and an invalid response is returned.
+     *
+     * @param request Request to be sent
+     * @return Response message object
+     */
+    Response execute(Request& request) const;
+
+    /*!
+     * @brief Send all requests to tgtd before reading the responses
+     * @param requests Requests to be sent
+     * @return Responses in order of the requests
+     */
+    Responses execute_pipelined(std::vector<Request>& requests) const;
+
     /*!
      * @brief Prepare create target request
      *
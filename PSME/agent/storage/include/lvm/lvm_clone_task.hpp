@@ -35,13 +35,18 @@ public:
     /*!
      * @brief Constructor
      * @param[in] create_data Data to clone
+     * @param[in] task_uuid UUID of the task resource to report progress to
      * */
-    explicit LvmCloneTask(const LvmCreateData& create_data);
+    explicit LvmCloneTask(const LvmCreateData& create_data, const std::string& task_uuid = {});
 
-    /*! @brief Starts cloning */
+    /*!
+     * @brief Starts cloning
+     * @throw agent_framework::exceptions::LvmError if the data cannot be copied
+     * */
     void operator()();
 private:
     LvmCreateData m_create_data{};
+    std::string m_task_uuid{};
 
     std::string get_source() const;
     std::string get_dest() const;
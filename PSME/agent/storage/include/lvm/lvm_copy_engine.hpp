@@ -0,0 +1,135 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file lvm_copy_engine.hpp
+ * @brief Block device copy engine used to clone logical volumes
+ * */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace json { class Value; }
+
+namespace agent {
+namespace storage {
+namespace lvm {
+
+/*!
+ * @brief Copies data between block devices (or regular files).
+ *
+ * Data is transferred with direct I/O by several workers, each using its own
+ * aligned buffer, so multiple reads and writes are in flight at once.
+ * Blocks containing only zeroes (and holes of sparse source files) are not
+ * written, the destination range is discarded or zeroed by the kernel instead.
+ * */
+class LvmCopyEngine {
+public:
+    /*! @brief Copy engine settings */
+    struct Settings {
+        /*! Size of a single I/O, rounded up to the direct I/O alignment */
+        std::size_t block_size;
+        /*! Number of I/Os in flight */
+        std::size_t queue_depth;
+        /*! Throughput limit in bytes per second, 0 means no limit */
+        std::uint64_t max_throughput;
+        /*! Skip writing blocks containing only zeroes */
+        bool detect_zeroes;
+    };
+
+    /*! @brief Statistics of a finished copy */
+    struct Statistics {
+        /*! Size of the source */
+        std::uint64_t total_bytes;
+        /*! Number of bytes written to the destination */
+        std::uint64_t written_bytes;
+        /*! Number of bytes of zero blocks and holes which were not written */
+        std::uint64_t skipped_bytes;
+        /*! Duration of the copy */
+        std::chrono::milliseconds duration;
+    };
+
+    /*! Progress callback, called with number of processed and total bytes */
+    using ProgressCallback = std::function<void(std::uint64_t, std::uint64_t)>;
+
+    /*! Default size of a single I/O */
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4 * 1024 * 1024;
+
+    /*! Default number of I/Os in flight */
+    static constexpr std::size_t DEFAULT_QUEUE_DEPTH = 4;
+
+    /*!
+     * @brief Get default settings
+     * @return Default copy engine settings
+     * */
+    static Settings get_default_settings();
+
+    /*!
+     * @brief Read settings from the "lvm-clone" section of agent configuration
+     *
+     * Recognized properties are "block-size", "queue-depth", "max-throughput"
+     * and "detect-zeroes". Missing properties keep their default values.
+     *
+     * @param[in] configuration Agent configuration
+     * @return Copy engine settings
+     * */
+    static Settings load_settings(const json::Value& configuration);
+
+    /*!
+     * @brief Constructor
+     * @param[in] settings Copy engine settings
+     * */
+    explicit LvmCopyEngine(const Settings& settings = get_default_settings());
+
+    /*!
+     * @brief Set progress callback.
+     *
+     * The callback is called from the worker threads, each time another
+     * percent of the source is processed.
+     *
+     * @param[in] callback Progress callback
+     * */
+    void set_progress_callback(const ProgressCallback& callback) {
+        m_progress_callback = callback;
+    }
+
+    /*!
+     * @brief Copy whole source to the destination
+     *
+     * @param[in] source Path to the source device or file
+     * @param[in] destination Path to the destination device or file
+     *
+     * @return Copy statistics
+     *
+     * @throw agent_framework::exceptions::LvmError on I/O errors
+     * */
+    Statistics copy(const std::string& source, const std::string& destination) const;
+
+private:
+    Settings m_settings;
+    ProgressCallback m_progress_callback{};
+};
+
+}
+}
+}
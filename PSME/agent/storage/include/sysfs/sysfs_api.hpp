@@ -26,6 +26,9 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 
 struct sysfs_device;
 
@@ -310,6 +313,22 @@ public:
      * */
     void get_hard_drives(vector<HardDrive>& drives);
 
+    /*!
+     * @brief Force ATA identification of given devices on next drives read.
+     *
+     * Drives are identified only once and cached until their sysfs path,
+     * device number or size changes. Devices which were replaced by a drive
+     * looking the same to sysfs have to be invalidated explicitly.
+     *
+     * @param[in] device_names Kernel names of block devices (e.g. sdb)
+     * */
+    void invalidate_drives(const std::set<string>& device_names);
+
+    /*!
+     * @brief Force ATA identification of all devices on next drives read.
+     * */
+    void invalidate_drives();
+
     /*!
      * @brief Gets list of partitions for given hard drive.
      * @param[in] drive Hard Drive.
@@ -327,6 +346,17 @@ private:
 
     string m_boot_device{};
 
+    /*! Identified drive with sysfs attributes it was identified with */
+    struct CachedDrive {
+        string sysfs_path;
+        string dev;
+        unsigned long long size;
+        HardDrive hard_drive;
+    };
+
+    std::unordered_map<string, CachedDrive> m_drive_cache{};
+    std::mutex m_drive_cache_mutex{};
+
     bool m_is_virtual_device(const struct sysfs_device* device);
     bool m_is_boot_device(const struct sysfs_device* device);
 
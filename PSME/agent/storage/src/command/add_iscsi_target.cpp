@@ -70,16 +70,6 @@ void get_target_chap_attributes(const AddIscsiTarget::Request& request,
 }
 
 
-void create_target(agent::storage::iscsi::tgt::Manager& manager,
-                   const std::int32_t target_id,
-                   const std::string& target_iqn) {
-    auto target_res = manager.create_target(target_id, target_iqn);
-    if (!target_res.is_valid()) {
-        Errors::throw_exception(target_res.get_error());
-    }
-}
-
-
 void delete_target(agent::storage::iscsi::tgt::Manager& manager,
                    const std::int32_t target_id) {
     auto response = manager.destroy_target(target_id);
@@ -90,54 +80,54 @@ void delete_target(agent::storage::iscsi::tgt::Manager& manager,
 }
 
 
-void set_initiator_name(agent::storage::iscsi::tgt::Manager& manager,
-                        const std::int32_t target_id,
-                        const std::string& initiator_name) {
-    if (initiator_name.empty()) {
-        log_debug(GET_LOGGER("storage-agent"), "No target initiator-name set.");
-        return;
-    }
-    agent::storage::iscsi::tgt::Manager::OptionMapper options;
-    options.emplace(std::make_pair("initiator-name", initiator_name));
-    auto response = manager.bind_target(target_id, options);
-    if (!response.is_valid()) {
-        Errors::throw_exception(response.get_error(),
-                                "Cannot bind initiator-name to target: ");
-    }
-}
-
-
-void set_initiator_address(agent::storage::iscsi::tgt::Manager& manager,
-                           const std::int32_t target_id,
-                           const std::string& initiator_address) {
-    if (initiator_address.empty()) {
-        log_debug(GET_LOGGER("storage-agent"), "No target initiator set.");
+void add_binding(agent::storage::iscsi::tgt::Manager::TargetDefinition& definition,
+                 const std::string& name, const std::string& value,
+                 std::vector<std::string>& error_messages) {
+    if (value.empty()) {
+        log_debug(GET_LOGGER("storage-agent"), "No target " << name << " set.");
         return;
     }
     agent::storage::iscsi::tgt::Manager::OptionMapper options;
-    options.emplace(std::make_pair("initiator-address", initiator_address));
-    auto response = manager.bind_target(target_id, options);
-    if (!response.is_valid()) {
-        Errors::throw_exception(response.get_error(),
-                                "Cannot bind initiator-address to target: ");
-    }
+    options.emplace(std::make_pair(name, value));
+    definition.bindings.emplace_back(std::move(options));
+    error_messages.emplace_back("Cannot bind " + name + " to target: ");
 }
 
 
-void create_luns(agent::storage::iscsi::tgt::Manager& manager,
-                 IscsiTarget& target, int target_id,
-                 const AddIscsiTarget::Request& request) {
+void create_target(agent::storage::iscsi::tgt::Manager& manager,
+                   IscsiTarget& target, const std::int32_t target_id,
+                   const AddIscsiTarget::Request& request) {
+    agent::storage::iscsi::tgt::Manager::TargetDefinition definition{target_id, request.get_target_iqn(), {}, {}};
+
+    // Error message prefixes of requests following target creation
+    std::vector<std::string> error_messages{};
+    add_binding(definition, "initiator-name",
+                request.get_initiator_iqn().has_value() ? request.get_initiator_iqn().value() : EMPTY_VALUE,
+                error_messages);
+    add_binding(definition, "initiator-address", TGT_INITIATOR_ADDRESS_ALL, error_messages);
+
+    std::vector<TargetLun> target_luns{};
     for (const auto& target_lun : request.get_target_luns()) {
         const auto drive = get_manager<LogicalDrive>().
             get_entry(target_lun.get_logical_drive());
+        definition.luns.emplace_back(target_lun.get_lun(), drive.get_device_path());
+        error_messages.emplace_back("Create lun error: ");
+        target_luns.push_back({target_lun.get_lun(), drive.get_uuid()});
+    }
 
-        auto lun_res = manager.create_lun(target_id,
-                                          target_lun.get_lun(),
-                                          drive.get_device_path());
-        if (!lun_res.is_valid()) {
-            Errors::throw_exception(lun_res.get_error(), "Create lun error: ");
+    const auto responses = manager.apply_target(definition);
+    if (!responses.front().is_valid()) {
+        Errors::throw_exception(responses.front().get_error());
+    }
+    for (std::size_t i = 1; i < responses.size(); ++i) {
+        if (!responses[i].is_valid()) {
+            delete_target(manager, target_id);
+            Errors::throw_exception(responses[i].get_error(), error_messages[i - 1]);
         }
-        target.add_target_lun({target_lun.get_lun(), drive.get_uuid()});
+    }
+
+    for (auto& target_lun : target_luns) {
+        target.add_target_lun(std::move(target_lun));
     }
 }
 
@@ -220,18 +210,7 @@ void add_iscsi_target(const AddIscsiTarget::Request& request, AddIscsiTarget::Re
         create_target_id();
     target.set_target_id(target_id);
     agent::storage::iscsi::tgt::Manager manager{};
-    create_target(manager, int(target_id), request.get_target_iqn());
-    set_initiator_name(manager, int(target_id),
-                       request.get_initiator_iqn().has_value() ? request.get_initiator_iqn().value() : EMPTY_VALUE);
-    set_initiator_address(manager, int(target_id), TGT_INITIATOR_ADDRESS_ALL);
-
-    try {
-        create_luns(manager, target, int(target_id), request);
-    }
-    catch (...) {
-        delete_target(manager, int(target_id));
-        throw;
-    }
+    create_target(manager, target, int(target_id), request);
 
     TgtConfig tgtConfig(iscsi_data.get_configuration_path());
     try {
@@ -195,7 +195,7 @@ void add_logical_drive(const AddLogicalDrive::Request& req, AddLogicalDrive::Res
         task_creator.prepare_task();
 
         task_creator.add_subtask(lvm_create_clone_subtask);
-        task_creator.add_subtask(LvmCloneTask{lvm_create_data});
+        task_creator.add_subtask(LvmCloneTask{lvm_create_data, task_creator.get_task_resource().get_uuid()});
         task_creator.set_promised_response(promised_response_builder);
         task_creator.set_promised_error_thrower(promised_exception_builder);
 
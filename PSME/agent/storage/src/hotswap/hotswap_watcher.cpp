@@ -21,6 +21,7 @@
 
 #include "hotswap/hotswap_watcher.hpp"
 #include "logger/logger_factory.hpp"
+#include "sysfs/sysfs_api.hpp"
 
 extern "C" {
 #include <sys/inotify.h>
@@ -29,28 +30,46 @@ extern "C" {
 #include <unistd.h>
 #include <string.h>
 #include <linux/limits.h>
+#include <dirent.h>
+#include <libgen.h>
+#include <stdlib.h>
 }
 
+#include <chrono>
+
 using namespace agent::storage;
 using namespace agent::storage::hotswap_discovery;
 
 namespace {
     constexpr int TIMEOUT_MS = 10000;
-    constexpr int BUFFER_LEN = sizeof(struct inotify_event) + NAME_MAX + 1;
+    /* events are handled when no new one comes for this time... */
+    constexpr int DEBOUNCE_MS = 1000;
+    /* ...but not later than this after the first one */
+    constexpr std::chrono::milliseconds MAX_DEBOUNCE{10000};
+    constexpr std::size_t BUFFER_LEN = 64 * (sizeof(struct inotify_event) + NAME_MAX + 1);
     constexpr char WATCH_DISK_PATH[] = "/dev/disk/by-id/";
     constexpr char DEVICE_MAPPER_PREFIX[] = "dm-";
 
-    /* INotify event message deleter */
-    struct INotifyDeleter {
-        void operator()(struct inotify_event* event) const {
-            delete event;
+    /* Returns kernel name of the device pointed by the disk link (e.g. sdb) */
+    std::string get_device_name(const std::string& link_name) {
+        char resolved[PATH_MAX];
+        if (nullptr == realpath((std::string(WATCH_DISK_PATH) + link_name).c_str(), resolved)) {
+            return {};
         }
-    };
-    using INotify = std::unique_ptr<struct inotify_event, INotifyDeleter>;
+        const auto name = basename(resolved);
+        return (nullptr != name) ? name : "";
+    }
 }
 
-void HotswapWatcher::handle_hotswap() {
+void HotswapWatcher::handle_hotswap(const DeviceNames& devices, bool rescan_all) {
     try {
+        /* only drives affected by the events are identified again */
+        if (rescan_all) {
+            sysfs::SysfsAPI::get_instance()->invalidate_drives();
+        }
+        else {
+            sysfs::SysfsAPI::get_instance()->invalidate_drives(devices);
+        }
         HotswapManager hotswap_manager{};
         hotswap_manager.hotswap_discover_hard_drives();
     }
@@ -60,22 +79,75 @@ void HotswapWatcher::handle_hotswap() {
     }
 }
 
-bool HotswapWatcher::detect_hotswap(int fd, int wd) {
-    INotify ievent_buffer(INotify::pointer((::operator new (BUFFER_LEN))));
-    auto ievent = ievent_buffer.get();
+void HotswapWatcher::read_disk_links() {
+    m_disk_links.clear();
+    DIR* dir = opendir(WATCH_DISK_PATH);
+    if (nullptr == dir) {
+        return;
+    }
+    while (const struct dirent* entry = readdir(dir)) {
+        if ('.' != entry->d_name[0]) {
+            m_disk_links[entry->d_name] = get_device_name(entry->d_name);
+        }
+    }
+    closedir(dir);
+}
+
+void HotswapWatcher::update_disk_link(const std::string& link_name, bool created,
+                                      DeviceNames& devices) {
+    if (created) {
+        auto device_name = get_device_name(link_name);
+        if (!device_name.empty()) {
+            devices.insert(device_name);
+        }
+        m_disk_links[link_name] = std::move(device_name);
+    }
+    else {
+        const auto it = m_disk_links.find(link_name);
+        if (m_disk_links.end() != it) {
+            if (!it->second.empty()) {
+                devices.insert(it->second);
+            }
+            m_disk_links.erase(it);
+        }
+    }
+}
+
+bool HotswapWatcher::detect_hotswap(int fd, int wd, int timeout_ms,
+                                    DeviceNames& devices, bool& rescan_all) {
+    alignas(struct inotify_event) char buffer[BUFFER_LEN];
     struct pollfd pfds[] = {{fd, POLLIN | POLLPRI, 0}};
 
     /* poll inotify events */
-    if (0 < poll(pfds, sizeof(pfds)/sizeof(pfds[0]), TIMEOUT_MS)) {
-        if (0 < read(fd, ievent, BUFFER_LEN)) {
-            return (0 < ievent->len) && (wd == ievent->wd) &&
-                (0 != strncmp(DEVICE_MAPPER_PREFIX, ievent->name,
-                strlen(DEVICE_MAPPER_PREFIX)));
-        }
+    if (0 >= poll(pfds, sizeof(pfds)/sizeof(pfds[0]), timeout_ms)) {
+        return false;
+    }
+    const auto length = read(fd, buffer, BUFFER_LEN);
+    if (0 >= length) {
         log_warning(GET_LOGGER("storage-agent"),
             "Could not read disks notification.");
+        return false;
     }
-    return false;
+
+    /* handle all events returned by single read */
+    bool detected = false;
+    for (auto offset = 0l; offset < length;) {
+        const auto ievent = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+        offset += long(sizeof(struct inotify_event) + ievent->len);
+
+        if (ievent->mask & IN_Q_OVERFLOW) {
+            /* events were lost, affected devices are unknown */
+            rescan_all = true;
+            detected = true;
+        }
+        else if ((0 < ievent->len) && (wd == ievent->wd) &&
+                 (0 != strncmp(DEVICE_MAPPER_PREFIX, ievent->name,
+                  strlen(DEVICE_MAPPER_PREFIX)))) {
+            update_disk_link(ievent->name, 0 != (ievent->mask & IN_CREATE), devices);
+            detected = true;
+        }
+    }
+    return detected;
 }
 
 void HotswapWatcher::execute() {
@@ -94,11 +166,24 @@ void HotswapWatcher::execute() {
         close(fd);
         return;
     }
+    read_disk_links();
     /* listen for inotify events and handle them */
     while (is_running()) {
-        if (detect_hotswap(fd, wd)) {
-            handle_hotswap();
+        DeviceNames devices{};
+        bool rescan_all = false;
+        if (!detect_hotswap(fd, wd, TIMEOUT_MS, devices, rescan_all)) {
+            continue;
+        }
+        /* collect events of all drives inserted/removed at once */
+        const auto deadline = std::chrono::steady_clock::now() + MAX_DEBOUNCE;
+        while (is_running() && std::chrono::steady_clock::now() < deadline &&
+               detect_hotswap(fd, wd, DEBOUNCE_MS, devices, rescan_all)) { }
+        if (rescan_all) {
+            read_disk_links();
         }
+        log_debug(GET_LOGGER("storage-agent"), "Hotswap detected, "
+            << (rescan_all ? std::string("all") : std::to_string(devices.size())) << " devices affected");
+        handle_hotswap(devices, rescan_all);
     }
     /* close inotify instance */
     inotify_rm_watch(fd, wd);
@@ -30,6 +30,9 @@
 #include "configuration/configuration.hpp"
 #include "logger/logger_factory.hpp"
 
+#include <chrono>
+#include <thread>
+
 
 
 using Socket = net::StreamSocket;
@@ -42,8 +45,14 @@ namespace {
 
 const uint32_t MUTUAL = 1;
 
+// Number of connection attempts, tgtd may be restarting
+constexpr int CONNECT_ATTEMPTS = 3;
+constexpr std::chrono::milliseconds CONNECT_RETRY_DELAY{100};
+
+using Clock = std::chrono::steady_clock;
+
 // Reads UNIX local TGT socket path from configuration file.
-SocketAddress get_tgt_socket_address() {
+SocketAddress read_tgt_socket_address() {
     try {
         return SocketAddress(configuration::Configuration::get_instance().to_json()["tgt-socket"].as_string());
     }
@@ -53,224 +62,195 @@ SocketAddress get_tgt_socket_address() {
     return SocketAddress();
 }
 
+// The address is read once, configuration is not reloaded at runtime
+const SocketAddress& get_tgt_socket_address() {
+    static const SocketAddress address = read_tgt_socket_address();
+    return address;
 }
 
-
-Response Manager::create_target(const std::int32_t target_id, const std::string& target_name) const {
-    Response response;
-    try {
-        auto request = create_target_request(target_id, target_name);
-
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
+// tgtd closes the management connection after each response,
+// so every request needs its own connection
+Socket connect_to_tgt() {
+    for (int attempt = 1; ; ++attempt) {
+        try {
+            return Socket(get_tgt_socket_address());
+        }
+        catch (const std::runtime_error& e) {
+            if (attempt >= CONNECT_ATTEMPTS) {
+                throw;
+            }
+            log_warning(GET_LOGGER("tgt"), "Cannot connect to tgtd (attempt " << attempt << "): " << e.what());
+            std::this_thread::sleep_for(CONNECT_RETRY_DELAY * attempt);
+        }
     }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
+}
+
+void send_request(Socket& socket, Request& request) {
+    auto bytes = request.get_request_data();
+    std::size_t done = 0;
+    while (done < bytes.size()) {
+        done += std::size_t(socket.send_bytes(bytes.data() + done, bytes.size() - done));
     }
-    return response;
 }
 
+void receive_all(Socket& socket, char* buffer, std::size_t length) {
+    std::size_t done = 0;
+    while (done < length) {
+        auto ret = socket.receive_bytes(buffer + done, length - done);
+        if (ret <= 0) {
+            throw std::runtime_error("Connection to tgtd closed before the whole response was received");
+        }
+        done += std::size_t(ret);
+    }
+}
 
-Response Manager::create_lun(const int32_t target_id, const uint64_t lun_id, const string& device_path) const {
-    Response response;
-    try {
-        auto request = create_lun_request(target_id, lun_id, device_path);
+void receive_response(Socket& socket, Response& response) {
+    receive_all(socket, response.data(), response.get_response_pod_size());
+    if (response.is_valid() && response.get_length()) {
+        auto& extra_data = response.get_extra_data();
+        extra_data.resize(response.get_length());
+        receive_all(socket, extra_data.data(), extra_data.size());
+    }
+}
 
-        std::lock_guard<std::mutex> lock(m_mutex);
+long elapsed_us(const Clock::time_point& start) {
+    return long(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+}
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
 }
 
 
-Response Manager::bind_target(const int32_t target_id, const Manager::OptionMapper& options) const {
+Response Manager::execute(Request& request) const {
     Response response;
+    const auto start = Clock::now();
     try {
-        auto request = bind_target_request(target_id, options);
-
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
+        Socket socket = connect_to_tgt();
+        send_request(socket, request);
+        receive_response(socket, response);
     }
     catch (const std::runtime_error& e) {
         log_error(GET_LOGGER("tgt"), e.what());
     }
+    log_debug(GET_LOGGER("tgt"), "tgtd request took " << elapsed_us(start) << " us");
     return response;
 }
 
 
-Response Manager::unbind_target(const int32_t target_id, const Manager::OptionMapper& options) const {
-    Response response;
+Manager::Responses Manager::execute_pipelined(std::vector<Request>& requests) const {
+    Responses responses(requests.size());
+    const auto start = Clock::now();
     try {
-        auto request = unbind_target_request(target_id, options);
-
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
+        // All requests are sent before any response is read, tgtd serves them one by one
+        std::vector<Socket> sockets{};
+        sockets.reserve(requests.size());
+        for (auto& request : requests) {
+            sockets.emplace_back(connect_to_tgt());
+            send_request(sockets.back(), request);
+        }
+        for (std::size_t i = 0; i < sockets.size(); ++i) {
+            receive_response(sockets[i], responses[i]);
+        }
     }
     catch (const std::runtime_error& e) {
         log_error(GET_LOGGER("tgt"), e.what());
     }
-    return response;
+    log_debug(GET_LOGGER("tgt"), requests.size() << " pipelined tgtd requests took " << elapsed_us(start) << " us");
+    return responses;
 }
 
 
-Response Manager::update_target(const int32_t target_id, const Manager::OptionMapper& options) const {
-    Response response;
-    try {
-        auto request = update_target_request(target_id, options);
+Manager::Responses Manager::apply_target(const TargetDefinition& definition) const {
+    const auto start = Clock::now();
+    Responses responses{};
 
-        std::lock_guard<std::mutex> lock(m_mutex);
+    // The target has to exist before its LUNs and bindings are added
+    auto create_request = create_target_request(definition.target_id, definition.target_name);
+    responses.emplace_back(execute(create_request));
+    if (!responses.front().is_valid()) {
+        return responses;
+    }
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
+    std::vector<Request> requests{};
+    for (const auto& binding : definition.bindings) {
+        requests.emplace_back(bind_target_request(definition.target_id, binding));
     }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
+    for (const auto& lun : definition.luns) {
+        requests.emplace_back(create_lun_request(definition.target_id, lun.first, lun.second));
     }
-    return response;
+    if (!requests.empty()) {
+        auto batch = execute_pipelined(requests);
+        std::move(batch.begin(), batch.end(), std::back_inserter(responses));
+    }
+
+    log_debug(GET_LOGGER("tgt"), "Target " << definition.target_id << " applied with " << responses.size()
+        << " tgtd requests in " << elapsed_us(start) << " us");
+    return responses;
 }
 
 
-Response Manager::destroy_target(const int32_t target_id) const {
-    Response response;
-    try {
-        auto request = destroy_target_request(target_id);
+Response Manager::create_target(const std::int32_t target_id, const std::string& target_name) const {
+    auto request = create_target_request(target_id, target_name);
+    return execute(request);
+}
 
-        std::lock_guard<std::mutex> lock(m_mutex);
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
+Response Manager::create_lun(const int32_t target_id, const uint64_t lun_id, const string& device_path) const {
+    auto request = create_lun_request(target_id, lun_id, device_path);
+    return execute(request);
 }
 
 
-Response Manager::show_targets() const {
-    Response response;
-    try {
-        auto request = show_targets_request();
+Response Manager::bind_target(const int32_t target_id, const Manager::OptionMapper& options) const {
+    auto request = bind_target_request(target_id, options);
+    return execute(request);
+}
 
-        std::lock_guard<std::mutex> lock(m_mutex);
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
+Response Manager::unbind_target(const int32_t target_id, const Manager::OptionMapper& options) const {
+    auto request = unbind_target_request(target_id, options);
+    return execute(request);
+}
 
-        if (response.is_valid() && response.get_length()) {
-            auto len = response.get_length();
-            auto& extra_data = response.get_extra_data();
-            extra_data.resize(len);
 
-            long done = 0;
-            while (len > done) {
-                auto ret = socket.receive_bytes(extra_data.data() + done, len - done);
-                done += ret;
-            }
-        }
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
+Response Manager::update_target(const int32_t target_id, const Manager::OptionMapper& options) const {
+    auto request = update_target_request(target_id, options);
+    return execute(request);
+}
 
-    return response;
+
+Response Manager::destroy_target(const int32_t target_id) const {
+    auto request = destroy_target_request(target_id);
+    return execute(request);
 }
 
-Response Manager::create_chap_account(const string& username, const string& password) const {
-    Response response;
-    try {
-        auto request = create_chap_account_request(username, password);
 
-        std::lock_guard<std::mutex> lock(m_mutex);
+Response Manager::show_targets() const {
+    auto request = show_targets_request();
+    return execute(request);
+}
 
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
+Response Manager::create_chap_account(const string& username, const string& password) const {
+    auto request = create_chap_account_request(username, password);
+    return execute(request);
 }
 
 Response Manager::delete_chap_account(const string& username) const {
-    Response response;
-    try {
-        auto request = delete_chap_account_request(username);
-
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
+    auto request = delete_chap_account_request(username);
+    return execute(request);
 }
 
 Response Manager::bind_chap_account(const int32_t target_id, const string& username, const bool mutual) const {
-    Response response;
-    try {
-        auto request = bind_chap_account_request(target_id, username, mutual);
-
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
+    auto request = bind_chap_account_request(target_id, username, mutual);
+    return execute(request);
 }
 
 Response Manager::unbind_chap_account(const int32_t target_id, const string& username, const bool mutual) const {
-    Response response;
-    try {
-        auto request = unbind_chap_account_request(target_id, username, mutual);
-
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        Socket socket(get_tgt_socket_address());
-        auto bytes = request.get_request_data();
-        socket.send_bytes(bytes.data(), bytes.size());
-        socket.receive_bytes(response.data(), response.get_response_pod_size());
-    }
-    catch (const std::runtime_error& e) {
-        log_error(GET_LOGGER("tgt"), e.what());
-    }
-    return response;
+    auto request = unbind_chap_account_request(target_id, username, mutual);
+    return execute(request);
 }
 
 Request Manager::create_chap_account_request(const string& username, const string& password) const {
@@ -28,10 +28,12 @@
 
 #include "event/storage_event.hpp"
 #include "lvm/lvm_clone_task.hpp"
+#include "lvm/lvm_copy_engine.hpp"
 
+#include "agent-framework/action/task_progress.hpp"
+#include "agent-framework/exceptions/lvm_error.hpp"
 #include "agent-framework/module/storage_components.hpp"
-
-#include <fstream>
+#include "configuration/configuration.hpp"
 
 
 
@@ -41,35 +43,32 @@ using namespace agent_framework::model;
 using namespace agent_framework::eventing;
 using namespace agent_framework::module;
 
-LvmCloneTask::LvmCloneTask(const LvmCreateData& create_data) :
-    m_create_data{create_data} { }
+LvmCloneTask::LvmCloneTask(const LvmCreateData& create_data, const std::string& task_uuid) :
+    m_create_data{create_data}, m_task_uuid{task_uuid} { }
 
 void LvmCloneTask::operator()() {
     log_info(GET_LOGGER("lvm"), "Clone start \n"
             << " src: " << get_source() << " \n "
             << " dest: " << get_dest());
 
-    attribute::Status status{enums::State::Enabled, enums::Health::OK};
-    try {
-        std::ifstream source(get_source(), std::ios::binary);
-        std::ofstream dest(get_dest(), std::ios::binary);
-        // TODO make bufsize configurable, maybe add to REST/GAMI API
-        static constexpr int bufsize = 1024*1024;
-        char buffer[bufsize];
-
-        do {
-            source.read(buffer, bufsize);
-            dest.write(buffer, source.gcount());
-        } while (!source.eof());
+    LvmCopyEngine engine{LvmCopyEngine::load_settings(configuration::Configuration::get_instance().to_json())};
+    if (!m_task_uuid.empty()) {
+        const std::string task_uuid = m_task_uuid;
+        engine.set_progress_callback([task_uuid](std::uint64_t processed, std::uint64_t total) {
+            agent_framework::action::update_task_progress(task_uuid, std::uint32_t(processed * 100 / total));
+        });
+    }
 
-        source.close();
-        dest.close();
-    } catch (std::exception const& err) {
+    try {
+        const auto statistics = engine.copy(get_source(), get_dest());
+        log_info(GET_LOGGER("lvm"), "Clone finished: " << statistics.total_bytes << " bytes in "
+                << statistics.duration.count() << " ms, " << statistics.skipped_bytes
+                << " bytes of zeroes skipped");
+    } catch (const agent_framework::exceptions::LvmError& err) {
         log_error(GET_LOGGER("lvm"), "Could not copy data to clone: "
                 << err.what());
-        status = {enums::State::Absent, enums::Health::OK};
+        throw;
     }
-    log_info(GET_LOGGER("lvm"), "Clone finished");
 }
 
 std::string LvmCloneTask::get_source() const {
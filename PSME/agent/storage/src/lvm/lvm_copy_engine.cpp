@@ -0,0 +1,407 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file lvm_copy_engine.cpp
+ *
+ * @brief Block device copy engine implementation
+ * */
+
+#include "lvm/lvm_copy_engine.hpp"
+
+#include "agent-framework/exceptions/lvm_error.hpp"
+#include "logger/logger_factory.hpp"
+#include "json/json.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <linux/falloc.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+
+
+using namespace agent::storage::lvm;
+using agent_framework::exceptions::LvmError;
+
+constexpr std::size_t LvmCopyEngine::DEFAULT_BLOCK_SIZE;
+constexpr std::size_t LvmCopyEngine::DEFAULT_QUEUE_DEPTH;
+
+namespace {
+
+/*! Alignment of buffers, offsets and lengths required by direct I/O */
+constexpr std::size_t DIRECT_IO_ALIGNMENT = 4096;
+
+/*! Maximal number of I/Os in flight */
+constexpr std::size_t MAX_QUEUE_DEPTH = 64;
+
+
+std::string error_string(const std::string& message, const std::string& path) {
+    return message + " " + path + ": " + std::strerror(errno);
+}
+
+
+std::size_t align_up(std::size_t value) {
+    return (value + DIRECT_IO_ALIGNMENT - 1) / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT;
+}
+
+
+bool is_aligned(std::uint64_t value) {
+    return 0 == value % DIRECT_IO_ALIGNMENT;
+}
+
+
+bool is_zero(const char* buffer, std::size_t length) {
+    // Compare the buffer with itself shifted by one byte, memcmp is vectorized
+    return 0 == length || (0 == buffer[0] && 0 == std::memcmp(buffer, buffer + 1, length - 1));
+}
+
+
+/*! Source or destination of a copy */
+class Device final {
+public:
+    Device(const std::string& path, int flags) : m_path{path} {
+        m_fd = ::open(path.c_str(), flags | O_CLOEXEC);
+        if (m_fd < 0) {
+            throw LvmError(error_string("Cannot open", path));
+        }
+        // Direct I/O is not supported by every filesystem, buffered I/O is used then
+        m_direct_fd = ::open(path.c_str(), flags | O_CLOEXEC | O_DIRECT);
+
+        struct stat st{};
+        if (0 != ::fstat(m_fd, &st)) {
+            throw LvmError(error_string("Cannot stat", path));
+        }
+        m_is_block = S_ISBLK(st.st_mode);
+        if (m_is_block) {
+            if (0 != ::ioctl(m_fd, BLKGETSIZE64, &m_size)) {
+                throw LvmError(error_string("Cannot read size of", path));
+            }
+            unsigned int discard_zeroes = 0;
+            m_discard_zeroes = (0 == ::ioctl(m_fd, BLKDISCARDZEROES, &discard_zeroes)) && (0 != discard_zeroes);
+        }
+        else {
+            m_size = static_cast<std::uint64_t>(st.st_size);
+        }
+    }
+
+    ~Device() {
+        if (m_direct_fd >= 0) {
+            ::close(m_direct_fd);
+        }
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+    }
+
+    Device(const Device&) = delete;
+    Device& operator=(const Device&) = delete;
+
+    const std::string& get_path() const {
+        return m_path;
+    }
+
+    std::uint64_t get_size() const {
+        return m_size;
+    }
+
+    bool is_block() const {
+        return m_is_block;
+    }
+
+    /*! Check if the range lies in a hole of a sparse regular file */
+    bool is_hole(std::uint64_t offset, std::size_t length) const {
+        if (m_is_block) {
+            return false;
+        }
+        const auto data = ::lseek(m_fd, static_cast<off_t>(offset), SEEK_DATA);
+        if (data < 0) {
+            // ENXIO means there is no more data after the offset
+            return ENXIO == errno;
+        }
+        return static_cast<std::uint64_t>(data) >= offset + length;
+    }
+
+    void read(char* buffer, std::uint64_t offset, std::size_t length) const {
+        std::size_t done = 0;
+        while (done < length) {
+            const std::uint64_t position = offset + done;
+            const bool direct = m_direct_fd >= 0 && is_aligned(position) && is_aligned(done);
+            const auto result = direct ?
+                ::pread(m_direct_fd, buffer + done, align_up(length - done), static_cast<off_t>(position)) :
+                ::pread(m_fd, buffer + done, length - done, static_cast<off_t>(position));
+            if (result < 0) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                throw LvmError(error_string("Cannot read", m_path));
+            }
+            if (0 == result) {
+                throw LvmError("Unexpected end of " + m_path);
+            }
+            done += static_cast<std::size_t>(result);
+        }
+    }
+
+    void write(const char* buffer, std::uint64_t offset, std::size_t length) const {
+        std::size_t done = 0;
+        while (done < length) {
+            const std::uint64_t position = offset + done;
+            const bool direct = m_direct_fd >= 0 && is_aligned(position) && is_aligned(length - done);
+            const auto result = ::pwrite(direct ? m_direct_fd : m_fd, buffer + done, length - done,
+                                         static_cast<off_t>(position));
+            if (result < 0) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                throw LvmError(error_string("Cannot write", m_path));
+            }
+            done += static_cast<std::size_t>(result);
+        }
+    }
+
+    /*!
+     * Make the range read back as zeroes without transferring data, if possible.
+     * @return false if the caller has to write zeroes itself
+     * */
+    bool zero_range(std::uint64_t offset, std::size_t length) const {
+        if (m_is_block) {
+            std::uint64_t range[2] = {offset, length};
+            if (m_discard_zeroes && 0 == ::ioctl(m_fd, BLKDISCARD, &range)) {
+                return true;
+            }
+            return 0 == ::ioctl(m_fd, BLKZEROOUT, &range);
+        }
+        return 0 == ::fallocate(m_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                                static_cast<off_t>(offset), static_cast<off_t>(length));
+    }
+
+    void sync() const {
+        if (0 != ::fsync(m_fd)) {
+            throw LvmError(error_string("Cannot sync", m_path));
+        }
+    }
+
+    void truncate(std::uint64_t size) const {
+        if (!m_is_block && 0 != ::ftruncate(m_fd, static_cast<off_t>(size))) {
+            throw LvmError(error_string("Cannot resize", m_path));
+        }
+    }
+
+private:
+    std::string m_path;
+    int m_fd{-1};
+    int m_direct_fd{-1};
+    std::uint64_t m_size{0};
+    bool m_is_block{false};
+    bool m_discard_zeroes{false};
+};
+
+
+/*! Limits throughput shared by all the workers */
+class Throttle final {
+public:
+    explicit Throttle(std::uint64_t bytes_per_second) : m_rate{bytes_per_second} { }
+
+    void acquire(std::size_t bytes) {
+        if (0 == m_rate) {
+            return;
+        }
+        std::chrono::steady_clock::time_point deadline{};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_bytes += bytes;
+            // split into seconds and the rest, bytes * 1000000 overflows for copies of large volumes
+            deadline = m_start + std::chrono::seconds{m_bytes / m_rate}
+                + std::chrono::microseconds{(m_bytes % m_rate) * 1000000 / m_rate};
+        }
+        std::this_thread::sleep_until(deadline);
+    }
+
+private:
+    const std::uint64_t m_rate;
+    const std::chrono::steady_clock::time_point m_start{std::chrono::steady_clock::now()};
+    std::uint64_t m_bytes{0};
+    std::mutex m_mutex{};
+};
+
+
+using AlignedBuffer = std::unique_ptr<char, decltype(&std::free)>;
+
+AlignedBuffer make_aligned_buffer(std::size_t size) {
+    void* memory = nullptr;
+    if (0 != ::posix_memalign(&memory, DIRECT_IO_ALIGNMENT, size)) {
+        throw LvmError("Cannot allocate copy buffer");
+    }
+    return AlignedBuffer{static_cast<char*>(memory), &std::free};
+}
+
+}
+
+
+LvmCopyEngine::Settings LvmCopyEngine::get_default_settings() {
+    return Settings{DEFAULT_BLOCK_SIZE, DEFAULT_QUEUE_DEPTH, 0, true};
+}
+
+
+LvmCopyEngine::Settings LvmCopyEngine::load_settings(const json::Value& configuration) {
+    auto settings = get_default_settings();
+    try {
+        const auto& clone = configuration["lvm-clone"];
+        if (!clone.is_object()) {
+            return settings;
+        }
+        if (clone["block-size"].is_uint()) {
+            settings.block_size = clone["block-size"].as_uint();
+        }
+        if (clone["queue-depth"].is_uint()) {
+            settings.queue_depth = clone["queue-depth"].as_uint();
+        }
+        if (clone["max-throughput"].is_uint()) {
+            settings.max_throughput = clone["max-throughput"].as_uint64();
+        }
+        if (clone["detect-zeroes"].is_boolean()) {
+            settings.detect_zeroes = clone["detect-zeroes"].as_bool();
+        }
+    }
+    catch (const json::Value::Exception& e) {
+        log_error(GET_LOGGER("lvm"), "Cannot parse lvm-clone settings: " << e.what());
+    }
+    return settings;
+}
+
+
+LvmCopyEngine::LvmCopyEngine(const Settings& settings) : m_settings{settings} {
+    m_settings.block_size = align_up(0 == m_settings.block_size ? DEFAULT_BLOCK_SIZE : m_settings.block_size);
+    if (0 == m_settings.queue_depth) {
+        m_settings.queue_depth = 1;
+    }
+    if (m_settings.queue_depth > MAX_QUEUE_DEPTH) {
+        m_settings.queue_depth = MAX_QUEUE_DEPTH;
+    }
+}
+
+
+LvmCopyEngine::Statistics LvmCopyEngine::copy(const std::string& source_path,
+                                              const std::string& destination_path) const {
+    const auto start = std::chrono::steady_clock::now();
+    const Device source{source_path, O_RDONLY};
+    const Device destination{destination_path, O_WRONLY};
+
+    const std::uint64_t total = source.get_size();
+    if (destination.is_block() && destination.get_size() < total) {
+        throw LvmError("Destination " + destination_path + " is smaller than source " + source_path);
+    }
+    destination.truncate(total);
+
+    Throttle throttle{m_settings.max_throughput};
+    std::atomic<std::uint64_t> next_offset{0};
+    std::atomic<std::uint64_t> written{0};
+    std::atomic<std::uint64_t> skipped{0};
+    std::atomic<bool> failed{false};
+    std::mutex progress_mutex{};
+    std::uint64_t last_percent{0};
+    std::string error{};
+
+    auto report_progress = [&](std::uint64_t processed) {
+        if (!m_progress_callback || 0 == total) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{progress_mutex};
+        const std::uint64_t percent = processed * 100 / total;
+        if (percent > last_percent) {
+            last_percent = percent;
+            m_progress_callback(processed, total);
+        }
+    };
+
+    auto worker = [&]() {
+        try {
+            auto buffer = make_aligned_buffer(m_settings.block_size);
+            while (!failed) {
+                const std::uint64_t offset = next_offset.fetch_add(m_settings.block_size);
+                if (offset >= total) {
+                    break;
+                }
+                const auto length = static_cast<std::size_t>(
+                    std::min<std::uint64_t>(m_settings.block_size, total - offset));
+                throttle.acquire(length);
+
+                bool zero = source.is_hole(offset, length);
+                if (!zero) {
+                    source.read(buffer.get(), offset, length);
+                    zero = m_settings.detect_zeroes && is_zero(buffer.get(), length);
+                }
+
+                if (zero && destination.zero_range(offset, length)) {
+                    skipped += length;
+                }
+                else {
+                    if (zero) {
+                        std::memset(buffer.get(), 0, length);
+                    }
+                    destination.write(buffer.get(), offset, length);
+                    written += length;
+                }
+                report_progress(written + skipped);
+            }
+        }
+        catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock{progress_mutex};
+            if (!failed.exchange(true)) {
+                error = e.what();
+            }
+        }
+    };
+
+    const auto blocks = (total + m_settings.block_size - 1) / m_settings.block_size;
+    const auto worker_count = std::max<std::size_t>(1,
+        static_cast<std::size_t>(std::min<std::uint64_t>(m_settings.queue_depth, blocks)));
+    std::vector<std::thread> workers{};
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    if (failed) {
+        throw LvmError("Cannot copy " + source_path + " to " + destination_path + ": " + error);
+    }
+    destination.sync();
+
+    const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    return Statistics{total, written, skipped, duration};
+}
@@ -25,6 +25,7 @@
 #include "agent-framework/version.hpp"
 #include "agent-framework/state_machine/state_machine_thread.hpp"
 #include "agent-framework/action/task_runner.hpp"
+#include "agent-framework/action/task_cleaner.hpp"
 
 #include "agent-framework/command-ref/command_server.hpp"
 
@@ -168,12 +169,17 @@ int main(int argc, const char* argv[]) {
     IpWatcher ip_watcher{};
     ip_watcher.start();
 
+    /* Start removing outdated tasks */
+    TaskCleaner task_cleaner{configuration};
+    task_cleaner.start();
+
     /* Stop the program and wait for interrupt */
     wait_for_interrupt();
 
     log_info(GET_LOGGER("agent"), "Stopping PSME Storage...\n");
 
     /* Cleanup */
+    task_cleaner.stop();
     ip_watcher.stop();
     hotswap_watcher.stop();
     server.stop();
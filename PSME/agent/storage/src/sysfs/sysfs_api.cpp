@@ -68,16 +68,19 @@ void SysfsAPI::get_hard_drives(vector<HardDrive>& hard_drives) {
     struct dlist* devices_list = nullptr;
     std::list<std::thread> threads{};
     std::mutex push_back_mutex{};
+    std::set<string> present_devices{};
 
-    auto discover_device = [&](struct sysfs_device* dev) {
-        HardDrive hard_drive{};
+    auto add_hard_drive = [&](const HardDrive& hard_drive) {
+        std::lock_guard<std::mutex> guard(push_back_mutex);
+        hard_drives.push_back(hard_drive);
+    };
+
+    auto discover_device = [&](struct sysfs_device* dev, CachedDrive cached) {
+        HardDrive& hard_drive = cached.hard_drive;
 
         m_read_block_device_attributes(dev, hard_drive);
         if (!hard_drive.get_serial_number().empty()){
-
-            std::lock_guard<std::mutex> guard(push_back_mutex);
-
-            hard_drives.push_back(hard_drive);
+            add_hard_drive(hard_drive);
 
             log_debug(GET_LOGGER("storage-agent"), "Found block device "
                 << hard_drive.get_device_path());
@@ -85,6 +88,10 @@ void SysfsAPI::get_hard_drives(vector<HardDrive>& hard_drives) {
                 << hard_drive.get_model());
             log_debug(GET_LOGGER("storage-agent"), "Capacity: "
                 << hard_drive.get_capacity_gb());
+
+            std::lock_guard<std::mutex> guard(m_drive_cache_mutex);
+            m_drive_cache.erase(dev->name);
+            m_drive_cache.emplace(dev->name, std::move(cached));
         } else {
             log_debug(GET_LOGGER("storage-agent"), "Cannot read parameters directly from device: "
                     <<hard_drive.get_device_path()<<", it might have been recently removed or is not responding.");
@@ -101,8 +108,28 @@ void SysfsAPI::get_hard_drives(vector<HardDrive>& hard_drives) {
         if (nullptr != device && !m_is_virtual_device(device)
                 && !m_is_boot_device(device)) {
 
+            present_devices.emplace(device->name);
+
+            /* identify only drives which were not seen before */
+            CachedDrive cached{device->path, "", 0, {}};
+            m_read_attribute(cached.dev, device, "dev");
+            m_read_attribute(cached.size, device, "size");
+            {
+                std::lock_guard<std::mutex> guard(m_drive_cache_mutex);
+                const auto it = m_drive_cache.find(device->name);
+                if (m_drive_cache.end() != it &&
+                    it->second.sysfs_path == cached.sysfs_path &&
+                    it->second.dev == cached.dev &&
+                    it->second.size == cached.size) {
+                    log_debug(GET_LOGGER("storage-agent"), "Using cached block device "
+                        << it->second.hard_drive.get_device_path());
+                    add_hard_drive(it->second.hard_drive);
+                    continue;
+                }
+            }
+
             // discover hard drives simultaneously
-            threads.emplace_back(discover_device, device);
+            threads.emplace_back(discover_device, device, std::move(cached));
         }
     }
 
@@ -112,6 +139,28 @@ void SysfsAPI::get_hard_drives(vector<HardDrive>& hard_drives) {
 
     sysfs_close_class(block);
 
+    /* forget drives which are gone */
+    std::lock_guard<std::mutex> guard(m_drive_cache_mutex);
+    for (auto it = m_drive_cache.begin(); it != m_drive_cache.end();) {
+        if (0 == present_devices.count(it->first)) {
+            it = m_drive_cache.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void SysfsAPI::invalidate_drives(const std::set<string>& device_names) {
+    std::lock_guard<std::mutex> guard(m_drive_cache_mutex);
+    for (const auto& name : device_names) {
+        m_drive_cache.erase(name);
+    }
+}
+
+void SysfsAPI::invalidate_drives() {
+    std::lock_guard<std::mutex> guard(m_drive_cache_mutex);
+    m_drive_cache.clear();
 }
 
 void SysfsAPI::get_partitions(const HardDrive& drive,
@@ -0,0 +1,233 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file lvm_copy_engine_benchmark.cpp
+ *
+ * @brief Benchmark of the LvmCopyEngine on loop devices.
+ *
+ * Source and destination are loop devices backed by sparse files in /tmp, a part of
+ * the source is filled with data and the rest is left zeroed. The source is copied
+ * without zero detection, with zero detection and with a throughput limit, throughput
+ * of each copy is reported. Loop devices can be set up by root only, the benchmark is
+ * skipped for other users.
+ *
+ * Usage: psme-storage-lvm-copy-benchmark [--size=MiB] [--data=percent] [--throughput=MiB/s]
+ * */
+
+#include "lvm/lvm_copy_engine.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+}
+
+using namespace agent::storage::lvm;
+
+namespace {
+
+constexpr std::uint64_t MiB = 1024 * 1024;
+
+struct Options {
+    unsigned size{512};
+    unsigned data{25};
+    unsigned throughput{100};
+};
+
+/*! @brief Loop device backed by a sparse temporary file, detached and removed in destructor */
+class LoopDevice {
+public:
+    explicit LoopDevice(std::uint64_t size) {
+        char path[] = "/tmp/lvm-copy-benchmark-XXXXXX";
+        int fd = ::mkstemp(path);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot create backing file");
+        }
+        m_file = path;
+        const bool is_resized = 0 == ::ftruncate(fd, off_t(size));
+        ::close(fd);
+        try {
+            if (!is_resized) {
+                throw std::runtime_error("Cannot resize " + m_file);
+            }
+            attach();
+        }
+        catch (...) {
+            ::unlink(m_file.c_str());
+            throw;
+        }
+    }
+
+    ~LoopDevice() {
+        const std::string command = "losetup -d " + m_device;
+        if (0 != std::system(command.c_str())) {
+            std::cerr << "Cannot detach " << m_device << std::endl;
+        }
+        ::unlink(m_file.c_str());
+    }
+
+    LoopDevice(const LoopDevice&) = delete;
+    LoopDevice& operator=(const LoopDevice&) = delete;
+
+    const std::string& get_device() const {
+        return m_device;
+    }
+
+    const std::string& get_file() const {
+        return m_file;
+    }
+
+private:
+    void attach() {
+        const std::string command = "losetup --find --show " + m_file;
+        FILE* output = ::popen(command.c_str(), "r");
+        if (nullptr == output) {
+            throw std::runtime_error("Cannot run losetup");
+        }
+        char line[256]{};
+        const bool is_read = nullptr != std::fgets(line, sizeof(line), output);
+        if (0 != ::pclose(output) || !is_read) {
+            throw std::runtime_error("Cannot attach loop device to " + m_file);
+        }
+        m_device = line;
+        m_device.erase(m_device.find_last_not_of("\n") + 1);
+    }
+
+    std::string m_file{};
+    std::string m_device{};
+};
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--size" == name) {
+            options.size = value;
+        }
+        else if ("--data" == name) {
+            options.data = value;
+        }
+        else if ("--throughput" == name) {
+            options.throughput = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.size || 100 < options.data || 0 == options.throughput) {
+        throw std::invalid_argument("Invalid size, data percentage or throughput");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--size=512] [--data=25] [--throughput=100]" << std::endl;
+}
+
+/*! Fills the given percentage of the file with data, data blocks are spread evenly over the file */
+void fill_with_data(const std::string& path, std::uint64_t size, std::size_t block_size, unsigned percent) {
+    int fd = ::open(path.c_str(), O_WRONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    std::vector<char> block(block_size);
+    for (std::size_t i = 0; i < block.size(); ++i) {
+        block[i] = char(1 + i % 251);
+    }
+    const std::uint64_t blocks = size / block_size;
+    bool is_written = true;
+    for (std::uint64_t i = 0; i < blocks && is_written; ++i) {
+        if ((i * percent) / 100 != ((i + 1) * percent) / 100) {
+            is_written = ssize_t(block.size()) == ::pwrite(fd, block.data(), block.size(), off_t(i * block_size));
+        }
+    }
+    ::close(fd);
+    if (!is_written) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+void print_copy(const std::string& name, const LvmCopyEngine::Statistics& statistics) {
+    const double seconds = double(statistics.duration.count()) / 1000.0;
+    const double throughput = 0.0 < seconds ? double(statistics.total_bytes) / double(MiB) / seconds : 0.0;
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::setw(10) << statistics.duration.count() << " ms, "
+              << std::setw(10) << throughput << " MiB/s, written: "
+              << statistics.written_bytes / MiB << " MiB, skipped: "
+              << statistics.skipped_bytes / MiB << " MiB" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (0 != ::geteuid()) {
+        std::cout << "Loop devices can be set up by root only, benchmark skipped" << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    try {
+        LoopDevice source{options.size * MiB};
+        LoopDevice destination{options.size * MiB};
+        auto settings = LvmCopyEngine::get_default_settings();
+        // data is written in whole copy blocks, zero detection skips the others
+        fill_with_data(source.get_file(), options.size * MiB, settings.block_size, options.data);
+        std::cout << "Source: " << options.size << " MiB, data: " << options.data << "%, block size: "
+                  << settings.block_size / MiB << " MiB, queue depth: " << settings.queue_depth << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+
+        settings.detect_zeroes = false;
+        print_copy("No zero detection:", LvmCopyEngine{settings}.copy(source.get_device(), destination.get_device()));
+
+        settings.detect_zeroes = true;
+        print_copy("Zero detection:", LvmCopyEngine{settings}.copy(source.get_device(), destination.get_device()));
+
+        settings.max_throughput = options.throughput * MiB;
+        print_copy("Throttled to " + std::to_string(options.throughput) + " MiB/s:",
+                   LvmCopyEngine{settings}.copy(source.get_device(), destination.get_device()));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,190 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file lvm_copy_engine_test.cpp
+ *
+ * Copy engine tests use sparse regular files, the same code paths are used
+ * for loop devices and logical volumes (with BLKZEROOUT instead of holes).
+ * */
+
+#include "lvm/lvm_copy_engine.hpp"
+#include "agent-framework/exceptions/lvm_error.hpp"
+
+#include "gtest/gtest.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+}
+
+
+
+using namespace agent::storage::lvm;
+
+namespace {
+
+constexpr std::size_t MiB = 1024 * 1024;
+
+std::string make_temporary_file() {
+    char path[] = "/tmp/lvm_copy_engine_test_XXXXXX";
+    int fd = ::mkstemp(path);
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    return path;
+}
+
+
+void write_at(const std::string& path, std::uint64_t offset, const std::vector<char>& data) {
+    int fd = ::open(path.c_str(), O_WRONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(::pwrite(fd, data.data(), data.size(), off_t(offset)), ssize_t(data.size()));
+    ::close(fd);
+}
+
+
+std::vector<char> read_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+
+std::vector<char> make_pattern(std::size_t size, char seed) {
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = char(seed + char(i % 251));
+    }
+    return data;
+}
+
+}
+
+
+class LvmCopyEngineTest : public ::testing::Test {
+public:
+    virtual ~LvmCopyEngineTest();
+
+    virtual void SetUp();
+
+    virtual void TearDown();
+
+    std::string m_source{};
+    std::string m_destination{};
+};
+
+
+LvmCopyEngineTest::~LvmCopyEngineTest() { }
+
+
+void LvmCopyEngineTest::SetUp() {
+    m_source = make_temporary_file();
+    m_destination = make_temporary_file();
+}
+
+
+void LvmCopyEngineTest::TearDown() {
+    ::unlink(m_source.c_str());
+    ::unlink(m_destination.c_str());
+}
+
+
+TEST_F(LvmCopyEngineTest, CopiesDataAndSkipsZeroes) {
+    // 16 MiB sparse source: data, explicit zeroes, hole, data and an unaligned tail
+    ASSERT_EQ(::truncate(m_source.c_str(), 16 * MiB + 123), 0);
+    write_at(m_source, 0, make_pattern(MiB, 'a'));
+    write_at(m_source, 2 * MiB, std::vector<char>(2 * MiB, 0));
+    write_at(m_source, 9 * MiB + 17, make_pattern(3 * MiB, 'k'));
+    write_at(m_source, 16 * MiB, make_pattern(123, 'x'));
+
+    // Destination contains garbage which has to be overwritten
+    write_at(m_destination, 0, make_pattern(20 * MiB, 'z'));
+
+    LvmCopyEngine::Settings settings = LvmCopyEngine::get_default_settings();
+    settings.block_size = MiB;
+    settings.queue_depth = 4;
+    const auto statistics = LvmCopyEngine{settings}.copy(m_source, m_destination);
+
+    ASSERT_EQ(statistics.total_bytes, 16 * MiB + 123);
+    ASSERT_EQ(statistics.written_bytes + statistics.skipped_bytes, statistics.total_bytes);
+    ASSERT_GE(statistics.skipped_bytes, 10 * MiB);
+    ASSERT_EQ(read_file(m_source), read_file(m_destination));
+}
+
+
+TEST_F(LvmCopyEngineTest, CopiesWithoutZeroDetection) {
+    ASSERT_EQ(::truncate(m_source.c_str(), 4 * MiB), 0);
+    write_at(m_source, MiB, make_pattern(MiB, 'q'));
+
+    LvmCopyEngine::Settings settings = LvmCopyEngine::get_default_settings();
+    settings.detect_zeroes = false;
+    settings.block_size = MiB;
+    const auto statistics = LvmCopyEngine{settings}.copy(m_source, m_destination);
+
+    // Holes of a sparse source are skipped regardless of the setting
+    ASSERT_EQ(statistics.written_bytes + statistics.skipped_bytes, 4 * MiB);
+    ASSERT_EQ(read_file(m_source), read_file(m_destination));
+}
+
+
+TEST_F(LvmCopyEngineTest, ReportsProgress) {
+    write_at(m_source, 0, make_pattern(8 * MiB, 'p'));
+
+    LvmCopyEngine::Settings settings = LvmCopyEngine::get_default_settings();
+    settings.block_size = 256 * 1024;
+    LvmCopyEngine engine{settings};
+
+    std::vector<std::uint64_t> progress{};
+    engine.set_progress_callback([&progress](std::uint64_t processed, std::uint64_t total) {
+        ASSERT_EQ(total, 8 * MiB);
+        progress.push_back(processed);
+    });
+    engine.copy(m_source, m_destination);
+
+    ASSERT_FALSE(progress.empty());
+    ASSERT_EQ(progress.back(), 8 * MiB);
+    for (std::size_t i = 1; i < progress.size(); ++i) {
+        ASSERT_GT(progress[i], progress[i - 1]);
+    }
+}
+
+
+TEST_F(LvmCopyEngineTest, ThrottlesThroughput) {
+    write_at(m_source, 0, make_pattern(2 * MiB, 't'));
+
+    LvmCopyEngine::Settings settings = LvmCopyEngine::get_default_settings();
+    settings.block_size = 256 * 1024;
+    settings.max_throughput = 8 * MiB;
+    const auto statistics = LvmCopyEngine{settings}.copy(m_source, m_destination);
+
+    // 2 MiB at 8 MiB/s takes at least 250 ms
+    ASSERT_GE(statistics.duration.count(), 240);
+    ASSERT_EQ(read_file(m_source), read_file(m_destination));
+}
+
+
+TEST_F(LvmCopyEngineTest, MissingSourceThrows) {
+    ASSERT_THROW(LvmCopyEngine{}.copy(m_source + ".missing", m_destination),
+                 agent_framework::exceptions::LvmError);
+}
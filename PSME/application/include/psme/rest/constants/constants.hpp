@@ -162,6 +162,7 @@ extern const char RESOLUTION[];
 namespace Collection {
 extern const char ODATA_COUNT[];
 extern const char MEMBERS[];
+extern const char NEXT_LINK[];
 }
 
 /*!
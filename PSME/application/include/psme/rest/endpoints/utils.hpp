@@ -111,6 +111,8 @@ void get_component_url_recursive(psme::rest::endpoint::PathBuilder& path, agent_
 /*!
  * @brief finds the URL of the given component
  *
+ * URLs are memoized, the parent chain is walked only when the URL is not known yet.
+ *
  * @param type component's type
  *
  * @param uuid component's uuid
@@ -120,6 +122,23 @@ void get_component_url_recursive(psme::rest::endpoint::PathBuilder& path, agent_
 std::string get_component_url(agent_framework::model::enums::Component type, const std::string& uuid);
 
 
+/*!
+ * @brief forgets memoized URL of the given component
+ *
+ * Has to be called when the component is added to or removed from the model,
+ * its REST id or parent might be different then.
+ *
+ * @param uuid component's uuid
+ */
+void invalidate_component_url(const std::string& uuid);
+
+
+/*!
+ * @brief forgets all memoized component URLs
+ */
+void clear_component_urls();
+
+
 /*!
  * @brief Sets component location in response header
  *
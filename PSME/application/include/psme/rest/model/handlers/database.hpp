@@ -71,6 +71,8 @@ public:
      * Creates database. All databases are kept statically by the name.
      * It is allowed to have only one database created.
      * All databases with name starting with '*' are related to all data.
+     * Log databases are created if "backend" in the "database" section of the
+     * configuration is set to "log", file databases otherwise.
      *
      * @param name database name to be returned
      * @return database for requested name.
@@ -242,6 +244,9 @@ private:
 
     /*! @brief All created databases. */
     static Databases databases;
+
+    /*! @brief Check if log databases are to be created */
+    static bool use_log_backend();
 };
 
 /*!
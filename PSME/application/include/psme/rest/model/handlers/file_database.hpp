@@ -39,6 +39,7 @@ namespace handler {
 class FileDatabase : public Database {
 
     friend class DatabaseTester;
+    friend class LogStore;
 
 public:
     FileDatabase(const std::string& name);
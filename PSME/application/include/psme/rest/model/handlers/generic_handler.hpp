@@ -29,6 +29,7 @@
 #include "psme/rest/model/handlers/handler_interface.hpp"
 #include "psme/rest/model/handlers/handler_manager.hpp"
 #include "psme/rest/model/handlers/id_policy.hpp"
+#include "psme/rest/utils/health_rollup_index.hpp"
 #include "psme/rest/eventing/event.hpp"
 #include "psme/core/agent/agent_unreachable.hpp"
 
@@ -46,6 +47,19 @@ namespace handler {
 
 using agent_framework::eventing::EventData;
 
+/*! @brief Health of a resource status, tasks keep their health as their status */
+inline const agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health>&
+get_health(const agent_framework::model::attribute::Status& status) {
+    return status.get_health();
+}
+
+
+inline const agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health>&
+get_health(const agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health>& health) {
+    return health;
+}
+
+
 /*!
  * @brief Class template that is instantiated for each Model (derived from Resource class).
  *
@@ -284,13 +298,13 @@ protected:
 
 private:
 
-    Model fetch(Context& ctx, const std::string& parent, const std::string& uuid, UpdateStatus& update_status);
+    Model fetch(Context& ctx, const std::string& parent, const std::string& uuid);
 
 
     virtual Model fetch_entry(Context& ctx, const std::string& parent, const std::string& uuid);
 
 
-    UpdateStatus add_to_model(Context& ctx, Model& entry, const std::string& uuid);
+    UpdateStatus add_to_model(Context& ctx, Model&& entry, const std::string& uuid);
 };
 
 
@@ -534,8 +548,11 @@ void GenericHandler<Request, Model, IdPolicy>
 template<typename Request, typename Model, typename IdPolicy>
 std::uint64_t GenericHandler<Request, Model, IdPolicy>
 ::add(Context& ctx, const std::string& parent, const std::string& uuid, bool recursively) {
-    UpdateStatus update_status;
-    const Model entry = fetch(ctx, parent, uuid, update_status);
+    Model entry = fetch(ctx, parent, uuid);
+    const auto id = entry.get_id();
+    const auto collections = recursively ? entry.get_collections() : typename Model::Collections{};
+    // the entry is moved to the model, the model keeps the only copy of it
+    const auto update_status = add_to_model(ctx, std::move(entry), uuid);
     if (recursively) {
         auto indent = ctx.indent;
         ctx.indent += "    ";
@@ -545,14 +562,14 @@ std::uint64_t GenericHandler<Request, Model, IdPolicy>
             my_skip = true;
         }
 
-        fetch_subcomponents(ctx, uuid, entry.get_collections());
+        fetch_subcomponents(ctx, uuid, collections);
 
         if (my_skip) {
             ctx.do_not_emit_from_descendants = false;
         }
         ctx.indent = indent;
     }
-    return entry.get_id();
+    return id;
 }
 
 
@@ -565,24 +582,33 @@ std::uint64_t GenericHandler<Request, Model, IdPolicy>
 
 template<typename Request, typename Model, typename IdPolicy>
 typename GenericHandler<Request, Model, IdPolicy>::UpdateStatus GenericHandler<Request, Model, IdPolicy>
-::add_to_model(Context& ctx, Model& entry, const std::string& uuid) {
+::add_to_model(Context& ctx, Model&& entry, const std::string& uuid) {
 
-    auto status = agent_framework::module::get_manager<Model>().add_or_update_entry(entry);
+    const auto parent_uuid = entry.get_parent_uuid();
+    const auto id = entry.get_id();
+    const auto health = get_health(entry.get_status());
+    auto status = agent_framework::module::get_manager<Model>().add_or_update_entry(std::move(entry));
+    if (UpdateStatus::Added == status || UpdateStatus::Updated == status) {
+        psme::rest::endpoint::utils::invalidate_component_url(uuid);
+    }
+    if (UpdateStatus::Added == status || UpdateStatus::StatusChanged == status) {
+        psme::rest::utils::HealthRollupIndex::get_instance().set(get_component(), uuid, parent_uuid, health);
+    }
     if (UpdateStatus::StatusChanged == status) {
         ctx.add_event(get_component(), eventing::EventType::StatusChange, uuid);
         ctx.num_status_changed++;
         log_debug(GET_LOGGER("rest"), ctx.indent << "[" << char(ctx.mode) << "] "
                                                  << "Status changed [" << component_s() << " " << uuid
-                                                 << ", parent_uuid: " << entry.get_parent_uuid()
-                                                 << ", id: " << entry.get_id() << "]");
+                                                 << ", parent_uuid: " << parent_uuid
+                                                 << ", id: " << id << "]");
     }
     if (UpdateStatus::StatusChanged == status || UpdateStatus::Updated == status) {
         ctx.add_event(get_component(), eventing::EventType::ResourceUpdated, uuid);
         ctx.num_updated++;
         log_debug(GET_LOGGER("rest"), ctx.indent << "[" << char(ctx.mode) << "] "
                                                  << "Updated [" << component_s() << " " << uuid
-                                                 << ", parent_uuid: " << entry.get_parent_uuid()
-                                                 << ", id: " << entry.get_id() << "]");
+                                                 << ", parent_uuid: " << parent_uuid
+                                                 << ", id: " << id << "]");
     }
     if (UpdateStatus::Added == status) {
         if (!ctx.do_not_emit_from_descendants) {
@@ -591,8 +617,8 @@ typename GenericHandler<Request, Model, IdPolicy>::UpdateStatus GenericHandler<R
         ctx.num_added++;
         log_info(GET_LOGGER("rest"), ctx.indent << "[" << char(ctx.mode) << "] "
                                                 << "Added [" << component_s() << " " << uuid
-                                                << ", parent_uuid: " << entry.get_parent_uuid()
-                                                << ", id: " << entry.get_id() << "]");
+                                                << ", parent_uuid: " << parent_uuid
+                                                << ", id: " << id << "]");
     }
 
     return status;
@@ -601,15 +627,13 @@ typename GenericHandler<Request, Model, IdPolicy>::UpdateStatus GenericHandler<R
 
 template<typename Request, typename Model, typename IdPolicy>
 Model GenericHandler<Request, Model, IdPolicy>
-::fetch(Context& ctx, const std::string& parent, const std::string& uuid, UpdateStatus& update_status) {
+::fetch(Context& ctx, const std::string& parent, const std::string& uuid) {
 
     auto entry = fetch_entry(ctx, parent, uuid);
     entry.set_id(get_id(uuid, parent));
     entry.set_agent_id(ctx.agent->get_gami_id());
     assert(!entry.get_agent_id().empty());
 
-    update_status = add_to_model(ctx, entry, uuid);
-
     return entry;
 }
 
@@ -822,6 +846,8 @@ void GenericHandler<Request, Model, IdPolicy>::remove_single(const std::string u
                                               << agent_framework::module::get_manager<Model>().uuid_to_rest_id(uuid)
                                               << "] from the model");
     agent_framework::module::get_manager<Model>().remove_entry(uuid);
+    psme::rest::endpoint::utils::invalidate_component_url(uuid);
+    psme::rest::utils::HealthRollupIndex::get_instance().remove(uuid);
 
     log_debug(GET_LOGGER("db"), "remove single " << parent_uuid << "." << uuid);
     m_id_policy.purge(uuid, parent_uuid); // we do not want to have same rest id when FRU is reinserted
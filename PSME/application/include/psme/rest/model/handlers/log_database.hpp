@@ -0,0 +1,281 @@
+/*!
+ * @brief Database implementation
+ *
+ * Database entries of all databases are kept in memory and stored in single
+ * append-only log file. Each record is protected with a checksum, the log is
+ * compacted when most of it is taken by outdated records.
+ *
+ * @header{License}
+ * @copyright Copyright (c) 2017 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @header{Filesystem}
+ * @file log_database.hpp
+ */
+
+#pragma once
+
+#include "psme/rest/model/handlers/database.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+
+namespace psme {
+namespace rest {
+namespace model {
+namespace handler {
+
+/*!
+ * @brief Log structured key/value store shared by all log databases.
+ *
+ * All entries are kept in memory, every change is appended to the log file.
+ * The log is synced in batches: after SYNC_RECORDS records, otherwise by
+ * the sync thread SYNC_INTERVAL after the first unsynced record. Records torn
+ * by a crash are detected by their checksums and cut off when the log is loaded.
+ * The log is compacted when it is loaded and by the sync thread, never by writes.
+ */
+class LogStore final {
+public:
+    /*! @brief Stored entry */
+    struct Entry {
+        /*! Serialized value */
+        std::string value;
+        /*! Entry is valid (in use) */
+        bool valid;
+        /*! Time of the last validity change, as status change time of the files */
+        std::time_t changed;
+    };
+
+    /*! @brief Number of records appended before the log is synced */
+    static constexpr unsigned SYNC_RECORDS = 256;
+
+    /*! @brief Maximal time records are kept in the log unsynced */
+    static constexpr std::chrono::milliseconds SYNC_INTERVAL{1000};
+
+    /*! @brief Log is not compacted until it is smaller */
+    static constexpr std::uint64_t COMPACTION_MIN_SIZE = 256 * 1024;
+
+    /*! @brief Log is compacted when it is that many times bigger than live data */
+    static constexpr std::uint64_t COMPACTION_RATIO = 3;
+
+    /*!
+     * @brief Get store used by log databases
+     *
+     * Log file is kept in the same directory as files of the file database.
+     * Entries of the file database are imported when the log doesn't exist.
+     * The store is synced and closed at exit.
+     *
+     * @return Store instance
+     */
+    static LogStore& get_instance();
+
+    /*!
+     * @brief Open (or create) the log and load all entries
+     * @param file_name Full name of the log file
+     */
+    explicit LogStore(const std::string& file_name);
+
+    /*! @brief Stop the sync thread, sync and close the log */
+    ~LogStore();
+
+    /*!
+     * @brief Get entry
+     * @param key Full key of the entry
+     * @param[out] entry Found entry
+     * @return true if entry exists
+     */
+    bool get(const std::string& key, Entry& entry) const;
+
+    /*!
+     * @brief Store value, entry is valid afterwards
+     * @param key Full key of the entry
+     * @param value Serialized value
+     * @return true if value was stored
+     */
+    bool put(const std::string& key, const std::string& value);
+
+    /*!
+     * @brief Remove entry
+     * @param key Full key of the entry
+     * @return true if entry was removed
+     */
+    bool remove(const std::string& key);
+
+    /*!
+     * @brief Mark valid entry as invalid
+     * @param key Full key of the entry
+     * @return true if entry was valid
+     */
+    bool invalidate(const std::string& key);
+
+    /*!
+     * @brief Get keys of all entries
+     * @param prefix Only keys starting with prefix are returned
+     * @return Sorted list of keys
+     */
+    std::vector<std::string> get_keys(const std::string& prefix) const;
+
+    /*! @brief Write all appended records to the disk */
+    void sync();
+
+    /*! @brief Rewrite the log with live entries only */
+    void compact();
+
+    /*! @brief Get number of entries */
+    std::size_t size() const;
+
+    /*! @brief Get size of the log file */
+    std::uint64_t get_log_size() const;
+
+private:
+    LogStore(const LogStore&) = delete;
+    LogStore& operator=(const LogStore&) = delete;
+
+    /*! @brief Log record operation */
+    enum class Operation : std::uint8_t {
+        PUT = 1,
+        REMOVE = 2
+    };
+
+    LogStore(const std::string& file_name, bool import);
+
+    void load();
+    bool open_log();
+    void import_files();
+    void sync_loop();
+    bool put(const std::string& key, const std::string& value, bool valid, std::time_t changed);
+    bool append(Operation operation, const std::string& key, const Entry& entry);
+    void sync_if_needed();
+    void compact_if_needed();
+    void sync_unlocked();
+    void compact_unlocked();
+    void set_entry(const std::string& key, Entry&& entry);
+    void erase_entry(std::map<std::string, Entry>::iterator it);
+
+    static std::string make_record(Operation operation, const std::string& key, const Entry& entry);
+
+    const std::string m_file_name;
+    int m_fd{-1};
+    std::map<std::string, Entry> m_entries{};
+    std::uint64_t m_log_size{0};
+    std::uint64_t m_live_size{0};
+    unsigned m_unsynced{0};
+    std::chrono::steady_clock::time_point m_last_sync{};
+    bool m_stopped{false};
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_sync_cv{};
+    std::thread m_sync_thread{};
+};
+
+
+
+/*!
+ * @brief Database storing key/value pairs in the shared log store.
+ */
+class LogDatabase : public Database {
+public:
+    /*!
+     * @brief Creates database with given name
+     * @param name Database name
+     * @param store Store where entries are kept
+     */
+    LogDatabase(const std::string& name, LogStore& store = LogStore::get_instance());
+
+    virtual ~LogDatabase();
+
+    bool start() override;
+
+    bool next(Serializable& key, Serializable& value) override;
+
+    void end() override;
+
+    bool get(const Serializable& key, Serializable& value) override;
+
+    bool put(const Serializable& key, const Serializable& value) override;
+
+    bool remove(const Serializable& key) override;
+
+    EntityValidity get_validity(const Serializable& key, std::chrono::seconds interval = NEVER) override;
+
+    bool invalidate(const Serializable& key) override;
+
+    unsigned cleanup(Serializable& key, std::chrono::seconds interval = NEVER) override;
+
+    unsigned wipe_outdated(Serializable& key, std::chrono::seconds interval) override;
+
+    unsigned drop(Serializable& key) override;
+
+private:
+    LogDatabase& operator=(const LogDatabase&) = delete;
+    LogDatabase(const LogDatabase&) = delete;
+    LogDatabase() = delete;
+
+    /*! @brief Function to be called on each found key */
+    using ForeachFunction = std::function<bool(const std::string& full_key)>;
+
+    /*!
+     * @brief Iterate over all entries
+     * @param key to iterate over
+     * @param function to be executed on each matching key
+     * @return number of processed entries
+     */
+    unsigned foreach(Serializable& key, ForeachFunction function);
+
+    /*!
+     * @brief Return key in the store for given (serialized) key
+     * @param stripped_name Serialized key
+     * @return full key, empty if stripped name is empty
+     */
+    std::string full_key(const std::string& stripped_name) const;
+
+    /*!
+     * @brief Check entry validity
+     * @param full_key Full key of the entry
+     * @param interval when entry stands outdated
+     * @return state of the entry
+     */
+    EntityValidity validity(const std::string& full_key, std::chrono::seconds interval) const;
+
+    /*! @brief Current state of iterating process */
+    enum class IteratingState {
+        NOT_STARTED, //!< Iterating not in progress
+        STARTED, //!< Iterating was just started, but no next() was called
+        ITERATE //!< Iterating
+    };
+
+    IteratingState iterating_state{IteratingState::NOT_STARTED};
+
+    /*! @brief List of found keys to be used during iterating */
+    using IteratedKeys = std::vector<std::string>;
+    IteratedKeys iterated_keys{};
+    IteratedKeys::const_iterator current_key{};
+
+    LogStore& store;
+
+    /*! Mutex to disallow iterating from multiple threads. */
+    std::recursive_mutex mutex{};
+};
+
+} // @i{handler}
+} // @i{model}
+} // @i{rest}
+} // @i{psme}
@@ -111,9 +111,10 @@ private:
         try {
             auto elem = ctx.agent->execute<Task>(request);
             if (agent_framework::module::get_manager<Task>().entry_exists(uuid)) {
-                const auto& task = agent_framework::module::get_manager<Task>().get_entry(uuid);
-                elem.set_messages(task.get_messages());
-                elem.set_completion_notifiers(task.get_completion_notifiers());
+                // only the messages and notifiers are copied, not the whole stored task
+                auto task = agent_framework::module::get_manager<Task>().get_entry_reference(uuid);
+                elem.set_messages(task->get_messages());
+                elem.set_completion_notifiers(task->get_completion_notifiers());
             }
             if (elem.get_state() == agent_framework::model::enums::TaskState::Exception) {
                 try {
@@ -45,6 +45,7 @@
 #include "psme/rest/server/response.hpp"
 #include "psme/rest/server/methods_handler.hpp"
 #include "psme/rest/server/mux/matchers.hpp"
+#include "psme/rest/server/query_options.hpp"
 
 #include <tuple>
 #include <vector>
@@ -112,6 +113,7 @@ public:
      *
      * Based on the URI target of the request object, forwards the request and response objects to
      * an appropriate handler for producing a response. Always chooses the first registered match.
+     * OData query options ($expand, $select, $top, $skip) of GET requests are applied to the response.
      *
      * @param response object used to generate an HTTP response
      * @param request object containing information about the HTTP request
@@ -134,6 +136,12 @@ private:
     bool is_access_allowed(Response& response, Request& request,
                            const PathHandlerCandidate& candidate) const;
 
+    /*! @brief Apply query options to JSON body of the response */
+    void apply_query_options(const QueryOptions& options, const Request& request, Response& response);
+
+    /*! @brief GET resource to be expanded, the request of the expanding resource is used for access check */
+    bool get_resource(const Request& request, const std::string& url, json::Value& resource);
+
     PathHandlerCandidates m_handler_candidates{};
 
     PluginHandler m_plugin_pre_handlers{};
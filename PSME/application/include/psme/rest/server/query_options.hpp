@@ -0,0 +1,108 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/* Forward declaration */
+namespace json {
+class Value;
+}
+
+namespace psme {
+namespace rest {
+namespace server {
+
+/*! Forward declaration */
+class Request;
+
+/*!
+ * @brief OData query options of GET requests: $expand, $select, $top and $skip.
+ *
+ * Options are applied to the JSON body returned by the endpoint:
+ * - $top/$skip page Members of a collection, Members@odata.nextLink points to the next page,
+ * - $expand replaces references ({"@odata.id": ...}) with the referenced resources:
+ *   "." those outside of Links, "~" those in Links, "*" all of them; "($levels=n)" may follow,
+ * - $select keeps only given properties (and @odata annotations). For collections
+ *   it is applied to the expanded members.
+ */
+class QueryOptions {
+public:
+    /*! @brief Callback getting resource with given URL, returns false if it cannot be read */
+    using ResourceGetter = std::function<bool(const std::string& url, json::Value& resource)>;
+
+    /*! @brief Deepest $expand supported */
+    static constexpr std::uint32_t MAX_EXPAND_LEVELS = 6;
+
+    /*!
+     * @brief Parse query options of the request
+     * @param request HTTP request
+     * @return Parsed options
+     * @throw ServerException if any option has invalid value
+     */
+    static QueryOptions from_request(const Request& request);
+
+    /*!
+     * @brief Check if any option was given
+     * @return true if there is nothing to apply
+     */
+    bool empty() const;
+
+    /*!
+     * @brief Apply options to the resource
+     * @param url URL of the resource (without query)
+     * @param resource JSON body of the resource
+     * @param get_resource Getter of expanded resources
+     */
+    void apply(const std::string& url, json::Value& resource, const ResourceGetter& get_resource) const;
+
+private:
+    enum class Expand {
+        NONE,
+        NOT_LINKS,
+        LINKS,
+        ALL
+    };
+
+    void page(const std::string& url, json::Value& resource) const;
+
+    void expand(json::Value& value, std::uint32_t levels, bool in_links, const ResourceGetter& get_resource) const;
+
+    void select(json::Value& resource) const;
+
+    std::string get_next_link(const std::string& url, std::uint64_t skip) const;
+
+    Expand m_expand{Expand::NONE};
+    std::uint32_t m_expand_levels{1};
+    std::string m_expand_value{};
+    std::vector<std::string> m_select{};
+    std::string m_select_value{};
+    bool m_has_top{false};
+    std::uint64_t m_top{0};
+    std::uint64_t m_skip{0};
+};
+
+}
+}
+}
@@ -0,0 +1,123 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#pragma once
+
+
+
+#include "agent-framework/module/enum/common.hpp"
+#include "agent-framework/module/utils/optional_field.hpp"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+
+
+namespace psme {
+namespace rest {
+namespace utils {
+
+/*!
+ * @brief Health of the model components aggregated over their subtrees.
+ *
+ * Each component keeps number of its descendants of each type with each health.
+ * Counts are updated along the parent chain when a component is added, removed
+ * or its health changes, so the rollup health is read without walking the subtree.
+ * The index is fed by the generic handlers, components added to the model by other
+ * means are not known to it.
+ */
+class HealthRollupIndex final {
+public:
+    using Component = agent_framework::model::enums::Component;
+    using Health = agent_framework::model::enums::Health;
+    using OptionalHealth = agent_framework::module::utils::OptionalField<Health>;
+
+    static HealthRollupIndex& get_instance();
+
+
+    /*!
+     * @brief Add component or update its health
+     *
+     * @param[in] component Component type
+     * @param[in] uuid Component's uuid
+     * @param[in] parent_uuid Parent's uuid
+     * @param[in] health Component's own health
+     */
+    void set(Component component, const std::string& uuid, const std::string& parent_uuid,
+             const OptionalHealth& health);
+
+
+    /*!
+     * @brief Remove component, its descendants are kept until they are removed
+     *
+     * @param[in] uuid Component's uuid
+     */
+    void remove(const std::string& uuid);
+
+
+    /*! @brief Forget all components */
+    void clear();
+
+
+    /*!
+     * @brief Get health rollup of the component
+     *
+     * @param[in] uuid Component's uuid
+     * @param[in] filter Only components of given type are rolled up, None for all types
+     * @param[out] rollup Health rollup
+     * @return false if the component is not known
+     */
+    bool get(const std::string& uuid, Component filter, OptionalHealth& rollup) const;
+
+private:
+    static constexpr std::size_t HEALTH_COUNT = 3;
+
+    /*! @brief Number of components with each health */
+    using HealthCounts = std::array<std::uint64_t, HEALTH_COUNT>;
+
+    /*! @brief Health counts of components of each type */
+    using Counts = std::map<Component, HealthCounts>;
+
+    struct Node {
+        Component component{Component::None};
+        std::string parent{};
+        OptionalHealth health{};
+        /*! Node is in the model, otherwise it's only kept for its descendants */
+        bool in_model{false};
+        Counts descendants{};
+    };
+
+    /*! @brief Counts to be added to (or subtracted from) the ancestors of the node */
+    static Counts get_contribution(const Node& node);
+
+    /*! @brief Add (or subtract) counts to all ancestors starting from given parent */
+    void propagate(const std::string& parent_uuid, const Counts& counts, bool subtract);
+
+    std::unordered_map<std::string, Node> m_nodes{};
+    mutable std::mutex m_mutex{};
+};
+
+}
+}
+}
@@ -25,6 +25,7 @@
 #include "psme/rest/model/handlers/handler_manager.hpp"
 #include "psme/rest/model/handlers/generic_handler_deps.hpp"
 #include "psme/rest/model/handlers/handler_interface.hpp"
+#include "psme/rest/utils/health_rollup_index.hpp"
 #include <algorithm>
 
 
@@ -49,6 +50,27 @@ public:
     }
 
 
+    /*!
+     * @brief Gets Health rollup of node identified by uuid
+     *
+     * Rollup is read from HealthRollupIndex, subtree is walked only for nodes not known to the index.
+     *
+     * @param[in] uuid Node for which health rollup is to be computed
+     * @param[in] filter Optional parameter that limits rollup computation to given component type
+     * @return Health Rollup optional
+     */
+    agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health> get(
+        const std::string& uuid,
+        const Component filter = Component::None) {
+
+        agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health> rollup{};
+        if (psme::rest::utils::HealthRollupIndex::get_instance().get(uuid, filter, rollup)) {
+            return rollup;
+        }
+        return compute(uuid, filter);
+    }
+
+
     /*!
      * @brief Computes Health rollup starting from node identified by uuid
      *
@@ -58,7 +80,7 @@ public:
      * @param[in] filter Optional parameter that limits rollup computation to given component type
      * @return Health Rollup optional
      */
-    agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health> get(
+    agent_framework::module::utils::OptionalField<agent_framework::model::enums::Health> compute(
         const std::string& uuid,
         const Component filter = Component::None) {
 
@@ -138,6 +138,7 @@ const char RESOLUTION[] = "Resolution";
 namespace Collection {
 const char ODATA_COUNT[] = "Members@odata.count";
 const char MEMBERS[] = "Members";
+const char NEXT_LINK[] = "Members@odata.nextLink";
 }
 
 namespace Root {
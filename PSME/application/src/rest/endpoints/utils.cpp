@@ -32,6 +32,8 @@
 
 #include <regex>
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
 
 
 
@@ -138,7 +140,93 @@ void build_child_path(endpoint::PathBuilder& path, const std::string& uuid, cons
 }
 
 
-void get_component_url_recursive(endpoint::PathBuilder& path, enums::Component type, const std::string& uuid) {
+namespace {
+
+/*!
+ * @brief Memoized paths (relative to the service root) of the model components.
+ *
+ * Path depends on REST ids of the component and all its ancestors, which don't change
+ * until the component is added again or removed, so the handlers invalidate the path then.
+ */
+class UrlIndex final {
+public:
+    /*! @brief Index is cleared when it grows that big, not all components are removed by handlers */
+    static constexpr std::size_t MAX_SIZE = 128 * 1024;
+
+    static UrlIndex& get_instance() {
+        static UrlIndex instance{};
+        return instance;
+    }
+
+    /*!
+     * @brief Find memoized path
+     * @param type component's type
+     * @param uuid component's uuid
+     * @param[out] path found path
+     * @param[out] generation to be passed to add() when the path is not found
+     * @return true if path was found
+     */
+    bool find(enums::Component type, const std::string& uuid, std::string& path, std::uint64_t& generation) const {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        generation = m_generation;
+        const auto it = m_paths.find(uuid);
+        if (m_paths.end() == it || it->second.type != type) {
+            return false;
+        }
+        path = it->second.path;
+        return true;
+    }
+
+    /*!
+     * @brief Memoize path. Path computed while any path was invalidated is not stored.
+     * @param type component's type
+     * @param uuid component's uuid
+     * @param path component's path
+     * @param generation returned by find() before the path was computed
+     */
+    void add(enums::Component type, const std::string& uuid, const std::string& path, std::uint64_t generation) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (generation != m_generation) {
+            return;
+        }
+        if (m_paths.size() >= MAX_SIZE) {
+            m_paths.clear();
+        }
+        m_paths.erase(uuid);
+        m_paths.emplace(uuid, Entry{type, path});
+    }
+
+    void invalidate(const std::string& uuid) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_generation;
+        m_paths.erase(uuid);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_generation;
+        m_paths.clear();
+    }
+
+private:
+    struct Entry {
+        enums::Component type;
+        std::string path;
+    };
+
+    std::unordered_map<std::string, Entry> m_paths{};
+    std::uint64_t m_generation{0};
+    mutable std::mutex m_mutex{};
+};
+
+constexpr std::size_t UrlIndex::MAX_SIZE;
+
+
+/*!
+ * @brief Builds path of the component, parent paths are taken from the index
+ * @return false if the path couldn't be built completely
+ */
+bool build_component_path(endpoint::PathBuilder& path, enums::Component type, const std::string& uuid) {
     using Component = enums::Component;
     using namespace psme::rest;
     using namespace agent_framework;
@@ -217,7 +305,7 @@ void get_component_url_recursive(endpoint::PathBuilder& path, enums::Component t
                 log_error(GET_LOGGER("rest"),
                           "PNC Manager should have precisely one Chassis child!"
                               " Server is unable to build a path to PCIeDevice component.");
-                break;
+                return false;
             }
             get_component_url_recursive(path, enums::Component::Chassis, chassis_uuids.front());
             path.append(constants::Chassis::PCIE_DEVICES).append(pcie_device.get_id());
@@ -266,6 +354,31 @@ void get_component_url_recursive(endpoint::PathBuilder& path, enums::Component t
                   "Could not get URL for component type: " + std::string(type.to_string()));
             break;
     }
+    return true;
+}
+
+}
+
+
+void get_component_url_recursive(endpoint::PathBuilder& path, enums::Component type, const std::string& uuid) {
+    auto& index = UrlIndex::get_instance();
+    std::string component_path{};
+    std::uint64_t generation{};
+
+    if (!index.find(type, uuid, component_path, generation)) {
+        endpoint::PathBuilder builder{};
+        const bool complete = build_component_path(builder, type, uuid);
+        component_path = builder.build();
+        if (component_path.empty()) {
+            return;
+        }
+        // stored without leading separator, it is added by append()
+        component_path.erase(0, 1);
+        if (complete) {
+            index.add(type, uuid, component_path, generation);
+        }
+    }
+    path.append(component_path);
 }
 
 
@@ -276,6 +389,16 @@ std::string get_component_url(enums::Component type, const std::string& uuid) {
 }
 
 
+void invalidate_component_url(const std::string& uuid) {
+    UrlIndex::get_instance().invalidate(uuid);
+}
+
+
+void clear_component_urls() {
+    UrlIndex::get_instance().clear();
+}
+
+
 void set_location_header(server::Response& res, const std::string& path) {
     res.set_header(LOCATION, path);
 }
@@ -19,6 +19,8 @@
  */
 
 #include "psme/rest/model/handlers/file_database.hpp"
+#include "psme/rest/model/handlers/log_database.hpp"
+#include "configuration/configuration.hpp"
 
 #include <logger/logger.hpp>
 #include <logger/logger_factory.hpp>
@@ -105,6 +107,15 @@ Database::Database(const std::string& _name) : name(_name) { }
 
 const std::string& Database::get_name() const { return name; }
 
+bool Database::use_log_backend() {
+    static const bool use_log = []() {
+        auto config = configuration::Configuration::get_instance().to_json();
+        auto backend = config["database"]["backend"];
+        return backend.is_string() && (backend.as_string() == "log");
+    }();
+    return use_log;
+}
+
 Database::SPtr Database::create(const std::string& name) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
 
@@ -118,7 +129,13 @@ Database::SPtr Database::create(const std::string& name) {
     }
     /* create new one, everything started with '*' means "all the data" */
     const std::string n = (name.substr(0, 1) == "*") ? "" : name;
-    SPtr added{new FileDatabase(n)};
+    SPtr added{};
+    if (use_log_backend()) {
+        added.reset(new LogDatabase(n));
+    }
+    else {
+        added.reset(new FileDatabase(n));
+    }
     databases.push_back(added);
     return added;
 }
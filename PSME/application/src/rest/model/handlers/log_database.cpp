@@ -0,0 +1,699 @@
+/*!
+ * @brief Log structured database implementation
+ *
+ * @header{License}
+ * @copyright Copyright (c) 2017 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @header{Filesystem}
+ * @file log_database.cpp
+ */
+
+#include "psme/rest/model/handlers/log_database.hpp"
+#include "psme/rest/model/handlers/file_database.hpp"
+
+#include <logger/logger.hpp>
+#include <logger/logger_factory.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstring>
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+
+
+namespace psme {
+namespace rest {
+namespace model {
+namespace handler {
+
+namespace {
+
+/*! @brief Name of the log file */
+constexpr const char LOG_FILE[] = "/rest-ids.log";
+
+/*! @brief Checksum and payload length */
+constexpr std::size_t RECORD_HEADER_LEN = 2 * sizeof(std::uint32_t);
+
+/*! @brief Operation, validity, change time and key length */
+constexpr std::size_t PAYLOAD_FIXED_LEN = 2 * sizeof(std::uint8_t) + sizeof(std::int64_t) + sizeof(std::uint32_t);
+
+/*! @brief Records longer than that are assumed to be corrupted */
+constexpr std::uint32_t MAX_PAYLOAD_LEN = 64 * 1024;
+
+/*! FAIL condition for assert. Raise assertion when given condition is met. */
+constexpr bool FAIL(const char*, bool when = true) { return !when; }
+
+/*! @brief CRC-32 (IEEE 802.3) of the data */
+std::uint32_t crc32(const char* data, std::size_t length) {
+    static const std::array<std::uint32_t, 256> table = []() {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < t.size(); ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < length; ++i) {
+        crc = table[(crc ^ std::uint8_t(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+template <typename T>
+void write_field(std::string& record, T value) {
+    record.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T read_field(const char* data) {
+    T value{};
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+std::uint64_t record_size(const std::string& key, const LogStore::Entry& entry) {
+    return RECORD_HEADER_LEN + PAYLOAD_FIXED_LEN + key.size() + entry.value.size();
+}
+
+bool write_all(int fd, const std::string& data) {
+    std::size_t done = 0;
+    while (done < data.size()) {
+        auto written = ::write(fd, data.data() + done, data.size() - done);
+        if (0 > written) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return false;
+        }
+        done += std::size_t(written);
+    }
+    return true;
+}
+
+/*! @brief Any string as a key/value, used to import file database */
+class RawString final : public Serializable {
+public:
+    const std::string& get() const { return data; }
+
+private:
+    std::string data{};
+
+    std::string serialize() const override { return data; }
+
+    bool unserialize(const std::string& str) override {
+        data = str;
+        return true;
+    }
+};
+
+}
+
+constexpr unsigned LogStore::SYNC_RECORDS;
+constexpr std::chrono::milliseconds LogStore::SYNC_INTERVAL;
+constexpr std::uint64_t LogStore::COMPACTION_MIN_SIZE;
+constexpr std::uint64_t LogStore::COMPACTION_RATIO;
+
+LogStore& LogStore::get_instance() {
+    /* destroyed at exit, so the last records are synced */
+    static LogStore store{[]() {
+        if (FileDatabase::PATH.empty()) {
+            FileDatabase::PATH = FileDatabase::get_directory();
+        }
+        return FileDatabase::PATH + LOG_FILE;
+    }(), true};
+    return store;
+}
+
+LogStore::LogStore(const std::string& file_name) : LogStore(file_name, false) { }
+
+LogStore::LogStore(const std::string& file_name, bool import) : m_file_name(file_name) {
+    struct stat stats;
+    const bool exists = (0 == stat(m_file_name.c_str(), &stats));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        load();
+        m_last_sync = std::chrono::steady_clock::now();
+        compact_if_needed();
+    }
+    if (import && !exists) {
+        import_files();
+    }
+    m_sync_thread = std::thread(&LogStore::sync_loop, this);
+}
+
+LogStore::~LogStore() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_sync_cv.notify_one();
+    if (m_sync_thread.joinable()) {
+        m_sync_thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (0 <= m_fd) {
+        sync_unlocked();
+        close(m_fd);
+    }
+}
+
+void LogStore::import_files() {
+    /* keep IDs assigned while files were used, with their validity and age */
+    FileDatabase files{""};
+    RawString key{};
+    RawString value{};
+    files.start();
+    while (files.next(key, value)) {
+        struct stat stats;
+        if (0 != stat(files.full_name(key.get()).c_str(), &stats)) {
+            log_warning(GET_LOGGER("db"), "Cannot import " << key.get() << ":: " << strerror(errno));
+            continue;
+        }
+        put(key.get(), value.get(), S_ISVTX == (stats.st_mode & S_ISVTX), stats.st_ctim.tv_sec);
+    }
+    files.end();
+    sync();
+    log_info(GET_LOGGER("db"), "Imported " << size() << " entries from the file database");
+}
+
+void LogStore::sync_loop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopped) {
+        const auto now = std::chrono::steady_clock::now();
+        if ((0 != m_unsynced) && (now - m_last_sync >= SYNC_INTERVAL)) {
+            sync_unlocked();
+        }
+        /* not done by writes, requests don't wait for the log to be rewritten */
+        compact_if_needed();
+        /* woken up by the first unsynced record */
+        if (0 != m_unsynced) {
+            m_sync_cv.wait_until(lock, m_last_sync + SYNC_INTERVAL);
+        }
+        else {
+            m_sync_cv.wait(lock);
+        }
+    }
+}
+
+bool LogStore::open_log() {
+    m_fd = open(m_file_name.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (0 > m_fd) {
+        log_error(GET_LOGGER("db"), "Cannot open database log " << m_file_name << ":: " << strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void LogStore::load() {
+    if (!open_log()) {
+        return;
+    }
+
+    /* read whole log */
+    std::string data{};
+    char buffer[64 * 1024];
+    ssize_t bytes;
+    while (0 < (bytes = pread(m_fd, buffer, sizeof(buffer), off_t(data.size())))) {
+        data.append(buffer, std::size_t(bytes));
+    }
+
+    /* replay records, stop on the first damaged one */
+    std::size_t offset = 0;
+    while (offset + RECORD_HEADER_LEN <= data.size()) {
+        const char* record = data.data() + offset;
+        const auto checksum = read_field<std::uint32_t>(record);
+        const auto payload_len = read_field<std::uint32_t>(record + sizeof(std::uint32_t));
+        if ((payload_len < PAYLOAD_FIXED_LEN) || (payload_len > MAX_PAYLOAD_LEN) ||
+            (offset + RECORD_HEADER_LEN + payload_len > data.size()) ||
+            (checksum != crc32(record + sizeof(std::uint32_t), sizeof(std::uint32_t) + payload_len))) {
+            break;
+        }
+
+        const char* payload = record + RECORD_HEADER_LEN;
+        const auto operation = Operation(read_field<std::uint8_t>(payload));
+        Entry entry{};
+        entry.valid = (0 != read_field<std::uint8_t>(payload + 1));
+        entry.changed = std::time_t(read_field<std::int64_t>(payload + 2));
+        const auto key_len = read_field<std::uint32_t>(payload + 2 + sizeof(std::int64_t));
+        if (key_len > payload_len - PAYLOAD_FIXED_LEN) {
+            break;
+        }
+        std::string key(payload + PAYLOAD_FIXED_LEN, key_len);
+        entry.value.assign(payload + PAYLOAD_FIXED_LEN + key_len, payload_len - PAYLOAD_FIXED_LEN - key_len);
+
+        if (Operation::PUT == operation) {
+            set_entry(key, std::move(entry));
+        }
+        else {
+            auto it = m_entries.find(key);
+            if (m_entries.end() != it) {
+                erase_entry(it);
+            }
+        }
+        offset += RECORD_HEADER_LEN + payload_len;
+    }
+
+    if (offset != data.size()) {
+        log_warning(GET_LOGGER("db"), "Database log " << m_file_name << " damaged at offset " << offset
+                                      << ", " << (data.size() - offset) << " bytes dropped");
+        if (0 != ftruncate(m_fd, off_t(offset))) {
+            log_error(GET_LOGGER("db"), "Cannot truncate database log:: " << strerror(errno));
+        }
+    }
+    m_log_size = offset;
+    log_debug(GET_LOGGER("db"), "Loaded " << m_entries.size() << " entries from " << m_file_name);
+}
+
+std::string LogStore::make_record(Operation operation, const std::string& key, const Entry& entry) {
+    std::string record{};
+    record.reserve(std::size_t(record_size(key, entry)));
+    write_field(record, std::uint32_t(0));
+    write_field(record, std::uint32_t(PAYLOAD_FIXED_LEN + key.size() + entry.value.size()));
+    write_field(record, std::uint8_t(operation));
+    write_field(record, std::uint8_t(entry.valid ? 1 : 0));
+    write_field(record, std::int64_t(entry.changed));
+    write_field(record, std::uint32_t(key.size()));
+    record.append(key);
+    record.append(entry.value);
+
+    const auto checksum = crc32(record.data() + sizeof(std::uint32_t), record.size() - sizeof(std::uint32_t));
+    std::memcpy(&record[0], &checksum, sizeof(checksum));
+    return record;
+}
+
+bool LogStore::append(Operation operation, const std::string& key, const Entry& entry) {
+    if (0 > m_fd) {
+        return false;
+    }
+    const auto record = make_record(operation, key, entry);
+    if (!write_all(m_fd, record)) {
+        log_error(GET_LOGGER("db"), "Cannot write database log " << m_file_name << ":: " << strerror(errno));
+        return false;
+    }
+    m_log_size += record.size();
+    if (1 == ++m_unsynced) {
+        m_sync_cv.notify_one();
+    }
+    return true;
+}
+
+void LogStore::set_entry(const std::string& key, Entry&& entry) {
+    auto it = m_entries.find(key);
+    if (m_entries.end() != it) {
+        m_live_size -= record_size(it->first, it->second);
+        it->second = std::move(entry);
+    }
+    else {
+        it = m_entries.emplace(key, std::move(entry)).first;
+    }
+    m_live_size += record_size(it->first, it->second);
+}
+
+void LogStore::erase_entry(std::map<std::string, Entry>::iterator it) {
+    m_live_size -= record_size(it->first, it->second);
+    m_entries.erase(it);
+}
+
+void LogStore::sync_if_needed() {
+    if ((m_unsynced >= SYNC_RECORDS) ||
+        (std::chrono::steady_clock::now() - m_last_sync >= SYNC_INTERVAL)) {
+        sync_unlocked();
+    }
+}
+
+void LogStore::sync_unlocked() {
+    if ((0 <= m_fd) && (0 != m_unsynced)) {
+        if (0 != fdatasync(m_fd)) {
+            log_error(GET_LOGGER("db"), "Cannot sync database log:: " << strerror(errno));
+        }
+        m_unsynced = 0;
+    }
+    m_last_sync = std::chrono::steady_clock::now();
+}
+
+void LogStore::compact_if_needed() {
+    if ((m_log_size > COMPACTION_MIN_SIZE) && (m_log_size > COMPACTION_RATIO * m_live_size)) {
+        compact_unlocked();
+    }
+}
+
+void LogStore::compact_unlocked() {
+    const std::string tmp_name = m_file_name + ".tmp";
+    int fd = open(tmp_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (0 > fd) {
+        log_error(GET_LOGGER("db"), "Cannot create " << tmp_name << ":: " << strerror(errno));
+        return;
+    }
+
+    std::string data{};
+    bool ok = true;
+    for (const auto& entry : m_entries) {
+        data.append(make_record(Operation::PUT, entry.first, entry.second));
+        if (data.size() >= 64 * 1024) {
+            ok = ok && write_all(fd, data);
+            data.clear();
+        }
+    }
+    ok = ok && write_all(fd, data) && (0 == fdatasync(fd));
+    close(fd);
+
+    /* new log replaces old one atomically, only when it is safe on the disk */
+    if (!ok || (0 != rename(tmp_name.c_str(), m_file_name.c_str()))) {
+        log_error(GET_LOGGER("db"), "Cannot compact database log:: " << strerror(errno));
+        ::remove(tmp_name.c_str());
+        return;
+    }
+    const auto slash = m_file_name.rfind('/');
+    const std::string dir_name = (std::string::npos != slash) ? m_file_name.substr(0, slash + 1) : ".";
+    int dir_fd = open(dir_name.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (0 <= dir_fd) {
+        fsync(dir_fd);
+        close(dir_fd);
+    }
+
+    log_debug(GET_LOGGER("db"), "Database log compacted from " << m_log_size << " to " << m_live_size << " bytes");
+    close(m_fd);
+    m_fd = -1;
+    if (open_log()) {
+        m_log_size = m_live_size;
+    }
+    m_unsynced = 0;
+    m_last_sync = std::chrono::steady_clock::now();
+}
+
+bool LogStore::get(const std::string& key, Entry& entry) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_entries.find(key);
+    if (m_entries.end() == it) {
+        return false;
+    }
+    entry = it->second;
+    return true;
+}
+
+bool LogStore::put(const std::string& key, const std::string& value) {
+    return put(key, value, true, time(nullptr));
+}
+
+bool LogStore::put(const std::string& key, const std::string& value, bool valid, std::time_t changed) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry entry{value, valid, changed};
+    if (!append(Operation::PUT, key, entry)) {
+        return false;
+    }
+    set_entry(key, std::move(entry));
+    sync_if_needed();
+    return true;
+}
+
+bool LogStore::remove(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_entries.find(key);
+    if ((m_entries.end() == it) || !append(Operation::REMOVE, key, Entry{"", false, 0})) {
+        return false;
+    }
+    erase_entry(it);
+    sync_if_needed();
+    return true;
+}
+
+bool LogStore::invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_entries.find(key);
+    if ((m_entries.end() == it) || !it->second.valid) {
+        return false;
+    }
+    Entry entry{it->second.value, false, time(nullptr)};
+    if (!append(Operation::PUT, key, entry)) {
+        return false;
+    }
+    it->second = std::move(entry);
+    sync_if_needed();
+    return true;
+}
+
+std::vector<std::string> LogStore::get_keys(const std::string& prefix) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<std::string> keys{};
+    for (auto it = m_entries.lower_bound(prefix);
+         (m_entries.end() != it) && (0 == it->first.compare(0, prefix.size(), prefix)); ++it) {
+        keys.push_back(it->first);
+    }
+    return keys;
+}
+
+void LogStore::sync() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sync_unlocked();
+}
+
+void LogStore::compact() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    compact_unlocked();
+}
+
+std::size_t LogStore::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+std::uint64_t LogStore::get_log_size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_log_size;
+}
+
+
+
+LogDatabase::LogDatabase(const std::string& _name, LogStore& _store) :
+    Database(_name),
+    store(_store) { }
+
+LogDatabase::~LogDatabase() { }
+
+bool LogDatabase::start() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    if (iterating_state != IteratingState::NOT_STARTED) {
+        log_error(GET_LOGGER("db"), "Iterating in progress");
+        assert (FAIL("In progress"));
+        return false;
+    }
+    iterating_state = IteratingState::STARTED;
+    return true;
+}
+
+bool LogDatabase::next(Serializable& key, Serializable& value) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    switch (iterating_state) {
+        case IteratingState::NOT_STARTED:
+            log_error(GET_LOGGER("db"), "Iterating not started");
+            assert (FAIL("Not iterating"));
+            return false;
+        case IteratingState::STARTED:
+            iterated_keys.clear();
+            foreach(key, [this](const std::string& key_name) -> bool {
+                iterated_keys.push_back(key_name);
+                return true;
+            });
+            current_key = iterated_keys.begin();
+            iterating_state = IteratingState::ITERATE;
+            break;
+        case IteratingState::ITERATE:
+            break;
+        default:
+            assert (FAIL("Unreachable code"));
+            return false;
+    }
+
+    const std::size_t prefix_len = get_name().empty() ? 0 : get_name().length() + 1;
+    while (iterated_keys.cend() != current_key) {
+        const std::string& key_name = *current_key;
+        current_key++;
+
+        /* entry might be removed in the meantime */
+        LogStore::Entry entry{};
+        if (!store.get(key_name, entry)) {
+            continue;
+        }
+        key.unserialize(key_name.substr(prefix_len));
+        if (!value.unserialize(entry.value)) {
+            log_error(GET_LOGGER("db"), "Incorrect data for " << key_name << ":: " << entry.value);
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+void LogDatabase::end() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    switch (iterating_state) {
+        case IteratingState::NOT_STARTED:
+            log_error(GET_LOGGER("db"), "Not iterating");
+            assert (FAIL("Not iterating"));
+            return;
+        case IteratingState::STARTED:
+            log_error(GET_LOGGER("db"), "Iterating started but not proceeded");
+            assert (FAIL("Not iterating"));
+            break;
+        case IteratingState::ITERATE:
+            break;
+        default:
+            assert (FAIL("Unreachable code"));
+            return;
+    }
+    iterated_keys.clear();
+    iterating_state = IteratingState::NOT_STARTED;
+}
+
+bool LogDatabase::get(const Serializable& key, Serializable& value) {
+    const auto key_name = full_key(key.serialize());
+    LogStore::Entry entry{};
+    if (key_name.empty() || !store.get(key_name, entry)) {
+        return false;
+    }
+    return value.unserialize(entry.value);
+}
+
+bool LogDatabase::put(const Serializable& key, const Serializable& value) {
+    const auto key_name = full_key(key.serialize());
+    const auto data = value.serialize();
+    if (key_name.empty()) {
+        log_error(GET_LOGGER("db"), "No key given");
+        return false;
+    }
+    if (data.empty()) {
+        log_error(GET_LOGGER("db"), "Writing empty data forbidden, key " << key_name);
+        return false;
+    }
+    return store.put(key_name, data);
+}
+
+bool LogDatabase::remove(const Serializable& key) {
+    const auto key_name = full_key(key.serialize());
+    return !key_name.empty() && store.remove(key_name);
+}
+
+bool LogDatabase::invalidate(const Serializable& key) {
+    const auto key_name = full_key(key.serialize());
+    return !key_name.empty() && store.invalidate(key_name);
+}
+
+Database::EntityValidity LogDatabase::get_validity(const Serializable& key, std::chrono::seconds interval) {
+    return validity(full_key(key.serialize()), interval);
+}
+
+unsigned LogDatabase::cleanup(Serializable& key, std::chrono::seconds interval) {
+    const auto ret = foreach(key, [this, interval](const std::string& key_name) -> bool {
+        switch (validity(key_name, interval)) {
+            case EntityValidity::ERROR:
+                return false;
+            case EntityValidity::VALID:
+                return store.invalidate(key_name);
+            case EntityValidity::INVALID:
+                return false;
+            case EntityValidity::OUTDATED:
+                return store.remove(key_name);
+            default:
+                assert (FAIL("Unreachable code"));
+                return false;
+        }
+    });
+    store.sync();
+    return ret;
+}
+
+unsigned LogDatabase::wipe_outdated(Serializable& key, std::chrono::seconds interval) {
+    const auto ret = foreach(key, [this, interval](const std::string& key_name) -> bool {
+        switch (validity(key_name, interval)) {
+            case EntityValidity::ERROR:
+            case EntityValidity::VALID:
+            case EntityValidity::INVALID:
+                return false;
+            case EntityValidity::OUTDATED:
+                return store.remove(key_name);
+            default:
+                assert (FAIL("Unreachable code"));
+                return false;
+        }
+    });
+    store.sync();
+    return ret;
+}
+
+unsigned LogDatabase::drop(Serializable& key) {
+    const auto ret = foreach(key, [this](const std::string& key_name) -> bool {
+        return store.remove(key_name);
+    });
+    store.sync();
+    return ret;
+}
+
+unsigned LogDatabase::foreach(Serializable& key, ForeachFunction function) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    const std::string prefix = get_name().empty() ? "" : get_name() + ".";
+    unsigned num = 0;
+    for (const auto& key_name : store.get_keys(prefix)) {
+        /* key without database name, it must match given key */
+        if (key_name.length() == prefix.length() || !key.unserialize(key_name.substr(prefix.length()))) {
+            continue;
+        }
+        if (function(key_name)) {
+            num++;
+        }
+    }
+    return num;
+}
+
+std::string LogDatabase::full_key(const std::string& stripped_name) const {
+    if (stripped_name.empty()) {
+        return stripped_name;
+    }
+    return get_name().empty() ? stripped_name : (get_name() + "." + stripped_name);
+}
+
+Database::EntityValidity LogDatabase::validity(const std::string& key_name, std::chrono::seconds interval) const {
+    LogStore::Entry entry{};
+    if (key_name.empty() || !store.get(key_name, entry)) {
+        log_error(GET_LOGGER("db"), "Cannot check validity of " << key_name);
+        return EntityValidity::ERROR;
+    }
+    /* still marked as valid */
+    if (entry.valid) {
+        return EntityValidity::VALID;
+    }
+    if (time(nullptr) - entry.changed >= interval.count()) {
+        return EntityValidity::OUTDATED;
+    }
+    return EntityValidity::INVALID;
+}
+
+
+} // @i{handler}
+} // @i{model}
+} // @i{rest}
+} // @i{psme}
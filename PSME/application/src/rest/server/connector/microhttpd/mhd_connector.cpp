@@ -70,6 +70,14 @@ int add_request_headers(void* cls, enum MHD_ValueKind /*kind*/,
     return MHD_YES;
 }
 
+int add_request_query(void* cls, enum MHD_ValueKind /*kind*/,
+        const char* key, const char* value) {
+    Request* request = static_cast<Request*>(cls);
+    request->query.set(key, (nullptr != value) ? value : "");
+
+    return MHD_YES;
+}
+
 Method get_request_method(const char* method) {
     try {
         return Method::from_string(method);
@@ -115,6 +123,8 @@ int access_handler_callback(void* cls, struct MHD_Connection *connection,
     }
     MHD_get_connection_values(connection, MHD_HEADER_KIND,
             &add_request_headers, request.get());
+    MHD_get_connection_values(connection, MHD_GET_ARGUMENT_KIND,
+            &add_request_query, request.get());
 
     Response response;
     connector->handle(*request, response);
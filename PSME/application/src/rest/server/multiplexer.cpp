@@ -41,9 +41,12 @@
 #include "psme/rest/server/status.hpp"
 #include "psme/rest/server/mux/matchers.hpp"
 #include "psme/rest/server/multiplexer.hpp"
+#include "psme/rest/server/query_options.hpp"
 #include "psme/rest/server/utils.hpp"
 #include "psme/rest/server/error/error_factory.hpp"
 
+#include "json/json.hpp"
+
 using namespace psme::rest::server;
 
 namespace {
@@ -153,7 +156,64 @@ void Multiplexer::forward_to_handler(Response& response, Request& request) {
     // Collect parameters from REST path segments
     collect_request_params(request, std::get<0>(candidate), request_segments);
 
+    if (Method::GET != request.get_method()) {
+        execute_handler(method_handler, request, response);
+        return;
+    }
+
+    const auto options = QueryOptions::from_request(request);
     execute_handler(method_handler, request, response);
+    if (!options.empty() && status_2XX::OK == response.get_status()) {
+        apply_query_options(options, request, response);
+    }
+}
+
+void Multiplexer::apply_query_options(const QueryOptions& options, const Request& request, Response& response) {
+    json::Deserializer deserializer(response.get_body());
+    if (deserializer.is_invalid()) {
+        return; // not a JSON resource (e.g. metadata document)
+    }
+    json::Value resource{};
+    deserializer >> resource;
+
+    options.apply(request.get_url(), resource, [this, &request](const std::string& url, json::Value& expanded) {
+        return get_resource(request, url, expanded);
+    });
+    response.set_body(json::Serializer(resource));
+}
+
+bool Multiplexer::get_resource(const Request& request, const std::string& url, json::Value& resource) {
+    Request resource_request{};
+    resource_request.set_method(Method::GET);
+    resource_request.set_destination(url);
+    resource_request.set_HTTP_version(request.get_HTTP_version());
+    resource_request.set_source(request.get_source());
+    resource_request.set_secure(request.is_secure());
+    Response resource_response{};
+
+    try {
+        auto request_segments = mux::split_path(url);
+        const auto& candidate = select_handler(request_segments, url);
+        if (!is_access_allowed(resource_response, resource_request, candidate)) {
+            return false;
+        }
+        collect_request_params(resource_request, std::get<0>(candidate), request_segments);
+        std::get<1>(candidate)->get(resource_request, resource_response);
+    }
+    catch (const std::exception& ex) {
+        log_warning(GET_LOGGER("rest"), "Resource " << url << " not expanded: " << ex.what());
+        return false;
+    }
+
+    if (status_2XX::OK != resource_response.get_status()) {
+        return false;
+    }
+    json::Deserializer deserializer(resource_response.get_body());
+    if (deserializer.is_invalid()) {
+        return false;
+    }
+    deserializer >> resource;
+    return true;
 }
 
 EndpointList Multiplexer::get_endpoint_list() {
@@ -0,0 +1,304 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#include "psme/rest/server/query_options.hpp"
+#include "psme/rest/server/request.hpp"
+#include "psme/rest/server/error/error_factory.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+#include "psme/rest/constants/constants.hpp"
+
+#include "json/json.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+using namespace psme::rest::server;
+using namespace psme::rest::constants;
+using namespace psme::rest::error;
+
+constexpr std::uint32_t QueryOptions::MAX_EXPAND_LEVELS;
+
+namespace {
+
+constexpr const char EXPAND[] = "$expand";
+constexpr const char SELECT[] = "$select";
+constexpr const char TOP[] = "$top";
+constexpr const char SKIP[] = "$skip";
+constexpr const char LEVELS[] = "($levels=";
+constexpr const char ODATA_ANNOTATION[] = "@odata.";
+
+/* Longer numbers don't fit in 64 bits */
+constexpr std::size_t MAX_NUMBER_DIGITS = 18;
+
+
+bool is_number(const std::string& value) {
+    return !value.empty() && value.size() <= MAX_NUMBER_DIGITS &&
+        std::all_of(value.cbegin(), value.cend(), [](char c) { return 0 != std::isdigit(c); });
+}
+
+
+std::uint64_t parse_number(const std::string& option, const std::string& value) {
+    if (!is_number(value)) {
+        throw ServerException(ErrorFactory::create_value_format_error(option, value,
+            "Query option " + option + " has to be a non-negative integer."));
+    }
+    return std::stoull(value);
+}
+
+
+std::string trim(const std::string& value) {
+    const auto begin = value.find_first_not_of(' ');
+    if (std::string::npos == begin) {
+        return {};
+    }
+    return value.substr(begin, value.find_last_not_of(' ') - begin + 1);
+}
+
+
+/*! @brief Percent-encode query option value */
+std::string encode(const std::string& value) {
+    static constexpr const char HEX[] = "0123456789ABCDEF";
+    std::string encoded{};
+    for (const char c : value) {
+        if (0 != std::isalnum(static_cast<unsigned char>(c)) || nullptr != std::strchr("-._~,/*$()=", c)) {
+            encoded += c;
+        }
+        else {
+            const auto byte = static_cast<unsigned char>(c);
+            encoded += '%';
+            encoded += HEX[byte >> 4];
+            encoded += HEX[byte & 0xf];
+        }
+    }
+    return encoded;
+}
+
+
+bool is_reference(const json::Value& value) {
+    return value.is_object() && 1 == value.size() && value.is_member(Common::ODATA_ID) &&
+        value[Common::ODATA_ID].is_string();
+}
+
+
+bool is_collection(const json::Value& resource) {
+    return resource.is_object() && resource.is_member(Collection::MEMBERS) &&
+        resource[Collection::MEMBERS].is_array();
+}
+
+
+/*! @brief Copy property given by path ("Name" or "Name/Nested/...") from source to target */
+void copy_property(const json::Value& source, json::Value& target, const std::string& path) {
+    const auto slash = path.find('/');
+    const auto name = path.substr(0, slash);
+    if (!source.is_object() || !source.is_member(name)) {
+        return;
+    }
+    if (std::string::npos == slash || !source[name].is_object()) {
+        target[name] = source[name];
+        return;
+    }
+    if (!target.is_member(name)) {
+        target[name] = json::Value::Type::OBJECT;
+    }
+    copy_property(source[name], target[name], path.substr(slash + 1));
+}
+
+
+void project(json::Value& resource, const std::vector<std::string>& properties) {
+    if (!resource.is_object() || is_reference(resource)) {
+        return;
+    }
+    json::Value projected(json::Value::Type::OBJECT);
+    for (auto it = resource.cbegin(); it != resource.cend(); ++it) {
+        const std::string name{it.key()};
+        if (0 == name.compare(0, sizeof(ODATA_ANNOTATION) - 1, ODATA_ANNOTATION)) {
+            projected[name] = *it;
+        }
+    }
+    for (const auto& property : properties) {
+        copy_property(resource, projected, property);
+    }
+    resource = std::move(projected);
+}
+
+}
+
+
+QueryOptions QueryOptions::from_request(const Request& request) {
+    QueryOptions options{};
+
+    const auto top = request.query.get(TOP);
+    if (!top.empty()) {
+        options.m_has_top = true;
+        options.m_top = parse_number(TOP, top);
+    }
+    const auto skip = request.query.get(SKIP);
+    if (!skip.empty()) {
+        options.m_skip = parse_number(SKIP, skip);
+    }
+
+    const auto expand = request.query.get(EXPAND);
+    if (!expand.empty()) {
+        switch (expand[0]) {
+            case '.':
+                options.m_expand = Expand::NOT_LINKS;
+                break;
+            case '~':
+                options.m_expand = Expand::LINKS;
+                break;
+            case '*':
+                options.m_expand = Expand::ALL;
+                break;
+            default:
+                throw ServerException(ErrorFactory::create_value_format_error(EXPAND, expand,
+                    "Supported $expand values are '.', '~' and '*', optionally followed by '($levels=n)'."));
+        }
+        if (expand.size() > 1) {
+            const auto levels = expand.substr(1);
+            const auto prefix_size = sizeof(LEVELS) - 1;
+            if (0 != levels.compare(0, prefix_size, LEVELS) || ')' != levels.back()
+                || !is_number(levels.substr(prefix_size, levels.size() - prefix_size - 1))) {
+                throw ServerException(ErrorFactory::create_value_format_error(EXPAND, expand,
+                    "Supported $expand values are '.', '~' and '*', optionally followed by '($levels=n)'."));
+            }
+            const auto value = std::stoull(levels.substr(prefix_size, levels.size() - prefix_size - 1));
+            if (0 == value || MAX_EXPAND_LEVELS < value) {
+                throw ServerException(ErrorFactory::create_value_format_error(EXPAND, expand,
+                    "Expand levels have to be between 1 and " + std::to_string(MAX_EXPAND_LEVELS) + "."));
+            }
+            options.m_expand_levels = static_cast<std::uint32_t>(value);
+        }
+        options.m_expand_value = expand;
+    }
+
+    const auto select = request.query.get(SELECT);
+    if (!select.empty()) {
+        std::string::size_type begin = 0;
+        while (begin <= select.size()) {
+            auto end = select.find(',', begin);
+            if (std::string::npos == end) {
+                end = select.size();
+            }
+            const auto property = trim(select.substr(begin, end - begin));
+            if (property.empty() || '/' == property.front() || '/' == property.back()) {
+                throw ServerException(ErrorFactory::create_value_format_error(SELECT, select,
+                    "$select has to be a comma separated list of properties."));
+            }
+            options.m_select.push_back(property);
+            begin = end + 1;
+        }
+        options.m_select_value = select;
+    }
+
+    return options;
+}
+
+
+bool QueryOptions::empty() const {
+    return Expand::NONE == m_expand && m_select.empty() && !m_has_top && 0 == m_skip;
+}
+
+
+void QueryOptions::apply(const std::string& url, json::Value& resource, const ResourceGetter& get_resource) const {
+    if (!resource.is_object()) {
+        return;
+    }
+    page(url, resource);
+    if (Expand::NONE != m_expand) {
+        expand(resource, m_expand_levels, false, get_resource);
+    }
+    if (!m_select.empty()) {
+        select(resource);
+    }
+}
+
+
+void QueryOptions::page(const std::string& url, json::Value& resource) const {
+    if ((!m_has_top && 0 == m_skip) || !is_collection(resource)) {
+        return;
+    }
+    const auto& members = resource[Collection::MEMBERS];
+    const std::uint64_t total = members.size();
+    const auto begin = std::min(m_skip, total);
+    const auto end = m_has_top ? std::min(begin + m_top, total) : total;
+
+    json::Value page(json::Value::Type::ARRAY);
+    for (auto index = begin; index < end; ++index) {
+        page.push_back(members[static_cast<std::size_t>(index)]);
+    }
+    resource[Collection::MEMBERS] = std::move(page);
+    if (end < total) {
+        resource[Collection::NEXT_LINK] = get_next_link(url, end);
+    }
+}
+
+
+void QueryOptions::expand(json::Value& value, std::uint32_t levels, bool in_links,
+                          const ResourceGetter& get_resource) const {
+    if (value.is_array()) {
+        for (auto& element : value) {
+            expand(element, levels, in_links, get_resource);
+        }
+    }
+    else if (is_reference(value)) {
+        const bool wanted = (Expand::ALL == m_expand) || (Expand::LINKS == m_expand && in_links)
+            || (Expand::NOT_LINKS == m_expand && !in_links);
+        json::Value resource{};
+        if (wanted && get_resource(value[Common::ODATA_ID].as_string(), resource) && resource.is_object()) {
+            if (levels > 1) {
+                expand(resource, levels - 1, false, get_resource);
+            }
+            value = std::move(resource);
+        }
+    }
+    else if (value.is_object()) {
+        for (auto it = value.begin(); it != value.end(); ++it) {
+            expand(*it, levels, in_links || (0 == std::strcmp(Common::LINKS, it.key())), get_resource);
+        }
+    }
+}
+
+
+void QueryOptions::select(json::Value& resource) const {
+    if (is_collection(resource)) {
+        for (auto& member : resource[Collection::MEMBERS]) {
+            project(member, m_select);
+        }
+    }
+    else {
+        project(resource, m_select);
+    }
+}
+
+
+std::string QueryOptions::get_next_link(const std::string& url, std::uint64_t skip) const {
+    std::string link{url + "?" + SKIP + "=" + std::to_string(skip)};
+    if (m_has_top) {
+        link += std::string{"&"} + TOP + "=" + std::to_string(m_top);
+    }
+    if (!m_expand_value.empty()) {
+        link += std::string{"&"} + EXPAND + "=" + encode(m_expand_value);
+    }
+    if (!m_select_value.empty()) {
+        link += std::string{"&"} + SELECT + "=" + encode(m_select_value);
+    }
+    return link;
+}
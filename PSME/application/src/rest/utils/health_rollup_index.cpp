@@ -0,0 +1,210 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#include "psme/rest/utils/health_rollup_index.hpp"
+
+#include <algorithm>
+
+
+
+using namespace psme::rest::utils;
+
+constexpr std::size_t HealthRollupIndex::HEALTH_COUNT;
+
+namespace {
+
+std::size_t to_index(HealthRollupIndex::Health health) {
+    return static_cast<std::size_t>(health);
+}
+
+
+HealthRollupIndex::Health from_index(std::size_t index) {
+    return static_cast<HealthRollupIndex::Health::Health_enum>(index);
+}
+
+
+bool same_health(const HealthRollupIndex::OptionalHealth& lhs, const HealthRollupIndex::OptionalHealth& rhs) {
+    if (lhs.has_value() && rhs.has_value()) {
+        return lhs.value() == rhs.value();
+    }
+    return lhs.has_value() == rhs.has_value();
+}
+
+}
+
+
+HealthRollupIndex& HealthRollupIndex::get_instance() {
+    static_assert(Health::OK == 0 && Health::Warning == 1 && Health::Critical == HEALTH_COUNT - 1,
+                  "Unexpected Health values ordering");
+    static HealthRollupIndex instance{};
+    return instance;
+}
+
+
+void HealthRollupIndex::set(Component component, const std::string& uuid, const std::string& parent_uuid,
+                            const OptionalHealth& health) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    auto& node = m_nodes[uuid];
+    if (node.in_model && node.component == component && node.parent == parent_uuid) {
+        if (same_health(node.health, health)) {
+            return;
+        }
+        // only own health of the node changes for its ancestors
+        Node own{};
+        own.component = component;
+        own.health = node.health;
+        propagate(parent_uuid, get_contribution(own), true);
+        own.health = health;
+        propagate(parent_uuid, get_contribution(own), false);
+        node.health = health;
+        return;
+    }
+
+    if (node.in_model) {
+        propagate(node.parent, get_contribution(node), true);
+    }
+    node.component = component;
+    node.parent = parent_uuid;
+    node.health = health;
+    node.in_model = true;
+    propagate(parent_uuid, get_contribution(node), false);
+}
+
+
+void HealthRollupIndex::remove(const std::string& uuid) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    auto it = m_nodes.find(uuid);
+    if (m_nodes.end() == it || !it->second.in_model) {
+        return;
+    }
+    auto& node = it->second;
+    propagate(node.parent, get_contribution(node), true);
+    node.in_model = false;
+    node.health = OptionalHealth{};
+    if (node.descendants.empty()) {
+        m_nodes.erase(it);
+    }
+}
+
+
+void HealthRollupIndex::clear() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_nodes.clear();
+}
+
+
+bool HealthRollupIndex::get(const std::string& uuid, Component filter, OptionalHealth& rollup) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+
+    const auto it = m_nodes.find(uuid);
+    if (m_nodes.end() == it || !it->second.in_model) {
+        return false;
+    }
+    const auto& node = it->second;
+
+    rollup = OptionalHealth{};
+    if (Component::None == filter || node.component == filter) {
+        rollup = node.health;
+        if (!rollup.has_value()) {
+            return true; // unknown own health, descendants don't matter
+        }
+    }
+
+    for (const auto& counts : node.descendants) {
+        if (Component::None != filter && counts.first != filter) {
+            continue;
+        }
+        for (std::size_t index = HEALTH_COUNT; index > 0; --index) {
+            if (0 != counts.second[index - 1]) {
+                if (!rollup.has_value() || to_index(rollup.value()) < index - 1) {
+                    rollup = OptionalHealth{from_index(index - 1)};
+                }
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+
+HealthRollupIndex::Counts HealthRollupIndex::get_contribution(const Node& node) {
+    Counts counts{node.descendants};
+    if (node.health.has_value()) {
+        auto found = counts.find(node.component);
+        if (counts.end() == found) {
+            found = counts.emplace(node.component, HealthCounts{}).first;
+        }
+        ++found->second[to_index(node.health.value())];
+    }
+    return counts;
+}
+
+
+void HealthRollupIndex::propagate(const std::string& parent_uuid, const Counts& counts, bool subtract) {
+    if (counts.empty()) {
+        return;
+    }
+    std::string uuid{parent_uuid};
+    // hops are limited in case an agent reports a cycle of parents
+    for (std::size_t hops = 0; !uuid.empty() && hops <= m_nodes.size(); ++hops) {
+        auto it = m_nodes.find(uuid);
+        if (m_nodes.end() == it) {
+            if (subtract) {
+                return;
+            }
+            // parent is not added yet, it takes the counts when it is
+            it = m_nodes.emplace(uuid, Node{}).first;
+        }
+        auto& node = it->second;
+
+        for (const auto& component_counts : counts) {
+            auto found = node.descendants.find(component_counts.first);
+            if (node.descendants.end() == found) {
+                if (subtract) {
+                    continue;
+                }
+                found = node.descendants.emplace(component_counts.first, HealthCounts{}).first;
+            }
+            auto& target = found->second;
+            for (std::size_t index = 0; index < HEALTH_COUNT; ++index) {
+                if (subtract) {
+                    target[index] -= std::min(target[index], component_counts.second[index]);
+                }
+                else {
+                    target[index] += component_counts.second[index];
+                }
+            }
+            if (subtract && std::all_of(target.cbegin(), target.cend(), [](std::uint64_t count) { return 0 == count; })) {
+                node.descendants.erase(found);
+            }
+        }
+
+        if (!node.in_model) {
+            // counts of the node are passed to its ancestors when it is added
+            if (node.descendants.empty()) {
+                m_nodes.erase(it);
+            }
+            return;
+        }
+        uuid = node.parent;
+    }
+}
@@ -0,0 +1,170 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file component_url_benchmark.cpp
+ *
+ * @brief Benchmark of the component URL memoization.
+ *
+ * A fabric switch with a configurable number of ports is added to the model.
+ * Links to all ports are filled in as GET of a resource linking the ports does,
+ * once with the URL memo cleared before each request (each URL is built by
+ * walking the parents) and once with memoized URLs.
+ *
+ * Usage: psme-component-url-benchmark [--ports=N] [--requests=N]
+ * */
+
+#include "psme/rest/endpoints/utils.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "agent-framework/module/model/model_pnc.hpp"
+#include "json/json.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace psme::rest;
+using namespace agent_framework::module;
+using namespace agent_framework::model;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string FABRIC_UUID = "fabric";
+const std::string SWITCH_UUID = "switch";
+
+struct Options {
+    unsigned ports{1000};
+    unsigned requests{20};
+};
+
+std::string port_uuid(unsigned i) {
+    return "port-" + std::to_string(i);
+}
+
+void populate_model(const Options& options) {
+    Fabric fabric{};
+    fabric.set_uuid(FABRIC_UUID);
+    fabric.set_id(1);
+    get_manager<Fabric>().add_entry(fabric);
+
+    Switch fabric_switch{FABRIC_UUID};
+    fabric_switch.set_uuid(SWITCH_UUID);
+    fabric_switch.set_id(2);
+    get_manager<Switch>().add_entry(fabric_switch);
+
+    for (unsigned i = 0; i < options.ports; ++i) {
+        Port port{SWITCH_UUID};
+        port.set_uuid(port_uuid(i));
+        port.set_id(i + 10);
+        get_manager<Port>().add_entry(port);
+    }
+}
+
+/*! Fill links to all ports, as GET of a resource linking the ports does */
+json::Value get_port_links(const Options& options) {
+    json::Value json{};
+    for (unsigned i = 0; i < options.ports; ++i) {
+        json::Value port_link{};
+        port_link[constants::Common::ODATA_ID] = endpoint::PathBuilder(
+            endpoint::utils::get_component_url(enums::Component::Port, port_uuid(i))).build();
+        json[constants::Common::LINKS][constants::Switch::PORTS].push_back(std::move(port_link));
+    }
+    return json;
+}
+
+/*! Average time of the request, the prepare function is called before each one */
+template <typename P>
+double measure_ms(const Options& options, P prepare) {
+    Clock::duration elapsed{};
+    for (unsigned i = 0; i < options.requests; ++i) {
+        prepare();
+        const auto start = Clock::now();
+        const auto links = get_port_links(options);
+        elapsed += Clock::now() - start;
+        if (options.ports != links[constants::Common::LINKS][constants::Switch::PORTS].size()) {
+            throw std::runtime_error("Links to some ports are missing");
+        }
+    }
+    return std::chrono::duration<double, std::milli>(elapsed).count() / options.requests;
+}
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--ports" == name) {
+            options.ports = value;
+        }
+        else if ("--requests" == name) {
+            options.requests = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.ports || 0 == options.requests) {
+        throw std::invalid_argument("Invalid number of ports or requests");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--ports=1000] [--requests=20]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        populate_model(options);
+
+        const auto walking_ms = measure_ms(options, []() { endpoint::utils::clear_component_urls(); });
+        const auto memoized_ms = measure_ms(options, []() {});
+
+        std::cout << "Links to " << options.ports << " ports" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Walking parents:  " << std::setw(10) << walking_ms << " ms" << std::endl;
+        std::cout << "Memoized:         " << std::setw(10) << memoized_ms << " ms" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
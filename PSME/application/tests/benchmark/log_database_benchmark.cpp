@@ -0,0 +1,193 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file log_database_benchmark.cpp
+ *
+ * @brief Benchmark of the REST ids database startup.
+ *
+ * The same entries are stored in the file database and in the log database.
+ * Startup of each database (opening it and iterating over all entries, as
+ * the REST server does when the ids are restored) is timed.
+ *
+ * Usage: psme-log-database-benchmark [--entries=N]
+ * */
+
+#include "psme/rest/model/handlers/log_database.hpp"
+#include "psme/rest/model/handlers/file_database.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace psme::rest::model::handler;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    unsigned entries{50000};
+};
+
+/*! Any string as a key/value */
+class StringValue final : public Serializable {
+public:
+    StringValue() { }
+    StringValue(const std::string& str) : data(str) { }
+
+private:
+    std::string data{};
+
+    std::string serialize() const override { return data; }
+
+    bool unserialize(const std::string& str) override {
+        data = str;
+        return true;
+    }
+};
+
+std::string make_uuid(unsigned i) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "parent-%04u.%08x-0000-4000-8000-%012x", i % 100, i, i * 7u);
+    return std::string(buffer);
+}
+
+void fill(Database& db, const Options& options) {
+    for (unsigned i = 0; i < options.entries; ++i) {
+        if (!db.put(StringValue{make_uuid(i)}, StringValue{std::to_string(i + 1)})) {
+            throw std::runtime_error("Cannot store entry " + std::to_string(i));
+        }
+    }
+}
+
+/*! Iterate over all entries of the database, as restoring ids does */
+void iterate(Database& db, const Options& options) {
+    StringValue key{};
+    StringValue value{};
+    unsigned count = 0;
+    db.start();
+    while (db.next(key, value)) {
+        count++;
+    }
+    db.end();
+    if (options.entries != count) {
+        throw std::runtime_error("Only " + std::to_string(count) + " entries found");
+    }
+}
+
+double elapsed_ms(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--entries" == name) {
+            options.entries = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.entries) {
+        throw std::invalid_argument("Invalid number of entries");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--entries=50000]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char dir_name[] = "/tmp/psme-log-database-benchmark-XXXXXX";
+    if (nullptr == mkdtemp(dir_name)) {
+        std::cerr << "Cannot create directory " << dir_name << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string file_name = std::string(dir_name) + "/benchmark.log";
+
+    int result = EXIT_SUCCESS;
+    try {
+        double file_ms{};
+        {
+            FileDatabase db{"logbench"};
+            fill(db, options);
+
+            const auto start = Clock::now();
+            FileDatabase reopened{"logbench"};
+            iterate(reopened, options);
+            file_ms = elapsed_ms(start);
+
+            StringValue any{};
+            reopened.drop(any);
+        }
+
+        double log_ms{};
+        {
+            {
+                LogStore store{file_name};
+                LogDatabase db{"logbench", store};
+                fill(db, options);
+            }
+
+            const auto start = Clock::now();
+            LogStore store{file_name};
+            LogDatabase db{"logbench", store};
+            iterate(db, options);
+            log_ms = elapsed_ms(start);
+        }
+
+        std::cout << "Startup with " << options.entries << " entries" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "File database:  " << std::setw(10) << file_ms << " ms" << std::endl;
+        std::cout << "Log database:   " << std::setw(10) << log_ms << " ms" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        result = EXIT_FAILURE;
+    }
+
+    ::remove(file_name.c_str());
+    ::remove(dir_name);
+    return result;
+}
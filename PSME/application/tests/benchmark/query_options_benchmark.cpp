@@ -0,0 +1,235 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file query_options_benchmark.cpp
+ *
+ * @brief Benchmark of the $expand query option.
+ *
+ * Handlers of a computer system collection and its members are registered in
+ * a multiplexer. A client scan of all systems is timed, once as a read of the
+ * collection followed by a read of each member and once as a single read of the
+ * collection with $expand. Requests are forwarded to the handlers directly,
+ * without HTTP round trips.
+ *
+ * Usage: psme-query-options-benchmark [--systems=N] [--scans=N]
+ * */
+
+#include "psme/rest/server/multiplexer.hpp"
+#include "json/json.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace psme::rest::server;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string SYSTEMS_URL = "/redfish/v1/Systems";
+
+struct Options {
+    unsigned systems{256};
+    unsigned scans{5};
+};
+
+class BenchmarkHandler : public MethodsHandler {
+public:
+    explicit BenchmarkHandler(const std::string& path) : MethodsHandler(path) {}
+
+    void del(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void post(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void patch(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void put(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+};
+
+
+class SystemCollection : public BenchmarkHandler {
+public:
+    explicit SystemCollection(unsigned systems) : BenchmarkHandler(SYSTEMS_URL), m_systems(systems) {}
+
+    void get(const Request&, Response& response) override {
+        json::Value json{};
+        json["@odata.id"] = SYSTEMS_URL;
+        json["Name"] = "Computer System Collection";
+        json["Members@odata.count"] = m_systems;
+        json["Members"] = json::Value::Type::ARRAY;
+        for (unsigned id = 1; id <= m_systems; ++id) {
+            json::Value link{};
+            link["@odata.id"] = SYSTEMS_URL + "/" + std::to_string(id);
+            json["Members"].push_back(std::move(link));
+        }
+        response << json::Serializer(json);
+    }
+
+private:
+    unsigned m_systems;
+};
+
+
+class System : public BenchmarkHandler {
+public:
+    System() : BenchmarkHandler(SYSTEMS_URL + "/{systemId:[0-9]+}") {}
+
+    void get(const Request& request, Response& response) override {
+        json::Value json{};
+        json["@odata.id"] = request.get_url();
+        json["@odata.type"] = "#ComputerSystem.v1_1_0.ComputerSystem";
+        json["Id"] = request.params["systemId"];
+        json["Name"] = "Computer System";
+        json["Manufacturer"] = "Intel Corporation";
+        json["SerialNumber"] = "SN" + request.params["systemId"];
+        json["Status"]["State"] = "Enabled";
+        json["Status"]["Health"] = "OK";
+        json["ProcessorSummary"]["Count"] = 2;
+        json["ProcessorSummary"]["Model"] = "Intel(R) Xeon(R) CPU E5-2699 v4";
+        json["MemorySummary"]["TotalSystemMemoryGiB"] = 256;
+        json["Processors"]["@odata.id"] = request.get_url() + "/Processors";
+        response << json::Serializer(json);
+    }
+};
+
+
+json::Value get(Multiplexer& mux, const std::string& url, const Parameters& query = {}) {
+    Request request{};
+    request.set_method(Method::GET);
+    request.set_destination(url);
+    request.query = query;
+    Response response{};
+    mux.forward_to_handler(response, request);
+    if (status_2XX::OK != response.get_status()) {
+        throw std::runtime_error("GET " + url + " failed with status " + std::to_string(response.get_status()));
+    }
+
+    json::Deserializer deserializer(response.get_body());
+    if (deserializer.is_invalid()) {
+        throw std::runtime_error("GET " + url + " returned invalid JSON");
+    }
+    json::Value json{};
+    deserializer >> json;
+    return json;
+}
+
+void check_health(const json::Value& system) {
+    if ("OK" != system["Status"]["Health"].as_string()) {
+        throw std::runtime_error("System " + system["@odata.id"].as_string() + " not read");
+    }
+}
+
+/*! Average time of the scan of all systems */
+template <typename F>
+double measure_ms(const Options& options, F scan) {
+    const auto start = Clock::now();
+    for (unsigned i = 0; i < options.scans; ++i) {
+        scan();
+    }
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / options.scans;
+}
+
+Options parse_options(int argc, const char* argv[]) {
+    Options options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--systems" == name) {
+            options.systems = value;
+        }
+        else if ("--scans" == name) {
+            options.scans = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.systems || 0 == options.scans) {
+        throw std::invalid_argument("Invalid number of systems or scans");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--systems=256] [--scans=5]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        Multiplexer mux{};
+        mux.register_handler(MethodsHandler::UPtr(new SystemCollection(options.systems)), AccessType::ALL);
+        mux.register_handler(MethodsHandler::UPtr(new System()), AccessType::ALL);
+
+        // client reads the collection and then each member
+        const auto separate_ms = measure_ms(options, [&mux]() {
+            const auto collection = get(mux, SYSTEMS_URL);
+            for (const auto& member : collection["Members"]) {
+                check_health(get(mux, member["@odata.id"].as_string()));
+            }
+        });
+
+        Parameters expand{};
+        expand.set("$expand", ".");
+        const auto expanded_ms = measure_ms(options, [&mux, &expand]() {
+            const auto collection = get(mux, SYSTEMS_URL, expand);
+            for (const auto& member : collection["Members"]) {
+                check_health(member);
+            }
+        });
+
+        std::cout << "Scan of " << options.systems << " systems, without HTTP round trips" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "Separate requests:  " << std::setw(10) << separate_ms << " ms" << std::endl;
+        std::cout << "Single $expand:     " << std::setw(10) << expanded_ms << " ms" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
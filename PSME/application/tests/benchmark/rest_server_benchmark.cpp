@@ -0,0 +1,575 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file rest_server_benchmark.cpp
+ *
+ * @brief Load generator and latency benchmark of the REST server.
+ *
+ * The REST server is started in-process on the loopback interface with a synthetic
+ * model (managers, chassis, systems, processors and memory). Client threads keep
+ * HTTP/1.1 connections open and send a configurable mix of GET, PATCH and POST
+ * requests. Throughput and latency percentiles are reported per route class.
+ *
+ * Usage: psme-rest-server-benchmark [--option=value ...], see print_usage().
+ * */
+
+#include "psme/rest/rest_server.hpp"
+#include "psme/rest/eventing/config/subscription_config.hpp"
+#include "psme/rest/registries/config/registry_configurator.hpp"
+#include "psme/rest/registries/config/base_configuration.hpp"
+#include "default_configuration.hpp"
+#include "configuration/configuration.hpp"
+#include "agent-framework/logger_ext.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/module/compute_components.hpp"
+#include "json/json.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace agent_framework::model;
+using namespace agent_framework::module;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*! @brief Route classes reported separately */
+enum RouteClass : std::size_t {
+    GET_COLLECTION,
+    GET_RESOURCE,
+    GET_EXPANDED,
+    PATCH_RESOURCE,
+    POST_COLLECTION,
+    DELETE_RESOURCE,
+    ROUTE_CLASS_COUNT
+};
+
+constexpr const char* ROUTE_CLASS_NAMES[ROUTE_CLASS_COUNT] = {
+    "GET collection",
+    "GET resource",
+    "GET $expand",
+    "PATCH resource",
+    "POST collection",
+    "DELETE resource"
+};
+
+constexpr const char SYSTEMS_URL[] = "/redfish/v1/Systems";
+constexpr const char SUBSCRIPTIONS_URL[] = "/redfish/v1/EventService/Subscriptions";
+
+
+struct Options {
+    std::uint16_t port{18888};
+    unsigned connections{32};
+    unsigned server_threads{4};
+    unsigned duration_s{10};
+    unsigned systems{64};
+    /*! Weights of GET, PATCH and POST requests, each POST is followed by DELETE */
+    unsigned get_weight{90};
+    unsigned patch_weight{5};
+    unsigned post_weight{5};
+    std::string patch_body{"{}"};
+};
+
+
+void print_usage(const char* name) {
+    const Options defaults{};
+    std::cout << "Usage: " << name << " [--option=value ...]\n"
+        << "  --port=N         loopback port of the REST server (" << defaults.port << ")\n"
+        << "  --connections=N  concurrent client connections (" << defaults.connections << ")\n"
+        << "  --threads=N      REST server thread pool size (" << defaults.server_threads << ")\n"
+        << "  --duration=N     seconds of load (" << defaults.duration_s << ")\n"
+        << "  --systems=N      computer systems in the model (" << defaults.systems << ")\n"
+        << "  --mix=G,P,C      weights of GET, PATCH and POST requests (" << defaults.get_weight << ","
+        << defaults.patch_weight << "," << defaults.post_weight << ")\n"
+        << "  --patch-body=S   JSON body of PATCH requests (" << defaults.patch_body << ")" << std::endl;
+}
+
+
+unsigned to_unsigned(const std::string& option, const std::string& value) {
+    if (value.empty() || std::string::npos != value.find_first_not_of("0123456789") || value.size() > 9) {
+        throw std::invalid_argument("Invalid value of " + option + ": " + value);
+    }
+    return static_cast<unsigned>(std::stoul(value));
+}
+
+
+Options parse_options(int argc, const char** argv) {
+    Options options{};
+    for (int index = 1; index < argc; ++index) {
+        const std::string argument{argv[index]};
+        const auto equals = argument.find('=');
+        const auto option = argument.substr(0, equals);
+        const auto value = (std::string::npos == equals) ? std::string{} : argument.substr(equals + 1);
+
+        if ("--port" == option) {
+            const auto port = to_unsigned(option, value);
+            if (0 == port || port > 65535) {
+                throw std::invalid_argument("Invalid port: " + value);
+            }
+            options.port = static_cast<std::uint16_t>(port);
+        }
+        else if ("--connections" == option) {
+            options.connections = std::max(1u, to_unsigned(option, value));
+        }
+        else if ("--threads" == option) {
+            options.server_threads = std::max(1u, to_unsigned(option, value));
+        }
+        else if ("--duration" == option) {
+            options.duration_s = std::max(1u, to_unsigned(option, value));
+        }
+        else if ("--systems" == option) {
+            options.systems = std::max(1u, to_unsigned(option, value));
+        }
+        else if ("--mix" == option) {
+            const auto first = value.find(',');
+            const auto second = value.find(',', first + 1);
+            if (std::string::npos == first || std::string::npos == second) {
+                throw std::invalid_argument("Invalid mix: " + value);
+            }
+            options.get_weight = to_unsigned(option, value.substr(0, first));
+            options.patch_weight = to_unsigned(option, value.substr(first + 1, second - first - 1));
+            options.post_weight = to_unsigned(option, value.substr(second + 1));
+            if (0 == options.get_weight + options.patch_weight + options.post_weight) {
+                throw std::invalid_argument("At least one weight of the mix has to be positive.");
+            }
+        }
+        else if ("--patch-body" == option) {
+            options.patch_body = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + argument);
+        }
+    }
+    return options;
+}
+
+
+/*! @brief Load default configuration with a single HTTP connector and scratch files */
+void configure(const Options& options) {
+    json::Value config{};
+    json::Deserializer deserializer{psme::app::DEFAULT_CONFIGURATION};
+    deserializer >> config;
+
+    json::Value connector{};
+    connector["use-ssl"] = false;
+    connector["port"] = static_cast<unsigned>(options.port);
+    connector["thread-mode"] = "select";
+    connector["thread-pool-size"] = options.server_threads;
+    config["server"]["connectors"] = json::Value::Type::ARRAY;
+    config["server"]["connectors"].push_back(std::move(connector));
+    config["subscription-config-file"] = "/tmp/psme-rest-server-benchmark-subscriptions";
+    config["service-uuid-file"] = "/tmp/psme-rest-server-benchmark-service-uuid.json";
+
+    std::string serialized{};
+    serialized << json::Serializer(config);
+    auto& basic_config = configuration::Configuration::get_instance();
+    basic_config.set_default_configuration(serialized);
+
+    logger_cpp::LoggerLoader loader(basic_config.to_json());
+    logger_cpp::LoggerFactory::instance().set_loggers(loader.load());
+    logger_cpp::LoggerFactory::set_main_logger_name("app");
+
+    psme::rest::eventing::config::SubscriptionConfig::get_instance()->set_config_file(
+        config["subscription-config-file"].as_string());
+    psme::rest::registries::RegistryConfigurator::get_instance()->load(
+        psme::rest::registries::make_base_configuration());
+}
+
+
+/*! @brief Populate the model as the handlers would do for a compute agent */
+void populate_model(const Options& options) {
+    auto common = CommonComponents::get_instance();
+    auto compute = ComputeComponents::get_instance();
+
+    Manager manager{};
+    manager.set_id(1);
+    manager.set_status({enums::State::Enabled, enums::Health::OK});
+    const auto manager_uuid = manager.get_uuid();
+    common->get_module_manager().add_entry(manager);
+
+    Chassis chassis{manager_uuid, enums::Component::Manager};
+    chassis.set_id(1);
+    chassis.set_status({enums::State::Enabled, enums::Health::OK});
+    const auto chassis_uuid = chassis.get_uuid();
+    common->get_chassis_manager().add_entry(chassis);
+
+    for (unsigned id = 1; id <= options.systems; ++id) {
+        System system{manager_uuid, enums::Component::Manager};
+        system.set_id(id);
+        system.set_status({enums::State::Enabled, enums::Health::OK});
+        system.set_chassis(chassis_uuid);
+        const auto system_uuid = system.get_uuid();
+        common->get_system_manager().add_entry(system);
+
+        for (unsigned socket_id = 1; socket_id <= 2; ++socket_id) {
+            Processor processor{system_uuid};
+            processor.set_id(socket_id);
+            processor.set_status({enums::State::Enabled, enums::Health::OK});
+            processor.set_manufacturer(std::string{"Intel Corporation"});
+            processor.set_model_name(std::string{"Intel(R) Xeon(R) CPU E5-2699 v4"});
+            processor.set_max_speed_mhz(3600);
+            processor.set_total_threads(44);
+            compute->get_processor_manager().add_entry(processor);
+        }
+        for (unsigned slot = 1; slot <= 8; ++slot) {
+            Memory memory{system_uuid};
+            memory.set_id(slot);
+            memory.set_status({enums::State::Enabled, enums::Health::OK});
+            memory.set_capacity_mb(32768);
+            compute->get_memory_manager().add_entry(memory);
+        }
+    }
+}
+
+
+/*! @brief Parsed HTTP response */
+struct HttpResponse {
+    unsigned status{0};
+    std::string location{};
+    std::string body{};
+};
+
+
+/*! @brief Client keeping a persistent HTTP/1.1 connection to the loopback port */
+class HttpConnection final {
+public:
+    explicit HttpConnection(std::uint16_t port) : m_port{port} {}
+
+    ~HttpConnection() {
+        disconnect();
+    }
+
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+
+    /*!
+     * @brief Send request and read its response
+     * @return false on transport errors
+     */
+    bool send(const char* method, const std::string& url, const std::string& body, HttpResponse& response) {
+        std::string request{};
+        request.append(method).append(" ").append(url).append(" HTTP/1.1\r\nHost: localhost\r\n");
+        if (!body.empty()) {
+            request.append("Content-Type: application/json\r\nContent-Length: ")
+                .append(std::to_string(body.size())).append("\r\n");
+        }
+        request.append("\r\n").append(body);
+
+        // server may close idle connection, the request is retried once on a new one
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            if (m_socket < 0 && !connect()) {
+                return false;
+            }
+            if (write_all(request) && read_response(response)) {
+                return true;
+            }
+            disconnect();
+        }
+        return false;
+    }
+
+private:
+    bool connect() {
+        m_socket = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (m_socket < 0) {
+            return false;
+        }
+        const int enable = 1;
+        ::setsockopt(m_socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(m_port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (0 != ::connect(m_socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address))) {
+            disconnect();
+            return false;
+        }
+        m_buffer.clear();
+        return true;
+    }
+
+    void disconnect() {
+        if (m_socket >= 0) {
+            ::close(m_socket);
+            m_socket = -1;
+        }
+    }
+
+    bool write_all(const std::string& data) {
+        std::size_t sent = 0;
+        while (sent < data.size()) {
+            const auto result = ::send(m_socket, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return false;
+            }
+            sent += static_cast<std::size_t>(result);
+        }
+        return true;
+    }
+
+    bool fill() {
+        char chunk[16384];
+        const auto result = ::recv(m_socket, chunk, sizeof(chunk), 0);
+        if (result <= 0) {
+            return false;
+        }
+        m_buffer.append(chunk, static_cast<std::size_t>(result));
+        return true;
+    }
+
+    static std::string get_header(const std::string& headers, const char* name) {
+        const auto length = std::strlen(name);
+        std::size_t line = headers.find("\r\n");
+        while (std::string::npos != line && line + 2 < headers.size()) {
+            const auto begin = line + 2;
+            if (0 == strncasecmp(headers.c_str() + begin, name, length) && ':' == headers[begin + length]) {
+                const auto value = headers.find_first_not_of(' ', begin + length + 1);
+                return headers.substr(value, headers.find("\r\n", begin) - value);
+            }
+            line = headers.find("\r\n", begin);
+        }
+        return {};
+    }
+
+    bool read_response(HttpResponse& response) {
+        std::size_t end_of_headers{};
+        while (std::string::npos == (end_of_headers = m_buffer.find("\r\n\r\n"))) {
+            if (!fill()) {
+                return false;
+            }
+        }
+        const auto headers = m_buffer.substr(0, end_of_headers);
+        if (0 != headers.compare(0, 5, "HTTP/") || headers.size() < 12) {
+            return false;
+        }
+        response.status = static_cast<unsigned>(std::atoi(headers.c_str() + headers.find(' ') + 1));
+        response.location = get_header(headers, "Location");
+
+        const auto content_length = get_header(headers, "Content-Length");
+        const std::size_t body_size = content_length.empty() ? 0 : std::stoul(content_length);
+        const auto body_begin = end_of_headers + 4;
+        while (m_buffer.size() < body_begin + body_size) {
+            if (!fill()) {
+                return false;
+            }
+        }
+        response.body = m_buffer.substr(body_begin, body_size);
+        m_buffer.erase(0, body_begin + body_size);
+
+        if ("close" == get_header(headers, "Connection")) {
+            disconnect();
+        }
+        return true;
+    }
+
+    std::uint16_t m_port;
+    int m_socket{-1};
+    std::string m_buffer{};
+};
+
+
+/*! @brief Latencies (in microseconds) and errors of a route class */
+struct RouteStatistics {
+    std::vector<std::uint32_t> latencies_us{};
+    std::uint64_t errors{0};
+
+    void add(Clock::time_point start, bool ok) {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+        latencies_us.push_back(static_cast<std::uint32_t>(elapsed));
+        if (!ok) {
+            ++errors;
+        }
+    }
+};
+
+using Statistics = std::array<RouteStatistics, ROUTE_CLASS_COUNT>;
+
+
+/*! @brief Single client connection sending requests until stopped */
+void run_client(const Options& options, unsigned seed, const std::atomic<bool>& running, Statistics& statistics) {
+    const std::string subscription_body{
+        R"({"Name":"Benchmark","Destination":"http://127.0.0.1:65000/events","EventTypes":["Alert"],)"
+        R"("Context":"benchmark","Protocol":"Redfish"})"};
+    const auto total_weight = options.get_weight + options.patch_weight + options.post_weight;
+    std::mt19937 random{seed};
+    std::uniform_int_distribution<unsigned> pick_weight{0, total_weight - 1};
+    std::uniform_int_distribution<unsigned> pick_system{1, options.systems};
+    std::uniform_int_distribution<unsigned> pick_get{0, 15};
+
+    HttpConnection connection{options.port};
+    HttpResponse response{};
+
+    while (running.load(std::memory_order_relaxed)) {
+        const auto weight = pick_weight(random);
+        const std::string system_url = std::string{SYSTEMS_URL} + "/" + std::to_string(pick_system(random));
+        const auto start = Clock::now();
+
+        if (weight < options.get_weight) {
+            // mostly single resources, as the GUI and orchestration software do
+            const auto kind = pick_get(random);
+            if (0 == kind) {
+                const bool sent = connection.send("GET", SYSTEMS_URL, {}, response);
+                statistics[GET_COLLECTION].add(start, sent && 200 == response.status);
+            }
+            else if (1 == kind) {
+                const bool sent = connection.send("GET", system_url + "/Processors?$expand=.", {}, response);
+                statistics[GET_EXPANDED].add(start, sent && 200 == response.status);
+            }
+            else {
+                const auto url = (kind < 8) ? system_url : system_url + "/Memory/" + std::to_string(kind - 7);
+                const bool sent = connection.send("GET", url, {}, response);
+                statistics[GET_RESOURCE].add(start, sent && 200 == response.status);
+            }
+        }
+        else if (weight < options.get_weight + options.patch_weight) {
+            const bool sent = connection.send("PATCH", system_url, options.patch_body, response);
+            statistics[PATCH_RESOURCE].add(start, sent && response.status < 300);
+        }
+        else {
+            const bool sent = connection.send("POST", SUBSCRIPTIONS_URL, subscription_body, response);
+            statistics[POST_COLLECTION].add(start, sent && 201 == response.status);
+            if (sent && !response.location.empty()) {
+                // Location is an absolute URL, only its path is requested
+                const auto path = response.location.find(SUBSCRIPTIONS_URL);
+                if (std::string::npos != path) {
+                    const auto delete_start = Clock::now();
+                    const bool deleted = connection.send("DELETE", response.location.substr(path), {}, response);
+                    statistics[DELETE_RESOURCE].add(delete_start, deleted && response.status < 300);
+                }
+            }
+        }
+    }
+}
+
+
+std::uint32_t percentile(const std::vector<std::uint32_t>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const auto rank = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+
+void report(const Options& options, const std::vector<Statistics>& clients, double seconds) {
+    std::cout << "Connections: " << options.connections << ", server threads: " << options.server_threads
+              << ", systems: " << options.systems << ", mix GET/PATCH/POST: " << options.get_weight << "/"
+              << options.patch_weight << "/" << options.post_weight << ", " << seconds << " s\n\n";
+    std::cout << std::left << std::setw(18) << "route class" << std::right
+              << std::setw(10) << "requests" << std::setw(9) << "errors" << std::setw(11) << "req/s"
+              << std::setw(10) << "p50 us" << std::setw(10) << "p99 us" << std::setw(10) << "p999 us"
+              << std::setw(10) << "max us" << "\n";
+
+    std::vector<std::uint32_t> all{};
+    std::uint64_t all_errors{0};
+    const auto print_row = [seconds](const char* name, std::vector<std::uint32_t>& latencies, std::uint64_t errors) {
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << std::left << std::setw(18) << name << std::right
+                  << std::setw(10) << latencies.size() << std::setw(9) << errors
+                  << std::setw(11) << std::fixed << std::setprecision(1)
+                  << static_cast<double>(latencies.size()) / seconds
+                  << std::setw(10) << percentile(latencies, 0.5) << std::setw(10) << percentile(latencies, 0.99)
+                  << std::setw(10) << percentile(latencies, 0.999)
+                  << std::setw(10) << (latencies.empty() ? 0 : latencies.back()) << "\n";
+    };
+
+    for (std::size_t route = 0; route < ROUTE_CLASS_COUNT; ++route) {
+        std::vector<std::uint32_t> latencies{};
+        std::uint64_t errors{0};
+        for (const auto& client : clients) {
+            latencies.insert(latencies.end(), client[route].latencies_us.cbegin(), client[route].latencies_us.cend());
+            errors += client[route].errors;
+        }
+        if (latencies.empty()) {
+            continue;
+        }
+        all.insert(all.end(), latencies.cbegin(), latencies.cend());
+        all_errors += errors;
+        print_row(ROUTE_CLASS_NAMES[route], latencies, errors);
+    }
+    print_row("total", all, all_errors);
+    std::cout << std::flush;
+}
+
+}
+
+
+int main(int argc, const char* argv[]) {
+    Options options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        configure(options);
+        populate_model(options);
+
+        psme::rest::server::RestServer server{};
+        server.start();
+
+        std::atomic<bool> running{true};
+        std::vector<Statistics> statistics(options.connections);
+        std::vector<std::thread> clients{};
+        const auto start = Clock::now();
+        for (unsigned client = 0; client < options.connections; ++client) {
+            clients.emplace_back(run_client, std::cref(options), client + 1, std::cref(running),
+                                 std::ref(statistics[client]));
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(options.duration_s));
+        running = false;
+        for (auto& client : clients) {
+            client.join();
+        }
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+        server.stop();
+
+        report(options, statistics, elapsed.count());
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,137 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#include "psme/rest/endpoints/utils.hpp"
+#include "psme/rest/constants/constants.hpp"
+#include "agent-framework/module/model/model_pnc.hpp"
+#include "json/json.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace psme::rest;
+using namespace agent_framework::module;
+using namespace agent_framework::model;
+
+namespace {
+
+constexpr unsigned PORTS = 1000;
+
+const std::string FABRIC_UUID = "fabric";
+const std::string SWITCH_UUID = "switch";
+
+std::string port_uuid(unsigned i) {
+    return "port-" + std::to_string(i);
+}
+
+std::string port_url(unsigned i) {
+    return "/redfish/v1/Fabrics/1/Switches/2/Ports/" + std::to_string(i + 10);
+}
+
+}
+
+class ComponentUrlTest : public ::testing::Test {
+public:
+    void SetUp() {
+        Fabric fabric{};
+        fabric.set_uuid(FABRIC_UUID);
+        fabric.set_id(1);
+        get_manager<Fabric>().add_entry(fabric);
+
+        Switch fabric_switch{FABRIC_UUID};
+        fabric_switch.set_uuid(SWITCH_UUID);
+        fabric_switch.set_id(2);
+        get_manager<Switch>().add_entry(fabric_switch);
+
+        for (unsigned i = 0; i < PORTS; ++i) {
+            Port port{SWITCH_UUID};
+            port.set_uuid(port_uuid(i));
+            port.set_id(i + 10);
+            get_manager<Port>().add_entry(port);
+        }
+        endpoint::utils::clear_component_urls();
+    }
+
+    void TearDown() {
+        get_manager<Port>().clear_entries();
+        get_manager<Switch>().clear_entries();
+        get_manager<Fabric>().clear_entries();
+        endpoint::utils::clear_component_urls();
+    }
+
+    ~ComponentUrlTest();
+
+protected:
+    /*! @brief Fill links to all ports, as GET of a resource linking the ports does */
+    static json::Value get_port_links() {
+        json::Value json{};
+        for (unsigned i = 0; i < PORTS; ++i) {
+            json::Value port_link{};
+            port_link[constants::Common::ODATA_ID] = endpoint::PathBuilder(
+                endpoint::utils::get_component_url(enums::Component::Port, port_uuid(i))).build();
+            json[constants::Common::LINKS][constants::Switch::PORTS].push_back(std::move(port_link));
+        }
+        return json;
+    }
+};
+
+ComponentUrlTest::~ComponentUrlTest() {}
+
+
+TEST_F(ComponentUrlTest, UrlsOfAllLevels) {
+    ASSERT_EQ("/redfish/v1/Fabrics/1", endpoint::utils::get_component_url(enums::Component::Fabric, FABRIC_UUID));
+    ASSERT_EQ("/redfish/v1/Fabrics/1/Switches/2",
+              endpoint::utils::get_component_url(enums::Component::Switch, SWITCH_UUID));
+    for (unsigned i = 0; i < PORTS; ++i) {
+        ASSERT_EQ(port_url(i), endpoint::utils::get_component_url(enums::Component::Port, port_uuid(i)));
+    }
+    // memoized urls
+    ASSERT_EQ(port_url(7), endpoint::utils::get_component_url(enums::Component::Port, port_uuid(7)));
+    ASSERT_EQ("/redfish/v1/Fabrics/1/Switches/2",
+              endpoint::utils::get_component_url(enums::Component::Switch, SWITCH_UUID));
+}
+
+
+TEST_F(ComponentUrlTest, InvalidatedUrlIsBuiltAgain) {
+    ASSERT_EQ(port_url(0), endpoint::utils::get_component_url(enums::Component::Port, port_uuid(0)));
+
+    // port reinserted with new rest id
+    get_manager<Port>().remove_entry(port_uuid(0));
+    endpoint::utils::invalidate_component_url(port_uuid(0));
+    ASSERT_THROW(endpoint::utils::get_component_url(enums::Component::Port, port_uuid(0)),
+                 agent_framework::exceptions::InvalidUuid);
+
+    Port port{SWITCH_UUID};
+    port.set_uuid(port_uuid(0));
+    port.set_id(5000);
+    get_manager<Port>().add_entry(port);
+    endpoint::utils::invalidate_component_url(port_uuid(0));
+
+    ASSERT_EQ("/redfish/v1/Fabrics/1/Switches/2/Ports/5000",
+              endpoint::utils::get_component_url(enums::Component::Port, port_uuid(0)));
+    ASSERT_EQ(port_url(1), endpoint::utils::get_component_url(enums::Component::Port, port_uuid(1)));
+}
+
+
+TEST_F(ComponentUrlTest, UrlOfOtherTypeNotMemoized) {
+    ASSERT_EQ(port_url(0), endpoint::utils::get_component_url(enums::Component::Port, port_uuid(0)));
+    ASSERT_THROW(endpoint::utils::get_component_url(enums::Component::Switch, port_uuid(0)),
+                 agent_framework::exceptions::InvalidUuid);
+}
+
@@ -0,0 +1,295 @@
+/*!
+ * @brief Log structured database tests
+ *
+ * @header{License}
+ * @copyright Copyright (c) 2017 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @header{Filesystem}
+ * @file log_database_test.cpp
+ */
+
+#include "psme/rest/model/handlers/log_database.hpp"
+#include "psme/rest/model/handlers/file_database.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+namespace psme {
+namespace rest {
+namespace model {
+namespace handler {
+
+namespace {
+
+/*! @brief Any string as a key/value */
+class LogStringValue final : public Serializable {
+public:
+    LogStringValue() { }
+    LogStringValue(const std::string& str) : data(str) { }
+
+    const std::string& get() const { return data; }
+
+private:
+    std::string data{};
+
+    std::string serialize() const override { return data; }
+
+    bool unserialize(const std::string& str) override {
+        data = str;
+        return true;
+    }
+};
+
+/*! @brief Key matching only given parent */
+class ParentKey final : public Serializable {
+public:
+    ParentKey(const std::string& parent) : m_parent(parent + ".") { }
+
+private:
+    std::string m_parent;
+
+    std::string serialize() const override { return ""; }
+
+    bool unserialize(const std::string& str) override {
+        return 0 == str.compare(0, m_parent.size(), m_parent);
+    }
+};
+
+std::string make_directory() {
+    char dir_name[] = "/tmp/log_database_XXXXXX";
+    return (nullptr != mkdtemp(dir_name)) ? dir_name : "";
+}
+
+off_t get_file_size(const std::string& file_name) {
+    struct stat stats;
+    return (0 == stat(file_name.c_str(), &stats)) ? stats.st_size : -1;
+}
+
+}
+
+class LogDatabaseTest : public ::testing::Test {
+public:
+    virtual ~LogDatabaseTest();
+
+    void SetUp() override {
+        directory = make_directory();
+        ASSERT_FALSE(directory.empty());
+        file_name = directory + "/test.log";
+    }
+
+    void TearDown() override {
+        ::remove(file_name.c_str());
+        ::remove(directory.c_str());
+    }
+
+protected:
+    std::string directory{};
+    std::string file_name{};
+};
+
+LogDatabaseTest::~LogDatabaseTest() { }
+
+
+TEST_F(LogDatabaseTest, PutGetRemove) {
+    LogStore store{file_name};
+    LogDatabase db{"test", store};
+    LogDatabase all{"", store};
+
+    LogStringValue value{};
+    ASSERT_FALSE(db.get(LogStringValue{"key"}, value));
+    ASSERT_FALSE(db.put(LogStringValue{"key"}, LogStringValue{""}));
+    ASSERT_FALSE(db.put(LogStringValue{""}, LogStringValue{"value"}));
+
+    ASSERT_TRUE(db.put(LogStringValue{"key"}, LogStringValue{"value"}));
+    ASSERT_TRUE(db.get(LogStringValue{"key"}, value));
+    ASSERT_EQ("value", value.get());
+
+    /* visible in "all" database with the prefix */
+    ASSERT_TRUE(all.get(LogStringValue{"test.key"}, value));
+    ASSERT_EQ("value", value.get());
+
+    ASSERT_TRUE(db.put(LogStringValue{"key"}, LogStringValue{"other"}));
+    ASSERT_TRUE(db.get(LogStringValue{"key"}, value));
+    ASSERT_EQ("other", value.get());
+    ASSERT_EQ(1, store.size());
+
+    ASSERT_TRUE(db.remove(LogStringValue{"key"}));
+    ASSERT_FALSE(db.remove(LogStringValue{"key"}));
+    ASSERT_FALSE(db.get(LogStringValue{"key"}, value));
+    ASSERT_EQ(0, store.size());
+}
+
+
+TEST_F(LogDatabaseTest, Iterating) {
+    LogStore store{file_name};
+    LogDatabase db{"iter", store};
+    LogDatabase other{"iterother", store};
+
+    ASSERT_TRUE(other.put(LogStringValue{"x"}, LogStringValue{"0"}));
+    for (const auto& key : {"a", "b", "c"}) {
+        ASSERT_TRUE(db.put(LogStringValue{key}, LogStringValue{std::string("v") + key}));
+    }
+
+    LogStringValue key{};
+    LogStringValue value{};
+    std::vector<std::string> found{};
+    ASSERT_TRUE(db.start());
+    while (db.next(key, value)) {
+        found.push_back(key.get() + "=" + value.get());
+        /* removed entries are skipped */
+        db.remove(LogStringValue{"b"});
+    }
+    db.end();
+    ASSERT_EQ((std::vector<std::string>{"a=va", "c=vc"}), found);
+}
+
+
+TEST_F(LogDatabaseTest, Validity) {
+    LogStore store{file_name};
+    LogDatabase db{"valid", store};
+
+    ASSERT_TRUE(db.put(LogStringValue{"p1.a"}, LogStringValue{"1"}));
+    ASSERT_TRUE(db.put(LogStringValue{"p1.b"}, LogStringValue{"2"}));
+    ASSERT_TRUE(db.put(LogStringValue{"p2.c"}, LogStringValue{"3"}));
+
+    ASSERT_EQ(Database::EntityValidity::VALID, db.get_validity(LogStringValue{"p1.a"}));
+    ASSERT_EQ(Database::EntityValidity::ERROR, db.get_validity(LogStringValue{"p1.x"}));
+
+    ASSERT_TRUE(db.invalidate(LogStringValue{"p1.a"}));
+    ASSERT_FALSE(db.invalidate(LogStringValue{"p1.a"}));
+    ASSERT_EQ(Database::EntityValidity::INVALID, db.get_validity(LogStringValue{"p1.a"}));
+    ASSERT_EQ(Database::EntityValidity::OUTDATED,
+              db.get_validity(LogStringValue{"p1.a"}, std::chrono::seconds{0}));
+
+    /* put makes entry valid again */
+    ASSERT_TRUE(db.put(LogStringValue{"p1.a"}, LogStringValue{"1"}));
+    ASSERT_EQ(Database::EntityValidity::VALID, db.get_validity(LogStringValue{"p1.a"}));
+
+    /* cleanup invalidates valid entries, then removes outdated ones */
+    ParentKey p1{"p1"};
+    ASSERT_EQ(2, db.cleanup(p1, Database::NEVER));
+    ASSERT_EQ(0, db.cleanup(p1, Database::NEVER));
+    ASSERT_EQ(Database::EntityValidity::VALID, db.get_validity(LogStringValue{"p2.c"}));
+    ASSERT_EQ(0, db.wipe_outdated(p1, Database::NEVER));
+    ASSERT_EQ(2, db.wipe_outdated(p1, std::chrono::seconds{0}));
+    ASSERT_EQ(1, store.size());
+
+    LogStringValue any{};
+    ASSERT_EQ(1, db.drop(any));
+    ASSERT_EQ(0, store.size());
+}
+
+
+TEST_F(LogDatabaseTest, Reload) {
+    {
+        LogStore store{file_name};
+        LogDatabase db{"reload", store};
+        ASSERT_TRUE(db.put(LogStringValue{"a"}, LogStringValue{"1"}));
+        ASSERT_TRUE(db.put(LogStringValue{"b"}, LogStringValue{"2"}));
+        ASSERT_TRUE(db.put(LogStringValue{"a"}, LogStringValue{"3"}));
+        ASSERT_TRUE(db.invalidate(LogStringValue{"b"}));
+        ASSERT_TRUE(db.put(LogStringValue{"c"}, LogStringValue{"4"}));
+        ASSERT_TRUE(db.remove(LogStringValue{"c"}));
+    }
+
+    LogStore store{file_name};
+    LogDatabase db{"reload", store};
+    LogStringValue value{};
+    ASSERT_EQ(2, store.size());
+    ASSERT_TRUE(db.get(LogStringValue{"a"}, value));
+    ASSERT_EQ("3", value.get());
+    ASSERT_EQ(Database::EntityValidity::INVALID, db.get_validity(LogStringValue{"b"}));
+    ASSERT_FALSE(db.get(LogStringValue{"c"}, value));
+}
+
+
+TEST_F(LogDatabaseTest, TornRecord) {
+    off_t good_size{};
+    {
+        LogStore store{file_name};
+        LogDatabase db{"torn", store};
+        ASSERT_TRUE(db.put(LogStringValue{"a"}, LogStringValue{"1"}));
+        store.sync();
+        good_size = get_file_size(file_name);
+        ASSERT_TRUE(db.put(LogStringValue{"b"}, LogStringValue{"2"}));
+    }
+
+    /* cut the last record in the middle */
+    const off_t full_size = get_file_size(file_name);
+    ASSERT_EQ(0, truncate(file_name.c_str(), good_size + (full_size - good_size) / 2));
+
+    {
+        LogStore store{file_name};
+        LogDatabase db{"torn", store};
+        LogStringValue value{};
+        ASSERT_EQ(1, store.size());
+        ASSERT_TRUE(db.get(LogStringValue{"a"}, value));
+        ASSERT_FALSE(db.get(LogStringValue{"b"}, value));
+        ASSERT_EQ(good_size, get_file_size(file_name));
+
+        /* new records are appended after the last good one */
+        ASSERT_TRUE(db.put(LogStringValue{"c"}, LogStringValue{"3"}));
+    }
+
+    /* corrupt the checksum of the last record */
+    int fd = open(file_name.c_str(), O_WRONLY);
+    ASSERT_LE(0, fd);
+    const char garbage = 'X';
+    ASSERT_EQ(1, pwrite(fd, &garbage, 1, get_file_size(file_name) - 1));
+    close(fd);
+
+    LogStore store{file_name};
+    ASSERT_EQ(1, store.size());
+}
+
+
+TEST_F(LogDatabaseTest, Compaction) {
+    LogStore store{file_name};
+    LogDatabase db{"compact", store};
+
+    for (unsigned i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(db.put(LogStringValue{"key" + std::to_string(i % 10)}, LogStringValue{std::to_string(i)}));
+    }
+    /* compacted by the sync thread */
+    const auto deadline = std::chrono::steady_clock::now() + 10 * LogStore::SYNC_INTERVAL;
+    while ((store.get_log_size() > LogStore::COMPACTION_MIN_SIZE) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_GT(LogStore::COMPACTION_MIN_SIZE + 1024, store.get_log_size());
+
+    store.compact();
+    ASSERT_EQ(off_t(store.get_log_size()), get_file_size(file_name));
+    ASSERT_LT(store.get_log_size(), 1024);
+
+    LogStore reloaded{file_name};
+    LogDatabase reloaded_db{"compact", reloaded};
+    LogStringValue value{};
+    ASSERT_EQ(10, reloaded.size());
+    ASSERT_TRUE(reloaded_db.get(LogStringValue{"key9"}, value));
+    ASSERT_EQ("9999", value.get());
+}
+
+} // @i{handler}
+} // @i{model}
+} // @i{rest}
+} // @i{psme}
@@ -0,0 +1,254 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * */
+
+#include "psme/rest/server/multiplexer.hpp"
+#include "psme/rest/server/error/server_exception.hpp"
+#include "json/json.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace psme::rest::server;
+
+namespace {
+
+constexpr unsigned SYSTEMS = 256;
+
+const std::string SYSTEMS_URL = "/redfish/v1/Systems";
+const std::string CHASSIS_URL = "/redfish/v1/Chassis/1";
+
+std::string system_url(std::size_t id) {
+    return SYSTEMS_URL + "/" + std::to_string(id);
+}
+
+
+class TestHandler : public MethodsHandler {
+public:
+    explicit TestHandler(const std::string& path) : MethodsHandler(path) {}
+
+    void del(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void post(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void patch(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+
+    void put(const Request&, Response& response) override {
+        response.set_status(status_4XX::METHOD_NOT_ALLOWED);
+    }
+};
+
+
+class SystemCollection : public TestHandler {
+public:
+    SystemCollection() : TestHandler(SYSTEMS_URL) {}
+
+    void get(const Request&, Response& response) override {
+        json::Value json{};
+        json["@odata.id"] = SYSTEMS_URL;
+        json["Name"] = "Computer System Collection";
+        json["Members@odata.count"] = SYSTEMS;
+        json["Members"] = json::Value::Type::ARRAY;
+        for (unsigned id = 1; id <= SYSTEMS; ++id) {
+            json::Value link{};
+            link["@odata.id"] = system_url(id);
+            json["Members"].push_back(std::move(link));
+        }
+        response << json::Serializer(json);
+    }
+};
+
+
+class System : public TestHandler {
+public:
+    System() : TestHandler(SYSTEMS_URL + "/{systemId:[0-9]+}") {}
+
+    void get(const Request& request, Response& response) override {
+        json::Value json{};
+        json["@odata.id"] = request.get_url();
+        json["@odata.type"] = "#ComputerSystem.v1_1_0.ComputerSystem";
+        json["Id"] = request.params["systemId"];
+        json["Name"] = "Computer System";
+        json["Manufacturer"] = "Intel Corporation";
+        json["SerialNumber"] = "SN" + request.params["systemId"];
+        json["Status"]["State"] = "Enabled";
+        json["Status"]["Health"] = "OK";
+        json["ProcessorSummary"]["Count"] = 2;
+        json["ProcessorSummary"]["Model"] = "Intel(R) Xeon(R) CPU E5-2699 v4";
+        json["MemorySummary"]["TotalSystemMemoryGiB"] = 256;
+        json["Processors"]["@odata.id"] = request.get_url() + "/Processors";
+        json["Links"]["Chassis"] = json::Value::Type::ARRAY;
+        json::Value chassis{};
+        chassis["@odata.id"] = CHASSIS_URL;
+        json["Links"]["Chassis"].push_back(std::move(chassis));
+        response << json::Serializer(json);
+    }
+};
+
+
+class Chassis : public TestHandler {
+public:
+    Chassis() : TestHandler(CHASSIS_URL) {}
+
+    void get(const Request&, Response& response) override {
+        json::Value json{};
+        json["@odata.id"] = CHASSIS_URL;
+        json["Name"] = "Drawer";
+        response << json::Serializer(json);
+    }
+};
+
+}
+
+
+class QueryOptionsTest : public ::testing::Test {
+public:
+    QueryOptionsTest() {
+        m_mux.register_handler(MethodsHandler::UPtr(new SystemCollection()), AccessType::ALL);
+        m_mux.register_handler(MethodsHandler::UPtr(new System()), AccessType::ALL);
+        m_mux.register_handler(MethodsHandler::UPtr(new Chassis()), AccessType::ALL);
+    }
+
+    ~QueryOptionsTest();
+
+protected:
+    json::Value get(const std::string& url, const Parameters& query = {}) {
+        Request request{};
+        request.set_method(Method::GET);
+        request.set_destination(url);
+        request.query = query;
+        Response response{};
+        m_mux.forward_to_handler(response, request);
+        EXPECT_EQ(status_2XX::OK, response.get_status());
+
+        json::Deserializer deserializer(response.get_body());
+        EXPECT_FALSE(deserializer.is_invalid());
+        json::Value json{};
+        deserializer >> json;
+        return json;
+    }
+
+    static Parameters query(std::initializer_list<std::pair<std::string, std::string>> options) {
+        Parameters parameters{};
+        for (const auto& option : options) {
+            parameters.set(option.first, option.second);
+        }
+        return parameters;
+    }
+
+    Multiplexer m_mux{};
+};
+
+QueryOptionsTest::~QueryOptionsTest() {}
+
+
+TEST_F(QueryOptionsTest, NoOptions) {
+    const auto json = get(SYSTEMS_URL);
+    ASSERT_EQ(SYSTEMS, json["Members"].size());
+    ASSERT_EQ(1, json["Members"][0].size());
+    ASSERT_FALSE(json.is_member("Members@odata.nextLink"));
+}
+
+
+TEST_F(QueryOptionsTest, Paging) {
+    auto json = get(SYSTEMS_URL, query({{"$top", "10"}, {"$skip", "5"}}));
+    ASSERT_EQ(10, json["Members"].size());
+    ASSERT_EQ(system_url(6), json["Members"][0]["@odata.id"].as_string());
+    ASSERT_EQ(system_url(15), json["Members"][9]["@odata.id"].as_string());
+    ASSERT_EQ(SYSTEMS, json["Members@odata.count"].as_uint());
+    ASSERT_EQ(SYSTEMS_URL + "?$skip=15&$top=10", json["Members@odata.nextLink"].as_string());
+
+    json = get(SYSTEMS_URL, query({{"$top", "10"}, {"$skip", std::to_string(SYSTEMS - 4)}}));
+    ASSERT_EQ(4, json["Members"].size());
+    ASSERT_FALSE(json.is_member("Members@odata.nextLink"));
+
+    json = get(SYSTEMS_URL, query({{"$skip", std::to_string(SYSTEMS + 1)}}));
+    ASSERT_EQ(0, json["Members"].size());
+
+    json = get(SYSTEMS_URL, query({{"$top", "2"}, {"$select", "Name, Status/Health"}, {"$expand", "."}}));
+    ASSERT_EQ(SYSTEMS_URL + "?$skip=2&$top=2&$expand=.&$select=Name,%20Status/Health",
+              json["Members@odata.nextLink"].as_string());
+}
+
+
+TEST_F(QueryOptionsTest, ExpandMembers) {
+    const auto json = get(SYSTEMS_URL, query({{"$expand", "."}}));
+    ASSERT_EQ(SYSTEMS, json["Members"].size());
+    for (std::size_t i = 0; i < SYSTEMS; ++i) {
+        const auto& member = json["Members"][i];
+        ASSERT_EQ(system_url(i + 1), member["@odata.id"].as_string());
+        ASSERT_EQ(std::to_string(i + 1), member["Id"].as_string());
+        ASSERT_EQ("OK", member["Status"]["Health"].as_string());
+        // not existing resource stays a reference, references in Links are not expanded
+        ASSERT_EQ(1, member["Processors"].size());
+        ASSERT_EQ(1, member["Links"]["Chassis"][0].size());
+    }
+}
+
+
+TEST_F(QueryOptionsTest, ExpandLinks) {
+    auto json = get(system_url(1), query({{"$expand", "~"}}));
+    ASSERT_EQ("Drawer", json["Links"]["Chassis"][0]["Name"].as_string());
+
+    json = get(SYSTEMS_URL, query({{"$expand", "*"}}));
+    ASSERT_EQ("1", json["Members"][0]["Id"].as_string());
+    ASSERT_EQ(1, json["Members"][0]["Links"]["Chassis"][0].size());
+
+    json = get(SYSTEMS_URL, query({{"$expand", "*($levels=2)"}}));
+    ASSERT_EQ("Drawer", json["Members"][0]["Links"]["Chassis"][0]["Name"].as_string());
+}
+
+
+TEST_F(QueryOptionsTest, Select) {
+    auto json = get(system_url(7), query({{"$select", "Name,Status/Health,Missing"}}));
+    ASSERT_EQ(4, json.size());
+    ASSERT_EQ(system_url(7), json["@odata.id"].as_string());
+    ASSERT_TRUE(json.is_member("@odata.type"));
+    ASSERT_EQ("Computer System", json["Name"].as_string());
+    ASSERT_EQ(1, json["Status"].size());
+    ASSERT_EQ("OK", json["Status"]["Health"].as_string());
+
+    // selected properties of collection members
+    json = get(SYSTEMS_URL, query({{"$expand", "."}, {"$select", "SerialNumber"}}));
+    ASSERT_EQ(SYSTEMS, json["Members@odata.count"].as_uint());
+    ASSERT_EQ(3, json["Members"][0].size());
+    ASSERT_EQ("SN1", json["Members"][0]["SerialNumber"].as_string());
+}
+
+
+TEST_F(QueryOptionsTest, InvalidOptions) {
+    Request request{};
+    request.set_method(Method::GET);
+    request.set_destination(SYSTEMS_URL);
+    Response response{};
+
+    for (const auto& option : {std::make_pair("$top", "-1"), std::make_pair("$skip", "x"),
+                               std::make_pair("$expand", "Members"), std::make_pair("$expand", ".($levels=7)"),
+                               std::make_pair("$select", "Name,,Id")}) {
+        request.query = query({option});
+        ASSERT_THROW(m_mux.forward_to_handler(response, request), psme::rest::error::ServerException)
+            << option.first << "=" << option.second;
+    }
+}
+
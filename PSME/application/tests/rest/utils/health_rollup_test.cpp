@@ -30,11 +30,15 @@
 #include "agent-framework/module/compute_components.hpp"
 #include "agent-framework/module/requests/compute.hpp"
 #include "psme/rest/utils/status_helpers.hpp"
+#include "psme/rest/utils/health_rollup_index.hpp"
 #include "psme/rest/model/handlers/generic_handler.hpp"
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <random>
+
 using namespace agent_framework;
 using namespace agent_framework::model;
 using namespace agent_framework::module;
@@ -83,12 +87,14 @@ public:
         system_handler->remember_sub_handler(memory_handler);
         system_handler->remember_sub_handler(processor_handler);
         memory_handler->remember_sub_handler(system_handler); // circural dependency - not real, only for testing
+        psme::rest::utils::HealthRollupIndex::get_instance().clear();
     }
 
     void TearDown() {
         systems.clear_entries();
         memories.clear_entries();
         processors.clear_entries();
+        psme::rest::utils::HealthRollupIndex::get_instance().clear();
     }
 
 protected:
@@ -104,6 +110,37 @@ protected:
         manager.add_entry(r);
     }
 
+    /*! @brief Add resource or change its health in the model and in the index, as handlers do */
+    template<typename T>
+    void setResource(const std::string& parent_uuid, const std::string& uuid, OptionalField<enums::Health> health) {
+        auto r = T(parent_uuid);
+        r.set_uuid(uuid);
+        attribute::Status status;
+        status.set_health(health);
+        r.set_status(status);
+
+        module::get_manager<T>().add_or_update_entry(r);
+        psme::rest::utils::HealthRollupIndex::get_instance().set(T::get_component(), uuid, parent_uuid, health);
+    }
+
+    template<typename T>
+    void removeResource(const std::string& uuid) {
+        module::get_manager<T>().remove_entry(uuid);
+        psme::rest::utils::HealthRollupIndex::get_instance().remove(uuid);
+    }
+
+    /*! @brief Check that rollup read from the index is the one computed by walking the subtree */
+    template<typename T>
+    void expectIndexedRollup(const std::string& uuid, enums::Component filter = enums::Component::None) {
+        OptionalField<enums::Health> indexed{};
+        ASSERT_TRUE(psme::rest::utils::HealthRollupIndex::get_instance().get(uuid, filter, indexed));
+        const auto computed = HealthRollup<T>().compute(uuid, filter);
+        ASSERT_EQ(computed.has_value(), indexed.has_value()) << uuid << " " << filter.to_string();
+        if (computed.has_value()) {
+            ASSERT_EQ(computed.value(), indexed.value()) << uuid << " " << filter.to_string();
+        }
+    }
+
     SystemManager& systems;
     MemoryManager& memories;
     ProcessorManager& processors;
@@ -175,6 +212,84 @@ TEST_F(RollupTest, IgnoreOtherComponentsWhenFilterSpecified) {
     EXPECT_EQ(Health::Warning, HealthRollup<System>().get("system1", agent_framework::model::enums::Component::Memory));
 }
 
+TEST_F(RollupTest, IndexedRollupIsTheComputedOne) {
+    constexpr unsigned SYSTEMS = 8;
+    constexpr unsigned CHILDREN = 40;
+    constexpr unsigned STEPS = 400;
+    const std::vector<OptionalField<Health>> healths{Health::OK, Health::Warning, Health::Critical, {}};
+
+    std::mt19937 random{2017};
+    auto random_health = [&random, &healths]() {
+        return healths[std::uniform_int_distribution<std::size_t>(0, healths.size() - 1)(random)];
+    };
+    auto system_uuid = [](unsigned i) { return "system" + std::to_string(i); };
+    auto child_uuid = [](unsigned i) { return "child" + std::to_string(i); };
+    // even children are memories, odd are processors, child i is placed under system i % SYSTEMS
+    auto set_child = [&](unsigned i) {
+        if (0 == i % 2) {
+            setResource<Memory>(system_uuid(i % SYSTEMS), child_uuid(i), random_health());
+        }
+        else {
+            setResource<Processor>(system_uuid(i % SYSTEMS), child_uuid(i), random_health());
+        }
+    };
+    auto remove_child = [&](unsigned i) {
+        if (0 == i % 2) {
+            removeResource<Memory>(child_uuid(i));
+        }
+        else {
+            removeResource<Processor>(child_uuid(i));
+        }
+    };
+
+    // children are added before their parents as well
+    std::vector<unsigned> order(SYSTEMS + CHILDREN);
+    for (unsigned i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), random);
+    for (const auto i : order) {
+        if (i < SYSTEMS) {
+            setResource<System>("manager", system_uuid(i), random_health());
+        }
+        else {
+            set_child(i - SYSTEMS);
+        }
+    }
+
+    for (unsigned step = 0; step < STEPS; ++step) {
+        const auto i = std::uniform_int_distribution<unsigned>(0, SYSTEMS + CHILDREN - 1)(random);
+        const bool remove = 0 == std::uniform_int_distribution<unsigned>(0, 3)(random);
+        if (i < SYSTEMS) {
+            if (remove) {
+                removeResource<System>(system_uuid(i));
+            }
+            else {
+                setResource<System>("manager", system_uuid(i), random_health());
+            }
+        }
+        else if (remove) {
+            remove_child(i - SYSTEMS);
+        }
+        else {
+            set_child(i - SYSTEMS);
+        }
+
+        for (unsigned j = 0; j < SYSTEMS; ++j) {
+            if (systems.entry_exists(system_uuid(j))) {
+                expectIndexedRollup<System>(system_uuid(j));
+                expectIndexedRollup<System>(system_uuid(j), enums::Component::Memory);
+                expectIndexedRollup<System>(system_uuid(j), enums::Component::Processor);
+            }
+        }
+        for (unsigned j = 0; j < CHILDREN; j += 2) {
+            if (memories.entry_exists(child_uuid(j))) {
+                expectIndexedRollup<Memory>(child_uuid(j));
+            }
+        }
+    }
+}
+
 
 
 }
@@ -0,0 +1,92 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file task_cleaner.hpp
+ *
+ * @brief Declaration of TaskCleaner class
+ * */
+
+#pragma once
+
+
+
+#include "agent-framework/action/task_result_manager.hpp"
+#include "agent-framework/threading/thread.hpp"
+
+#include <chrono>
+
+
+
+namespace json { class Value; }
+
+namespace agent_framework {
+namespace action {
+
+/*!
+ * @brief TaskCleaner thread periodically removes finished tasks.
+ *
+ * Task results which violate the retention policy of the TaskResultManager
+ * are removed together with the corresponding Task resources, so long running
+ * agents do not accumulate tasks without a limit.
+ * */
+class TaskCleaner final : public threading::Thread {
+public:
+    /*! Default interval between two cleanups (in seconds) */
+    static constexpr std::chrono::seconds::rep DEFAULT_INTERVAL_SEC = 60;
+
+
+    /*!
+     * @brief Create cleaner with default retention policy
+     * */
+    TaskCleaner() = default;
+
+
+    /*!
+     * @brief Create cleaner configured by the optional "tasks" section of agent configuration
+     *
+     * Recognized properties are "maxCount", "maxAge" and "cleanupInterval",
+     * the latter two are expressed in seconds.
+     *
+     * @param[in] configuration Agent configuration
+     * */
+    explicit TaskCleaner(const json::Value& configuration);
+
+
+    /*! @brief Destructor */
+    ~TaskCleaner();
+
+
+    /*!
+     * @brief Remove all tasks violating the retention policy
+     *
+     * @return Number of removed tasks
+     * */
+    static std::size_t remove_outdated_tasks();
+
+
+    /*! @brief Cleaner thread loop */
+    void execute() override;
+
+private:
+    std::chrono::seconds m_interval{DEFAULT_INTERVAL_SEC};
+};
+
+}
+}
@@ -0,0 +1,50 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file task_progress.hpp
+ *
+ * @brief Reporting progress of long running tasks
+ * */
+
+#pragma once
+
+
+
+#include <cstdint>
+#include <string>
+
+
+
+namespace agent_framework {
+namespace action {
+
+/*!
+ * @brief Report progress of a running task.
+ *
+ * Task messages are replaced with a single TaskProgressChanged message and
+ * an update event is sent, so the REST server reloads the task.
+ *
+ * @param[in] task_uuid UUID of the task resource
+ * @param[in] percent Percent of completed work (values over 100 are capped)
+ * */
+void update_task_progress(const std::string& task_uuid, std::uint32_t percent);
+
+}
+}
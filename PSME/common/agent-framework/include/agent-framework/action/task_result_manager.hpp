@@ -31,10 +31,13 @@
 
 #include <json/json.h>
 
-#include <map>
+#include <chrono>
+#include <list>
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 
 
 
@@ -43,16 +46,36 @@ namespace action {
 
 /*!
  * This class acts as a registry of task results.
+ *
+ * Results are kept in insertion (i.e. task completion) order and are evicted
+ * according to the retention policy by remove_outdated() calls.
  * */
 class TaskResultManager : public agent_framework::generic::Singleton<TaskResultManager> {
 public:
     ~TaskResultManager();
 
 
+    using Clock = std::chrono::steady_clock;
+    using TaskUuids = std::vector<std::string>;
+
     // The first parameter is a task response, second is an exception flag, third is an associated exception object
     // (only classes derived from agent_framework::exceptions::ExceptionBase are supported)
     using TaskResultValue = std::tuple<Json::Value, bool, agent_framework::exceptions::GamiException>;
-    using TaskResultMap = std::map<std::string, TaskResultValue>;
+
+
+    /*! Limits applied to the stored task results */
+    struct RetentionPolicy {
+        /*! Maximal number of stored results, 0 means no limit */
+        std::size_t max_count;
+        /*! Maximal time a result is stored after it was set, 0 means no limit */
+        std::chrono::seconds max_age;
+    };
+
+    /*! Default maximal number of stored task results */
+    static constexpr std::size_t DEFAULT_MAX_COUNT = 1000;
+
+    /*! Default maximal age of stored task results (in seconds) */
+    static constexpr std::chrono::seconds::rep DEFAULT_MAX_AGE_SEC = 24 * 60 * 60;
 
 
     /*!
@@ -93,8 +116,62 @@ public:
     bool task_exists(const std::string& task_uuid) const;
 
 
+    /*!
+     * Remove task result from the result manager
+     *
+     * @param[in] task_uuid Task UUID
+     * */
+    void remove_result(const std::string& task_uuid);
+
+
+    /*!
+     * Remove all task results violating the retention policy, the oldest first.
+     *
+     * @return UUIDs of the tasks whose results were removed
+     * */
+    TaskUuids remove_outdated();
+
+
+    /*!
+     * Get number of stored task results
+     *
+     * @return Number of task results
+     * */
+    std::size_t get_result_count() const;
+
+
+    /*!
+     * Set retention policy used by remove_outdated()
+     *
+     * @param[in] policy Retention policy
+     * */
+    void set_retention_policy(const RetentionPolicy& policy);
+
+
+    /*!
+     * Get retention policy used by remove_outdated()
+     *
+     * @return Retention policy
+     * */
+    RetentionPolicy get_retention_policy() const;
+
+
 private:
+    using TaskOrder = std::list<std::string>;
+
+    struct TaskResultEntry {
+        TaskResultValue value;
+        Clock::time_point timestamp;
+        TaskOrder::iterator position;
+    };
+
+    using TaskResultMap = std::unordered_map<std::string, TaskResultEntry>;
+
+    void add_result(const std::string& task_uuid, TaskResultValue&& value);
+
     TaskResultMap m_results{};
+    TaskOrder m_order{};
+    RetentionPolicy m_policy{DEFAULT_MAX_COUNT, std::chrono::seconds{DEFAULT_MAX_AGE_SEC}};
     mutable std::recursive_mutex m_resource_mutex{};
 };
 
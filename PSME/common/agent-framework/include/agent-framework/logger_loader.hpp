@@ -122,7 +122,7 @@ private:
 
     static std::array<const char*, 8> g_level;
     static std::array<const char*, 5> g_time_format;
-    static std::array<const char*, 6> g_stream_type;
+    static std::array<const char*, 7> g_stream_type;
 
     /*!
      * @brief Reference to configuration data
@@ -24,15 +24,81 @@
  *
  * ENUM macro is used to wrap enums into classes providing additional methods
  * to convert it to/from strings. This may be used like the normal enum keyword.
+ *
+ * Enumerators are numbered from 0, so names are found by value in constant time.
+ * Values are found by name with a binary search in the EnumNameIndex built on
+ * the first conversion from string.
  * */
 
 #pragma once
 
 #include "agent-framework/exceptions/exception.hpp"
+#include <algorithm>
 #include <string>
 #include <cstring>
 #include <stdexcept>
 #include <ostream>
+#include <vector>
+
+namespace agent_framework {
+namespace model {
+namespace enums {
+
+/*!
+ * @brief Index of enum names used to convert strings to enum values.
+ *
+ * Names are sorted by length first, so most comparisons are resolved without
+ * touching the characters. Lookups do not allocate memory.
+ * */
+class EnumNameIndex final {
+public:
+    /*!
+     * @brief Builds index of names
+     * @param[in] names Names of enumerators in order of their values
+     * @param[in] size Number of enumerators
+     * */
+    EnumNameIndex(const char* const names[], std::size_t size) {
+        m_entries.reserve(size);
+        for (std::size_t position = 0; position < size; ++position) {
+            m_entries.push_back({names[position], std::strlen(names[position]), position});
+        }
+        std::sort(m_entries.begin(), m_entries.end(), less);
+    }
+
+    /*!
+     * @brief Finds position of the name in the enum
+     * @param[in] name Name of the enumerator
+     * @return Position of the enumerator, number of enumerators if not found
+     * */
+    std::size_t find(const std::string& name) const {
+        const Entry key{name.c_str(), name.size(), m_entries.size()};
+        const auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key, less);
+        if (it != m_entries.end() && !less(key, *it)) {
+            return it->position;
+        }
+        return m_entries.size();
+    }
+
+private:
+    struct Entry {
+        const char* name;
+        std::size_t length;
+        std::size_t position;
+    };
+
+    static bool less(const Entry& lhs, const Entry& rhs) {
+        if (lhs.length != rhs.length) {
+            return lhs.length < rhs.length;
+        }
+        return std::memcmp(lhs.name, rhs.name, lhs.length) < 0;
+    }
+
+    std::vector<Entry> m_entries{};
+};
+
+}
+}
+}
 
 /*! Count defines macro arguments */
 #define NUM_ARGS_LIST(_1,   _2,  _3,  _4,  _5,  _6,  _7,  _8, \
@@ -153,48 +219,36 @@ public:                                                                       \
     enum EnumName ## _enum : T { __VA_ARGS__ };                               \
                                                                               \
     const char* to_string() const {                                           \
-        for (std::size_t index = 0;                                           \
-                         index < EnumName ## _data_ns::g_size;                \
-                                                     ++index) {               \
-            if (EnumName ## _data_ns::g_values[index] == m_value) {           \
-                return EnumName ## _data_ns::g_names[index];                  \
-            }                                                                 \
+        const auto index = static_cast<std::size_t>(m_value);                 \
+        if (index < EnumName ## _data_ns::g_size &&                           \
+            EnumName ## _data_ns::g_values[index] == m_value) {               \
+            return EnumName ## _data_ns::g_names[index];                      \
         }                                                                     \
         throw std::runtime_error("Invalid enum value: '" +                    \
                     std::to_string(m_value) + "'.");                          \
     }                                                                         \
                                                                               \
     static EnumName from_string(const std::string& str) {                     \
-        for (std::size_t index = 0;                                           \
-                         index < EnumName ## _data_ns::g_size;                \
-                                                     ++index) {               \
-            if (!strcmp(EnumName ## _data_ns::g_names[index],                 \
-                        str.c_str())) {                                       \
-                return                                                        \
-                    {static_cast<EnumName ## _enum>(                          \
-                        EnumName ## _data_ns::g_values[index])};              \
-            }                                                                 \
+        const auto index = get_index().find(str);                             \
+        if (index < EnumName ## _data_ns::g_size) {                           \
+            return                                                            \
+                {static_cast<EnumName ## _enum>(                              \
+                    EnumName ## _data_ns::g_values[index])};                  \
         }                                                                     \
         THROW(agent_framework::exceptions::InvalidValue, "agent-framework",   \
             std::string(#EnumName" enum value not found: '") + str + "'.");   \
     }                                                                         \
                                                                               \
     /*! Gets all available enum values as a vector of strings */              \
-    static std::vector<std::string> get_values() {                            \
-        return std::vector<std::string>(EnumName ## _data_ns::g_names,        \
+    static const std::vector<std::string>& get_values() {                     \
+        static const std::vector<std::string> values(                         \
+            EnumName ## _data_ns::g_names,                                    \
             EnumName ## _data_ns::g_names + EnumName ## _data_ns::g_size);    \
+        return values;                                                        \
     }                                                                         \
                                                                               \
     static bool is_allowable_value(const std::string& str) {                  \
-        for (std::size_t index = 0;                                           \
-                         index < EnumName ## _data_ns::g_size;                \
-                                                     ++index) {               \
-            if (!strcmp(EnumName ## _data_ns::g_names[index],                 \
-                        str.c_str())) {                                       \
-                return true;                                                  \
-            }                                                                 \
-        }                                                                     \
-        return false;                                                         \
+        return get_index().find(str) < EnumName ## _data_ns::g_size;          \
     }                                                                         \
                                                                               \
     EnumName() = delete;                                                      \
@@ -212,6 +266,12 @@ public:                                                                       \
     }                                                                         \
                                                                               \
 private:                                                                      \
+    static const ::agent_framework::model::enums::EnumNameIndex& get_index() {\
+        static const ::agent_framework::model::enums::EnumNameIndex index{    \
+            EnumName ## _data_ns::g_names, EnumName ## _data_ns::g_size};     \
+        return index;                                                         \
+    }                                                                         \
+                                                                              \
     T m_value{};                                                              \
 }
 
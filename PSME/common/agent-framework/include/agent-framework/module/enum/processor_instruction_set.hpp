@@ -70,7 +70,7 @@ public:
      * @brief Gets all available Enum values as a vector of strings.
      * @return Returns std::vector of std::string containing Enum values.
      * */
-    static std::vector<std::string> get_values();
+    static const std::vector<std::string>& get_values();
 
     /*!
      * @brief Default constructor
@@ -93,10 +93,10 @@ public:
 
         auto it = find_entry(entry.get_uuid());
         if (m_manager_data.end() != it) {
-            if (it->get_parent_uuid() != entry_r.get_parent_uuid()) {
+            if (it->get_parent_uuid() != entry.get_parent_uuid()) {
                 THROW(::agent_framework::exceptions::InvalidUuid, "model",
-                      "Parent UUID cannot be updated. Entry = '" + entry_r.get_uuid() + "', parent changed from "
-                      + it->get_parent_uuid() + " to " + entry_r.get_parent_uuid());
+                      "Parent UUID cannot be updated. Entry = '" + entry.get_uuid() + "', parent changed from "
+                      + it->get_parent_uuid() + " to " + entry.get_parent_uuid());
             }
             const auto& db_hash = it->get_resource_hash();
             const auto& entry_hash = entry.get_resource_hash();
@@ -108,7 +108,7 @@ public:
                 res = UpdateStatus::Updated;
             }
 
-            (*it) = std::forward<U>(entry);
+            (*it) = std::move(entry);
         }
         else {
             m_manager_data.emplace_back(std::move(entry));
@@ -117,6 +117,71 @@ public:
         return res;
     }
 
+    /*!
+     * @brief Constructs entry in place
+     *
+     * The entry may be filled in through the returned reference, which keeps
+     * the manager locked, so no copy of the entry is made.
+     *
+     * @param args Arguments of the entry constructor
+     *
+     * @return Reference to the added entry
+     */
+    template <typename... Args>
+    Reference emplace_entry(Args&&... args) {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        m_manager_data.emplace_back(std::forward<Args>(args)...);
+        auto& entry = m_manager_data.back();
+        if (m_manager_data.end() - 1 != find_entry(entry.get_uuid())) {
+            const auto uuid = entry.get_uuid();
+            m_manager_data.pop_back();
+            THROW(::agent_framework::exceptions::InvalidUuid, "model",
+                  "Object with this UUID already exists. UUID = '" + uuid + "'.");
+        }
+        entry.touch(++m_current_epoch);
+        return Reference(entry, m_mutex);
+    }
+
+    /*!
+     * @brief Modifies entry in place
+     *
+     * Replaces get_entry()/add_or_update_entry() pairs, the entry is not copied.
+     * The modifier is called with the manager locked.
+     *
+     * @param uuid UUID of the entry
+     * @param modifier Function called with reference to the entry
+     */
+    template <typename F>
+    void modify_entry(const std::string& uuid, F&& modifier) {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        const auto it = find_entry(uuid);
+        if (m_manager_data.end() == it) {
+            THROW(::agent_framework::exceptions::InvalidUuid, "model",
+                  std::string(T::get_collection_name().to_string()) +
+                          " [UUID = '" + uuid + "'] not found.");
+        }
+        modifier(*it);
+        it->touch(++m_current_epoch);
+    }
+
+    /*!
+     * @brief Modifies all entries in place in a single pass
+     *
+     * Replaces get_keys()/get_entry_reference() loops which search the entries for each key.
+     * The modifier is called with the manager locked.
+     *
+     * @param modifier Function called with reference to each entry, returns true if the entry was changed
+     */
+    template <typename F>
+    void modify_entries(F&& modifier) {
+        std::lock_guard<std::recursive_mutex> lock{m_mutex};
+        for (auto& entry : m_manager_data) {
+            if (modifier(entry)) {
+                entry.touch(++m_current_epoch);
+            }
+        }
+    }
+
     T get_entry(const std::string& uuid) const {
         std::lock_guard<std::recursive_mutex> lock{m_mutex};
         const auto it = find_entry(uuid);
@@ -434,10 +499,10 @@ GenericManager<agent_framework::model::Task>::add_or_update_entry(U&& entry_r) {
 
     auto it = find_entry(entry.get_uuid());
     if (m_manager_data.end() != it) {
-        if (it->get_parent_uuid() != entry_r.get_parent_uuid()) {
+        if (it->get_parent_uuid() != entry.get_parent_uuid()) {
             THROW(::agent_framework::exceptions::InvalidUuid, "model",
-                  "Parent UUID cannot be updated. Entry = '" + entry_r.get_uuid() + "', parent changed from "
-                  + it->get_parent_uuid() + " to " + entry_r.get_parent_uuid());
+                  "Parent UUID cannot be updated. Entry = '" + entry.get_uuid() + "', parent changed from "
+                  + it->get_parent_uuid() + " to " + entry.get_parent_uuid());
         }
         const auto& db_hash = it->get_resource_hash();
         const auto& entry_hash = entry.get_resource_hash();
@@ -449,8 +514,8 @@ GenericManager<agent_framework::model::Task>::add_or_update_entry(U&& entry_r) {
             res = UpdateStatus::Updated;
         }
 
-        (*it) = std::forward<U>(entry);
-        if (UpdateStatus::NoUpdate != res && entry_r.get_end_time().has_value()) {
+        (*it) = std::move(entry);
+        if (UpdateStatus::NoUpdate != res && it->get_end_time().has_value()) {
             it->call_completion_notifiers();
         }
 
@@ -31,6 +31,7 @@
 
 #include "agent-framework/module/managers/generic_manager.hpp"
 
+#include <map>
 #include <mutex>
 #include <string>
 #include <set>
@@ -303,6 +304,34 @@ public:
     }
 
 
+    /*!
+     * Replace parents and children in the manager entries table in a single pass.
+     * Each UUID found in the map is changed to the mapped UUID.
+     *
+     * @param[in] uuids Map of UUIDs to be replaced to new UUIDs
+     * */
+    void update_uuids(const std::map<std::string, std::string>& uuids) {
+        std::lock_guard <std::mutex> lock{m_mutex};
+        if (uuids.empty()) {
+            return;
+        }
+        IdPairCollection updated_data{};
+        for (const auto& entry : m_manager_data) {
+            IdPair updated_entry = entry;
+            const auto parent = uuids.find(std::get<0>(entry));
+            if (uuids.end() != parent) {
+                std::get<0>(updated_entry) = parent->second;
+            }
+            const auto child = uuids.find(std::get<1>(entry));
+            if (uuids.end() != child) {
+                std::get<1>(updated_entry) = child->second;
+            }
+            updated_data.insert(updated_data.end(), std::move(updated_entry));
+        }
+        m_manager_data.swap(updated_data);
+    }
+
+
 protected:
 
     template<unsigned P>
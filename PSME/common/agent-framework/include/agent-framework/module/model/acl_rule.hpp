@@ -124,8 +124,8 @@ public:
      *
      * @param[in] forward_mirror_port Forward/mirror port
      * */
-    void set_forward_mirror_port(const OptionalField<std::string>& forward_mirror_port ) {
-        m_forward_mirror_port = forward_mirror_port;
+    void set_forward_mirror_port(OptionalField<std::string> forward_mirror_port) {
+        m_forward_mirror_port = std::move(forward_mirror_port);
     }
 
     /*!
@@ -151,8 +151,8 @@ public:
      *
      * @param[in] mirrored_ports Mirrored ports
      * */
-    void set_mirrored_ports(const MirroredPorts& mirrored_ports) {
-        m_mirrored_ports = mirrored_ports;
+    void set_mirrored_ports(MirroredPorts mirrored_ports) {
+        m_mirrored_ports = std::move(mirrored_ports);
     }
 
     /*!
@@ -198,8 +198,8 @@ public:
      *
      * @param[in] vlan_id VLAN Id
      * */
-    void set_vlan_id(const VlanId& vlan_id) {
-        m_vlan_id = vlan_id;
+    void set_vlan_id(VlanId vlan_id) {
+        m_vlan_id = std::move(vlan_id);
     }
 
     /*!
@@ -216,8 +216,8 @@ public:
      *
      * @param[in] source_ip Source IP
      * */
-    void set_source_ip(const Ip& source_ip ) {
-        m_source_ip = source_ip;
+    void set_source_ip(Ip source_ip) {
+        m_source_ip = std::move(source_ip);
     }
 
     /*!
@@ -234,8 +234,8 @@ public:
      *
      * @param[in] destination_ip Destination IP
      * */
-    void set_destination_ip(const Ip& destination_ip ) {
-        m_destination_ip = destination_ip;
+    void set_destination_ip(Ip destination_ip) {
+        m_destination_ip = std::move(destination_ip);
     }
 
     /*!
@@ -252,8 +252,8 @@ public:
      *
      * @param[in] source_mac Source MAC
      * */
-    void set_source_mac(const Mac& source_mac ) {
-        m_source_mac = source_mac;
+    void set_source_mac(Mac source_mac) {
+        m_source_mac = std::move(source_mac);
     }
 
     /*!
@@ -270,8 +270,8 @@ public:
      *
      * @param[in] destination_mac Destination MAC
      * */
-    void set_destination_mac(const Mac& destination_mac ) {
-        m_destination_mac = destination_mac;
+    void set_destination_mac(Mac destination_mac) {
+        m_destination_mac = std::move(destination_mac);
     }
 
     /*!
@@ -288,8 +288,8 @@ public:
      *
      * @param[in] source_port Source port
      * */
-    void set_source_port(const Port& source_port ) {
-        m_source_port = source_port;
+    void set_source_port(Port source_port) {
+        m_source_port = std::move(source_port);
     }
 
     /*!
@@ -305,8 +305,8 @@ public:
      *
      * @param[in] destination_port Destination port
      * */
-    void set_destination_port(const Port& destination_port ) {
-        m_destination_port = destination_port;
+    void set_destination_port(Port destination_port) {
+        m_destination_port = std::move(destination_port);
     }
 
     /*!
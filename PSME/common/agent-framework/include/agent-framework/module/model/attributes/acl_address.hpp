@@ -70,8 +70,8 @@ public:
      *
      * @param[in] address Address.
      * */
-    void set_address(const OptionalField<std::string>& address) {
-        m_address = address;
+    void set_address(OptionalField<std::string> address) {
+        m_address = std::move(address);
     }
 
 
@@ -89,8 +89,8 @@ public:
      *
      * @param[in] mask Address mask
      * */
-    void set_mask(const OptionalField<std::string>& mask) {
-        m_mask = mask;
+    void set_mask(OptionalField<std::string> mask) {
+        m_mask = std::move(mask);
     }
 
 
@@ -27,6 +27,7 @@
 #include <vector>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 using std::string;
 
@@ -56,6 +57,12 @@ public:
      */
     Array(const ArrayObject& v) : m_array(v) { }
 
+    /*!
+     * @brief Constructor moving the vector
+     * @param[in] v vector<T>
+     */
+    Array(ArrayObject&& v) : m_array(std::move(v)) { }
+
     /*!
      * @brief Constructor from initializer list
      * @param[in] list initializer list
@@ -81,6 +88,14 @@ public:
         m_array = array;
     }
 
+    /*!
+     * @brief Sets array, the vector is moved
+     * @param array Array
+     */
+    void set_array(ArrayObject&& array) {
+        m_array = std::move(array);
+    }
+
     /*!
      * @brief Returns array
      * @return Array
@@ -97,6 +112,33 @@ public:
         m_array.emplace_back(entry);
     }
 
+    /*!
+     * @brief Moves entry to the array
+     * @param entry Entry to be added
+     */
+    void add_entry(T&& entry) {
+        m_array.emplace_back(std::move(entry));
+    }
+
+    /*!
+     * @brief Constructs entry in place at the end of the array
+     * @param args Arguments of the entry constructor
+     * @return Added entry
+     */
+    template <typename... Args>
+    T& emplace_entry(Args&&... args) {
+        m_array.emplace_back(std::forward<Args>(args)...);
+        return m_array.back();
+    }
+
+    /*!
+     * @brief Reserves memory for entries
+     * @param capacity Expected number of entries
+     */
+    void reserve(size_t capacity) {
+        m_array.reserve(capacity);
+    }
+
      /*!
       * @brief Creates array from the json object
       * @param json Json object
@@ -93,8 +93,8 @@ public:
      * @brief Set collections array entry slot mask
      * @param[in] slot_mask Entry slot mask
      */
-    void set_slot_mask(const std::string& slot_mask) {
-        m_slot_mask = slot_mask;
+    void set_slot_mask(std::string slot_mask) {
+        m_slot_mask = std::move(slot_mask);
     }
 
     /*!
@@ -118,8 +118,8 @@ public:
     * @brief Set supported types of connection (should be optional)
     * @param[in] types_supported array with supported types of connections
     */
-   void set_types_supported(const SupportedConnections& types_supported) {
-       m_types_supported = types_supported;
+   void set_types_supported(SupportedConnections types_supported) {
+       m_types_supported = std::move(types_supported);
    }
 
 private:
@@ -94,8 +94,8 @@ public:
      * @brief Sets entity
      * @param[in] entity Entity
      * */
-    void set_entity(const OptionalField<std::string>& entity) {
-        m_entity = entity;
+    void set_entity(OptionalField<std::string> entity) {
+        m_entity = std::move(entity);
     }
 
     /*
@@ -90,8 +90,8 @@ public:
      *
      * @param ip_address of type std::string
      */
-    void set_ip_address(const std::string& ip_address) {
-        m_ip_address = ip_address;
+    void set_ip_address(std::string ip_address) {
+        m_ip_address = std::move(ip_address);
     }
 
     /*!
@@ -99,8 +99,8 @@ public:
      *
      * @param username of type std::string
      */
-    void set_username(const std::string& username) {
-        m_username = username;
+    void set_username(std::string username) {
+        m_username = std::move(username);
     }
 
     /*!
@@ -108,8 +108,8 @@ public:
      *
      * @param password of type std::string
      */
-    void set_password(const std::string& password) {
-        m_password = password;
+    void set_password(std::string password) {
+        m_password = std::move(password);
     }
 
     /*!
@@ -70,8 +70,8 @@ public:
     * @brief Set vendor id for response
     * @param[in] vendor_id  Vendor id
     * */
-        void set_vendor_id(const OptionalField<std::string>& vendor_id) {
-        m_vendor_id = vendor_id;
+        void set_vendor_id(OptionalField<std::string> vendor_id) {
+        m_vendor_id = std::move(vendor_id);
     }
 
     /*!
@@ -86,8 +86,8 @@ public:
      * @brief Set numeric id for response
      * @param[in] numeric_id Numeric id
      * */
-    void set_numeric_id(const OptionalField<std::string>& numeric_id) {
-        m_numeric_id = numeric_id;
+    void set_numeric_id(OptionalField<std::string> numeric_id) {
+        m_numeric_id = std::move(numeric_id);
     }
 
     /*!
@@ -102,8 +102,8 @@ public:
      * @brief Set processor family for response
      * @param[in] family Processor family
      * */
-    void set_family(const OptionalField<std::string>& family) {
-        m_family = family;
+    void set_family(OptionalField<std::string> family) {
+        m_family = std::move(family);
     }
 
     /*!
@@ -118,8 +118,8 @@ public:
      * @brief Set processor model for response
      * @param[in] model Processor model
      * */
-    void set_model(const OptionalField<std::string>& model) {
-        m_model = model;
+    void set_model(OptionalField<std::string> model) {
+        m_model = std::move(model);
     }
 
     /*!
@@ -134,8 +134,8 @@ public:
      * @brief Set processor step for response
      * @param[in] step Processor step
      * */
-    void set_step(const OptionalField<std::string>& step) {
-        m_step = step;
+    void set_step(OptionalField<std::string> step) {
+        m_step = std::move(step);
     }
 
     /*!
@@ -150,8 +150,8 @@ public:
      * @brief Set microcode info for response
      * @param[in] microcode_info Microcode info
      * */
-    void set_microcode_info(const OptionalField<std::string>& microcode_info) {
-        m_microcode_info = microcode_info;
+    void set_microcode_info(OptionalField<std::string> microcode_info) {
+        m_microcode_info = std::move(microcode_info);
     }
 
     /*!
@@ -61,8 +61,8 @@ public:
      *
      * @param[in] serial_number serial number.
      * */
-    void set_serial_number(const OptionalField<std::string>& serial_number) {
-        m_serial_number = serial_number;
+    void set_serial_number(OptionalField<std::string> serial_number) {
+        m_serial_number = std::move(serial_number);
     }
 
     /*!
@@ -77,8 +77,8 @@ public:
      *
      * @param[in] manufacturer Manufacturer name
      * */
-    void set_manufacturer(const OptionalField<std::string>& manufacturer) {
-        m_manufacturer = manufacturer;
+    void set_manufacturer(OptionalField<std::string> manufacturer) {
+        m_manufacturer = std::move(manufacturer);
     }
 
     /*!
@@ -93,8 +93,8 @@ public:
      *
      * @param[in] model_number model number
      * */
-    void set_model_number(const OptionalField<std::string>& model_number) {
-        m_model_number = model_number;
+    void set_model_number(OptionalField<std::string> model_number) {
+        m_model_number = std::move(model_number);
     }
 
     /*!
@@ -109,8 +109,8 @@ public:
      *
      * @param[in] part_number part number
      * */
-    void set_part_number(const OptionalField<std::string>& part_number) {
-        m_part_number = part_number;
+    void set_part_number(OptionalField<std::string> part_number) {
+        m_part_number = std::move(part_number);
     }
 
     /*!
@@ -57,8 +57,8 @@ public:
      * @brief Set durable_name
      * @param durable_name durable_name
      */
-    void set_durable_name(const std::string& durable_name) {
-        m_durable_name = durable_name;
+    void set_durable_name(std::string durable_name) {
+        m_durable_name = std::move(durable_name);
     }
 
 
@@ -61,8 +61,8 @@ public:
      *
      * @param[in] address IP address.
      * */
-    void set_address(const OptionalField<std::string>& address) {
-        m_address = address;
+    void set_address(OptionalField<std::string> address) {
+        m_address = std::move(address);
     }
 
     /*!
@@ -77,8 +77,8 @@ public:
      *
      * @param[in] subnet_mask Subnet mask
      * */
-    void set_subnet_mask(const OptionalField<std::string>& subnet_mask) {
-        m_subnet_mask = subnet_mask;
+    void set_subnet_mask(OptionalField<std::string> subnet_mask) {
+        m_subnet_mask = std::move(subnet_mask);
     }
 
     /*!
@@ -109,8 +109,8 @@ public:
      *
      * @param[in] gateway Gateway.
      * */
-    void set_gateway(const OptionalField<std::string>& gateway) {
-        m_gateway = gateway;
+    void set_gateway(OptionalField<std::string> gateway) {
+        m_gateway = std::move(gateway);
     }
 
     /*!
@@ -60,8 +60,8 @@ public:
      *
      * @param[in] address IP address.
      * */
-    void set_address(const OptionalField<std::string>& address) {
-        m_address = address;
+    void set_address(OptionalField<std::string> address) {
+        m_address = std::move(address);
     }
 
     /*!
@@ -94,8 +94,8 @@ public:
      * @brief Set initiator address
      * @param[in] initiator_address the initiator IP address
      * */
-    void set_initiator_address(const std::string& initiator_address) {
-        m_initiator_address = initiator_address;
+    void set_initiator_address(std::string initiator_address) {
+        m_initiator_address = std::move(initiator_address);
     }
 
     /*!
@@ -110,8 +110,8 @@ public:
      * @brief Set initiator name
      * @param[in] initiator_name the initiator name
      * */
-    void set_initiator_name(const std::string& initiator_name) {
-        m_initiator_name = initiator_name;
+    void set_initiator_name(std::string initiator_name) {
+        m_initiator_name = std::move(initiator_name);
     }
 
     /*!
@@ -126,8 +126,8 @@ public:
      * @brief Set default gateway for initiator
      * @param[in] initiator_default_gateway the default gateway for initiator
      * */
-    void set_initiator_default_gateway(const OptionalField<std::string>& initiator_default_gateway) {
-        m_initiator_default_gateway = initiator_default_gateway;
+    void set_initiator_default_gateway(OptionalField<std::string> initiator_default_gateway) {
+        m_initiator_default_gateway = std::move(initiator_default_gateway);
     }
 
     /*!
@@ -142,8 +142,8 @@ public:
      * @brief Set the netmask for initiator
      * @param[in] initiator_netmask the netmask for initiator
      * */
-    void set_initiator_netmask(const std::string& initiator_netmask) {
-        m_initiator_netmask = initiator_netmask;
+    void set_initiator_netmask(std::string initiator_netmask) {
+        m_initiator_netmask = std::move(initiator_netmask);
     }
 
     /*!
@@ -206,8 +206,8 @@ public:
      * @brief Set primary target address
      * @param[in] primary_target_address the primary target address
      * */
-    void set_primary_target_address(const OptionalField<std::string>& primary_target_address) {
-        m_primary_target_address = primary_target_address;
+    void set_primary_target_address(OptionalField<std::string> primary_target_address) {
+        m_primary_target_address = std::move(primary_target_address);
     }
 
     /*!
@@ -222,8 +222,8 @@ public:
      * @brief Set primary_target_name
      * @param[in] primary_target_name the primary_target_name
      * */
-    void set_primary_target_name(const OptionalField<std::string>& primary_target_name) {
-        m_primary_target_name = primary_target_name;
+    void set_primary_target_name(OptionalField<std::string> primary_target_name) {
+        m_primary_target_name = std::move(primary_target_name);
     }
 
     /*!
@@ -302,8 +302,8 @@ public:
      * @brief Set primary target DNS IP address
      * @param[in] primary_dns the primary target DNS IP address
      * */
-    void set_primary_dns(const OptionalField<std::string>& primary_dns) {
-        m_primary_dns = primary_dns;
+    void set_primary_dns(OptionalField<std::string> primary_dns) {
+        m_primary_dns = std::move(primary_dns);
     }
 
     /*!
@@ -318,8 +318,8 @@ public:
      * @brief Set secondary target IP address
      * @param[in] secondary_target_address the secondary target IP address
      * */
-    void set_secondary_target_address(const OptionalField<std::string>& secondary_target_address) {
-        m_secondary_target_address = secondary_target_address;
+    void set_secondary_target_address(OptionalField<std::string> secondary_target_address) {
+        m_secondary_target_address = std::move(secondary_target_address);
     }
 
     /*!
@@ -334,8 +334,8 @@ public:
      * @brief Set secondary target name
      * @param[in] secondary_target_name the secondary target name
      * */
-    void set_secondary_target_name(const OptionalField<std::string>& secondary_target_name) {
-        m_secondary_target_name = secondary_target_name;
+    void set_secondary_target_name(OptionalField<std::string> secondary_target_name) {
+        m_secondary_target_name = std::move(secondary_target_name);
     }
 
     /*!
@@ -414,8 +414,8 @@ public:
      * @brief Set secondary target's DNS IP address
      * @param[in] secondary_dns the secondary target's DNS IP address
      * */
-    void set_secondary_dns(const OptionalField<std::string>& secondary_dns) {
-        m_secondary_dns = secondary_dns;
+    void set_secondary_dns(OptionalField<std::string> secondary_dns) {
+        m_secondary_dns = std::move(secondary_dns);
     }
 
     /*!
@@ -446,8 +446,8 @@ public:
      * @brief Set CHAP username
      * @param[in] chap_username the CHAP username
      * */
-    void set_chap_username(const OptionalField<std::string>& chap_username) {
-        m_chap_username = chap_username;
+    void set_chap_username(OptionalField<std::string> chap_username) {
+        m_chap_username = std::move(chap_username);
     }
 
     /*!
@@ -462,8 +462,8 @@ public:
      * @brief Set CHAP secret
      * @param[in] chap_secret the CHAP secret
      * */
-    void set_chap_secret(const OptionalField<std::string>& chap_secret) {
-        m_chap_secret = chap_secret;
+    void set_chap_secret(OptionalField<std::string> chap_secret) {
+        m_chap_secret = std::move(chap_secret);
     }
 
     /*!
@@ -478,8 +478,8 @@ public:
      * @brief Set CHAP username for 2-way authentication
      * @param[in] mutual_chap_username the CHAP username for 2-way authentication
      * */
-    void set_mutual_chap_username(const OptionalField<std::string>& mutual_chap_username) {
-        m_mutual_chap_username = mutual_chap_username;
+    void set_mutual_chap_username(OptionalField<std::string> mutual_chap_username) {
+        m_mutual_chap_username = std::move(mutual_chap_username);
     }
 
     /*!
@@ -494,8 +494,8 @@ public:
      * @brief Set CHAP secret for 2-way authentication
      * @param[in] mutual_chap_secret the CHAP secret for 2-way authentication
      * */
-    void set_mutual_chap_secret(const OptionalField<std::string>& mutual_chap_secret) {
-        m_mutual_chap_secret = mutual_chap_secret;
+    void set_mutual_chap_secret(OptionalField<std::string> mutual_chap_secret) {
+        m_mutual_chap_secret = std::move(mutual_chap_secret);
     }
 
 private:
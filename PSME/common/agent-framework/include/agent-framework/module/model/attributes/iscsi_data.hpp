@@ -45,8 +45,8 @@ public:
      * @brief Set portal ip
      * @param portal_ip Portal ip address
      */
-    void set_portal_ip(const std::string& portal_ip) {
-        m_portal_ip = portal_ip;
+    void set_portal_ip(std::string portal_ip) {
+        m_portal_ip = std::move(portal_ip);
     }
 
     /*!
@@ -77,16 +77,16 @@ public:
      * @brief Set initiator username
      * @param username    Username
      * */
-    void set_username(const std::string& username) {
-        m_username = username;
+    void set_username(std::string username) {
+        m_username = std::move(username);
     }
 
     /*!
      * @brief Set initiator password
      * @param password    Password
      * */
-    void set_password(const std::string& password) {
-        m_password = password;
+    void set_password(std::string password) {
+        m_password = std::move(password);
     }
 
     /*!
@@ -109,8 +109,8 @@ public:
      * @brief Set initiator
      * @param initiator initiator
      */
-    void set_initiator(const std::string& initiator) {
-        m_initiator = initiator;
+    void set_initiator(std::string initiator) {
+        m_initiator = std::move(initiator);
     }
 
     /*!
@@ -125,8 +125,8 @@ public:
      * @brief Set configuration path
      * @param conf_path configuration path, eg. /etc/tgt/conf.d/
      */
-    void set_configuration_path(const std::string& conf_path) {
-        m_conf_path = conf_path;
+    void set_configuration_path(std::string conf_path) {
+        m_conf_path = std::move(conf_path);
     }
 
     /*!
@@ -142,8 +142,8 @@ public:
      * @brief Set portal ip interface name
      * @param interface portal ip interface name, eg. eth0
      */
-    void set_portal_interface(const std::string& interface) {
-        m_portal_interface = interface;
+    void set_portal_interface(std::string interface) {
+        m_portal_interface = std::move(interface);
     }
 
 
@@ -57,8 +57,8 @@ public:
      * @brief Set info
      * @param info info
      */
-    void set_info(const std::string& info) {
-        m_info = info;
+    void set_info(std::string info) {
+        m_info = std::move(info);
     }
 
 
@@ -75,8 +75,8 @@ public:
      * @brief Set info format
      * @param info_format the format of the identifier
      */
-    void set_info_format(const std::string& info_format) {
-        m_info_format = info_format;
+    void set_info_format(std::string info_format) {
+        m_info_format = std::move(info_format);
     }
 
 
@@ -52,8 +52,8 @@ public:
      *
      * @param manager of type std::string
      */
-    void set_manager(const std::string& manager) {
-        m_manager = manager;
+    void set_manager(std::string manager) {
+        m_manager = std::move(manager);
     }
 
     /*!
@@ -72,16 +72,16 @@ public:
         return m_message_id;
     }
 
-    void set_message_id(const OptionalField<std::string>& message_id) {
-        m_message_id = message_id;
+    void set_message_id(OptionalField<std::string> message_id) {
+        m_message_id = std::move(message_id);
     }
 
     const OptionalField<std::string>& get_content() const {
         return m_message_content;
     }
 
-    void set_content(const OptionalField<std::string>& content) {
-        m_message_content = content;
+    void set_content(OptionalField<std::string> content) {
+        m_message_content = std::move(content);
     }
 
     const OptionalField<enums::Health>& get_severity() const {
@@ -96,32 +96,32 @@ public:
         return m_resolution;
     }
 
-    void set_resolution(const OptionalField<std::string>& resolution) {
-        m_resolution = resolution;
+    void set_resolution(OptionalField<std::string> resolution) {
+        m_resolution = std::move(resolution);
     }
 
     const Oem& get_oem() const {
         return m_oem;
     }
 
-    void set_oem(const Oem& oem) {
-        m_oem = oem;
+    void set_oem(Oem oem) {
+        m_oem = std::move(oem);
     }
 
     const RelatedProperties& get_related_properties() const {
         return m_related_properties;
     }
 
-    void set_related_properties(const RelatedProperties& related_properties) {
-        m_related_properties = related_properties;
+    void set_related_properties(RelatedProperties related_properties) {
+        m_related_properties = std::move(related_properties);
     }
 
     const MessageArgs& get_message_args() const {
         return m_message_args;
     }
 
-    void set_message_args(const MessageArgs& message_args) {
-        m_message_args = message_args;
+    void set_message_args(MessageArgs message_args) {
+        m_message_args = std::move(message_args);
     }
 
 private:
@@ -56,8 +56,8 @@ public:
      * @brief Set switch identifier
      * @param[in] switch_identifier Switch identifier
      * */
-    void set_switch_identifier(const OptionalField<std::string>& switch_identifier) {
-        m_switch_identifier = switch_identifier;
+    void set_switch_identifier(OptionalField<std::string> switch_identifier) {
+        m_switch_identifier = std::move(switch_identifier);
     }
 
     /*!
@@ -71,8 +71,8 @@ public:
      * @brief Set port identifier
      * @param[in] port_identifier Port identifier
      * */
-    void set_port_identifier(const OptionalField<std::string>& port_identifier) {
-        m_port_identifier = port_identifier;
+    void set_port_identifier(OptionalField<std::string> port_identifier) {
+        m_port_identifier = std::move(port_identifier);
     }
 
     /*!
@@ -86,8 +86,8 @@ public:
      * @brief Set cable id
      * @param[in] cable_id Cable ID
      * */
-    void set_cable_id(const OptionalField<std::string>& cable_id) {
-        m_cable_id = cable_id;
+    void set_cable_id(OptionalField<std::string> cable_id) {
+        m_cable_id = std::move(cable_id);
     }
 
     /*!
@@ -96,8 +96,8 @@ public:
      *
      * @param[in] ipv4_address IPv4 address
      * */
-    void set_ipv4_address(const String& ipv4_address) {
-        m_ipv4_address = ipv4_address;
+    void set_ipv4_address(String ipv4_address) {
+        m_ipv4_address = std::move(ipv4_address);
     }
 
     /*!
@@ -112,8 +112,8 @@ public:
      *
      * @param[in] ipv6_address IPv4 address
      * */
-    void set_ipv6_address(const String& ipv6_address) {
-        m_ipv6_address = ipv6_address;
+    void set_ipv6_address(String ipv6_address) {
+        m_ipv6_address = std::move(ipv6_address);
     }
 
     /*!
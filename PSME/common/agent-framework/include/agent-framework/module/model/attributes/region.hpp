@@ -60,8 +60,8 @@ public:
      * @brief Sets region id
      * @param[in] region_id Region ID
      * */
-    void set_region_id(const OptionalField<std::string>& region_id) {
-        m_region_id = region_id;
+    void set_region_id(OptionalField<std::string> region_id) {
+        m_region_id = std::move(region_id);
     }
 
     /*!
@@ -79,8 +79,8 @@ public:
      * @brief Set result message
      * @param[in] message Result message
      * */
-    void set_message(const std::string& message) {
-        m_message = message;
+    void set_message(std::string message) {
+        m_message = std::move(message);
     }
 
     /*!
@@ -95,8 +95,8 @@ public:
      * @brief Set attribute name
      * @param[in] attribute Attribute name
      * */
-    void set_attribute(const std::string& attribute) {
-        m_attribute = attribute;
+    void set_attribute(std::string attribute) {
+        m_attribute = std::move(attribute);
     }
 
     /*!
@@ -48,8 +48,8 @@ public:
     SubcomponentEntry(SubcomponentEntry&&) = default;
     SubcomponentEntry& operator=(SubcomponentEntry&&) = default;
 
-    void set_subcomponent(const std::string& subcomponent) {
-        m_subcomponent = subcomponent;
+    void set_subcomponent(std::string subcomponent) {
+        m_subcomponent = std::move(subcomponent);
     }
 
     /*!
@@ -72,8 +72,8 @@ public:
      *
      * @param logical_drive of type std::string
      */
-    void set_logical_drive(const std::string& logical_drive) {
-        m_logical_drive = logical_drive;
+    void set_logical_drive(std::string logical_drive) {
+        m_logical_drive = std::move(logical_drive);
     }
 
 
@@ -64,8 +64,8 @@ public:
      *
      * @param[in] task_uuid Task UUID
      * */
-    void set_task(const std::string& task_uuid) {
-        m_task_uuid = task_uuid;
+    void set_task(std::string task_uuid) {
+        m_task_uuid = std::move(task_uuid);
     }
 
 
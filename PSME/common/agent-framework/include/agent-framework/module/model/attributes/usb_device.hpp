@@ -56,8 +56,8 @@ public:
      *
      * @param vendor_id String with 4 digit hex number
      * */
-    void set_vendor_id(const std::string& vendor_id) {
-        m_vendor_id = vendor_id;
+    void set_vendor_id(std::string vendor_id) {
+        m_vendor_id = std::move(vendor_id);
     }
 
     /*!
@@ -74,8 +74,8 @@ public:
      *
      * @param device_id String with 4 digit hex number
      * */
-    void set_device_id(const std::string& device_id) {
-        m_device_id = device_id;
+    void set_device_id(std::string device_id) {
+        m_device_id = std::move(device_id);
     }
 
     /*!
@@ -85,8 +85,8 @@ public:
      *
      * @param[in] certificate certificate as base64 encoded string
      * */
-    void set_certificate(const std::string& certificate) {
-        m_certificate = certificate;
+    void set_certificate(std::string certificate) {
+        m_certificate = std::move(certificate);
     }
 
     /*!
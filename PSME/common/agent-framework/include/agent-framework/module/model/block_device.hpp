@@ -64,8 +64,8 @@ public:
      * @brief Get device path
      * @param[in] device_path Device path
      * */
-    void set_device_path(const OptionalField<std::string>& device_path) {
-        m_device_path = device_path;
+    void set_device_path(OptionalField<std::string> device_path) {
+        m_device_path = std::move(device_path);
     }
 private:
     std::string m_device_type{};
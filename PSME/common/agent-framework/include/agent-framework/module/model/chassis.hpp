@@ -125,8 +125,8 @@ public:
      * @brief Set parent id from optional string
      * @param[in] parent_id Parent id
      * */
-    void set_parent_id(const std::string& parent_id) {
-        m_parent_id = parent_id;
+    void set_parent_id(std::string parent_id) {
+        m_parent_id = std::move(parent_id);
     }
 
     /*!
@@ -165,8 +165,8 @@ public:
      * @brief Set Thermal zone structure
      * @param[in] thermal_zone system thermal zone
      * */
-    void set_thermal_zone(const OptionalField<std::string>& thermal_zone) {
-        m_thermal_zone = thermal_zone;
+    void set_thermal_zone(OptionalField<std::string> thermal_zone) {
+        m_thermal_zone = std::move(thermal_zone);
     }
 
     /*!
@@ -181,16 +181,16 @@ public:
      * @brief Set Power zone structure
      * @param[in] power_zone system power zone
      * */
-    void set_power_zone(const OptionalField<std::string>& power_zone) {
-        m_power_zone = power_zone;
+    void set_power_zone(OptionalField<std::string> power_zone) {
+        m_power_zone = std::move(power_zone);
     }
 
     /*!
      * @brief Set FRUInfo structure
      * @param[in] fru_info system FRUInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
@@ -229,8 +229,8 @@ public:
      * @brief Set network interface name
      * @param[in] interface Network interface name
      * */
-    void set_network_interface(const OptionalField<std::string>& interface) {
-        m_network_interface = interface;
+    void set_network_interface(OptionalField<std::string> interface) {
+        m_network_interface = std::move(interface);
     }
 
     /*!
@@ -245,8 +245,8 @@ public:
      * @brief Set SKU
      * @param[in] sku SKU
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
     /*!
@@ -261,8 +261,8 @@ public:
      * @brief Set Asset Tag
      * @param[in] asset_tag Asset Tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
     /*!
@@ -68,6 +68,14 @@ public:
     Json::Value to_json() const;
 
 
+    /*!
+     * @brief transform the object to JSon in place
+     *
+     * @param[out] json Value the object is serialized to, may be reused
+     */
+    void to_json(Json::Value& json) const;
+
+
     /*!
      * @brief construct an object of class Drive from JSON
      *
@@ -99,8 +107,8 @@ public:
      *
      * @param physical_id Drive physical location
      * */
-    void set_physical_id(const OptionalField<std::string>& physical_id) {
-        m_physical_id = physical_id;
+    void set_physical_id(OptionalField<std::string> physical_id) {
+        m_physical_id = std::move(physical_id);
     }
 
 
@@ -118,8 +126,8 @@ public:
      * @brief Set firmware version
      * @param firmware_version firmware version of the drive
      * */
-    void set_firmware_version(const OptionalField<std::string>& firmware_version) {
-        m_firmware_version = firmware_version;
+    void set_firmware_version(OptionalField<std::string> firmware_version) {
+        m_firmware_version = std::move(firmware_version);
     }
 
 
@@ -143,8 +151,8 @@ public:
      * Sets FRU info
      * @param[in] fru_info FRU info
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
 
@@ -233,8 +241,8 @@ public:
      *
      * @param asset_tag Drive's asset tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
 
@@ -304,8 +312,8 @@ public:
      *
      * @param locations of type Locations
      */
-    void set_locations(const Locations& locations) {
-        m_locations = locations;
+    void set_locations(Locations locations) {
+        m_locations = std::move(locations);
     }
 
 
@@ -330,8 +338,8 @@ public:
      *
      * @param revision Drive's revision
      * */
-    void set_revision(const OptionalField<std::string>& revision) {
-        m_revision = revision;
+    void set_revision(OptionalField<std::string> revision) {
+        m_revision = std::move(revision);
     }
 
 
@@ -370,8 +378,8 @@ public:
      *
      * @param sku Drive's sku
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
 
@@ -399,8 +407,8 @@ public:
      *
      * @param identifier a Identifier to add
      */
-    void add_identifier(const attribute::Identifier& identifier) {
-        m_identifiers.add_entry(identifier);
+    void add_identifier(attribute::Identifier identifier) {
+        m_identifiers.add_entry(std::move(identifier));
     }
 
 
@@ -409,8 +417,8 @@ public:
      *
      * @param identifiers of type Identifiers
      */
-    void set_identifiers(const Identifiers& identifiers) {
-        m_identifiers = identifiers;
+    void set_identifiers(Identifiers identifiers) {
+        m_identifiers = std::move(identifiers);
     }
 
 
@@ -584,8 +592,8 @@ public:
      * @brief Set dsp port uuids
      * @param[in] dsp_port_uuids Dsp port uuids
      */
-    void set_dsp_port_uuids(const std::vector<std::string>& dsp_port_uuids) {
-        m_dsp_port_uuids = dsp_port_uuids;
+    void set_dsp_port_uuids(std::vector<std::string> dsp_port_uuids) {
+        m_dsp_port_uuids = std::move(dsp_port_uuids);
     }
 
     /*!
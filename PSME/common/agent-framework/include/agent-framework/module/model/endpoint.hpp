@@ -101,8 +101,8 @@ public:
      * @brief Set connected entities
      * @param[in] connected_entities Connected Entities
      */
-    void set_connected_entities(const ConnectedEntities& connected_entities) {
-        m_connected_entities = connected_entities;
+    void set_connected_entities(ConnectedEntities connected_entities) {
+        m_connected_entities = std::move(connected_entities);
     }
 
     /*!
@@ -126,8 +126,8 @@ public:
      * @brief Set storage controller's identifiers
      * @param[in] identifiers array with storage controller's identifiers
      */
-    void set_identifiers(const Identifiers& identifiers) {
-        m_identifiers = identifiers;
+    void set_identifiers(Identifiers identifiers) {
+        m_identifiers = std::move(identifiers);
     }
 
 
@@ -135,8 +135,8 @@ public:
      * @brief Add device identifier
      * @param[in] identifier supported type of identifier
      */
-    void add_identifier(const attribute::Identifier& identifier) {
-        m_identifiers.add_entry(identifier);
+    void add_identifier(attribute::Identifier identifier) {
+        m_identifiers.add_entry(std::move(identifier));
     }
 
     /*!
@@ -77,8 +77,8 @@ public:
      * @brief Set switch identifier
      * @param[in] switch_identifier switch identifier string
      * */
-    void set_switch_identifier(const OptionalField<std::string>& switch_identifier) {
-        m_switch_identifier = switch_identifier;
+    void set_switch_identifier(OptionalField<std::string> switch_identifier) {
+        m_switch_identifier = std::move(switch_identifier);
     }
 
     /*!
@@ -93,8 +93,8 @@ public:
      * @brief Set mac address
      * @param[in] mac_address switch mac address
      * */
-    void set_mac_address(const OptionalField<std::string>& mac_address) {
-        m_mac_address = mac_address;
+    void set_mac_address(OptionalField<std::string> mac_address) {
+        m_mac_address = std::move(mac_address);
     }
 
     /*!
@@ -127,8 +127,8 @@ public:
      *
      * @param fru_info of type attribute::FruInfo
      */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
@@ -162,8 +162,8 @@ public:
      *
      * @param chassis of type std::string
      */
-    void set_chassis(const OptionalField<std::string>& chassis) {
-        m_chassis = chassis;
+    void set_chassis(OptionalField<std::string> chassis) {
+        m_chassis = std::move(chassis);
     }
 
     /*!
@@ -182,8 +182,8 @@ public:
      *
      * @param firmware_name firmware name to set or NIL to remove
      */
-    void set_firmware_name(const OptionalField<std::string>& firmware_name) {
-        m_firmware_name = firmware_name;
+    void set_firmware_name(OptionalField<std::string> firmware_name) {
+        m_firmware_name = std::move(firmware_name);
     }
     /*!
      * @brief Getter for firmware name
@@ -200,8 +200,8 @@ public:
      *
      * @param firmware_version firmware version to set or NIL to remove
      */
-    void set_firmware_version(const OptionalField<std::string>& firmware_version) {
-        m_firmware_version = firmware_version;
+    void set_firmware_version(OptionalField<std::string> firmware_version) {
+        m_firmware_version = std::move(firmware_version);
     }
     /*!
      * @brief Getter for firmware version
@@ -235,8 +235,8 @@ public:
      *
      * @param manufacturing_date manufacturing date to set or NIL to remove
      */
-    void set_manufacturing_date(const OptionalField<std::string>& manufacturing_date) {
-        m_manufacturing_date = manufacturing_date;
+    void set_manufacturing_date(OptionalField<std::string> manufacturing_date) {
+        m_manufacturing_date = std::move(manufacturing_date);
     }
     /*!
      * @brief Getter for manufacturing date
@@ -57,6 +57,14 @@ public:
      */
     Json::Value to_json() const;
 
+
+    /*!
+     * @brief transform the object to JSon in place
+     *
+     * @param[out] json Value the object is serialized to, may be reused
+     */
+    void to_json(Json::Value& json) const;
+
     /*!
      * @brief Get collection name
      * @return collection name
@@ -77,8 +85,8 @@ public:
      * @brief Set port identifier
      * @param[in] port_identifier switch port identifier
      * */
-    void set_port_identifier(const OptionalField<std::string>& port_identifier) {
-        m_port_identifier = port_identifier;
+    void set_port_identifier(OptionalField<std::string> port_identifier) {
+        m_port_identifier = std::move(port_identifier);
     }
 
     /*!
@@ -352,8 +360,8 @@ public:
      * @brief Set mac address
      * @param[in] mac_address switch port mac address
      * */
-    void set_mac_address(const OptionalField<std::string>& mac_address) {
-        m_mac_address = mac_address;
+    void set_mac_address(OptionalField<std::string> mac_address) {
+        m_mac_address = std::move(mac_address);
     }
 
     /*!
@@ -368,8 +376,8 @@ public:
      * @brief Set ipv4 address
      * @param[in] ipv4_address switch port ipv4 address
      * */
-    void set_ipv4_address(const attribute::Ipv4Address& ipv4_address) {
-        m_ipv4_address = ipv4_address;
+    void set_ipv4_address(attribute::Ipv4Address ipv4_address) {
+        m_ipv4_address = std::move(ipv4_address);
     }
 
     /*!
@@ -384,8 +392,8 @@ public:
      * @brief Set ipv6 address
      * @param[in] ipv6_address switch port ipv6 address
      * */
-    void set_ipv6_address(const attribute::Ipv6Address& ipv6_address) {
-        m_ipv6_address = ipv6_address;
+    void set_ipv6_address(attribute::Ipv6Address ipv6_address) {
+        m_ipv6_address = std::move(ipv6_address);
     }
 
     /*!
@@ -408,16 +416,16 @@ public:
      * @brief Set neighbor info
      * @param[in] neighbor_info neighbor info
      * */
-    void set_neighbor_info(const attribute::NeighborInfo& neighbor_info) {
-        m_neighbor_info = neighbor_info;
+    void set_neighbor_info(attribute::NeighborInfo neighbor_info) {
+        m_neighbor_info = std::move(neighbor_info);
     }
 
     /*!
      * @brief Set neighbor mac
      * @param[in] neighbor_mac switch port neighbor mac
      * */
-    void set_neighbor_mac(const OptionalField<std::string>& neighbor_mac) {
-        m_neighbor_mac = neighbor_mac;
+    void set_neighbor_mac(OptionalField<std::string> neighbor_mac) {
+        m_neighbor_mac = std::move(neighbor_mac);
     }
 
     /*!
@@ -448,8 +456,8 @@ public:
      * @brief Set default vlan
      * @param[in] default_vlan switch port default vlan
      * */
-    void set_default_vlan(const OptionalField<std::string>& default_vlan) {
-        m_default_vlan = default_vlan;
+    void set_default_vlan(OptionalField<std::string> default_vlan) {
+        m_default_vlan = std::move(default_vlan);
     }
 
     /*!
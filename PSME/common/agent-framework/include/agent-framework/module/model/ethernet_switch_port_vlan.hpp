@@ -91,8 +91,8 @@ public:
      * @brief Sets EthernetSwitchPortVlan name
      * @param[in] port_vlan_name  EthernetSwitchPortVlan name
      * */
-    void set_vlan_name(const OptionalField<std::string>& port_vlan_name) {
-        m_vlan_name = port_vlan_name;
+    void set_vlan_name(OptionalField<std::string> port_vlan_name) {
+        m_vlan_name = std::move(port_vlan_name);
     }
 
     /*!
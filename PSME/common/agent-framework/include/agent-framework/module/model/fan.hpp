@@ -141,8 +141,8 @@ public:
      *
      * @param fru_info of type attribute::FruInfo
      */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
 private:
@@ -89,8 +89,8 @@ public:
      *
      * @param initiator_iqn of type string
      */
-    void set_initiator_iqn(const OptionalField<string>& initiator_iqn) {
-        m_initiator_iqn = initiator_iqn;
+    void set_initiator_iqn(OptionalField<string> initiator_iqn) {
+        m_initiator_iqn = std::move(initiator_iqn);
     }
 
     /*!
@@ -107,8 +107,8 @@ public:
      *
      * @param target_address of type string
      */
-    void set_target_address(const OptionalField<string>& target_address) {
-        m_target_address = target_address;
+    void set_target_address(OptionalField<string> target_address) {
+        m_target_address = std::move(target_address);
     }
 
     /*!
@@ -125,8 +125,8 @@ public:
      *
      * @param target_port of type string
      */
-    void set_target_port(const OptionalField<string>& target_port) {
-        m_target_port = target_port;
+    void set_target_port(OptionalField<string> target_port) {
+        m_target_port = std::move(target_port);
     }
 
     /*!
@@ -143,8 +143,8 @@ public:
      *
      * @param target_iqn of type string
      */
-    void set_target_iqn(const OptionalField<string>& target_iqn) {
-        m_target_iqn = target_iqn;
+    void set_target_iqn(OptionalField<string> target_iqn) {
+        m_target_iqn = std::move(target_iqn);
     }
 
     /*!
@@ -161,8 +161,8 @@ public:
      *
      * @param target_lun of type TargetLuns
      */
-    void set_target_lun(const TargetLuns& target_lun) {
-        m_target_lun = target_lun;
+    void set_target_lun(TargetLuns target_lun) {
+        m_target_lun = std::move(target_lun);
     }
 
     /*!
@@ -208,8 +208,8 @@ public:
      *
      * @param authentication_method of type string
      */
-    void set_authentication_method(const OptionalField<string>& authentication_method) {
-        m_authentication_method = authentication_method;
+    void set_authentication_method(OptionalField<string> authentication_method) {
+        m_authentication_method = std::move(authentication_method);
     }
 
     /*!
@@ -226,8 +226,8 @@ public:
      *
      * @param chap_username of type string
      */
-    void set_chap_username(const OptionalField<string>& chap_username) {
-        m_chap_username = chap_username;
+    void set_chap_username(OptionalField<string> chap_username) {
+        m_chap_username = std::move(chap_username);
     }
 
     /*!
@@ -244,8 +244,8 @@ public:
      *
      * @param chap_secret of type string
      */
-    void set_chap_secret(const OptionalField<string>& chap_secret) {
-        m_chap_secret = chap_secret;
+    void set_chap_secret(OptionalField<string> chap_secret) {
+        m_chap_secret = std::move(chap_secret);
     }
 
     /*!
@@ -262,8 +262,8 @@ public:
      *
      * @param mutual_chap_username of type string
      */
-    void set_mutual_chap_username(const OptionalField<string>& mutual_chap_username) {
-        m_mutual_chap_username = mutual_chap_username;
+    void set_mutual_chap_username(OptionalField<string> mutual_chap_username) {
+        m_mutual_chap_username = std::move(mutual_chap_username);
     }
 
     /*!
@@ -280,8 +280,8 @@ public:
      *
      * @param mutual_chap_secret of type string
      */
-    void set_mutual_chap_secret(const OptionalField<string>& mutual_chap_secret) {
-        m_mutual_chap_secret = mutual_chap_secret;
+    void set_mutual_chap_secret(OptionalField<string> mutual_chap_secret) {
+        m_mutual_chap_secret = std::move(mutual_chap_secret);
     }
 
 private:
@@ -172,8 +172,8 @@ public:
      *
      * @param[in] logical_drive_master LogicalDrive master drive uuid
      * */
-    void set_master(const OptionalField<std::string>& logical_drive_master) {
-        m_master = logical_drive_master;
+    void set_master(OptionalField<std::string> logical_drive_master) {
+        m_master = std::move(logical_drive_master);
     }
 
 
@@ -192,8 +192,8 @@ public:
      *
      * @param[in] logical_drive_image LogicalDrive image info
      * */
-    void set_image(const OptionalField<std::string>& logical_drive_image) {
-        m_image = logical_drive_image;
+    void set_image(OptionalField<std::string> logical_drive_image) {
+        m_image = std::move(logical_drive_image);
     }
 
 
@@ -108,8 +108,8 @@ public:
      * @brief Set serial console
      * @param[in] serial_console Manager serial console
      * */
-    void set_serial_console(const attribute::SerialConsole& serial_console) {
-        m_serial_console = serial_console;
+    void set_serial_console(attribute::SerialConsole serial_console) {
+        m_serial_console = std::move(serial_console);
     }
 
 
@@ -126,8 +126,8 @@ public:
      * @brief Set connection data
      * @param[in] connection_data Manager connection data
      * */
-    void set_connection_data(const attribute::ConnectionData& connection_data) {
-        m_connection_data = connection_data;
+    void set_connection_data(attribute::ConnectionData connection_data) {
+        m_connection_data = std::move(connection_data);
     }
 
 
@@ -145,8 +145,8 @@ public:
      *
      * @param network_services of type NetworkServices
      */
-    void set_network_services(const NetworkServices& network_services) {
-        m_network_services = network_services;
+    void set_network_services(NetworkServices network_services) {
+        m_network_services = std::move(network_services);
     }
 
 
@@ -164,8 +164,8 @@ public:
      * @brief Set firmware version
      * @param[in] firmware_version Manager firmeware version
      * */
-    void set_firmware_version(const OptionalField<std::string>& firmware_version) {
-        m_firmware_version = firmware_version;
+    void set_firmware_version(OptionalField<std::string> firmware_version) {
+        m_firmware_version = std::move(firmware_version);
     }
 
 
@@ -182,8 +182,8 @@ public:
      * @brief Set IPv4 address
      * @param[in] ipv4_address Manager IPv4 address
      * */
-    void set_ipv4_address(const OptionalField<std::string>& ipv4_address) {
-        m_ipv4_address = ipv4_address;
+    void set_ipv4_address(OptionalField<std::string> ipv4_address) {
+        m_ipv4_address = std::move(ipv4_address);
     }
 
 
@@ -218,8 +218,8 @@ public:
     * @brief Set Manager GUID
     * @param[in] guid Manager GUID
     * */
-    void set_guid(const OptionalField<std::string>& guid) {
-        m_guid = guid;
+    void set_guid(OptionalField<std::string> guid) {
+        m_guid = std::move(guid);
     }
 
 
@@ -280,8 +280,8 @@ public:
      * @brief Set manager model (optional)
      * @param[in] manager_model manager model or NIL to remove value
      */
-    void set_manager_model(const OptionalField<std::string>& manager_model) {
-        m_model = manager_model;
+    void set_manager_model(OptionalField<std::string> manager_model) {
+        m_model = std::move(manager_model);
     }
 
 
@@ -298,8 +298,8 @@ public:
      * @brief Set UUID of the chassis being a manager’s physical location (optional)
      * @param[in] location parent location or NIL to remove value
      */
-    void set_location(const OptionalField<std::string>& location) {
-        m_location = location;
+    void set_location(OptionalField<std::string> location) {
+        m_location = std::move(location);
     }
 
 
@@ -316,8 +316,8 @@ public:
      * @brief Set the DateTime on the manager
      * @param[in] date_time the DateTime to set on the manager
      */
-    void set_date_time(const OptionalField<std::string>& date_time) {
-        m_date_time = date_time;
+    void set_date_time(OptionalField<std::string> date_time) {
+        m_date_time = std::move(date_time);
     }
 
 
@@ -334,8 +334,8 @@ public:
      * @brief Set the DateTime offset for the manager's locale
      * @param[in] date_time_local_offset the new locale offset for the manager
      */
-    void set_date_time_local_offset(const OptionalField<std::string>& date_time_local_offset) {
-        m_date_time_local_offset = date_time_local_offset;
+    void set_date_time_local_offset(OptionalField<std::string> date_time_local_offset) {
+        m_date_time_local_offset = std::move(date_time_local_offset);
     }
 
 
@@ -352,8 +352,8 @@ public:
      * @brief Set graphical console (obligatory)
      * @param[in] graphical_console Manager graphical console
      * */
-    void set_graphical_console(const attribute::GraphicalConsole& graphical_console) {
-        m_graphical_console = graphical_console;
+    void set_graphical_console(attribute::GraphicalConsole graphical_console) {
+        m_graphical_console = std::move(graphical_console);
     }
 
 
@@ -370,8 +370,8 @@ public:
      * @brief Set command shell (obligatory)
      * @param[in] command_shell command shell to be set
      * */
-    void set_command_shell(const attribute::CommandShell& command_shell) {
-        m_command_shell = command_shell;
+    void set_command_shell(attribute::CommandShell command_shell) {
+        m_command_shell = std::move(command_shell);
     }
 
     /*!
@@ -379,8 +379,8 @@ public:
      *
      * @param[in] port Switch port identifier.
      * */
-    void set_switch_port_identifier(const std::string& port) {
-        m_switch_port_identifier = port;
+    void set_switch_port_identifier(std::string port) {
+        m_switch_port_identifier = std::move(port);
     }
 
     /*!
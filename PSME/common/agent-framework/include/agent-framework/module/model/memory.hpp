@@ -133,8 +133,8 @@ public:
      * @brief Set media
      * @param[in] media  media array
      * */
-    void set_media(const attribute::Array<enums::Media>& media) {
-        m_media = media;
+    void set_media(attribute::Array<enums::Media> media) {
+        m_media = std::move(media);
     }
 
     /*!
@@ -157,8 +157,8 @@ public:
      * @brief Set memory modes
      * @param[in] memory_modes memory modes array
      * */
-    void set_memory_modes(const attribute::Array<enums::MemoryMode>& memory_modes) {
-        m_memory_modes = memory_modes;
+    void set_memory_modes(attribute::Array<enums::MemoryMode> memory_modes) {
+        m_memory_modes = std::move(memory_modes);
     }
 
     /*!
@@ -220,8 +220,8 @@ public:
      * @brief Set FruInfo for response
      * @param[in] fru_info FruInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
@@ -236,8 +236,8 @@ public:
      * @brief Set firmware revision
      * @param[in] firmware_revision firmware revision
      * */
-    void set_firmware_revision(const OptionalField<std::string>& firmware_revision) {
-        m_firmware_revision = firmware_revision;
+    void set_firmware_revision(OptionalField<std::string> firmware_revision) {
+        m_firmware_revision = std::move(firmware_revision);
     }
 
     /*!
@@ -252,8 +252,8 @@ public:
      * @brief Set firmware API version
      * @param[in] firmware_api_version firmware version
      * */
-    void set_firmware_api_version(const OptionalField<std::string>& firmware_api_version) {
-        m_firmware_api_version = firmware_api_version;
+    void set_firmware_api_version(OptionalField<std::string> firmware_api_version) {
+        m_firmware_api_version = std::move(firmware_api_version);
     }
 
     /*!
@@ -276,8 +276,8 @@ public:
      * @brief Set memory classes
      * @param[in] memory_classes memory classes array
      * */
-    void set_memory_classes(const attribute::Array<enums::MemoryClass>& memory_classes) {
-        m_memory_classes = memory_classes;
+    void set_memory_classes(attribute::Array<enums::MemoryClass> memory_classes) {
+        m_memory_classes = std::move(memory_classes);
     }
 
     /*!
@@ -292,9 +292,8 @@ public:
      * @brief Set vendor ID
      * @param[in] vendor_id vendor ID
      * */
-    void set_vendor_id(const OptionalField<std::string>&
-        vendor_id) {
-        m_vendor_id= vendor_id;
+    void set_vendor_id(OptionalField<std::string> vendor_id) {
+        m_vendor_id = std::move(vendor_id);
     }
 
     /*!
@@ -309,9 +308,8 @@ public:
      * @brief Set device ID
      * @param[in] device_id device ID
      * */
-    void set_device_id(const OptionalField<std::string>&
-        device_id) {
-        m_device_id= device_id;
+    void set_device_id(OptionalField<std::string> device_id) {
+        m_device_id = std::move(device_id);
     }
 
     /*!
@@ -350,8 +348,8 @@ public:
      * @brief Set memory allowed speeds in Mhz
      * @param[in] speeds memory allowed speeds in MHz array
      * */
-    void set_allowed_speeds_mhz(const attribute::Array<std::uint32_t>& speeds) {
-        m_allowed_speeds_mhz = speeds;
+    void set_allowed_speeds_mhz(attribute::Array<std::uint32_t> speeds) {
+        m_allowed_speeds_mhz = std::move(speeds);
     }
 
     /*!
@@ -416,8 +414,8 @@ public:
      * @brief Set device locator
      * @param[in] device_locator device locator (DIMM, SODIMM, ...)
      * */
-    void set_device_locator(const OptionalField<std::string>& device_locator) {
-        m_device_locator = device_locator;
+    void set_device_locator(OptionalField<std::string> device_locator) {
+        m_device_locator = std::move(device_locator);
     }
 
     /*!
@@ -432,8 +430,8 @@ public:
      * @brief Set memory location
      * @param[in] location memory location
      * */
-    void set_location(const attribute::MemoryLocation& location) {
-        m_location = location;
+    void set_location(attribute::MemoryLocation location) {
+        m_location = std::move(location);
     }
 
     /*!
@@ -489,8 +487,8 @@ public:
      * @brief Set regions
      * @param[in] regions memory regions
      * */
-    void set_regions(const attribute::Array<attribute::Region>& regions) {
-        m_regions = regions;
+    void set_regions(attribute::Array<attribute::Region> regions) {
+        m_regions = std::move(regions);
     }
 
     /*!
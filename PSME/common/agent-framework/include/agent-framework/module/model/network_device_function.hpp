@@ -110,8 +110,8 @@ public:
      * @brief Set the MAC address of the network device
      * @param[in] mac_address the the MAC address of the network device
      * */
-    void set_mac_address(const OptionalField<std::string>& mac_address) {
-        m_mac_address = mac_address;
+    void set_mac_address(OptionalField<std::string> mac_address) {
+        m_mac_address = std::move(mac_address);
     }
 
     /*!
@@ -126,8 +126,8 @@ public:
      * @brief Set the object containing iSCSI boot parameters
      * @param[in] iscsi_boot the the object containing iSCSI boot parameters
      * */
-    void set_iscsi_boot(const attribute::IscsiBoot& iscsi_boot) {
-        m_iscsi_boot = iscsi_boot;
+    void set_iscsi_boot(attribute::IscsiBoot iscsi_boot) {
+        m_iscsi_boot = std::move(iscsi_boot);
     }
 
 
@@ -162,8 +162,8 @@ public:
      * @brief Sets MAC address
      * @param[in] mac_address MAC address
      * */
-    void set_mac_address(const OptionalField<std::string>& mac_address) {
-        m_mac_address = mac_address;
+    void set_mac_address(OptionalField<std::string> mac_address) {
+        m_mac_address = std::move(mac_address);
     }
 
     /*!
@@ -178,8 +178,8 @@ public:
      * @brief Sets MAC address
      * @param[in] factory_mac_address factory MAC address
      * */
-    void set_factory_mac_address(const OptionalField<std::string>& factory_mac_address) {
-        m_factory_mac_address = factory_mac_address;
+    void set_factory_mac_address(OptionalField<std::string> factory_mac_address) {
+        m_factory_mac_address = std::move(factory_mac_address);
     }
 
     /*!
@@ -218,8 +218,8 @@ public:
      * @brief Set Ipv4 addresses
      * @param[in] ip_addresses Ipv4 addresses
      * */
-    void set_ipv4_addresses(const Ipv4Addresses& ip_addresses) {
-        m_ipv4_addresses = ip_addresses;
+    void set_ipv4_addresses(Ipv4Addresses ip_addresses) {
+        m_ipv4_addresses = std::move(ip_addresses);
     }
 
     /*!
@@ -242,8 +242,8 @@ public:
      * @brief Set Ipv6 addresses
      * @param[in] ip_address Ipv6 addresses
      * */
-    void set_ipv6_addresses(const Ipv6Addresses& ip_address) {
-        m_ipv6_addresses = ip_address;
+    void set_ipv6_addresses(Ipv6Addresses ip_address) {
+        m_ipv6_addresses = std::move(ip_address);
     }
 
     /*!
@@ -268,8 +268,8 @@ public:
      *
      * @param ipv6_default_gateway of type std::string
      */
-    void set_ipv6_default_gateway(const OptionalField<std::string>& ipv6_default_gateway) {
-        m_ipv6_default_gateway = ipv6_default_gateway;
+    void set_ipv6_default_gateway(OptionalField<std::string> ipv6_default_gateway) {
+        m_ipv6_default_gateway = std::move(ipv6_default_gateway);
     }
 
     /*!
@@ -81,8 +81,8 @@ public:
      * @brief Set FruInfo structure
      * @param[in] fru_info FruInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
@@ -97,8 +97,8 @@ public:
      * @brief Set device identifier
      * @param[in] device_id Switch identifier
      * */
-    void set_device_id(const OptionalField<std::string>& device_id) {
-        m_device_id = device_id;
+    void set_device_id(OptionalField<std::string> device_id) {
+        m_device_id = std::move(device_id);
     }
 
     /*!
@@ -201,8 +201,8 @@ public:
      * @brief Set firmware version
      * @param[in] firmware_version Firmware version
      * */
-    void set_firmware_version(const OptionalField<std::string>& firmware_version) {
-        m_firmware_version = firmware_version;
+    void set_firmware_version(OptionalField<std::string> firmware_version) {
+        m_firmware_version = std::move(firmware_version);
     }
 
     /*!
@@ -217,8 +217,8 @@ public:
      * @brief Set chassis
      * @param[in] chassis Chassis
      * */
-    void set_chassis(const OptionalField<std::string>& chassis) {
-        m_chassis = chassis;
+    void set_chassis(OptionalField<std::string> chassis) {
+        m_chassis = std::move(chassis);
     }
 
     /*!
@@ -233,8 +233,8 @@ public:
      * @brief Set chassis
      * @param[in] asset_tag Asset tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
     /*!
@@ -249,8 +249,8 @@ public:
      * @brief Set sku
      * @param[in] sku Sku
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
 private:
@@ -79,8 +79,8 @@ public:
      * @brief Set FunctionId
      * @param[in] function_id FunctionId
      * */
-    void set_function_id(const OptionalField<std::string>& function_id) {
-        m_function_id = function_id;
+    void set_function_id(OptionalField<std::string> function_id) {
+        m_function_id = std::move(function_id);
     }
 
     /*!
@@ -103,56 +103,56 @@ public:
      * @brief Set PCI Device Id
      * @param[in] pci_device_id PCI Device Id
      * */
-    void set_pci_device_id(const OptionalField<std::string>& pci_device_id) {
-        m_pci_device_id = pci_device_id;
+    void set_pci_device_id(OptionalField<std::string> pci_device_id) {
+        m_pci_device_id = std::move(pci_device_id);
     }
 
     /*!
      * @brief Set PCI Vendor Id
      * @param[in] pci_vendor_id PCI Vendor Id
      * */
-    void set_pci_vendor_id(const OptionalField<std::string>& pci_vendor_id) {
-        m_pci_vendor_id = pci_vendor_id;
+    void set_pci_vendor_id(OptionalField<std::string> pci_vendor_id) {
+        m_pci_vendor_id = std::move(pci_vendor_id);
     }
 
     /*!
      * @brief Set PCI Class Code
      * @param[in] pci_class_code PCI Class Code
      * */
-    void set_pci_class_code(const OptionalField<std::string>& pci_class_code) {
-        m_pci_class_code = pci_class_code;
+    void set_pci_class_code(OptionalField<std::string> pci_class_code) {
+        m_pci_class_code = std::move(pci_class_code);
     }
 
     /*!
      * @brief Set PCI Revision Id
      * @param[in] pci_revision_id PCI Revision Id
      * */
-    void set_pci_revision_id(const OptionalField<std::string>& pci_revision_id) {
-        m_pci_revision_id = pci_revision_id;
+    void set_pci_revision_id(OptionalField<std::string> pci_revision_id) {
+        m_pci_revision_id = std::move(pci_revision_id);
     }
 
     /*!
      * @brief Set PCI Subsystem Id
      * @param[in] pci_subsystem_id PCI Subsystem Id
      * */
-    void set_pci_subsystem_id(const OptionalField<std::string>& pci_subsystem_id) {
-        m_pci_subsystem_id = pci_subsystem_id;
+    void set_pci_subsystem_id(OptionalField<std::string> pci_subsystem_id) {
+        m_pci_subsystem_id = std::move(pci_subsystem_id);
     }
 
     /*!
      * @brief Set PCI Subsystem Vendor Id
      * @param[in] pci_subsystem_vendor_id PCI Subsystem Vendor Id
      * */
-    void set_pci_subsystem_vendor_id(const OptionalField<std::string>& pci_subsystem_vendor_id) {
-        m_pci_subsystem_vendor_id = pci_subsystem_vendor_id;
+    void set_pci_subsystem_vendor_id(OptionalField<std::string> pci_subsystem_vendor_id) {
+        m_pci_subsystem_vendor_id = std::move(pci_subsystem_vendor_id);
     }
 
     /*!
      * @brief Set functional device
      * @param[in] functional_device Functional device
      * */
-    void set_functional_device(const OptionalField<std::string>& functional_device) {
-        m_functional_device = functional_device;
+    void set_functional_device(OptionalField<std::string> functional_device) {
+        m_functional_device = std::move(functional_device);
     }
 
     /*!
@@ -247,8 +247,8 @@ public:
      * @brief Set downstream port uuid
      * @param[in] dsp_port_uuid Downstream port uuid
      * */
-    void set_dsp_port_uuid(const std::string& dsp_port_uuid) {
-        m_dsp_port_uuid = dsp_port_uuid;
+    void set_dsp_port_uuid(std::string dsp_port_uuid) {
+        m_dsp_port_uuid = std::move(dsp_port_uuid);
     }
 
 private:
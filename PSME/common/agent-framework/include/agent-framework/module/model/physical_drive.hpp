@@ -83,8 +83,8 @@ public:
      * Sets FRU info
      * @param[in] fru_info FRU info
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
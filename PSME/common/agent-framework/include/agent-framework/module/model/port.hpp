@@ -74,6 +74,12 @@ public:
      * */
     Json::Value to_json() const;
 
+    /*!
+     * @brief Writes JSON representation of the object to given value.
+     * @param[out] json Value reused for serialization of many objects.
+     * */
+    void to_json(Json::Value& json) const;
+
     /*!
      * @brief Constructs object from JSON
      * @param[in] json the Json::Value deserialized to object
@@ -85,8 +91,8 @@ public:
      * @brief Set PortId
      * @param[in] port_id PortId
      * */
-    void set_port_id(const OptionalField<std::string>& port_id) {
-        m_port_id = port_id;
+    void set_port_id(OptionalField<std::string> port_id) {
+        m_port_id = std::move(port_id);
     }
 
     /*!
@@ -101,8 +107,8 @@ public:
      * @brief Set cables ids structure
      * @param[in] cables_ids Cables ids
      * */
-    void set_cables_ids(const CablesIds& cables_ids) {
-        m_cables_ids = cables_ids;
+    void set_cables_ids(CablesIds cables_ids) {
+        m_cables_ids = std::move(cables_ids);
     }
 
     /*!
@@ -285,8 +291,8 @@ public:
      * @brief Sets list of all allowed actions on the port
      * @param allowed_actions List of allowed actions
      */
-    void set_allowed_actions(const AllowedActions& allowed_actions) {
-        m_allowed_actions = allowed_actions;
+    void set_allowed_actions(AllowedActions allowed_actions) {
+        m_allowed_actions = std::move(allowed_actions);
     }
 
     /*!
@@ -182,8 +182,8 @@ public:
      * @brief Set socket ("CPU 1", ...)
      * @param[in] socket Socket
      * */
-    void set_socket(const OptionalField<std::string>& socket) {
-        m_socket = socket;
+    void set_socket(OptionalField<std::string> socket) {
+        m_socket = std::move(socket);
     }
 
     /*!
@@ -214,8 +214,8 @@ public:
      * @brief Set manufacturer
      * @param[in] manufacturer Manufacturer
      * */
-    void set_manufacturer(const OptionalField<std::string>& manufacturer) {
-        m_manufacturer = manufacturer;
+    void set_manufacturer(OptionalField<std::string> manufacturer) {
+        m_manufacturer = std::move(manufacturer);
     }
 
     /*!
@@ -230,8 +230,8 @@ public:
      * @brief Set model name
      * @param[in] model_name Model name
      * */
-    void set_model_name(const OptionalField<std::string>& model_name) {
-        m_model_name = model_name;
+    void set_model_name(OptionalField<std::string> model_name) {
+        m_model_name = std::move(model_name);
     }
 
     /*!
@@ -278,8 +278,8 @@ public:
      * @brief Set CPUID for response
      * @param cpu_id CPUID object
      * */
-    void set_cpu_id(const attribute::CpuId& cpu_id) {
-        m_cpu_id = cpu_id;
+    void set_cpu_id(attribute::CpuId cpu_id) {
+        m_cpu_id = std::move(cpu_id);
     }
 
     /*!
@@ -287,8 +287,8 @@ public:
      *
      * @param capabilities Vector of capabilities
      * */
-    void set_capabilities(const Capabilities& capabilities) {
-        m_capabilities = capabilities;
+    void set_capabilities(Capabilities capabilities) {
+        m_capabilities = std::move(capabilities);
     }
 
     /*!
@@ -76,8 +76,8 @@ public:
      * @brief Set switch identifier
      * @param[in] switch_identifier switch identifier string
      * */
-    void set_switch_identifier(const OptionalField<std::string>& switch_identifier) {
-        m_switch_identifier = switch_identifier;
+    void set_switch_identifier(OptionalField<std::string> switch_identifier) {
+        m_switch_identifier = std::move(switch_identifier);
     }
 
     /*!
@@ -92,8 +92,8 @@ public:
      * @brief Set mac address
      * @param[in] mac_address switch mac address
      * */
-    void set_mac_address(const OptionalField<std::string>& mac_address) {
-        m_mac_address = mac_address;
+    void set_mac_address(OptionalField<std::string> mac_address) {
+        m_mac_address = std::move(mac_address);
     }
 
     /*!
@@ -108,8 +108,8 @@ public:
      * @brief Set next hop
      * @param[in] next_hop Array of next hop objects
      * */
-    void set_next_hop(const types::Array<attribute::NextHop>& next_hop) {
-        m_next_hop = next_hop;
+    void set_next_hop(types::Array<attribute::NextHop> next_hop) {
+        m_next_hop = std::move(next_hop);
     }
 
     /*!
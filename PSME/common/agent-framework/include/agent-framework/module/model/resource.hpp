@@ -78,9 +78,9 @@ public:
     }
 
 
-    void set_uuid(const std::string& uuid) {
+    void set_uuid(std::string uuid) {
         m_is_uuid_persistent = false;
-        m_temporary_uuid = uuid;
+        m_temporary_uuid = std::move(uuid);
     }
 
     const std::string& get_temporary_uuid() const {
@@ -126,8 +126,8 @@ public:
      *
      * @param[in] in_key Value of the unique key
      * */
-    void set_unique_key(const OptionalField<std::string>& in_key) {
-        m_unique_key = in_key;
+    void set_unique_key(OptionalField<std::string> in_key) {
+        m_unique_key = std::move(in_key);
     }
 
 
@@ -146,8 +146,8 @@ public:
      *
      * @param[in] parent Parent UUID
      * */
-    void set_parent_uuid(const std::string& parent) {
-        m_parent_uuid = parent;
+    void set_parent_uuid(std::string parent) {
+        m_parent_uuid = std::move(parent);
     }
 
 
@@ -186,8 +186,8 @@ public:
      *
      * @param[in] status Resource's status
      * */
-    void set_status(const attribute::Status& status) {
-        m_status = status;
+    void set_status(attribute::Status status) {
+        m_status = std::move(status);
     }
 
 
@@ -206,8 +206,8 @@ public:
      *
      * @param[in] collections subcomponents collection
      */
-    void set_collections(const Collections& collections) {
-        m_collections = collections;
+    void set_collections(Collections collections) {
+        m_collections = std::move(collections);
     }
 
 
@@ -216,8 +216,8 @@ public:
      *
      * @param[in] collection subcomponent collection
      */
-    void add_collection(const attribute::Collection& collection) {
-        m_collections.add_entry(collection);
+    void add_collection(attribute::Collection collection) {
+        m_collections.add_entry(std::move(collection));
     }
 
 
@@ -226,8 +226,8 @@ public:
      *
      * @param oem Oem data
      * */
-    void set_oem(const attribute::Oem& oem) {
-        m_oem = oem;
+    void set_oem(attribute::Oem oem) {
+        m_oem = std::move(oem);
     }
 
 
@@ -285,8 +285,8 @@ public:
      *
      * @param agent_id the resource agent_id as assigned by REST application
      */
-    void set_agent_id(const std::string& agent_id) {
-        m_agent_id = agent_id;
+    void set_agent_id(std::string agent_id) {
+        m_agent_id = std::move(agent_id);
     }
 
 
@@ -80,8 +80,8 @@ public:
      *
      * @param[in] address MAC address
      * */
-    void set_address(const OptionalField<std::string>& address) {
-        m_address = address;
+    void set_address(OptionalField<std::string> address) {
+        m_address = std::move(address);
     }
 
     /*!
@@ -102,8 +102,8 @@ public:
      *
      * @param physical_id bus type and location
      * */
-    void set_physical_id(const OptionalField<std::string>& physical_id) {
-        m_physical_id = physical_id;
+    void set_physical_id(OptionalField<std::string> physical_id) {
+        m_physical_id = std::move(physical_id);
     }
 
 
@@ -128,8 +128,8 @@ public:
      * @brief Set fru info
      * @param[in] fru_info FruInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
 
@@ -138,8 +138,8 @@ public:
      *
      * @param asset_tag storage controller's asset tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
 
@@ -158,8 +158,8 @@ public:
      *
      * @param sku storage controller's sku
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
 
@@ -178,8 +178,8 @@ public:
      *
      * @param firmware_version storage controller's firmware version
      * */
-    void set_firmware_version(const OptionalField<std::string>& firmware_version) {
-        m_firmware_version = firmware_version;
+    void set_firmware_version(OptionalField<std::string> firmware_version) {
+        m_firmware_version = std::move(firmware_version);
     }
 
 
@@ -226,8 +226,8 @@ public:
      * @brief Set supported controller storage protocols
      * @param[in] supported_controller_protocols array with supported types of storage protocols
      */
-    void set_supported_controller_protocols(const StorageProtocols& supported_controller_protocols) {
-        m_supported_controller_protocols = supported_controller_protocols;
+    void set_supported_controller_protocols(StorageProtocols supported_controller_protocols) {
+        m_supported_controller_protocols = std::move(supported_controller_protocols);
     }
 
 
@@ -253,8 +253,8 @@ public:
      * @brief Set supported device storage protocols
      * @param[in] supported_device_protocols array with supported types of storage protocols
      */
-    void set_supported_device_protocols(const StorageProtocols& supported_device_protocols) {
-        m_supported_device_protocols = supported_device_protocols;
+    void set_supported_device_protocols(StorageProtocols supported_device_protocols) {
+        m_supported_device_protocols = std::move(supported_device_protocols);
     }
 
 
@@ -280,8 +280,8 @@ public:
      * @brief Set storage controller's identifiers
      * @param[in] identifiers array with storage controller's identifiers
      */
-    void set_identifiers(const Identifiers& identifiers) {
-        m_identifiers = identifiers;
+    void set_identifiers(Identifiers identifiers) {
+        m_identifiers = std::move(identifiers);
     }
 
 
@@ -289,8 +289,8 @@ public:
      * @brief Add device identifier
      * @param[in] identifier supported type of identifier
      */
-    void add_identifier(const attribute::Identifier& identifier) {
-        m_identifiers.add_entry(identifier);
+    void add_identifier(attribute::Identifier identifier) {
+        m_identifiers.add_entry(std::move(identifier));
     }
 
 private:
@@ -82,8 +82,8 @@ public:
      * @brief Set FruInfo structure
      * @param[in] fru_info FruInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
     /*!
@@ -98,8 +98,8 @@ public:
      * @brief Set switch identifier
      * @param[in] switch_id Switch identifier
      * */
-    void set_switch_id(const OptionalField<std::string>& switch_id) {
-        m_switch_id = switch_id;
+    void set_switch_id(OptionalField<std::string> switch_id) {
+        m_switch_id = std::move(switch_id);
     }
 
     /*!
@@ -114,8 +114,8 @@ public:
      * @brief Set sku
      * @param[in] sku sku
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
     /*!
@@ -130,8 +130,8 @@ public:
      * @brief Set asset tag
      * @param[in] asset_tag asset tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
     /*!
@@ -146,8 +146,8 @@ public:
      * @brief Set chassis
      * @param[in] chassis chassis
      * */
-    void set_chassis(const OptionalField<std::string>& chassis) {
-        m_chassis = chassis;
+    void set_chassis(OptionalField<std::string> chassis) {
+        m_chassis = std::move(chassis);
     }
 
     /*!
@@ -162,8 +162,8 @@ public:
      * @brief Set memory path
      * @param[in] memory_path Memory Path
      */
-    void set_memory_path(const std::string& memory_path) {
-        m_memory_path = memory_path;
+    void set_memory_path(std::string memory_path) {
+        m_memory_path = std::move(memory_path);
     }
 
     /*!
@@ -178,8 +178,8 @@ public:
      * @brief Set bridge device path
      * @param[in] bridge_path Bridge device path
      */
-    void set_bridge_path(const std::string& bridge_path) {
-        m_bridge_path = bridge_path;
+    void set_bridge_path(std::string bridge_path) {
+        m_bridge_path = std::move(bridge_path);
     }
 
     /*!
@@ -266,8 +266,8 @@ public:
      * @brief Sets list of all allowed actions on the switch
      * @param allowed_actions List of allowed actions
      */
-    void set_allowed_actions(const AllowedActions& allowed_actions) {
-        m_allowed_actions = allowed_actions;
+    void set_allowed_actions(AllowedActions allowed_actions) {
+        m_allowed_actions = std::move(allowed_actions);
     }
 
     /*!
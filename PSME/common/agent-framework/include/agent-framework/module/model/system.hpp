@@ -81,6 +81,14 @@ public:
     Json::Value to_json() const;
 
 
+    /*!
+     * @brief transform the object to JSon in place
+     *
+     * @param[out] json Value the object is serialized to, may be reused
+     */
+    void to_json(Json::Value& json) const;
+
+
     /*!
      * @brief Get collection name
      * @return collection name
@@ -103,8 +111,8 @@ public:
      * @brief Set bios version
      * @param[in] bios_version blade bios version
      * */
-    void set_bios_version(const OptionalField<std::string>& bios_version) {
-        m_bios_version = bios_version;
+    void set_bios_version(OptionalField<std::string> bios_version) {
+        m_bios_version = std::move(bios_version);
     }
 
 
@@ -175,8 +183,8 @@ public:
      * @brief Set boot override supported
      * @param[in] boot_override_supported blade boot override supported
      * */
-    void set_boot_override_supported(const BootOverrideSupported& boot_override_supported) {
-        m_boot_override_supported = boot_override_supported;
+    void set_boot_override_supported(BootOverrideSupported boot_override_supported) {
+        m_boot_override_supported = std::move(boot_override_supported);
     }
 
 
@@ -202,8 +210,8 @@ public:
      * @brief Set uefi target
      * @param[in] uefi_target blade uefi target
      * */
-    void set_uefi_target(const OptionalField<std::string>& uefi_target) {
-        m_uefi_target = uefi_target;
+    void set_uefi_target(OptionalField<std::string> uefi_target) {
+        m_uefi_target = std::move(uefi_target);
     }
 
 
@@ -229,8 +237,8 @@ public:
      * @brief Set FRUInfo structure
      * @param[in] fru_info blade FRUInfo
      * */
-    void set_fru_info(const attribute::FruInfo& fru_info) {
-        m_fru_info = fru_info;
+    void set_fru_info(attribute::FruInfo fru_info) {
+        m_fru_info = std::move(fru_info);
     }
 
 
@@ -256,8 +264,8 @@ public:
      * @brief Set stock keeping unit
      * @param[in] sku stock keeping unit
      * */
-    void set_sku(const OptionalField<std::string>& sku) {
-        m_sku = sku;
+    void set_sku(OptionalField<std::string> sku) {
+        m_sku = std::move(sku);
     }
 
 
@@ -274,8 +282,8 @@ public:
      * @brief Set asset tag
      * @param[in] asset_tag asset tag
      * */
-    void set_asset_tag(const OptionalField<std::string>& asset_tag) {
-        m_asset_tag = asset_tag;
+    void set_asset_tag(OptionalField<std::string> asset_tag) {
+        m_asset_tag = std::move(asset_tag);
     }
 
 
@@ -330,8 +338,8 @@ public:
      *
      * @param chassis of type std::string
      */
-    void set_chassis(const OptionalField<std::string>& chassis) {
-        m_chassis = chassis;
+    void set_chassis(OptionalField<std::string> chassis) {
+        m_chassis = std::move(chassis);
     }
 
 
@@ -350,8 +358,8 @@ public:
      *
      * @param pci_devices of type PciDevices
      */
-    void set_pci_devices(const PciDevices& pci_devices) {
-        m_pci_devices = pci_devices;
+    void set_pci_devices(PciDevices pci_devices) {
+        m_pci_devices = std::move(pci_devices);
     }
 
 
@@ -390,8 +398,8 @@ public:
      *
      * @param usb_devices of type UsbDevices
      */
-    void set_usb_devices(const UsbDevices& usb_devices) {
-        m_usb_devices = usb_devices;
+    void set_usb_devices(UsbDevices usb_devices) {
+        m_usb_devices = std::move(usb_devices);
     }
 
 
@@ -418,8 +426,8 @@ public:
      * @brief sets connection data
      * @param connection_data connection data
      */
-    void set_connection_data(const attribute::ConnectionData& connection_data) {
-        m_connection_data = connection_data;
+    void set_connection_data(attribute::ConnectionData connection_data) {
+        m_connection_data = std::move(connection_data);
     }
 
 
@@ -427,8 +435,8 @@ public:
      * @brief Set System GUID
      * @param[in] guid System GUID
      * */
-    void set_guid(const OptionalField<std::string>& guid) {
-        m_guid = guid;
+    void set_guid(OptionalField<std::string> guid) {
+        m_guid = std::move(guid);
     }
 
 
@@ -444,8 +452,8 @@ public:
      * @brief Set Cable IDs
      * @param[in] cable_ids Cable IDs
      * */
-    void set_cable_ids(const CableIds& cable_ids) {
-        m_cable_ids = cable_ids;
+    void set_cable_ids(CableIds cable_ids) {
+        m_cable_ids = std::move(cable_ids);
     }
 
     /*!
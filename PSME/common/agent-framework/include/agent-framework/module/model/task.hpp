@@ -158,8 +158,8 @@ public:
      *
      * @param[in] name Task name
      * */
-    void set_name(const OptionalField<std::string>& name) {
-        m_name = name;
+    void set_name(OptionalField<std::string> name) {
+        m_name = std::move(name);
     }
 
 
@@ -218,8 +218,8 @@ public:
      *
      * @param[in] messages Array object containing task messages
      * */
-    void set_messages(const Messages& messages) {
-        m_messages = messages;
+    void set_messages(Messages messages) {
+        m_messages = std::move(messages);
     }
 
 
@@ -251,8 +251,8 @@ public:
     }
 
 
-    void set_completion_notifiers(const CompletionNotifiers& notifiers) {
-        m_completion_notifiers = notifiers;
+    void set_completion_notifiers(CompletionNotifiers notifiers) {
+        m_completion_notifiers = std::move(notifiers);
     }
 
 
@@ -272,13 +272,13 @@ public:
 
 
 protected:
-    void set_start_time(const OptionalField<std::string>& start_time) {
-        m_start_time = start_time;
+    void set_start_time(OptionalField<std::string> start_time) {
+        m_start_time = std::move(start_time);
     }
 
 
-    void set_end_time(const OptionalField<std::string>& end_time) {
-        m_end_time = end_time;
+    void set_end_time(OptionalField<std::string> end_time) {
+        m_end_time = std::move(end_time);
     }
 
 
@@ -91,8 +91,8 @@ public:
      * @brief Sets Vlan name
      * @param[in] vlan_name  Vlan name
      * */
-    void set_vlan_name(const OptionalField<std::string>& vlan_name) {
-        m_vlan_name = vlan_name;
+    void set_vlan_name(OptionalField<std::string> vlan_name) {
+        m_vlan_name = std::move(vlan_name);
     }
 
     /*!
@@ -122,8 +122,8 @@ public:
      * @brief Sets switch uuid
      * @param[in] switch_uuid switch uuid
      * */
-    void set_switch_uuid(const std::string& switch_uuid) {
-        m_switch_uuid = switch_uuid;
+    void set_switch_uuid(std::string switch_uuid) {
+        m_switch_uuid = std::move(switch_uuid);
     }
 
 private:
@@ -0,0 +1,244 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json_fields.hpp
+ * @brief Table driven conversion of model objects to/from Json::Value
+ *
+ * Each model class describes its fields with JSON_FIELD entries (JSON key,
+ * getter and setter). Types of the getter and the setter are checked at compile
+ * time and select the conversion of the value:
+ * - framework objects (attributes, arrays) use their to_json()/from_json(),
+ * - framework enums are converted to/from strings,
+ * - other values (OptionalFields, strings) are converted by Json::Value.
+ * */
+
+#pragma once
+
+#include "agent-framework/module/utils/is_framework_enum.hpp"
+#include "agent-framework/module/utils/is_framework_object.hpp"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace agent_framework {
+namespace model {
+namespace utils {
+
+/*! Conversion of field values, selected by type traits of the value */
+template <typename V, typename Enable = void>
+struct JsonFieldValue {
+    static void write(const V& value, Json::Value& json) {
+        json = value;
+    }
+
+    static V read(const Json::Value& json) {
+        return V(json);
+    }
+};
+
+/*! Conversion of framework objects */
+template <typename V>
+struct JsonFieldValue<V, typename std::enable_if<is_framework_object<V>::value>::type> {
+    static void write(const V& value, Json::Value& json) {
+        json = value.to_json();
+    }
+
+    static V read(const Json::Value& json) {
+        return V::from_json(json);
+    }
+};
+
+/*! Conversion of framework enums */
+template <typename V>
+struct JsonFieldValue<V, typename std::enable_if<is_framework_enum<V>::value>::type> {
+    static void write(const V& value, Json::Value& json) {
+        json = value.to_string();
+    }
+
+    static V read(const Json::Value& json) {
+        return V::from_string(json.asString());
+    }
+};
+
+/*! Type of the value returned by a getter */
+template <typename Getter>
+struct JsonFieldGetter;
+
+template <typename C, typename R>
+struct JsonFieldGetter<R (C::*)() const> {
+    using value_type = typename std::decay<R>::type;
+};
+
+/*! Type of the value taken by a setter */
+template <typename Setter>
+struct JsonFieldSetter;
+
+template <typename C, typename A>
+struct JsonFieldSetter<void (C::*)(A)> {
+    using value_type = typename std::decay<A>::type;
+};
+
+/*!
+ * @brief Table of JSON fields of a model class
+ *
+ * Used as a function local static object of the model class.
+ * */
+template <typename T>
+class JsonFields final {
+public:
+    /*! Maximal number of fields of a class */
+    static constexpr std::size_t MAX_FIELDS = 64;
+
+    using Writer = void (*)(const T&, Json::Value&);
+    using Reader = void (*)(T&, const Json::Value&);
+
+    /*! Field descriptor, created by JSON_FIELD macro */
+    struct Field {
+        const char* name;
+        Writer write;
+        Reader read;
+    };
+
+    /*!
+     * @brief Creates table of fields
+     * @param[in] fields Descriptors of fields
+     * */
+    JsonFields(std::initializer_list<Field> fields) : m_fields(fields) {
+        if (m_fields.size() > MAX_FIELDS) {
+            throw std::logic_error("Too many JSON fields");
+        }
+        for (std::size_t index = 0; index < m_fields.size(); ++index) {
+            m_index.push_back(index);
+        }
+        std::sort(m_index.begin(), m_index.end(), [this](std::size_t lhs, std::size_t rhs) {
+            return std::strcmp(m_fields[lhs].name, m_fields[rhs].name) < 0;
+        });
+        for (std::size_t position = 1; position < m_index.size(); ++position) {
+            if (0 == std::strcmp(m_fields[m_index[position - 1]].name, m_fields[m_index[position]].name)) {
+                throw std::logic_error(std::string("Duplicated JSON field: ") + m_fields[m_index[position]].name);
+            }
+        }
+    }
+
+    /*!
+     * @brief Writes fields of the object
+     *
+     * Members of a value reused for many objects are overwritten in place.
+     * @param[in] object Object to be serialized
+     * @param[out] json Object value the fields are written to
+     * */
+    void to_json(const T& object, Json::Value& json) const {
+        for (const auto& field : m_fields) {
+            field.write(object, json[field.name]);
+        }
+    }
+
+    /*!
+     * @brief Reads fields of the object in a single pass over members of the value
+     *
+     * Fields missing in the value are read from null value.
+     * @param[in] json Object value
+     * @param[out] object Object to be deserialized
+     * */
+    void from_json(const Json::Value& json, T& object) const {
+        const Json::Value null_value{};
+        std::bitset<MAX_FIELDS> read_fields{};
+        if (json.isObject()) {
+            for (auto it = json.begin(); it != json.end(); ++it) {
+                const char* end{nullptr};
+                const char* name = it.memberName(&end);
+                const auto index = find(name, std::size_t(end - name));
+                if (index < m_fields.size()) {
+                    m_fields[index].read(object, *it);
+                    read_fields.set(index);
+                }
+            }
+        }
+        for (std::size_t index = 0; index < m_fields.size(); ++index) {
+            if (!read_fields.test(index)) {
+                m_fields[index].read(object, null_value);
+            }
+        }
+    }
+
+private:
+    /*! Compares name of the field with the key of given length */
+    static int compare(const char* name, const char* key, std::size_t length) {
+        const int result = std::strncmp(name, key, length);
+        if (0 != result) {
+            return result;
+        }
+        return '\0' == name[length] ? 0 : 1;
+    }
+
+    std::size_t find(const char* key, std::size_t length) const {
+        const auto it = std::lower_bound(m_index.begin(), m_index.end(), key,
+            [this, length](std::size_t index, const char* value) {
+                return compare(m_fields[index].name, value, length) < 0;
+            });
+        if (m_index.end() != it && 0 == compare(m_fields[*it].name, key, length)) {
+            return *it;
+        }
+        return m_fields.size();
+    }
+
+    std::vector<Field> m_fields;
+    /*! Positions of fields sorted by names */
+    std::vector<std::size_t> m_index{};
+};
+
+/*!
+ * @brief Creates field descriptor
+ *
+ * Types of the getter and the setter must match and select the conversion.
+ * */
+template <typename T, typename Getter, Getter getter, typename Setter, Setter setter>
+typename JsonFields<T>::Field make_json_field(const char* name) {
+    using Value = typename JsonFieldGetter<Getter>::value_type;
+    static_assert(std::is_same<Value, typename JsonFieldSetter<Setter>::value_type>::value,
+                  "Getter and setter of JSON field use different types");
+    return {
+        name,
+        [](const T& object, Json::Value& json) { JsonFieldValue<Value>::write((object.*getter)(), json); },
+        [](T& object, const Json::Value& json) { (object.*setter)(JsonFieldValue<Value>::read(json)); }
+    };
+}
+
+}
+}
+}
+
+/*!
+ * @brief Descriptor of JSON field of model class
+ * @param Class Model class
+ * @param key JSON key
+ * @param name Name of the field, get_<name> and set_<name> methods are used
+ * */
+#define JSON_FIELD(Class, key, name)                                          \
+    ::agent_framework::model::utils::make_json_field<Class,                   \
+        decltype(&Class::get_ ## name), &Class::get_ ## name,                 \
+        decltype(&Class::set_ ## name), &Class::set_ ## name>(key)
@@ -74,6 +74,13 @@ public:
     template<typename V>
     OptionalField(const V& in_value) : optional<T>(T(in_value)) {}
 
+    /*!
+     * @brief Constructor moving the value into OptionalField object
+     *
+     * @param[in] in_value Value moved into OptionalField object
+     * */
+    OptionalField(T&& in_value) : optional<T>(std::move(in_value)) {}
+
     /*!
      * @brief Json::Value to OptionalField conversion constructor
      * */
@@ -104,6 +111,16 @@ public:
         return *this;
     }
 
+    /*!
+     * @brief Move assignment of the value
+     *
+     * @param[in] rhs Value moved into OptionalField object
+     * */
+    OptionalField& operator=(T&& rhs) {
+        if(!(this->has_value()) || rhs != *this) { optional<T>::operator=(std::move(rhs)); }
+        return *this;
+    }
+
     /*!
      * @brief ObjectField to Json::Value conversion operator
      * */
@@ -24,7 +24,7 @@ namespace jsonrpc {
 /*! @brief Enum validity checker */
 class EnumValidityChecker final : public ValidityChecker {
     using is_allowable_value_t = bool (*)(const std::string&);
-    using get_values_t = std::vector<std::string> (*)();
+    using get_values_t = const std::vector<std::string>& (*)();
 
 public:
     EnumValidityChecker(va_list args);
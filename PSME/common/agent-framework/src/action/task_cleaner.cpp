@@ -0,0 +1,112 @@
+/*!
+ * @brief Implementation of TaskCleaner class
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file task_cleaner.cpp
+ * */
+
+#include "agent-framework/action/task_cleaner.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/eventing/event_data.hpp"
+#include "agent-framework/eventing/events_queue.hpp"
+#include "logger/logger_factory.hpp"
+#include "json/json.hpp"
+
+#include <thread>
+
+
+
+namespace agent_framework {
+namespace action {
+
+constexpr std::chrono::seconds::rep TaskCleaner::DEFAULT_INTERVAL_SEC;
+
+
+TaskCleaner::TaskCleaner(const json::Value& configuration) {
+    const auto& tasks = configuration["tasks"];
+    if (!tasks.is_object()) {
+        return;
+    }
+
+    try {
+        auto policy = TaskResultManager::get_instance()->get_retention_policy();
+        if (tasks["maxCount"].is_uint()) {
+            policy.max_count = tasks["maxCount"].as_uint();
+        }
+        if (tasks["maxAge"].is_uint()) {
+            policy.max_age = std::chrono::seconds{tasks["maxAge"].as_uint()};
+        }
+        if (tasks["cleanupInterval"].is_uint() && 0 != tasks["cleanupInterval"].as_uint()) {
+            m_interval = std::chrono::seconds{tasks["cleanupInterval"].as_uint()};
+        }
+        TaskResultManager::get_instance()->set_retention_policy(policy);
+    }
+    catch (const json::Value::Exception& e) {
+        log_error(GET_LOGGER("agent"), "Cannot parse tasks settings " << e.what());
+    }
+}
+
+
+TaskCleaner::~TaskCleaner() {
+    stop();
+}
+
+
+std::size_t TaskCleaner::remove_outdated_tasks() {
+    auto& task_manager = module::CommonComponents::get_instance()->get_task_manager();
+    const auto removed = TaskResultManager::get_instance()->remove_outdated();
+
+    for (const auto& uuid : removed) {
+        task_manager.remove_entry(uuid);
+
+        eventing::EventData edat{};
+        edat.set_component(uuid);
+        edat.set_type(model::enums::Component::Task);
+        edat.set_notification(eventing::Notification::Remove);
+        eventing::EventsQueue::get_instance()->push_back(edat);
+    }
+
+    if (!removed.empty()) {
+        log_debug(GET_LOGGER("agent"), "Removed " << removed.size() << " outdated tasks");
+    }
+    return removed.size();
+}
+
+
+void TaskCleaner::execute() {
+    auto next_cleanup = std::chrono::steady_clock::now() + m_interval;
+    while (is_running()) {
+        // Sleep in short periods to let stop() return quickly
+        std::this_thread::sleep_for(std::chrono::seconds{1});
+        if (std::chrono::steady_clock::now() < next_cleanup) {
+            continue;
+        }
+        try {
+            remove_outdated_tasks();
+        }
+        catch (const std::exception& e) {
+            log_error(GET_LOGGER("agent"), "Cannot remove outdated tasks: " << e.what());
+        }
+        next_cleanup = std::chrono::steady_clock::now() + m_interval;
+    }
+}
+
+}
+}
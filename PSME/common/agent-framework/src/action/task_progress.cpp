@@ -0,0 +1,60 @@
+/*!
+ * @brief Implementation of task progress reporting
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file task_progress.cpp
+ * */
+
+#include "agent-framework/action/task_progress.hpp"
+#include "agent-framework/module/managers/utils/manager_utils.hpp"
+#include "agent-framework/eventing/event_data.hpp"
+#include "agent-framework/eventing/events_queue.hpp"
+
+
+
+namespace agent_framework {
+namespace action {
+
+void update_task_progress(const std::string& task_uuid, std::uint32_t percent) {
+    if (percent > 100) {
+        percent = 100;
+    }
+
+    {
+        auto task = module::get_manager<model::Task>().get_entry_reference(task_uuid);
+        model::Task::Messages messages{
+            model::attribute::Message{"TaskEvent.1.0.TaskProgressChanged",
+                                      "The task has changed to progress " + std::to_string(percent) +
+                                      " percent complete.",
+                                      model::enums::Health::OK, "None", model::attribute::Oem{},
+                                      model::attribute::Message::RelatedProperties{},
+                                      model::attribute::Message::MessageArgs{task_uuid, std::to_string(percent)}}};
+        task->set_messages(messages);
+    }
+
+    eventing::EventData edat{};
+    edat.set_component(task_uuid);
+    edat.set_type(model::enums::Component::Task);
+    edat.set_notification(eventing::Notification::Update);
+    eventing::EventsQueue::get_instance()->push_back(edat);
+}
+
+}
+}
@@ -34,16 +34,21 @@ namespace action {
 TaskResultManager::~TaskResultManager() { }
 
 
+constexpr std::size_t TaskResultManager::DEFAULT_MAX_COUNT;
+constexpr std::chrono::seconds::rep TaskResultManager::DEFAULT_MAX_AGE_SEC;
+
+
 const Json::Value TaskResultManager::get_result(const std::string& task_uuid) {
     std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
 
     // Verify that a given task exists and throw an exception if there is no such task
-    if (!task_exists(task_uuid)) {
+    const auto it = m_results.find(task_uuid);
+    if (m_results.end() == it) {
         THROW(agent_framework::exceptions::InvalidUuid, "action",
               "Cannot find requested task in the task manager.");
     }
 
-    TaskResultValue result_value = m_results.at(task_uuid);
+    const TaskResultValue& result_value = it->second.value;
 
     // Check if error flag is set; if so throw the corresponding exception object, otherwise return the result
     if (std::get<1>(result_value)) {
@@ -56,19 +61,15 @@ const Json::Value TaskResultManager::get_result(const std::string& task_uuid) {
 
 
 void TaskResultManager::set_result(const std::string& task_uuid, Json::Value result) {
-    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
-
     // The corresponding exception object must be created, use a dummy one
-    m_results.insert({task_uuid, std::make_tuple(result, false, agent_framework::exceptions::GamiException(
-        agent_framework::exceptions::ErrorCode::UNKNOWN_ERROR, ""))});
+    add_result(task_uuid, std::make_tuple(std::move(result), false, agent_framework::exceptions::GamiException(
+        agent_framework::exceptions::ErrorCode::UNKNOWN_ERROR, "")));
 }
 
 
 void TaskResultManager::set_exception(const std::string& task_uuid,
                                       const agent_framework::exceptions::GamiException& exception) {
-    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
-
-    m_results.insert({task_uuid, std::make_tuple(Json::Value{}, true, exception)});
+    add_result(task_uuid, std::make_tuple(Json::Value{}, true, exception));
 }
 
 
@@ -83,5 +84,74 @@ bool TaskResultManager::task_exists(const std::string& task_uuid) const {
     }
 }
 
+
+void TaskResultManager::remove_result(const std::string& task_uuid) {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    const auto it = m_results.find(task_uuid);
+    if (m_results.end() != it) {
+        m_order.erase(it->second.position);
+        m_results.erase(it);
+    }
+}
+
+
+TaskResultManager::TaskUuids TaskResultManager::remove_outdated() {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    TaskUuids removed{};
+    const auto now = Clock::now();
+
+    // Results are ordered by insertion time, so only the front of the list has to be checked
+    while (!m_order.empty()) {
+        const auto it = m_results.find(m_order.front());
+        const bool too_many = (0 != m_policy.max_count) && (m_results.size() > m_policy.max_count);
+        const bool too_old = (0 != m_policy.max_age.count()) && (now - it->second.timestamp > m_policy.max_age);
+        if (!too_many && !too_old) {
+            break;
+        }
+
+        removed.emplace_back(std::move(m_order.front()));
+        m_order.pop_front();
+        m_results.erase(it);
+    }
+
+    return removed;
+}
+
+
+std::size_t TaskResultManager::get_result_count() const {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    return m_results.size();
+}
+
+
+void TaskResultManager::set_retention_policy(const RetentionPolicy& policy) {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    m_policy = policy;
+}
+
+
+TaskResultManager::RetentionPolicy TaskResultManager::get_retention_policy() const {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    return m_policy;
+}
+
+
+void TaskResultManager::add_result(const std::string& task_uuid, TaskResultValue&& value) {
+    std::lock_guard<std::recursive_mutex> lock_guard{m_resource_mutex};
+
+    // The first stored result wins, as with std::map::insert
+    if (m_results.end() != m_results.find(task_uuid)) {
+        return;
+    }
+
+    const auto position = m_order.insert(m_order.end(), task_uuid);
+    m_results.emplace(task_uuid, TaskResultEntry{std::move(value), Clock::now(), position});
+}
+
 }
 }
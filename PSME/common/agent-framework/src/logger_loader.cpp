@@ -55,14 +55,15 @@ std::array<const char*, 5> LoggerLoader::g_time_format = {
     }
 };
 
-std::array<const char*, 6> LoggerLoader::g_stream_type = {
+std::array<const char*, 7> LoggerLoader::g_stream_type = {
     {
     "STDOUT",
     "STDERR",
     "FILE",
     "UDP",
     "TCP",
-    "DIRECT"
+    "DIRECT",
+    "BINARY"
     }
 };
 
@@ -150,6 +151,10 @@ Options LoggerLoader::get_options(const json::Value& config) {
         options.enable_more_debug(config["moredebug"].as_bool());
     }
 
+    if (!config["dropwhenfull"].is_null()) {
+        options.enable_drop_on_full(config["dropwhenfull"].as_bool());
+    }
+
     return options;
 }
 
@@ -183,6 +188,14 @@ void LoggerLoader::set_stream_output(Stream::Type type, StreamSPtr stream, const
                 }
             } break;
 
+            case Stream::Type::BINARY: {
+                if (!config["file"].is_null()) {
+                    stream->open_binary(config["file"].as_char(),
+                        config["size"].is_null() ? 0 : std::size_t(config["size"].as_uint()),
+                        config["files"].is_null() ? 1 : config["files"].as_uint());
+                }
+            } break;
+
             case Stream::Type::TCP: {
                 if (!config["address"].is_null() && !config["port"].is_null()) {
                     stream->open_tcp(config["address"].as_char(), static_cast<uint16_t>(config["port"].as_uint()));
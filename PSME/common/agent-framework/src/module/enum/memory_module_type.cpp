@@ -50,8 +50,9 @@ MemoryModuleType MemoryModuleType::from_string(const std::string& name) {
     return MemoryModuleType(MemoryModuleTypeEnum::Unknown);
 }
 
-std::vector<std::string> MemoryModuleType::get_values() {
-    return std::vector<std::string>(names.cbegin(), names.cend());
+const std::vector<std::string>& MemoryModuleType::get_values() {
+    static const std::vector<std::string> values(names.cbegin(), names.cend());
+    return values;
 }
 
 bool MemoryModuleType::is_allowable_value(const std::string& string) {
@@ -44,8 +44,9 @@ ProcessorInstructionSet ProcessorInstructionSet::from_string(const std::string&
     return ProcessorInstructionSetEnum(2);
 }
 
-std::vector<std::string> ProcessorInstructionSet::get_values() {
-    return std::vector<std::string>(names.cbegin(), names.cend());
+const std::vector<std::string>& ProcessorInstructionSet::get_values() {
+    static const std::vector<std::string> values(names.cbegin(), names.cend());
+    return values;
 }
 
 bool ProcessorInstructionSet::is_allowable_value(const std::string& string) {
@@ -145,6 +145,7 @@ Array<T>::~Array() { }
 template<typename T>
 Array<T> Array<T>::from_json(const Json::Value& json) {
     Array<T> array;
+    array.reserve(json.size());
     for (const auto& val : json) {
         ::append_to_array(array, val);
     }
@@ -25,6 +25,7 @@
 
 #include "agent-framework/module/model/drive.hpp"
 #include "agent-framework/module/constants/compute.hpp"
+#include "agent-framework/module/utils/json_fields.hpp"
 
 using namespace agent_framework::model;
 using namespace agent_framework::model::utils;
@@ -38,69 +39,55 @@ Drive::Drive(const std::string& parent_uuid, enums::Component parent_type) :
 
 Drive::~Drive() {}
 
+namespace {
+
+const JsonFields<Drive>& get_json_fields() {
+    static const JsonFields<Drive> fields{
+        JSON_FIELD(Drive, literals::Drive::STATUS, status),
+        JSON_FIELD(Drive, literals::Drive::INTERFACE, interface),
+        JSON_FIELD(Drive, literals::Drive::TYPE, type),
+        JSON_FIELD(Drive, literals::Drive::RPM, rpm),
+        JSON_FIELD(Drive, literals::Drive::FIRMWARE_VERSION, firmware_version),
+        JSON_FIELD(Drive, literals::Drive::CAPACITY, capacity_gb),
+        JSON_FIELD(Drive, literals::Drive::FRU_INFO, fru_info),
+        JSON_FIELD(Drive, literals::Drive::PHYSICAL_ID, physical_id),
+        JSON_FIELD(Drive, literals::Drive::INDICATOR_LED, indicator_led),
+        JSON_FIELD(Drive, literals::Drive::ASSET_TAG, asset_tag),
+        JSON_FIELD(Drive, literals::Drive::CAPABLE_SPEED_GBS, capable_speed_gbs),
+        JSON_FIELD(Drive, literals::Drive::NEGOTIATED_SPEED_GBS, negotiated_speed_gbs),
+        JSON_FIELD(Drive, literals::Drive::LOCATION, locations),
+        JSON_FIELD(Drive, literals::Drive::STATUS_INDICATOR, status_indicator),
+        JSON_FIELD(Drive, literals::Drive::REVISION, revision),
+        JSON_FIELD(Drive, literals::Drive::FAILURE_PREDICTED, failure_predicted),
+        JSON_FIELD(Drive, literals::Drive::SKU, sku),
+        JSON_FIELD(Drive, literals::Drive::IDENTIFIERS, identifiers),
+        JSON_FIELD(Drive, literals::Drive::HOTSPARE_TYPE, hotspare_type),
+        JSON_FIELD(Drive, literals::Drive::ENCRYPTION_ABILITY, encryption_ability),
+        JSON_FIELD(Drive, literals::Drive::ENCRYPTION_STATUS, encryption_status),
+        JSON_FIELD(Drive, literals::Drive::BLOCK_SIZE_BYTES, block_size_bytes),
+        JSON_FIELD(Drive, literals::Drive::PREDICTED_MEDIA_LIFE_LEFT, predicted_media_life_left),
+        JSON_FIELD(Drive, literals::Drive::ERASED, erased),
+        JSON_FIELD(Drive, literals::Drive::COLLECTIONS, collections),
+        JSON_FIELD(Drive, literals::Drive::OEM, oem)
+    };
+    return fields;
+}
+
+}
+
+void Drive::to_json(Json::Value& json) const {
+    get_json_fields().to_json(*this, json);
+}
+
 Json::Value Drive::to_json() const {
-    Json::Value result;
-    result[literals::Drive::STATUS] = get_status().to_json();
-    result[literals::Drive::INTERFACE] = get_interface();
-    result[literals::Drive::TYPE] = get_type();
-    result[literals::Drive::RPM] = get_rpm();
-    result[literals::Drive::FIRMWARE_VERSION] = get_firmware_version();
-    result[literals::Drive::CAPACITY] = get_capacity_gb();
-    result[literals::Drive::FRU_INFO] = get_fru_info().to_json();
-    result[literals::Drive::PHYSICAL_ID] = get_physical_id();
-    result[literals::Drive::INDICATOR_LED] = get_indicator_led();
-    result[literals::Drive::ASSET_TAG] = get_asset_tag();
-    result[literals::Drive::CAPABLE_SPEED_GBS] = get_capable_speed_gbs();
-    result[literals::Drive::NEGOTIATED_SPEED_GBS] = get_negotiated_speed_gbs();
-    result[literals::Drive::LOCATION] = get_locations().to_json();
-    result[literals::Drive::STATUS_INDICATOR] = get_status_indicator();
-    result[literals::Drive::REVISION] = get_revision();
-    result[literals::Drive::FAILURE_PREDICTED] = get_failure_predicted();
-    result[literals::Drive::SKU] = get_sku();
-    result[literals::Drive::IDENTIFIERS] = get_identifiers().to_json();
-    result[literals::Drive::HOTSPARE_TYPE] = get_hotspare_type();
-    result[literals::Drive::ENCRYPTION_ABILITY] = get_encryption_ability();
-    result[literals::Drive::ENCRYPTION_STATUS] = get_encryption_status();
-    result[literals::Drive::BLOCK_SIZE_BYTES] = get_block_size_bytes();
-    result[literals::Drive::PREDICTED_MEDIA_LIFE_LEFT] = get_predicted_media_life_left();
-    result[literals::Drive::ERASED] = get_erased();
-    result[literals::Drive::COLLECTIONS] = get_collections().to_json();
-    result[literals::Drive::OEM] = get_oem().to_json();
+    Json::Value result{Json::objectValue};
+    to_json(result);
     return result;
 }
 
 Drive Drive::from_json(const Json::Value& json) {
-    Drive drive;
-
-    drive.set_status(attribute::Status::from_json(json[literals::Drive::STATUS]));
-    drive.set_interface(json[literals::Drive::INTERFACE]);
-    drive.set_type(json[literals::Drive::TYPE]);
-    drive.set_firmware_version(json[literals::Drive::FIRMWARE_VERSION]);
-    drive.set_rpm(json[literals::Drive::RPM]);
-    drive.set_capacity_gb(json[literals::Drive::CAPACITY]);
-    drive.set_fru_info(attribute::FruInfo::from_json(
-        json[literals::Drive::FRU_INFO]));
-    drive.set_physical_id(json[literals::Drive::PHYSICAL_ID]);
-    drive.set_oem(attribute::Oem::from_json(json[literals::Drive::OEM]));
-    drive.set_indicator_led(json[literals::Drive::INDICATOR_LED]);
-    drive.set_asset_tag(json[literals::Drive::ASSET_TAG]);
-    drive.set_capable_speed_gbs(json[literals::Drive::CAPABLE_SPEED_GBS]);
-    drive.set_negotiated_speed_gbs(json[literals::Drive::NEGOTIATED_SPEED_GBS]);
-    drive.set_locations(Locations::from_json(json[literals::Drive::LOCATION]));
-    drive.set_status_indicator(json[literals::Drive::STATUS_INDICATOR]);
-    drive.set_revision(json[literals::Drive::REVISION]);
-    drive.set_failure_predicted(json[literals::Drive::FAILURE_PREDICTED]);
-    drive.set_sku(json[literals::Drive::SKU]);
-    drive.set_identifiers(Identifiers::from_json(json[literals::Drive::IDENTIFIERS]));
-    drive.set_hotspare_type(json[literals::Drive::HOTSPARE_TYPE]);
-    drive.set_encryption_ability(json[literals::Drive::ENCRYPTION_ABILITY]);
-    drive.set_encryption_status(json[literals::Drive::ENCRYPTION_STATUS]);
-    drive.set_block_size_bytes(json[literals::Drive::BLOCK_SIZE_BYTES]);
-    drive.set_predicted_media_life_left(json[literals::Drive::PREDICTED_MEDIA_LIFE_LEFT]);
-    drive.set_erased(json[literals::Drive::ERASED]);
-    drive.set_collections(Collections::from_json(
-        json[literals::Drive::COLLECTIONS]));
+    Drive drive{};
+    get_json_fields().from_json(json, drive);
     drive.set_resource_hash(json);
-
     return drive;
 }
@@ -25,6 +25,7 @@
 
 #include "agent-framework/module/model/ethernet_switch_port.hpp"
 #include "agent-framework/module/constants/network.hpp"
+#include "agent-framework/module/utils/json_fields.hpp"
 
 using namespace agent_framework::model;
 using namespace agent_framework::model::utils;
@@ -38,85 +39,56 @@ EthernetSwitchPort::EthernetSwitchPort(const std::string& parent_uuid, enums::Co
 
 EthernetSwitchPort::~EthernetSwitchPort() {}
 
+namespace {
+
+const JsonFields<EthernetSwitchPort>& get_json_fields() {
+    static const JsonFields<EthernetSwitchPort> fields{
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::STATUS, status),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::PORT_IDENTIFIER, port_identifier),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::PORT_CLASS, port_class),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::PORT_TYPE, port_type),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::PORT_MODE, port_mode),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::LINK_TECHNOLOGY, link_technology),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::LINK_SPEED_MBPS, link_speed_mbps),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::MAX_SPEED_MBPS, max_speed_mbps),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::OPERATIONAL_STATE, operational_state),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::ADMINISTRATIVE_STATE, administrative_state),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::PORT_WIDTH, port_width),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::FRAME_SIZE, frame_size),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::AUTO_SENSE, auto_sense),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::FULL_DUPLEX, full_duplex),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::IS_MANAGEMENT_PORT, is_management_port),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::LAST_ERROR_CODE, last_error_code),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::ERROR_CLEARED, error_cleared),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::LAST_STATE_CHANGE_TIME, last_state_change_time),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::MAC_ADDRESS, mac_address),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::IPV4_ADDRESS, ipv4_address),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::IPV6_ADDRESS, ipv6_address),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::NEIGHBOR_INFO, neighbor_info),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::NEIGHBOR_MAC, neighbor_mac),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::VLAN_ENABLE, vlan_enable),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::DEFAULT_VLAN, default_vlan),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::COLLECTIONS, collections),
+        JSON_FIELD(EthernetSwitchPort, literals::EthernetSwitchPort::OEM, oem)
+    };
+    return fields;
+}
+
+}
+
+void EthernetSwitchPort::to_json(Json::Value& json) const {
+    get_json_fields().to_json(*this, json);
+}
+
 Json::Value EthernetSwitchPort::to_json() const {
-    Json::Value result;
-    result[literals::EthernetSwitchPort::STATUS] = get_status().to_json();
-    result[literals::EthernetSwitchPort::PORT_IDENTIFIER] = get_port_identifier();
-    result[literals::EthernetSwitchPort::PORT_CLASS] = get_port_class();
-    result[literals::EthernetSwitchPort::PORT_TYPE] = get_port_type();
-    result[literals::EthernetSwitchPort::PORT_MODE] = get_port_mode();
-    result[literals::EthernetSwitchPort::LINK_TECHNOLOGY] =
-        get_link_technology();
-    result[literals::EthernetSwitchPort::LINK_SPEED_MBPS] = get_link_speed_mbps();
-    result[literals::EthernetSwitchPort::MAX_SPEED_MBPS] = get_max_speed_mbps();
-    result[literals::EthernetSwitchPort::OPERATIONAL_STATE] = get_operational_state();
-    result[literals::EthernetSwitchPort::ADMINISTRATIVE_STATE] =
-        get_administrative_state();
-    result[literals::EthernetSwitchPort::PORT_WIDTH] = get_port_width();
-    result[literals::EthernetSwitchPort::FRAME_SIZE] = get_frame_size();
-    result[literals::EthernetSwitchPort::AUTO_SENSE] = get_auto_sense();
-    result[literals::EthernetSwitchPort::FULL_DUPLEX] = get_full_duplex();
-    result[literals::EthernetSwitchPort::IS_MANAGEMENT_PORT] =
-        get_is_management_port();
-    result[literals::EthernetSwitchPort::LAST_ERROR_CODE] = get_last_error_code();
-    result[literals::EthernetSwitchPort::ERROR_CLEARED] = get_error_cleared();
-    result[literals::EthernetSwitchPort::LAST_STATE_CHANGE_TIME] =
-        get_last_state_change_time();
-    result[literals::EthernetSwitchPort::MAC_ADDRESS] = get_mac_address();
-    result[literals::EthernetSwitchPort::IPV4_ADDRESS] = get_ipv4_address().to_json();
-    result[literals::EthernetSwitchPort::IPV6_ADDRESS] = get_ipv6_address().to_json();
-    result[literals::EthernetSwitchPort::NEIGHBOR_INFO] =
-        get_neighbor_info().to_json();
-    result[literals::EthernetSwitchPort::NEIGHBOR_MAC] = get_neighbor_mac();
-    result[literals::EthernetSwitchPort::VLAN_ENABLE] = get_vlan_enable();
-    result[literals::EthernetSwitchPort::DEFAULT_VLAN] = get_default_vlan();
-    result[literals::EthernetSwitchPort::COLLECTIONS] = get_collections().to_json();
-    result[literals::EthernetSwitchPort::OEM] = get_oem().to_json();
+    Json::Value result{Json::objectValue};
+    to_json(result);
     return result;
 }
 
 EthernetSwitchPort EthernetSwitchPort::from_json(const Json::Value& json) {
-    EthernetSwitchPort port;
-
-    port.set_status(attribute::Status::from_json(json[literals::EthernetSwitchPort::STATUS]));
-    port.set_port_identifier(json[literals::EthernetSwitchPort::PORT_IDENTIFIER]);
-    port.set_port_class(json[literals::EthernetSwitchPort::PORT_CLASS]);
-    port.set_port_type(json[literals::EthernetSwitchPort::PORT_TYPE]);
-    port.set_port_mode(json[literals::EthernetSwitchPort::PORT_MODE]);
-    port.set_link_technology(json[literals::EthernetSwitchPort::LINK_TECHNOLOGY]);
-    port.set_link_speed_mbps(json[literals::EthernetSwitchPort::LINK_SPEED_MBPS]);
-    port.set_max_speed_mbps(
-        json[literals::EthernetSwitchPort::MAX_SPEED_MBPS]);
-    port.set_operational_state(
-        json[literals::EthernetSwitchPort::OPERATIONAL_STATE]);
-    port.set_administrative_state(
-        json[literals::EthernetSwitchPort::ADMINISTRATIVE_STATE]);
-    port.set_port_width(json[literals::EthernetSwitchPort::PORT_WIDTH]);
-    port.set_frame_size(json[literals::EthernetSwitchPort::FRAME_SIZE]);
-    port.set_auto_sense(json[literals::EthernetSwitchPort::AUTO_SENSE]);
-    port.set_full_duplex(json[literals::EthernetSwitchPort::FULL_DUPLEX]);
-    port.set_is_management_port(json[literals::EthernetSwitchPort::IS_MANAGEMENT_PORT]);
-    port.set_last_error_code(json[literals::EthernetSwitchPort::LAST_ERROR_CODE]);
-    port.set_error_cleared(json[literals::EthernetSwitchPort::ERROR_CLEARED]);
-    port.set_last_state_change_time(
-        json[literals::EthernetSwitchPort::LAST_STATE_CHANGE_TIME]);
-    port.set_mac_address(
-        json[literals::EthernetSwitchPort::MAC_ADDRESS]);
-    port.set_ipv4_address(attribute::Ipv4Address::from_json(
-        json[literals::EthernetSwitchPort::IPV4_ADDRESS]));
-    port.set_ipv6_address(attribute::Ipv6Address::from_json(
-        json[literals::EthernetSwitchPort::IPV6_ADDRESS]));
-    port.set_neighbor_info(attribute::NeighborInfo::from_json(
-        json[literals::EthernetSwitchPort::NEIGHBOR_INFO]));
-    port.set_neighbor_mac(
-        json[literals::EthernetSwitchPort::NEIGHBOR_MAC]);
-    port.set_vlan_enable(json[literals::EthernetSwitchPort::VLAN_ENABLE]);
-    port.set_default_vlan(
-        json[literals::EthernetSwitchPort::DEFAULT_VLAN]);
-    port.set_collections(Collections::from_json(
-        json[literals::EthernetSwitchPort::COLLECTIONS]));
-    port.set_oem(attribute::Oem::from_json(json[literals::EthernetSwitchPort::OEM]));
+    EthernetSwitchPort port{};
+    get_json_fields().from_json(json, port);
     port.set_resource_hash(json);
-
     return port;
 }
@@ -21,10 +21,12 @@
 
 #include "agent-framework/module/model/port.hpp"
 #include "agent-framework/module/constants/pnc.hpp"
+#include "agent-framework/module/utils/json_fields.hpp"
 #include <json/json.h>
 
 using namespace agent_framework::model;
 using namespace agent_framework::model::attribute;
+using namespace agent_framework::model::utils;
 
 const enums::Component Port::component = enums::Component::Port;
 const enums::CollectionName Port::collection_name =
@@ -35,38 +37,41 @@ Port::Port(const std::string& parent_uuid, enums::Component parent_type) :
 
 Port::~Port() {}
 
+namespace {
+
+const JsonFields<Port>& get_json_fields() {
+    static const JsonFields<Port> fields{
+        JSON_FIELD(Port, literals::Port::PORT_ID, port_id),
+        JSON_FIELD(Port, literals::Port::PORT_TYPE, port_type),
+        JSON_FIELD(Port, literals::Port::OPERATIONAL_STATE, operational_state),
+        JSON_FIELD(Port, literals::Port::ADMINISTRATIVE_STATE, administrative_state),
+        JSON_FIELD(Port, literals::Port::CABLE_ID, cables_ids),
+        JSON_FIELD(Port, literals::Port::SPEED_GBPS, speed_gbps),
+        JSON_FIELD(Port, literals::Port::MAX_SPEED_GBPS, max_speed_gbps),
+        JSON_FIELD(Port, literals::Port::MAX_WIDTH, max_width),
+        JSON_FIELD(Port, literals::Port::WIDTH, width),
+        JSON_FIELD(Port, literals::Port::STATUS, status),
+        JSON_FIELD(Port, literals::Port::OEM, oem),
+        JSON_FIELD(Port, literals::Port::ALLOWED_ACTIONS, allowed_actions),
+        JSON_FIELD(Port, literals::Port::PROTOCOL, protocol)
+    };
+    return fields;
+}
+
+}
+
+void Port::to_json(Json::Value& json) const {
+    get_json_fields().to_json(*this, json);
+}
+
 Json::Value Port::to_json() const {
-    Json::Value result;
-    result[literals::Port::PORT_ID] = get_port_id();
-    result[literals::Port::PORT_TYPE] = get_port_type();
-    result[literals::Port::OPERATIONAL_STATE] = get_operational_state();
-    result[literals::Port::ADMINISTRATIVE_STATE] = get_administrative_state();
-    result[literals::Port::CABLE_ID] = get_cables_ids().to_json();
-    result[literals::Port::SPEED_GBPS] = get_speed_gbps();
-    result[literals::Port::MAX_SPEED_GBPS] = get_max_speed_gbps();
-    result[literals::Port::MAX_WIDTH] = get_max_width();
-    result[literals::Port::WIDTH] = get_width();
-    result[literals::Port::STATUS] = get_status().to_json();
-    result[literals::Port::OEM] = get_oem().to_json();
-    result[literals::Port::ALLOWED_ACTIONS] = get_allowed_actions().to_json();
-    result[literals::Port::PROTOCOL] = get_protocol();
+    Json::Value result{Json::objectValue};
+    to_json(result);
     return result;
 }
 
 Port Port::from_json(const Json::Value& json) {
-    Port fabric_port;
-    fabric_port.set_port_id(json[literals::Port::PORT_ID]);
-    fabric_port.set_port_type(json[literals::Port::PORT_TYPE]);
-    fabric_port.set_operational_state(json[literals::Port::OPERATIONAL_STATE]);
-    fabric_port.set_administrative_state(json[literals::Port::ADMINISTRATIVE_STATE]);
-    fabric_port.set_cables_ids(CablesIds::from_json(json[literals::Port::CABLE_ID]));
-    fabric_port.set_speed_gbps(json[literals::Port::SPEED_GBPS]);
-    fabric_port.set_max_speed_gbps(json[literals::Port::MAX_SPEED_GBPS]);
-    fabric_port.set_max_width(json[literals::Port::MAX_WIDTH]);
-    fabric_port.set_width(json[literals::Port::WIDTH]);
-    fabric_port.set_status(Status::from_json(json[literals::Port::STATUS]));
-    fabric_port.set_oem(Oem::from_json(json[literals::Port::OEM]));
-    fabric_port.set_allowed_actions(AllowedActions::from_json(json[literals::Port::ALLOWED_ACTIONS]));
-    fabric_port.set_protocol(json[literals::Port::PROTOCOL]);
-    return fabric_port;
+    Port port{};
+    get_json_fields().from_json(json, port);
+    return port;
 }
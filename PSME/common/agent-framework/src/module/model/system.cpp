@@ -25,6 +25,7 @@
 
 #include "agent-framework/module/model/system.hpp"
 #include "agent-framework/module/constants/compute.hpp"
+#include "agent-framework/module/utils/json_fields.hpp"
 
 
 
@@ -42,67 +43,49 @@ System::System(const std::string& parent_uuid, enums::Component parent_type) :
 System::~System() { }
 
 
+namespace {
+
+const JsonFields<System>& get_json_fields() {
+    static const JsonFields<System> fields{
+        JSON_FIELD(System, literals::System::STATUS, status),
+        JSON_FIELD(System, literals::System::TYPE, system_type),
+        JSON_FIELD(System, literals::System::BIOS_VERSION, bios_version),
+        JSON_FIELD(System, literals::System::BOOT_OVERRIDE, boot_override),
+        JSON_FIELD(System, literals::System::BOOT_OVERRIDE_MODE, boot_override_mode),
+        JSON_FIELD(System, literals::System::BOOT_OVERRIDE_TARGET, boot_override_target),
+        JSON_FIELD(System, literals::System::BOOT_OVERRIDE_SUPPORTED, boot_override_supported),
+        JSON_FIELD(System, literals::System::UEFI_TARGET, uefi_target),
+        JSON_FIELD(System, literals::System::POWER_STATE, power_state),
+        JSON_FIELD(System, literals::System::PCI_DEVICES, pci_devices),
+        JSON_FIELD(System, literals::System::USB_DEVICES, usb_devices),
+        JSON_FIELD(System, literals::System::FRU_INFO, fru_info),
+        JSON_FIELD(System, literals::System::SKU, sku),
+        JSON_FIELD(System, literals::System::ASSET_TAG, asset_tag),
+        JSON_FIELD(System, literals::System::INDICATOR_LED, indicator_led),
+        JSON_FIELD(System, literals::System::COLLECTIONS, collections),
+        JSON_FIELD(System, literals::System::CHASSIS, chassis),
+        JSON_FIELD(System, literals::System::OEM, oem),
+        JSON_FIELD(System, literals::System::GUID, guid),
+        JSON_FIELD(System, literals::System::CABLE_IDS, cable_ids)
+    };
+    return fields;
+}
+
+}
+
+void System::to_json(Json::Value& json) const {
+    get_json_fields().to_json(*this, json);
+}
+
 Json::Value System::to_json() const {
-    Json::Value result;
-    result[literals::System::STATUS] = get_status().to_json();
-    result[literals::System::TYPE] = get_system_type();
-    result[literals::System::BIOS_VERSION] = get_bios_version();
-    result[literals::System::BOOT_OVERRIDE] = get_boot_override().to_string();
-    result[literals::System::BOOT_OVERRIDE_MODE] = get_boot_override_mode().to_string();
-    result[literals::System::BOOT_OVERRIDE_TARGET] =
-        get_boot_override_target().to_string();
-    result[literals::System::BOOT_OVERRIDE_SUPPORTED] =
-        get_boot_override_supported().to_json();
-    result[literals::System::UEFI_TARGET] = get_uefi_target();
-    result[literals::System::POWER_STATE] = get_power_state().to_string();
-    result[literals::System::PCI_DEVICES] = get_pci_devices().to_json();
-    result[literals::System::USB_DEVICES] = get_usb_devices().to_json();
-    result[literals::System::FRU_INFO] = get_fru_info().to_json();
-    result[literals::System::SKU] = get_sku();
-    result[literals::System::ASSET_TAG] = get_asset_tag();
-    result[literals::System::INDICATOR_LED] = get_indicator_led();
-    result[literals::System::COLLECTIONS] = get_collections().to_json();
-    result[literals::System::CHASSIS] = get_chassis();
-    result[literals::System::OEM] = get_oem().to_json();
-    result[literals::System::GUID] = get_guid();
-    result[literals::System::CABLE_IDS] = get_cable_ids().to_json();
+    Json::Value result{Json::objectValue};
+    to_json(result);
     return result;
 }
 
-
 System System::from_json(const Json::Value& json) {
-    System sys;
-
-    sys.set_status(attribute::Status::from_json(json[literals::System::STATUS]));
-    sys.set_system_type(json[literals::System::TYPE]);
-    sys.set_bios_version(json[literals::System::BIOS_VERSION]);
-    sys.set_boot_override(enums::BootOverride::from_string(
-        json[literals::System::BOOT_OVERRIDE].asString()));
-    sys.set_boot_override_mode(enums::BootOverrideMode::from_string(
-        json[literals::System::BOOT_OVERRIDE_MODE].asString()));
-    sys.set_boot_override_target(enums::BootOverrideTarget::from_string(
-        json[literals::System::BOOT_OVERRIDE_TARGET].asString()));
-    sys.set_boot_override_supported(BootOverrideSupported::from_json(
-        json[literals::System::BOOT_OVERRIDE_SUPPORTED]));
-    sys.set_uefi_target(json[literals::System::UEFI_TARGET]);
-    sys.set_power_state(enums::PowerState::from_string(
-        json[literals::System::POWER_STATE].asString()));
-    sys.set_pci_devices(PciDevices::from_json(
-        json[literals::System::PCI_DEVICES]));
-    sys.set_usb_devices(UsbDevices::from_json(
-        json[literals::System::USB_DEVICES]));
-    sys.set_fru_info(attribute::FruInfo::from_json(
-        json[literals::System::FRU_INFO]));
-    sys.set_sku(json[literals::System::SKU]);
-    sys.set_asset_tag(json[literals::System::ASSET_TAG]);
-    sys.set_indicator_led(json[literals::System::INDICATOR_LED]);
-    sys.set_collections(Collections::from_json(
-        json[literals::System::COLLECTIONS]));
-    sys.set_chassis(json[literals::System::CHASSIS]);
-    sys.set_oem(attribute::Oem::from_json(json[literals::System::OEM]));
-    sys.set_resource_hash(json);
-    sys.set_guid(json[literals::System::GUID]);
-    sys.set_cable_ids(CableIds::from_json(json[literals::System::CABLE_IDS]));
-
-    return sys;
+    System system{};
+    get_json_fields().from_json(json, system);
+    system.set_resource_hash(json);
+    return system;
 }
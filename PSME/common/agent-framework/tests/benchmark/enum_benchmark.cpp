@@ -0,0 +1,130 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file enum_benchmark.cpp
+ *
+ * @brief Benchmark of ENUM conversions to/from strings.
+ *
+ * All names of the largest enums of common.hpp and compute.hpp are converted
+ * to values and back. Conversion from string is compared with the linear strcmp
+ * search over names (the previous implementation).
+ *
+ * Usage: agent-framework-enum-benchmark [--iterations=N]
+ * */
+
+#include "agent-framework/module/enum/common.hpp"
+#include "agent-framework/module/enum/compute.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace agent_framework::model;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*! Prevents the compiler from removing conversions which results are not used */
+volatile std::size_t g_sink{0};
+
+/*! Previous implementation of from_string */
+std::size_t linear_search(const char* const names[], std::size_t size, const std::string& str) {
+    for (std::size_t index = 0; index < size; ++index) {
+        if (!std::strcmp(names[index], str.c_str())) {
+            return index;
+        }
+    }
+    throw std::invalid_argument(str);
+}
+
+template <typename F>
+double measure_ns(unsigned iterations, std::size_t conversions, F function) {
+    const auto start = Clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        function();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    return elapsed.count() / (double(iterations) * double(conversions));
+}
+
+template <typename E>
+void run(const char* name, const char* const names[], std::size_t size, unsigned iterations) {
+    const auto& values = E::get_values();
+    const auto linear_ns = measure_ns(iterations, values.size(), [&]() {
+        for (const auto& value : values) {
+            g_sink = g_sink + linear_search(names, size, value);
+        }
+    });
+    const auto from_string_ns = measure_ns(iterations, values.size(), [&]() {
+        for (const auto& value : values) {
+            g_sink = g_sink + E::from_string(value);
+        }
+    });
+    std::vector<E> enums{};
+    for (const auto& value : values) {
+        enums.push_back(E::from_string(value));
+    }
+    const auto to_string_ns = measure_ns(iterations, enums.size(), [&]() {
+        for (const auto& value : enums) {
+            g_sink = g_sink + reinterpret_cast<std::uintptr_t>(value.to_string());
+        }
+    });
+
+    std::cout << std::left << std::setw(20) << name << std::right << std::setw(4) << values.size()
+              << std::setw(14) << linear_ns << std::setw(14) << from_string_ns
+              << std::setw(14) << to_string_ns << std::endl;
+}
+
+#define RUN_ENUM(E, iterations) \
+    run<enums::E>(#E, enums::E ## _data_ns::g_names, enums::E ## _data_ns::g_size, iterations)
+
+}
+
+int main(int argc, const char* argv[]) {
+    unsigned iterations{100000};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const std::string option{"--iterations="};
+        if (0 != arg.compare(0, option.size(), option) || arg.size() == option.size()) {
+            std::cerr << "Usage: " << argv[0] << " [--iterations=100000]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        iterations = static_cast<unsigned>(std::stoul(arg.substr(option.size())));
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::left << std::setw(20) << "Enum" << std::right << std::setw(4) << "N"
+              << std::setw(14) << "strcmp [ns]" << std::setw(14) << "from [ns]"
+              << std::setw(14) << "to [ns]" << std::endl;
+    RUN_ENUM(CollectionName, iterations);
+    RUN_ENUM(Component, iterations);
+    RUN_ENUM(CollectionType, iterations);
+    RUN_ENUM(StorageProtocol, iterations);
+    RUN_ENUM(DeviceType, iterations);
+    RUN_ENUM(BootOverrideTarget, iterations);
+    RUN_ENUM(Health, iterations);
+    return EXIT_SUCCESS;
+}
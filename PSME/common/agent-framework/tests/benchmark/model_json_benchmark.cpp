@@ -0,0 +1,481 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file model_json_benchmark.cpp
+ *
+ * @brief Benchmark of JSON conversions of model classes.
+ *
+ * Table driven to_json/from_json of System, Drive, Port and EthernetSwitchPort
+ * are compared with the hand written conversions (the previous implementation,
+ * kept below). Serialization is measured both to a new value and to a value
+ * reused for all objects.
+ *
+ * Usage: agent-framework-model-json-benchmark [--iterations=N]
+ * */
+
+#include "agent-framework/module/model/drive.hpp"
+#include "agent-framework/module/model/ethernet_switch_port.hpp"
+#include "agent-framework/module/model/port.hpp"
+#include "agent-framework/module/model/system.hpp"
+#include "agent-framework/module/constants/compute.hpp"
+#include "agent-framework/module/constants/network.hpp"
+#include "agent-framework/module/constants/pnc.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace agent_framework::model;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*! Prevents the compiler from removing conversions which results are not used */
+volatile std::size_t g_sink{0};
+
+constexpr std::size_t OBJECTS = 100;
+
+/*! Gives the previous implementation access to the resource hash */
+template <typename T>
+class Legacy : public T {
+public:
+    void hash(const Json::Value& json) {
+        T::set_resource_hash(json);
+    }
+};
+
+/* Previous, hand written implementation */
+
+Json::Value legacy_to_json(const System& object) {
+    Json::Value result;
+    result[literals::System::STATUS] = object.get_status().to_json();
+    result[literals::System::TYPE] = object.get_system_type();
+    result[literals::System::BIOS_VERSION] = object.get_bios_version();
+    result[literals::System::BOOT_OVERRIDE] = object.get_boot_override().to_string();
+    result[literals::System::BOOT_OVERRIDE_MODE] = object.get_boot_override_mode().to_string();
+    result[literals::System::BOOT_OVERRIDE_TARGET] =
+        object.get_boot_override_target().to_string();
+    result[literals::System::BOOT_OVERRIDE_SUPPORTED] =
+        object.get_boot_override_supported().to_json();
+    result[literals::System::UEFI_TARGET] = object.get_uefi_target();
+    result[literals::System::POWER_STATE] = object.get_power_state().to_string();
+    result[literals::System::PCI_DEVICES] = object.get_pci_devices().to_json();
+    result[literals::System::USB_DEVICES] = object.get_usb_devices().to_json();
+    result[literals::System::FRU_INFO] = object.get_fru_info().to_json();
+    result[literals::System::SKU] = object.get_sku();
+    result[literals::System::ASSET_TAG] = object.get_asset_tag();
+    result[literals::System::INDICATOR_LED] = object.get_indicator_led();
+    result[literals::System::COLLECTIONS] = object.get_collections().to_json();
+    result[literals::System::CHASSIS] = object.get_chassis();
+    result[literals::System::OEM] = object.get_oem().to_json();
+    result[literals::System::GUID] = object.get_guid();
+    result[literals::System::CABLE_IDS] = object.get_cable_ids().to_json();
+    return result;
+}
+
+void legacy_from_json(const Json::Value& json, System& result) {
+    Legacy<System> sys{};
+    sys.set_status(attribute::Status::from_json(json[literals::System::STATUS]));
+    sys.set_system_type(json[literals::System::TYPE]);
+    sys.set_bios_version(json[literals::System::BIOS_VERSION]);
+    sys.set_boot_override(enums::BootOverride::from_string(
+        json[literals::System::BOOT_OVERRIDE].asString()));
+    sys.set_boot_override_mode(enums::BootOverrideMode::from_string(
+        json[literals::System::BOOT_OVERRIDE_MODE].asString()));
+    sys.set_boot_override_target(enums::BootOverrideTarget::from_string(
+        json[literals::System::BOOT_OVERRIDE_TARGET].asString()));
+    sys.set_boot_override_supported(System::BootOverrideSupported::from_json(
+        json[literals::System::BOOT_OVERRIDE_SUPPORTED]));
+    sys.set_uefi_target(json[literals::System::UEFI_TARGET]);
+    sys.set_power_state(enums::PowerState::from_string(
+        json[literals::System::POWER_STATE].asString()));
+    sys.set_pci_devices(System::PciDevices::from_json(
+        json[literals::System::PCI_DEVICES]));
+    sys.set_usb_devices(System::UsbDevices::from_json(
+        json[literals::System::USB_DEVICES]));
+    sys.set_fru_info(attribute::FruInfo::from_json(
+        json[literals::System::FRU_INFO]));
+    sys.set_sku(json[literals::System::SKU]);
+    sys.set_asset_tag(json[literals::System::ASSET_TAG]);
+    sys.set_indicator_led(json[literals::System::INDICATOR_LED]);
+    sys.set_collections(System::Collections::from_json(
+        json[literals::System::COLLECTIONS]));
+    sys.set_chassis(json[literals::System::CHASSIS]);
+    sys.set_oem(attribute::Oem::from_json(json[literals::System::OEM]));
+    sys.hash(json);
+    sys.set_guid(json[literals::System::GUID]);
+    sys.set_cable_ids(System::CableIds::from_json(json[literals::System::CABLE_IDS]));
+
+    result = std::move(sys);
+}
+
+Json::Value legacy_to_json(const Drive& object) {
+    Json::Value result;
+    result[literals::Drive::STATUS] = object.get_status().to_json();
+    result[literals::Drive::INTERFACE] = object.get_interface();
+    result[literals::Drive::TYPE] = object.get_type();
+    result[literals::Drive::RPM] = object.get_rpm();
+    result[literals::Drive::FIRMWARE_VERSION] = object.get_firmware_version();
+    result[literals::Drive::CAPACITY] = object.get_capacity_gb();
+    result[literals::Drive::FRU_INFO] = object.get_fru_info().to_json();
+    result[literals::Drive::PHYSICAL_ID] = object.get_physical_id();
+    result[literals::Drive::INDICATOR_LED] = object.get_indicator_led();
+    result[literals::Drive::ASSET_TAG] = object.get_asset_tag();
+    result[literals::Drive::CAPABLE_SPEED_GBS] = object.get_capable_speed_gbs();
+    result[literals::Drive::NEGOTIATED_SPEED_GBS] = object.get_negotiated_speed_gbs();
+    result[literals::Drive::LOCATION] = object.get_locations().to_json();
+    result[literals::Drive::STATUS_INDICATOR] = object.get_status_indicator();
+    result[literals::Drive::REVISION] = object.get_revision();
+    result[literals::Drive::FAILURE_PREDICTED] = object.get_failure_predicted();
+    result[literals::Drive::SKU] = object.get_sku();
+    result[literals::Drive::IDENTIFIERS] = object.get_identifiers().to_json();
+    result[literals::Drive::HOTSPARE_TYPE] = object.get_hotspare_type();
+    result[literals::Drive::ENCRYPTION_ABILITY] = object.get_encryption_ability();
+    result[literals::Drive::ENCRYPTION_STATUS] = object.get_encryption_status();
+    result[literals::Drive::BLOCK_SIZE_BYTES] = object.get_block_size_bytes();
+    result[literals::Drive::PREDICTED_MEDIA_LIFE_LEFT] = object.get_predicted_media_life_left();
+    result[literals::Drive::ERASED] = object.get_erased();
+    result[literals::Drive::COLLECTIONS] = object.get_collections().to_json();
+    result[literals::Drive::OEM] = object.get_oem().to_json();
+    return result;
+}
+
+void legacy_from_json(const Json::Value& json, Drive& result) {
+    Legacy<Drive> drive{};
+    drive.set_status(attribute::Status::from_json(json[literals::Drive::STATUS]));
+    drive.set_interface(json[literals::Drive::INTERFACE]);
+    drive.set_type(json[literals::Drive::TYPE]);
+    drive.set_firmware_version(json[literals::Drive::FIRMWARE_VERSION]);
+    drive.set_rpm(json[literals::Drive::RPM]);
+    drive.set_capacity_gb(json[literals::Drive::CAPACITY]);
+    drive.set_fru_info(attribute::FruInfo::from_json(
+        json[literals::Drive::FRU_INFO]));
+    drive.set_physical_id(json[literals::Drive::PHYSICAL_ID]);
+    drive.set_oem(attribute::Oem::from_json(json[literals::Drive::OEM]));
+    drive.set_indicator_led(json[literals::Drive::INDICATOR_LED]);
+    drive.set_asset_tag(json[literals::Drive::ASSET_TAG]);
+    drive.set_capable_speed_gbs(json[literals::Drive::CAPABLE_SPEED_GBS]);
+    drive.set_negotiated_speed_gbs(json[literals::Drive::NEGOTIATED_SPEED_GBS]);
+    drive.set_locations(Drive::Locations::from_json(json[literals::Drive::LOCATION]));
+    drive.set_status_indicator(json[literals::Drive::STATUS_INDICATOR]);
+    drive.set_revision(json[literals::Drive::REVISION]);
+    drive.set_failure_predicted(json[literals::Drive::FAILURE_PREDICTED]);
+    drive.set_sku(json[literals::Drive::SKU]);
+    drive.set_identifiers(Drive::Identifiers::from_json(json[literals::Drive::IDENTIFIERS]));
+    drive.set_hotspare_type(json[literals::Drive::HOTSPARE_TYPE]);
+    drive.set_encryption_ability(json[literals::Drive::ENCRYPTION_ABILITY]);
+    drive.set_encryption_status(json[literals::Drive::ENCRYPTION_STATUS]);
+    drive.set_block_size_bytes(json[literals::Drive::BLOCK_SIZE_BYTES]);
+    drive.set_predicted_media_life_left(json[literals::Drive::PREDICTED_MEDIA_LIFE_LEFT]);
+    drive.set_erased(json[literals::Drive::ERASED]);
+    drive.set_collections(Drive::Collections::from_json(
+        json[literals::Drive::COLLECTIONS]));
+    drive.hash(json);
+
+    result = std::move(drive);
+}
+
+Json::Value legacy_to_json(const Port& object) {
+    Json::Value result;
+    result[literals::Port::PORT_ID] = object.get_port_id();
+    result[literals::Port::PORT_TYPE] = object.get_port_type();
+    result[literals::Port::OPERATIONAL_STATE] = object.get_operational_state();
+    result[literals::Port::ADMINISTRATIVE_STATE] = object.get_administrative_state();
+    result[literals::Port::CABLE_ID] = object.get_cables_ids().to_json();
+    result[literals::Port::SPEED_GBPS] = object.get_speed_gbps();
+    result[literals::Port::MAX_SPEED_GBPS] = object.get_max_speed_gbps();
+    result[literals::Port::MAX_WIDTH] = object.get_max_width();
+    result[literals::Port::WIDTH] = object.get_width();
+    result[literals::Port::STATUS] = object.get_status().to_json();
+    result[literals::Port::OEM] = object.get_oem().to_json();
+    result[literals::Port::ALLOWED_ACTIONS] = object.get_allowed_actions().to_json();
+    result[literals::Port::PROTOCOL] = object.get_protocol();
+    return result;
+}
+
+void legacy_from_json(const Json::Value& json, Port& result) {
+    Legacy<Port> fabric_port{};
+    fabric_port.set_port_id(json[literals::Port::PORT_ID]);
+    fabric_port.set_port_type(json[literals::Port::PORT_TYPE]);
+    fabric_port.set_operational_state(json[literals::Port::OPERATIONAL_STATE]);
+    fabric_port.set_administrative_state(json[literals::Port::ADMINISTRATIVE_STATE]);
+    fabric_port.set_cables_ids(Port::CablesIds::from_json(json[literals::Port::CABLE_ID]));
+    fabric_port.set_speed_gbps(json[literals::Port::SPEED_GBPS]);
+    fabric_port.set_max_speed_gbps(json[literals::Port::MAX_SPEED_GBPS]);
+    fabric_port.set_max_width(json[literals::Port::MAX_WIDTH]);
+    fabric_port.set_width(json[literals::Port::WIDTH]);
+    fabric_port.set_status(attribute::Status::from_json(json[literals::Port::STATUS]));
+    fabric_port.set_oem(attribute::Oem::from_json(json[literals::Port::OEM]));
+    fabric_port.set_allowed_actions(Port::AllowedActions::from_json(json[literals::Port::ALLOWED_ACTIONS]));
+    fabric_port.set_protocol(json[literals::Port::PROTOCOL]);
+    result = std::move(fabric_port);
+}
+
+Json::Value legacy_to_json(const EthernetSwitchPort& object) {
+    Json::Value result;
+    result[literals::EthernetSwitchPort::STATUS] = object.get_status().to_json();
+    result[literals::EthernetSwitchPort::PORT_IDENTIFIER] = object.get_port_identifier();
+    result[literals::EthernetSwitchPort::PORT_CLASS] = object.get_port_class();
+    result[literals::EthernetSwitchPort::PORT_TYPE] = object.get_port_type();
+    result[literals::EthernetSwitchPort::PORT_MODE] = object.get_port_mode();
+    result[literals::EthernetSwitchPort::LINK_TECHNOLOGY] =
+        object.get_link_technology();
+    result[literals::EthernetSwitchPort::LINK_SPEED_MBPS] = object.get_link_speed_mbps();
+    result[literals::EthernetSwitchPort::MAX_SPEED_MBPS] = object.get_max_speed_mbps();
+    result[literals::EthernetSwitchPort::OPERATIONAL_STATE] = object.get_operational_state();
+    result[literals::EthernetSwitchPort::ADMINISTRATIVE_STATE] =
+        object.get_administrative_state();
+    result[literals::EthernetSwitchPort::PORT_WIDTH] = object.get_port_width();
+    result[literals::EthernetSwitchPort::FRAME_SIZE] = object.get_frame_size();
+    result[literals::EthernetSwitchPort::AUTO_SENSE] = object.get_auto_sense();
+    result[literals::EthernetSwitchPort::FULL_DUPLEX] = object.get_full_duplex();
+    result[literals::EthernetSwitchPort::IS_MANAGEMENT_PORT] =
+        object.get_is_management_port();
+    result[literals::EthernetSwitchPort::LAST_ERROR_CODE] = object.get_last_error_code();
+    result[literals::EthernetSwitchPort::ERROR_CLEARED] = object.get_error_cleared();
+    result[literals::EthernetSwitchPort::LAST_STATE_CHANGE_TIME] =
+        object.get_last_state_change_time();
+    result[literals::EthernetSwitchPort::MAC_ADDRESS] = object.get_mac_address();
+    result[literals::EthernetSwitchPort::IPV4_ADDRESS] = object.get_ipv4_address().to_json();
+    result[literals::EthernetSwitchPort::IPV6_ADDRESS] = object.get_ipv6_address().to_json();
+    result[literals::EthernetSwitchPort::NEIGHBOR_INFO] =
+        object.get_neighbor_info().to_json();
+    result[literals::EthernetSwitchPort::NEIGHBOR_MAC] = object.get_neighbor_mac();
+    result[literals::EthernetSwitchPort::VLAN_ENABLE] = object.get_vlan_enable();
+    result[literals::EthernetSwitchPort::DEFAULT_VLAN] = object.get_default_vlan();
+    result[literals::EthernetSwitchPort::COLLECTIONS] = object.get_collections().to_json();
+    result[literals::EthernetSwitchPort::OEM] = object.get_oem().to_json();
+    return result;
+}
+
+void legacy_from_json(const Json::Value& json, EthernetSwitchPort& result) {
+    Legacy<EthernetSwitchPort> port{};
+    port.set_status(attribute::Status::from_json(json[literals::EthernetSwitchPort::STATUS]));
+    port.set_port_identifier(json[literals::EthernetSwitchPort::PORT_IDENTIFIER]);
+    port.set_port_class(json[literals::EthernetSwitchPort::PORT_CLASS]);
+    port.set_port_type(json[literals::EthernetSwitchPort::PORT_TYPE]);
+    port.set_port_mode(json[literals::EthernetSwitchPort::PORT_MODE]);
+    port.set_link_technology(json[literals::EthernetSwitchPort::LINK_TECHNOLOGY]);
+    port.set_link_speed_mbps(json[literals::EthernetSwitchPort::LINK_SPEED_MBPS]);
+    port.set_max_speed_mbps(
+        json[literals::EthernetSwitchPort::MAX_SPEED_MBPS]);
+    port.set_operational_state(
+        json[literals::EthernetSwitchPort::OPERATIONAL_STATE]);
+    port.set_administrative_state(
+        json[literals::EthernetSwitchPort::ADMINISTRATIVE_STATE]);
+    port.set_port_width(json[literals::EthernetSwitchPort::PORT_WIDTH]);
+    port.set_frame_size(json[literals::EthernetSwitchPort::FRAME_SIZE]);
+    port.set_auto_sense(json[literals::EthernetSwitchPort::AUTO_SENSE]);
+    port.set_full_duplex(json[literals::EthernetSwitchPort::FULL_DUPLEX]);
+    port.set_is_management_port(json[literals::EthernetSwitchPort::IS_MANAGEMENT_PORT]);
+    port.set_last_error_code(json[literals::EthernetSwitchPort::LAST_ERROR_CODE]);
+    port.set_error_cleared(json[literals::EthernetSwitchPort::ERROR_CLEARED]);
+    port.set_last_state_change_time(
+        json[literals::EthernetSwitchPort::LAST_STATE_CHANGE_TIME]);
+    port.set_mac_address(
+        json[literals::EthernetSwitchPort::MAC_ADDRESS]);
+    port.set_ipv4_address(attribute::Ipv4Address::from_json(
+        json[literals::EthernetSwitchPort::IPV4_ADDRESS]));
+    port.set_ipv6_address(attribute::Ipv6Address::from_json(
+        json[literals::EthernetSwitchPort::IPV6_ADDRESS]));
+    port.set_neighbor_info(attribute::NeighborInfo::from_json(
+        json[literals::EthernetSwitchPort::NEIGHBOR_INFO]));
+    port.set_neighbor_mac(
+        json[literals::EthernetSwitchPort::NEIGHBOR_MAC]);
+    port.set_vlan_enable(json[literals::EthernetSwitchPort::VLAN_ENABLE]);
+    port.set_default_vlan(
+        json[literals::EthernetSwitchPort::DEFAULT_VLAN]);
+    port.set_collections(EthernetSwitchPort::Collections::from_json(
+        json[literals::EthernetSwitchPort::COLLECTIONS]));
+    port.set_oem(attribute::Oem::from_json(json[literals::EthernetSwitchPort::OEM]));
+    port.hash(json);
+
+    result = std::move(port);
+}
+
+attribute::FruInfo make_fru_info(std::size_t index) {
+    attribute::FruInfo fru_info{};
+    fru_info.set_serial_number("SN" + std::to_string(100000 + index));
+    fru_info.set_manufacturer("Intel Corporation");
+    fru_info.set_model_number("Model " + std::to_string(index % 7));
+    fru_info.set_part_number("PN-" + std::to_string(index));
+    return fru_info;
+}
+
+System make_system(std::size_t index) {
+    System system{};
+    system.set_status({enums::State::Enabled, enums::Health::OK});
+    system.set_system_type(enums::SystemType::Physical);
+    system.set_bios_version("SE5C620.86B.00.01." + std::to_string(index));
+    system.set_boot_override(enums::BootOverride::Once);
+    system.set_boot_override_mode(enums::BootOverrideMode::UEFI);
+    system.set_boot_override_target(enums::BootOverrideTarget::Pxe);
+    system.add_boot_override_supported(enums::BootOverrideTarget::Hdd);
+    system.add_boot_override_supported(enums::BootOverrideTarget::Pxe);
+    system.set_power_state(enums::PowerState::On);
+    system.set_fru_info(make_fru_info(index));
+    system.set_sku("SKU" + std::to_string(index));
+    system.set_asset_tag("Rack 1 Drawer " + std::to_string(index));
+    system.set_guid("2f3a4b5c-0000-1000-8000-" + std::to_string(100000000000 + index));
+    return system;
+}
+
+Drive make_drive(std::size_t index) {
+    Drive drive{};
+    drive.set_status({enums::State::Enabled, enums::Health::OK});
+    drive.set_interface(enums::StorageProtocol::NVMe);
+    drive.set_type(enums::DriveType::SSD);
+    drive.set_capacity_gb(931.5);
+    drive.set_firmware_version("GDC5" + std::to_string(index % 10));
+    drive.set_fru_info(make_fru_info(index));
+    drive.set_capable_speed_gbs(8.0);
+    drive.set_block_size_bytes(512);
+    drive.set_predicted_media_life_left(98);
+    drive.set_erased(true);
+    attribute::Identifier identifier{};
+    identifier.set_durable_name("5000c500a1b2" + std::to_string(1000 + index));
+    identifier.set_durable_name_format(enums::IdentifierType::NAA);
+    drive.add_identifier(identifier);
+    return drive;
+}
+
+Port make_port(std::size_t index) {
+    Port port{};
+    port.set_status({enums::State::Enabled, enums::Health::OK});
+    port.set_port_id(std::to_string(index));
+    port.set_port_type(enums::PciePortType::DownstreamPort);
+    port.set_operational_state(enums::PciePortOperationalState::Up);
+    port.set_speed_gbps(8.0);
+    port.set_max_speed_gbps(8.0);
+    port.set_width(4);
+    port.set_max_width(4);
+    port.set_protocol(enums::StorageProtocol::PCIe);
+    port.add_allowed_action(enums::ResetType::ForceOff);
+    port.add_allowed_action(enums::ResetType::ForceOn);
+    return port;
+}
+
+EthernetSwitchPort make_switch_port(std::size_t index) {
+    EthernetSwitchPort port{};
+    port.set_status({enums::State::Enabled, enums::Health::OK});
+    port.set_port_identifier("sw0p" + std::to_string(index));
+    port.set_port_class(enums::PortClass::Physical);
+    port.set_port_type(enums::PortType::Downstream);
+    port.set_port_mode(enums::PortMode::Unknown);
+    port.set_link_technology(enums::LinkTechnology::Ethernet);
+    port.set_link_speed_mbps(40000);
+    port.set_max_speed_mbps(40000);
+    port.set_operational_state(enums::OperationalState::Up);
+    port.set_administrative_state(enums::AdministrativeState::Up);
+    port.set_port_width(4);
+    port.set_frame_size(1520);
+    port.set_full_duplex(true);
+    port.set_mac_address("00:1e:67:00:00:" + std::to_string(10 + index % 90));
+    port.set_vlan_enable(true);
+    return port;
+}
+
+template <typename F>
+double measure_ns(unsigned iterations, F function) {
+    const auto start = Clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        function();
+    }
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    return elapsed.count() / (double(iterations) * double(OBJECTS));
+}
+
+template <typename T, typename Make>
+void run(const char* name, Make make, unsigned iterations) {
+    std::vector<T> objects{};
+    std::vector<Json::Value> values{};
+    for (std::size_t index = 0; index < OBJECTS; ++index) {
+        objects.push_back(make(index));
+        values.push_back(objects.back().to_json());
+        if (legacy_to_json(objects.back()) != values.back()) {
+            throw std::logic_error(std::string("Different JSON of ") + name);
+        }
+    }
+
+    const auto legacy_to_ns = measure_ns(iterations, [&]() {
+        for (const auto& object : objects) {
+            g_sink = g_sink + legacy_to_json(object).size();
+        }
+    });
+    const auto to_ns = measure_ns(iterations, [&]() {
+        for (const auto& object : objects) {
+            g_sink = g_sink + object.to_json().size();
+        }
+    });
+    Json::Value buffer{Json::objectValue};
+    const auto to_buffer_ns = measure_ns(iterations, [&]() {
+        for (const auto& object : objects) {
+            object.to_json(buffer);
+            g_sink = g_sink + buffer.size();
+        }
+    });
+    T result{};
+    const auto legacy_from_ns = measure_ns(iterations, [&]() {
+        for (const auto& value : values) {
+            legacy_from_json(value, result);
+            g_sink = g_sink + result.get_resource_hash().status.size();
+        }
+    });
+    const auto from_ns = measure_ns(iterations, [&]() {
+        for (const auto& value : values) {
+            result = T::from_json(value);
+            g_sink = g_sink + result.get_resource_hash().status.size();
+        }
+    });
+
+    std::cout << std::left << std::setw(20) << name << std::right
+              << std::setw(12) << legacy_to_ns << std::setw(12) << to_ns << std::setw(12) << to_buffer_ns
+              << std::setw(12) << legacy_from_ns << std::setw(12) << from_ns << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    unsigned iterations{1000};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const std::string option{"--iterations="};
+        if (0 != arg.compare(0, option.size(), option) || arg.size() == option.size()) {
+            std::cerr << "Usage: " << argv[0] << " [--iterations=1000]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        iterations = static_cast<unsigned>(std::stoul(arg.substr(option.size())));
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Time per object [ns]" << std::endl;
+    std::cout << std::left << std::setw(20) << "Model" << std::right
+              << std::setw(12) << "to (old)" << std::setw(12) << "to" << std::setw(12) << "to buffer"
+              << std::setw(12) << "from (old)" << std::setw(12) << "from" << std::endl;
+    run<System>("System", make_system, iterations);
+    run<Drive>("Drive", make_drive, iterations);
+    run<Port>("Port", make_port, iterations);
+    run<EthernetSwitchPort>("EthernetSwitchPort", make_switch_port, iterations);
+    return EXIT_SUCCESS;
+}
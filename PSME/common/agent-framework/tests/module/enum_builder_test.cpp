@@ -0,0 +1,69 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ * */
+
+#include "agent-framework/module/enum/enum_builder.hpp"
+#include "agent-framework/module/enum/common.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace agent_framework::model;
+
+namespace {
+    ENUM(Planet, uint32_t, Mercury, Venus, Earth, Mars, Jupiter, Saturn, Uranus, Neptune);
+    ENUM(Switch, uint32_t, On, Off);
+}
+
+TEST(EnumBuilderTest, ConversionsOfAllValues) {
+    for (const auto& name : Planet::get_values()) {
+        EXPECT_STREQ(name.c_str(), Planet::from_string(name).to_string());
+        EXPECT_TRUE(Planet::is_allowable_value(name));
+    }
+    for (const auto& name : enums::CollectionName::get_values()) {
+        EXPECT_STREQ(name.c_str(), enums::CollectionName::from_string(name).to_string());
+    }
+    EXPECT_EQ(Planet::Neptune, Planet::from_string("Neptune"));
+    EXPECT_EQ(Switch::Off, Switch::from_string("Off"));
+}
+
+TEST(EnumBuilderTest, NamesAreOrderedByValues) {
+    const auto& names = Planet::get_values();
+    ASSERT_EQ(8u, names.size());
+    EXPECT_EQ("Mercury", names.front());
+    EXPECT_EQ("Neptune", names.back());
+    EXPECT_EQ(&names, &Planet::get_values());
+}
+
+TEST(EnumBuilderTest, UnknownNames) {
+    for (const std::string name : {"", "Pluto", "earth", "Earth ", "Eart", "Zzzzzzz"}) {
+        EXPECT_FALSE(Planet::is_allowable_value(name));
+        EXPECT_THROW(Planet::from_string(name), agent_framework::exceptions::InvalidValue);
+    }
+    EXPECT_FALSE(Planet::is_allowable_value(std::string("Mars\0", 5)));
+    EXPECT_FALSE(Switch::is_allowable_value("O"));
+}
+
+TEST(EnumBuilderTest, InvalidValue) {
+    const Planet planet{static_cast<Planet::Planet_enum>(8)};
+    EXPECT_THROW(planet.to_string(), std::runtime_error);
+}
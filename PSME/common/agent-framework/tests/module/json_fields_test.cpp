@@ -0,0 +1,146 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section Table driven JSON conversion of model classes
+ * */
+
+#include "agent-framework/module/model/drive.hpp"
+#include "agent-framework/module/model/ethernet_switch_port.hpp"
+#include "agent-framework/module/model/port.hpp"
+#include "agent-framework/module/model/system.hpp"
+#include "agent-framework/module/constants/compute.hpp"
+#include "agent-framework/module/constants/network.hpp"
+#include "agent-framework/module/constants/pnc.hpp"
+#include "agent-framework/module/utils/json_fields.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace agent_framework::model;
+using namespace agent_framework::model::utils;
+
+namespace {
+
+System make_system() {
+    System system{};
+    system.set_status({enums::State::Enabled, enums::Health::OK});
+    system.set_system_type(enums::SystemType::Physical);
+    system.set_bios_version("1.2.3");
+    system.set_boot_override(enums::BootOverride::Once);
+    system.set_boot_override_target(enums::BootOverrideTarget::Pxe);
+    system.set_power_state(enums::PowerState::On);
+    system.set_guid("0123-4567");
+    return system;
+}
+
+Drive make_drive() {
+    Drive drive{};
+    drive.set_status({enums::State::Enabled, enums::Health::Warning});
+    drive.set_interface(enums::StorageProtocol::NVMe);
+    drive.set_rpm(7200);
+    drive.set_capacity_gb(931.5);
+    drive.set_firmware_version("FW01");
+    drive.set_erased(true);
+    attribute::Identifier identifier{};
+    identifier.set_durable_name("5000c500a1b2c3d4");
+    identifier.set_durable_name_format(enums::IdentifierType::NAA);
+    drive.add_identifier(identifier);
+    return drive;
+}
+
+}
+
+TEST(JsonFieldsTest, SystemRoundTrip) {
+    const auto json = make_system().to_json();
+    EXPECT_EQ("Physical", json[literals::System::TYPE].asString());
+    EXPECT_EQ("1.2.3", json[literals::System::BIOS_VERSION].asString());
+    EXPECT_EQ("Once", json[literals::System::BOOT_OVERRIDE].asString());
+    EXPECT_EQ("Pxe", json[literals::System::BOOT_OVERRIDE_TARGET].asString());
+    EXPECT_EQ("Enabled", json[literals::System::STATUS][literals::Status::STATE].asString());
+    EXPECT_TRUE(json[literals::System::SKU].isNull());
+    EXPECT_TRUE(json[literals::System::PCI_DEVICES].isArray());
+
+    const auto system = System::from_json(json);
+    EXPECT_EQ(json, system.to_json());
+    EXPECT_EQ(enums::PowerState::On, system.get_power_state());
+    EXPECT_FALSE(system.get_resource_hash().status.empty());
+}
+
+TEST(JsonFieldsTest, DriveRoundTrip) {
+    const auto json = make_drive().to_json();
+    EXPECT_EQ("NVMe", json[literals::Drive::INTERFACE].asString());
+    EXPECT_EQ(7200u, json[literals::Drive::RPM].asUInt());
+    EXPECT_DOUBLE_EQ(931.5, json[literals::Drive::CAPACITY].asDouble());
+    EXPECT_EQ(1u, json[literals::Drive::IDENTIFIERS].size());
+
+    const auto drive = Drive::from_json(json);
+    EXPECT_EQ(json, drive.to_json());
+    EXPECT_EQ(7200u, drive.get_rpm().value());
+    EXPECT_EQ("5000c500a1b2c3d4", drive.get_identifiers()[0].get_durable_name());
+}
+
+TEST(JsonFieldsTest, PortRoundTrip) {
+    Port port{};
+    port.set_port_id("Up1");
+    port.set_port_type(enums::PciePortType::UpstreamPort);
+    port.set_width(4);
+    const auto json = port.to_json();
+    EXPECT_EQ("Up1", json[literals::Port::PORT_ID].asString());
+    EXPECT_EQ(json, Port::from_json(json).to_json());
+
+    EthernetSwitchPort switch_port{};
+    switch_port.set_port_identifier("sw0p1");
+    switch_port.set_link_speed_mbps(10000);
+    switch_port.set_vlan_enable(true);
+    const auto switch_json = switch_port.to_json();
+    EXPECT_EQ(10000u, switch_json[literals::EthernetSwitchPort::LINK_SPEED_MBPS].asUInt());
+    EXPECT_EQ(switch_json, EthernetSwitchPort::from_json(switch_json).to_json());
+}
+
+TEST(JsonFieldsTest, MissingAndUnknownMembers) {
+    Json::Value json{Json::objectValue};
+    json[literals::Drive::STATUS] = attribute::Status{enums::State::Absent, enums::Health::Critical}.to_json();
+    json[literals::Drive::FIRMWARE_VERSION] = "FW02";
+    json["unknownMember"] = 1;
+    json["firmwareVersio"] = "prefix of the key";
+
+    const auto drive = Drive::from_json(json);
+    EXPECT_EQ("FW02", drive.get_firmware_version().value());
+    EXPECT_FALSE(drive.get_rpm().has_value());
+    EXPECT_FALSE(drive.get_erased().has_value());
+    EXPECT_EQ(0u, drive.get_identifiers().size());
+    EXPECT_EQ(enums::State::Absent, drive.get_status().get_state());
+}
+
+TEST(JsonFieldsTest, ReusedValueIsOverwritten) {
+    Json::Value buffer{Json::objectValue};
+    make_drive().to_json(buffer);
+    Drive{}.to_json(buffer);
+    EXPECT_EQ(Drive{}.to_json(), buffer);
+}
+
+TEST(JsonFieldsTest, DuplicatedKeyIsRejected) {
+    EXPECT_THROW((JsonFields<Port>{
+        JSON_FIELD(Port, literals::Port::WIDTH, width),
+        JSON_FIELD(Port, literals::Port::WIDTH, max_width)
+    }), std::logic_error);
+}
@@ -119,3 +119,21 @@ TEST_F(ManyToManyManagerTest, UpdateChildWithMultipleParents) {
     // assert that no additional entries were added to the manager
     ASSERT_EQ(2, my_manager.get_parents("CHILD_3").size());
 }
+
+TEST_F(ManyToManyManagerTest, UpdateUuids) {
+    // update parents and children in a single pass
+    my_manager.update_uuids({{"parent_0", "PARENT_0"}, {"child_3", "CHILD_3"}, {"unknown", "UNKNOWN"}});
+
+    // assert that no entries with old uuids exist
+    ASSERT_TRUE(my_manager.get_children("parent_0").empty());
+    ASSERT_TRUE(my_manager.get_parents("child_3").empty());
+
+    // assert that all entries were updated, including the ones with both uuids changed
+    ASSERT_TRUE(my_manager.entry_exists("PARENT_0", "child_0"));
+    ASSERT_TRUE(my_manager.entry_exists("PARENT_0", "CHILD_3"));
+    ASSERT_TRUE(my_manager.entry_exists("parent_1", "CHILD_3"));
+    ASSERT_EQ(4, my_manager.get_children("PARENT_0").size());
+    ASSERT_EQ(2, my_manager.get_parents("CHILD_3").size());
+    ASSERT_FALSE(my_manager.parent_exists("UNKNOWN"));
+    ASSERT_FALSE(my_manager.child_exists("UNKNOWN"));
+}
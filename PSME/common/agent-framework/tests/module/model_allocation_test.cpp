@@ -0,0 +1,292 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section Allocations made when resources are built and stored in managers
+ *
+ * Global operator new is replaced, so these tests are built as a separate binary.
+ * */
+
+#include "agent-framework/module/managers/generic_manager.hpp"
+#include "agent-framework/module/managers/many_to_many_manager.hpp"
+#include "agent-framework/module/model/chassis.hpp"
+#include "agent-framework/module/model/drive.hpp"
+#include "agent-framework/module/model/storage_subsystem.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace agent_framework;
+using namespace agent_framework::module;
+using namespace agent_framework::model;
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<std::size_t> g_allocations{0};
+
+/*! Counts allocations made in its scope */
+class AllocationCounter {
+public:
+    AllocationCounter() {
+        g_allocations = 0;
+        g_counting = true;
+    }
+
+    ~AllocationCounter() {
+        g_counting = false;
+    }
+
+    std::size_t get() const {
+        return g_allocations;
+    }
+};
+
+/*! Drives of the tree, with the chassis and the storage subsystem it has 1000 resources */
+constexpr std::size_t DRIVES = 998;
+
+/*! Longer than the small string buffer, so every copy allocates */
+std::string make_text(const char* prefix, std::size_t index) {
+    return std::string(prefix) + " of the drive number " + std::to_string(index);
+}
+
+attribute::FruInfo make_fru_info(std::size_t index) {
+    attribute::FruInfo fru_info{};
+    fru_info.set_serial_number(make_text("Serial number", index));
+    fru_info.set_manufacturer(make_text("Manufacturer", index));
+    fru_info.set_model_number(make_text("Model number", index));
+    fru_info.set_part_number(make_text("Part number", index));
+    return fru_info;
+}
+
+Drive::Identifiers make_identifiers(std::size_t index) {
+    Drive::Identifiers identifiers{};
+    auto& identifier = identifiers.emplace_entry();
+    identifier.set_durable_name(make_text("Durable name", index));
+    identifier.set_durable_name_format(enums::IdentifierType::NAA);
+    return identifiers;
+}
+
+/*! Managers of the discovered tree */
+struct Tree {
+    GenericManager<Chassis> chassis{};
+    GenericManager<StorageSubsystem> storage{};
+    GenericManager<Drive> drives{};
+    managers::ManyToManyManager storage_drives{};
+};
+
+/*!
+ * Discovery keeping the resources in local variables, passed by lvalues,
+ * updates go through get_entry()/add_or_update_entry() round trips
+ */
+std::size_t discover_with_copies(Tree& tree) {
+    AllocationCounter counter{};
+    Chassis chassis{};
+    tree.chassis.add_entry(chassis);
+    StorageSubsystem storage{chassis.get_uuid(), enums::Component::Chassis};
+    tree.storage.add_entry(storage);
+    for (std::size_t index = 0; index < DRIVES; ++index) {
+        Drive drive{chassis.get_uuid(), enums::Component::Chassis};
+        const std::string firmware_version = make_text("Firmware version", index);
+        const std::string asset_tag = make_text("Asset tag", index);
+        const attribute::FruInfo fru_info = make_fru_info(index);
+        const Drive::Identifiers identifiers = make_identifiers(index);
+        drive.set_firmware_version(firmware_version);
+        drive.set_asset_tag(asset_tag);
+        drive.set_fru_info(fru_info);
+        drive.set_identifiers(identifiers);
+        tree.drives.add_entry(drive);
+        tree.storage_drives.add_entry(storage.get_uuid(), drive.get_uuid());
+
+        auto stored = tree.drives.get_entry(drive.get_uuid());
+        stored.set_capacity_gb(double(index));
+        tree.drives.add_or_update_entry(stored);
+    }
+    auto stored_chassis = tree.chassis.get_entry(chassis.get_uuid());
+    stored_chassis.add_collection({enums::CollectionName::Drives, enums::CollectionType::Drives, ""});
+    tree.chassis.add_or_update_entry(stored_chassis);
+    auto stored_storage = tree.storage.get_entry(storage.get_uuid());
+    stored_storage.add_collection({enums::CollectionName::Drives, enums::CollectionType::Drives, ""});
+    tree.storage.add_or_update_entry(stored_storage);
+    return counter.get();
+}
+
+/*! Discovery building the resources in place in the managers, updates modify the stored entries */
+std::size_t discover_in_place(Tree& tree) {
+    AllocationCounter counter{};
+    const auto chassis_uuid = tree.chassis.emplace_entry()->get_uuid();
+    const auto storage_uuid = tree.storage.emplace_entry(chassis_uuid, enums::Component::Chassis)->get_uuid();
+    for (std::size_t index = 0; index < DRIVES; ++index) {
+        std::string uuid{};
+        {
+            auto drive = tree.drives.emplace_entry(chassis_uuid, enums::Component::Chassis);
+            drive->set_firmware_version(make_text("Firmware version", index));
+            drive->set_asset_tag(make_text("Asset tag", index));
+            drive->set_fru_info(make_fru_info(index));
+            drive->set_identifiers(make_identifiers(index));
+            uuid = drive->get_uuid();
+        }
+        tree.storage_drives.add_entry(storage_uuid, uuid);
+
+        tree.drives.modify_entry(uuid, [index](Drive& stored) { stored.set_capacity_gb(double(index)); });
+    }
+    tree.chassis.modify_entry(chassis_uuid, [](Chassis& stored) {
+        stored.add_collection({enums::CollectionName::Drives, enums::CollectionType::Drives, ""});
+    });
+    tree.storage.modify_entry(storage_uuid, [](StorageSubsystem& stored) {
+        stored.add_collection({enums::CollectionName::Drives, enums::CollectionType::Drives, ""});
+    });
+    return counter.get();
+}
+
+/*! Drive as received from an agent */
+Json::Value make_drive_json(std::size_t index) {
+    Drive drive{"parent", enums::Component::Chassis};
+    drive.set_firmware_version(make_text("Firmware version", index));
+    drive.set_asset_tag(make_text("Asset tag", index));
+    drive.set_fru_info(make_fru_info(index));
+    drive.set_identifiers(make_identifiers(index));
+    return drive.to_json();
+}
+
+}
+
+void* operator new(std::size_t size) {
+    if (g_counting) {
+        ++g_allocations;
+    }
+    if (void* memory = std::malloc(0 == size ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+TEST(ModelAllocationTest, MovedValuesAreNotCopied) {
+    std::string text = make_text("Firmware version", 0);
+    Drive drive{};
+    {
+        AllocationCounter counter{};
+        drive.set_firmware_version(std::move(text));
+        EXPECT_EQ(0u, counter.get());
+    }
+    EXPECT_EQ(make_text("Firmware version", 0), drive.get_firmware_version().value());
+
+    auto identifiers = make_identifiers(0);
+    {
+        AllocationCounter counter{};
+        drive.set_identifiers(std::move(identifiers));
+        EXPECT_EQ(0u, counter.get());
+    }
+    ASSERT_EQ(1u, drive.get_identifiers().size());
+    EXPECT_EQ(make_text("Durable name", 0), drive.get_identifiers()[0].get_durable_name());
+}
+
+TEST(ModelAllocationTest, EntryFromJsonIsMovedToManager) {
+    const auto json = make_drive_json(0);
+    GenericManager<Drive> drive_manager{};
+
+    std::size_t copies{};
+    {
+        AllocationCounter counter{};
+        for (std::size_t index = 0; index < DRIVES; ++index) {
+            const auto drive = Drive::from_json(json);
+            drive_manager.add_or_update_entry(drive);
+        }
+        copies = counter.get();
+    }
+    std::size_t moves{};
+    {
+        AllocationCounter counter{};
+        for (std::size_t index = 0; index < DRIVES; ++index) {
+            drive_manager.add_or_update_entry(Drive::from_json(json));
+        }
+        moves = counter.get();
+    }
+    ASSERT_EQ(2 * DRIVES, drive_manager.get_entry_count());
+    for (const auto& uuid : drive_manager.get_keys()) {
+        const auto drive = drive_manager.get_entry(uuid);
+        EXPECT_EQ(make_text("Firmware version", 0), drive.get_firmware_version().value());
+        EXPECT_EQ(make_text("Manufacturer", 0), drive.get_fru_info().get_manufacturer().value());
+        ASSERT_EQ(1u, drive.get_identifiers().size());
+        EXPECT_EQ(make_text("Durable name", 0), drive.get_identifiers()[0].get_durable_name());
+    }
+    // each drive holds 7 long strings, all copied when the entry is passed by lvalue
+    EXPECT_LE(moves + DRIVES * 7, copies);
+}
+
+TEST(ModelAllocationTest, EntryIsModifiedInPlace) {
+    GenericManager<Drive> drive_manager{};
+    const auto uuid = drive_manager.emplace_entry("parent", enums::Component::Chassis)->get_uuid();
+    drive_manager.modify_entry(uuid, [](Drive& drive) { drive.set_fru_info(make_fru_info(0)); });
+    {
+        AllocationCounter counter{};
+        drive_manager.modify_entry(uuid, [](Drive& drive) { drive.set_erased(true); });
+        EXPECT_EQ(0u, counter.get());
+    }
+    const auto drive = drive_manager.get_entry(uuid);
+    EXPECT_TRUE(drive.get_erased().value());
+    EXPECT_EQ("parent", drive.get_parent_uuid());
+    EXPECT_EQ(make_text("Manufacturer", 0), drive.get_fru_info().get_manufacturer().value());
+    EXPECT_THROW(drive_manager.modify_entry("unknown", [](Drive&) { }), exceptions::InvalidUuid);
+    EXPECT_THROW(drive_manager.emplace_entry(drive), exceptions::InvalidUuid);
+    EXPECT_EQ(1u, drive_manager.get_entry_count());
+}
+
+TEST(ModelAllocationTest, TreeIsDiscoveredInPlace) {
+    Tree copied{};
+    const auto copies = discover_with_copies(copied);
+    Tree in_place{};
+    const auto allocations = discover_in_place(in_place);
+
+    for (const auto* tree : {&copied, &in_place}) {
+        ASSERT_EQ(1u, tree->chassis.get_entry_count());
+        ASSERT_EQ(1u, tree->storage.get_entry_count());
+        ASSERT_EQ(DRIVES, tree->drives.get_entry_count());
+    }
+    const auto chassis = in_place.chassis.get_entry(in_place.chassis.get_keys().front());
+    const auto storage = in_place.storage.get_entry(in_place.storage.get_keys().front());
+    ASSERT_EQ(1u, chassis.get_collections().size());
+    ASSERT_EQ(1u, storage.get_collections().size());
+    EXPECT_EQ(chassis.get_uuid(), storage.get_parent_uuid());
+    const auto drives = in_place.storage_drives.get_children(storage.get_uuid());
+    ASSERT_EQ(DRIVES, drives.size());
+    for (const auto& uuid : drives) {
+        const auto drive = in_place.drives.get_entry(uuid);
+        EXPECT_EQ(chassis.get_uuid(), drive.get_parent_uuid());
+        EXPECT_TRUE(drive.get_capacity_gb().has_value());
+        ASSERT_EQ(1u, drive.get_identifiers().size());
+        EXPECT_EQ(make_text("Manufacturer", std::size_t(drive.get_capacity_gb().value())),
+                  drive.get_fru_info().get_manufacturer().value());
+    }
+
+    std::cout << "Allocations for " << DRIVES + 2 << " resources: " << copies << " with copies, "
+              << allocations << " in place" << std::endl;
+    // each drive holds 7 long strings, the copying discovery copies them at least 4 times
+    EXPECT_LT(allocations + DRIVES * 7 * 3, copies);
+}
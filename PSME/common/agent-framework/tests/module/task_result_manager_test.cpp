@@ -0,0 +1,149 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section TaskResultManager retention tests
+ * */
+
+#include "agent-framework/action/task_result_manager.hpp"
+#include "agent-framework/action/task_cleaner.hpp"
+#include "agent-framework/module/common_components.hpp"
+#include "agent-framework/eventing/events_queue.hpp"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+
+
+using namespace agent_framework;
+using namespace agent_framework::action;
+
+class TaskResultManagerTest : public ::testing::Test {
+public:
+    virtual ~TaskResultManagerTest();
+
+
+    virtual void SetUp();
+
+
+    virtual void TearDown();
+
+
+    TaskResultManager::RetentionPolicy m_default_policy{};
+};
+
+
+TaskResultManagerTest::~TaskResultManagerTest() { }
+
+
+void TaskResultManagerTest::SetUp() {
+    m_default_policy = TaskResultManager::get_instance()->get_retention_policy();
+}
+
+
+void TaskResultManagerTest::TearDown() {
+    // Push out all results stored by the test with a single sentinel one
+    auto manager = TaskResultManager::get_instance();
+    manager->set_retention_policy({1, std::chrono::seconds{0}});
+    manager->set_result("sentinel", Json::Value{});
+    manager->remove_outdated();
+    manager->remove_result("sentinel");
+    manager->set_retention_policy(m_default_policy);
+    module::CommonComponents::get_instance()->get_task_manager().clear_entries();
+    eventing::EventsQueue::get_instance()->clear();
+}
+
+
+TEST_F(TaskResultManagerTest, FirstResultIsKept) {
+    auto manager = TaskResultManager::get_instance();
+    manager->set_result("task", Json::Value{"first"});
+    manager->set_result("task", Json::Value{"second"});
+
+    ASSERT_TRUE(manager->task_exists("task"));
+    ASSERT_EQ(manager->get_result("task").asString(), "first");
+}
+
+
+TEST_F(TaskResultManagerTest, OldestResultsAreRemovedFirst) {
+    auto manager = TaskResultManager::get_instance();
+    manager->set_retention_policy({2, std::chrono::seconds{0}});
+    manager->set_result("task-1", Json::Value{});
+    manager->set_result("task-2", Json::Value{});
+    manager->set_exception("task-3", exceptions::GamiException(exceptions::ErrorCode::UNKNOWN_ERROR, "error"));
+
+    const auto removed = manager->remove_outdated();
+    ASSERT_EQ(removed.size(), 1);
+    ASSERT_EQ(removed.front(), "task-1");
+    ASSERT_FALSE(manager->task_exists("task-1"));
+    ASSERT_TRUE(manager->task_exists("task-2"));
+    ASSERT_THROW(manager->get_result("task-3"), exceptions::GamiException);
+}
+
+
+TEST_F(TaskResultManagerTest, ExpiredResultsAreRemoved) {
+    auto manager = TaskResultManager::get_instance();
+    manager->set_retention_policy({0, std::chrono::seconds{1}});
+    manager->set_result("task", Json::Value{});
+    ASSERT_TRUE(manager->remove_outdated().empty());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{1100});
+    ASSERT_EQ(manager->remove_outdated().size(), 1);
+    ASSERT_EQ(manager->get_result_count(), 0);
+}
+
+
+TEST_F(TaskResultManagerTest, RemovedResultCanBeSetAgain) {
+    auto manager = TaskResultManager::get_instance();
+    manager->set_result("task", Json::Value{"first"});
+    manager->remove_result("task");
+    ASSERT_FALSE(manager->task_exists("task"));
+
+    manager->set_result("task", Json::Value{"second"});
+    ASSERT_EQ(manager->get_result("task").asString(), "second");
+}
+
+
+TEST_F(TaskResultManagerTest, SoakTaskCountStaysBounded) {
+    constexpr std::size_t TASK_COUNT = 100000;
+    constexpr std::size_t MAX_COUNT = 1000;
+    constexpr std::size_t CLEANUP_PERIOD = 500;
+
+    auto manager = TaskResultManager::get_instance();
+    auto& task_manager = module::CommonComponents::get_instance()->get_task_manager();
+    manager->set_retention_policy({MAX_COUNT, std::chrono::seconds{0}});
+
+    for (std::size_t i = 0; i < TASK_COUNT; ++i) {
+        model::Task task{};
+        const auto uuid = task.get_uuid();
+        task_manager.add_entry(std::move(task));
+        manager->set_result(uuid, Json::Value{Json::UInt64(i)});
+
+        if (0 == (i + 1) % CLEANUP_PERIOD) {
+            TaskCleaner::remove_outdated_tasks();
+            eventing::EventsQueue::get_instance()->clear();
+        }
+        ASSERT_LE(manager->get_result_count(), MAX_COUNT + CLEANUP_PERIOD);
+        ASSERT_LE(task_manager.get_entry_count(), MAX_COUNT + CLEANUP_PERIOD);
+    }
+
+    ASSERT_EQ(manager->get_result_count(), MAX_COUNT);
+    ASSERT_EQ(task_manager.get_entry_count(), MAX_COUNT);
+}
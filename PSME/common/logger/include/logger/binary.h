@@ -0,0 +1,215 @@
+/*!
+ * @brief Binary log file format and decoder C prototypes
+ *
+ * @copyright Copyright (c) 2017 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Binary log file starts with #logger_binary_file_header followed by
+ * records. Each record starts with #logger_binary_record_header and is
+ * padded to #LOGGER_BINARY_ALIGNMENT bytes. Record of zero size marks the end
+ * of the data. All values are stored in host byte order.
+ *
+ * Logger tags and call sites (file, function and line) are written once per
+ * file as definition records, messages refer to them by ids. Ids are unique
+ * within the file only.
+ *
+ * @header{Files}
+ * @file binary.h
+ */
+
+#ifndef LOGGER_BINARY_H
+#define LOGGER_BINARY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @def LOGGER_BINARY_MAGIC
+ * Magic string which starts each binary log file
+ *
+ * @def LOGGER_BINARY_VERSION
+ * Version of the binary log file format
+ *
+ * @def LOGGER_BINARY_ALIGNMENT
+ * Alignment of all records in the file
+ * */
+#define LOGGER_BINARY_MAGIC         "PSMEBLOG"
+#define LOGGER_BINARY_VERSION       1
+#define LOGGER_BINARY_ALIGNMENT     8
+
+/*!
+ * @enum logger_binary_record_type
+ * @brief Binary log record type
+ *
+ * @var logger_binary_record_type::LOGGER_BINARY_RECORD_TAG
+ * Logger tag definition: uint32_t id followed by NUL terminated tag
+ *
+ * @var logger_binary_record_type::LOGGER_BINARY_RECORD_CALL_SITE
+ * Call site definition: uint32_t id, uint32_t line number followed by NUL
+ * terminated file and function names
+ *
+ * @var logger_binary_record_type::LOGGER_BINARY_RECORD_MESSAGE
+ * Log message: #logger_binary_message followed by message string
+ * */
+enum logger_binary_record_type {
+    LOGGER_BINARY_RECORD_TAG        = 1,
+    LOGGER_BINARY_RECORD_CALL_SITE  = 2,
+    LOGGER_BINARY_RECORD_MESSAGE    = 3
+};
+
+/*!
+ * @struct logger_binary_file_header
+ * @brief Binary log file header
+ *
+ * @var logger_binary_file_header::magic
+ * #LOGGER_BINARY_MAGIC without terminating NUL
+ *
+ * @var logger_binary_file_header::version
+ * #LOGGER_BINARY_VERSION
+ *
+ * @var logger_binary_file_header::header_size
+ * Size of the header, first record starts right after it
+ * */
+struct logger_binary_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+};
+
+/*!
+ * @struct logger_binary_record_header
+ * @brief Header of each record
+ *
+ * @var logger_binary_record_header::size
+ * Size of the record with the header and the padding. It is written as the
+ * last part of the record, so record of non zero size is complete
+ *
+ * @var logger_binary_record_header::type
+ * Record type #logger_binary_record_type
+ *
+ * @var logger_binary_record_header::reserved
+ * Always zero
+ * */
+struct logger_binary_record_header {
+    uint32_t size;
+    uint16_t type;
+    uint16_t reserved;
+};
+
+/*!
+ * @struct logger_binary_message
+ * @brief Log message record body
+ *
+ * @var logger_binary_message::seconds
+ * Log time stamp, seconds since the epoch
+ *
+ * @var logger_binary_message::nanoseconds
+ * Log time stamp, nanoseconds
+ *
+ * @var logger_binary_message::tag_id
+ * Logger tag id, 0 when unknown
+ *
+ * @var logger_binary_message::call_site_id
+ * Call site id, 0 when unknown
+ *
+ * @var logger_binary_message::level
+ * Log level
+ *
+ * @var logger_binary_message::length
+ * Length of the message string following the body (without terminating NUL)
+ * */
+struct logger_binary_message {
+    int64_t seconds;
+    uint32_t nanoseconds;
+    uint32_t tag_id;
+    uint32_t call_site_id;
+    uint32_t level;
+    uint32_t length;
+    uint32_t reserved;
+};
+
+/*!
+ * @struct logger_binary_entry
+ * @brief Decoded log message
+ *
+ * @var logger_binary_entry::seconds
+ * Log time stamp, seconds since the epoch
+ *
+ * @var logger_binary_entry::nanoseconds
+ * Log time stamp, nanoseconds
+ *
+ * @var logger_binary_entry::level
+ * Log level
+ *
+ * @var logger_binary_entry::tag
+ * Logger tag, NULL when unknown
+ *
+ * @var logger_binary_entry::file_name
+ * File name, NULL when unknown
+ *
+ * @var logger_binary_entry::function_name
+ * Function name, NULL when unknown
+ *
+ * @var logger_binary_entry::line_number
+ * Line number, 0 when unknown
+ *
+ * @var logger_binary_entry::message
+ * Message string, not NUL terminated
+ *
+ * @var logger_binary_entry::length
+ * Message string length
+ * */
+struct logger_binary_entry {
+    int64_t seconds;
+    uint32_t nanoseconds;
+    unsigned int level;
+    const char *tag;
+    const char *file_name;
+    const char *function_name;
+    unsigned int line_number;
+    const char *message;
+    size_t length;
+};
+
+/*!
+ * @brief Called for each decoded message
+ *
+ * @param[in]   context     User context given to logger_binary_decode()
+ * @param[in]   entry       Decoded message, valid only during the call
+ * @return      0 to continue decoding, other value stops decoding
+ * */
+typedef int (*logger_binary_callback_t)(void *context,
+        const struct logger_binary_entry *entry);
+
+/*!
+ * @brief Decode all messages stored in binary log file
+ *
+ * Decoding stops at the end of data or at the first malformed record.
+ *
+ * @param[in]   file_name   Binary log file name
+ * @param[in]   callback    Called for each decoded message
+ * @param[in]   context     User context passed to the callback
+ * @return      Number of decoded messages or a negative error code when the
+ *              file cannot be read or it is not a binary log file
+ * */
+long logger_binary_decode(const char *file_name,
+        logger_binary_callback_t callback, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_BINARY_H */
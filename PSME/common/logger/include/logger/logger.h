@@ -46,12 +46,16 @@
  * Set default wake up time in seconds for all created logger stream threads.
  * After wake up, thread will flush all remaining data in buffer stream
  *
+ * @def LOGGER_DEFAULT_BINARY_FILE_SIZE
+ * Set default size of a single file written by binary logger streams
+ *
  * */
 #define LOGGER_DEFAULT_STREAM_SIZE              4096
 #define LOGGER_DEFAULT_BUFFER_SIZE              1024
 #define LOGGER_DEFAULT_SOCKET_SIZE              512
 #define LOGGER_STREAM_UDP_RECEIVE_TIMEOUT_US    5000
 #define LOGGER_DEFAULT_THREAD_WAKE_SEC          1
+#define LOGGER_DEFAULT_BINARY_FILE_SIZE         (16 * 1024 * 1024)
 
 /*!
  * @def LOGGER_ARRAY_SIZE(array)
@@ -199,6 +203,10 @@ extern "C" {
  *
  * @var logger_options::output_enable
  * Enable/disable output
+ *
+ * @var logger_options::drop_on_full
+ * Drop messages when stream queue is full instead of waiting for free space.
+ * Only applies for logger stream object
  * */
 union logger_options {
     struct {
@@ -209,6 +217,7 @@ union logger_options {
         unsigned int more_debug : 1;
         unsigned int output_enable : 1;
         unsigned int def_level:3;
+        unsigned int drop_on_full : 1;
     }option;
     unsigned int raw;
 };
@@ -139,10 +139,74 @@ public:
             unsigned int line_number,
             const std::string& str);
 
+    /*!
+     * @brief Write log message without copying it. Used by log_* functions
+     *
+     * @param[in]   logger_name     Logger name to be put in the log file
+     * @param[in]   level           Log level
+     * @param[in]   file_name       File name string
+     * @param[in]   function_name   Function name string
+     * @param[in]   line_number     Line number
+     * @param[in]   str             Log message string to write
+     * */
+    void write(
+            const char* logger_name,
+            enum Level level,
+            const char* file_name,
+            const char* function_name,
+            unsigned int line_number,
+            const char* str);
+
 };
 using LoggerSPtr = std::shared_ptr<Logger>;
 using loggerUPtr = std::unique_ptr<Logger>;
 
+/*!
+ * @class logger_cpp::MessageStream
+ * @brief Output stream used by log_* functions to format messages
+ *
+ * Streams are kept per thread and reused, so formatting a message doesn't
+ * allocate memory unless it is longer than all messages formatted before.
+ * Messages logged while another one is formatted get their own streams.
+ * */
+class MessageStream final {
+public:
+    /*!
+     * @brief Take empty stream of the current thread
+     * */
+    MessageStream();
+
+    /*!
+     * @brief Give the stream back to the current thread
+     * */
+    ~MessageStream();
+
+    /*!
+     * @brief Get stream to write the message to
+     * @return output stream
+     * */
+    std::ostream& get_stream();
+
+    /*!
+     * @brief Get formatted message
+     * @return message string, valid until the object is destroyed
+     * */
+    const char* c_str() const;
+
+private:
+    MessageStream(const MessageStream&) = delete;
+    MessageStream& operator=(const MessageStream&) = delete;
+
+    class Buffer;
+    struct Entry;
+    struct ThreadStreams;
+
+    /*! @brief Get streams of the current thread */
+    static ThreadStreams& get_thread_streams();
+
+    Entry& m_entry;
+};
+
 /*!
  * @brief Write array to output stream object
  *
@@ -303,23 +367,27 @@ const char* logger_get_logger_name(LoggerSPtr logger);
 /*!
  * @brief Logger output stream write
  *
+ * Logger is looked up once per call site (see logger_cpp::LoggerHandle),
+ * the message is formatted only if it is to be logged.
+ *
  * @param[in]   inst    Logger buffer instance
  * @param[in]   level   Log level
  * @param[in]   stream  Stream
  * */
 #define log_write(inst, level, stream) \
     do {\
-        logger_cpp::LoggerSPtr __ptr = logger_cpp::LoggerFactory::instance().get_logger(inst);\
+        static logger_cpp::LoggerHandle __handle;\
+        logger_cpp::Logger* __ptr = __handle.get(inst);\
         if (__ptr && __ptr->is_loggable(level)) {\
-            std::stringstream __stream;\
-            __stream << std::string("") << stream;\
+            logger_cpp::MessageStream __stream;\
+            __stream.get_stream() << stream;\
             __ptr->write(\
                 logger_cpp::logger_get_logger_name(inst),\
                 level,\
                 LOGGER_FILE_NAME,\
                 LOGGER_FUNCTION_NAME,\
                 LOGGER_LINE_NUMBER,\
-                __stream.str()\
+                __stream.c_str()\
             );\
         }\
     } while (0)
@@ -25,6 +25,8 @@
 #include "logger/stream.hpp"
 #include "logger/logger.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 namespace logger_cpp {
@@ -123,6 +125,18 @@ public:
      */
     static const char* get_main_logger_name();
 
+    /*!
+     * @brief Get generation of the loggers configuration
+     *
+     * Generation is changed each time loggers returned by get_logger()
+     * might change: loggers are set, main logger name is set or on cleanup.
+     *
+     * @return generation number
+     */
+    static unsigned get_generation() {
+        return g_generation.load(std::memory_order_acquire);
+    }
+
 private:
     LoggerFactory();
     ~LoggerFactory() = default;
@@ -136,6 +150,81 @@ private:
     static StreamSPtr g_global_stream;
 
     static const char* g_main_logger_name;
+
+    static std::atomic<unsigned> g_generation;
+
+    static void next_generation();
+};
+
+/*!
+ * @brief Logger cached at the log_* call site
+ *
+ * Logger found by name is kept until loggers configuration changes, so
+ * logging doesn't look up the loggers map, nor touches shared pointers.
+ * Names are expected to be string literals (GET_LOGGER), they are compared
+ * by addresses. Cached logger is read without locking, it is guarded with
+ * sequence number changed when the logger is updated.
+ *
+ * @warning As with LoggerFactory::get_logger(), loggers configuration must
+ * not be changed while other threads log.
+ */
+class LoggerHandle final {
+public:
+    constexpr LoggerHandle() { }
+
+    /*!
+     * @brief Get logger for given name
+     * @param name Logger name
+     * @return Logger, nullptr if not found
+     */
+    Logger* get(const char* name) {
+        const unsigned sequence = m_sequence.load(std::memory_order_acquire);
+        if (0 == (sequence & 1)) {
+            const char* cached_name = m_name.load(std::memory_order_relaxed);
+            Logger* logger = m_logger.load(std::memory_order_relaxed);
+            const unsigned generation = m_generation.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if ((sequence == m_sequence.load(std::memory_order_relaxed)) && (cached_name == name) &&
+                (generation == LoggerFactory::get_generation()) && (nullptr != logger)) {
+                return logger;
+            }
+        }
+        return update(name);
+    }
+
+    /*!
+     * @brief Get logger for given name, not cached
+     * @param name Logger name
+     * @return Logger, nullptr if not found
+     */
+    Logger* get(const std::string& name) {
+        return LoggerFactory::instance().get_logger(name).get();
+    }
+
+    /*!
+     * @brief Get logger, dumb method to handle overloaded calls
+     * @param logger Shared pointer to logger
+     * @return Logger
+     */
+    Logger* get(const LoggerSPtr& logger) {
+        return logger.get();
+    }
+
+private:
+    LoggerHandle(const LoggerHandle&) = delete;
+    LoggerHandle& operator=(const LoggerHandle&) = delete;
+
+    /*!
+     * @brief Find logger in the factory and cache it
+     * @param name Logger name
+     * @return Logger
+     */
+    Logger* update(const char* name);
+
+    std::atomic<unsigned> m_sequence{0};
+    std::atomic<const char*> m_name{nullptr};
+    std::atomic<Logger*> m_logger{nullptr};
+    std::atomic<unsigned> m_generation{0};
 };
 
 }
@@ -113,6 +113,13 @@ public:
      * @param[in]   enable      Enable/disable more debug
      * */
     void enable_more_debug(bool enable);
+
+    /*!
+     * @brief Enable/disable dropping messages when stream queue is full,
+     * by default logging waits for free space in the queue
+     * @param[in]   enable      Enable/disable dropping
+     * */
+    void enable_drop_on_full(bool enable);
 };
 
 }
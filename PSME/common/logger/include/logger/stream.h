@@ -20,6 +20,7 @@
 #ifndef LOGGER_STREAM_H
 #define LOGGER_STREAM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*!
@@ -40,6 +41,9 @@
  *
  * @var logger_stream_type::LOGGER_STREAM_DIRECT
  * log directly to the console (without queueing in the worker)
+ *
+ * @var logger_stream_type::LOGGER_STREAM_BINARY
+ * Binary records in memory mapped rotating files, see logger/binary.h
  * */
 enum logger_stream_type {
     LOGGER_STREAM_STDOUT    = 0,
@@ -47,7 +51,8 @@ enum logger_stream_type {
     LOGGER_STREAM_FILE      = 2,
     LOGGER_STREAM_UDP       = 3,
     LOGGER_STREAM_TCP       = 4,
-    LOGGER_STREAM_DIRECT    = 5
+    LOGGER_STREAM_DIRECT    = 5,
+    LOGGER_STREAM_BINARY    = 6
 };
 
 struct logger_stream;
@@ -127,6 +132,23 @@ int logger_stream_open_tcp(struct logger_stream *inst,
 int logger_stream_open_file(struct logger_stream *inst,
         const char *file_name);
 
+/*!
+ * @brief Configure binary stream with given file name
+ *
+ * When the file is full, it is renamed with ".1" suffix (older files are
+ * shifted up to given number of files) and new file is started.
+ *
+ * @param[in]   inst        Logger stream instance
+ * @param[in]   file_name   File name string path like /var/log/example.blog
+ * @param[in]   file_size   Maximal size of single file in bytes, 0 means
+ *                          default size
+ * @param[in]   file_count  Number of rotated files kept
+ * @return      When success return #LOGGER_SUCCESS otherwise a negative
+ *              error code
+ * */
+int logger_stream_open_binary(struct logger_stream *inst,
+        const char *file_name, size_t file_size, unsigned int file_count);
+
 /*!
  * @brief Set logger options
  *
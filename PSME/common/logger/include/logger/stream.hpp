@@ -22,6 +22,8 @@
 #include "logger/logger_options.hpp"
 #include "logger/logger.hpp"
 
+#include <cstddef>
+
 namespace logger_cpp {
 
 /*!
@@ -47,7 +49,8 @@ public:
         FILE      = 2,
         UDP       = 3,
         TCP       = 4,
-        DIRECT    = 5
+        DIRECT    = 5,
+        BINARY    = 6
     } Type;
 
     /*!
@@ -86,6 +89,17 @@ public:
      * */
     void open_file(const char* file_name);
 
+    /*!
+     * @brief Open binary log file with given file name path. Stream type
+     * must match to binary type, otherwise it will now work
+     *
+     * @param[in]   file_name   File name path
+     * @param[in]   file_size   Maximal size of single file, 0 means default
+     * @param[in]   file_count  Number of rotated files kept
+     * */
+    void open_binary(const char* file_name, std::size_t file_size = 0,
+            unsigned file_count = 1);
+
     /*!
      * @brief Open IP UDP socket with given IP address and UDP port.
      * Stream type must match to UDP type, otherwise it will now work
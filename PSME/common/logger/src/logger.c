@@ -40,6 +40,12 @@ extern "C" {
 #endif
 
 
+/*!
+ * @def LOGGER_FORMAT_BUFFER_SIZE
+ * Messages formatted by logger which are shorter are not allocated
+ * */
+#define LOGGER_FORMAT_BUFFER_SIZE       512
+
 static const union logger_options g_logger_default_options = {
     .option = {
         .level = LOG_DEBUG,
@@ -153,9 +159,11 @@ static void __log_write(
         const char *file_name,
         const char *function_name,
         const unsigned int line_number,
-        struct logger_stream_message *msg,
-        const size_t size) {
-    int err;
+        const char *message,
+        const size_t message_length) {
+
+    struct logger_stream_message header;
+    memset(&header, 0, sizeof(header));
 
     /* Additional debug information */
     if (inst->options.option.more_debug) {
@@ -163,46 +171,27 @@ static void __log_write(
          * are located in read-only section by the compiler/linker and they
          * have non-volatile constant address that will never change during
          * whole program execution */
-        msg->line_number = line_number;
-        msg->file_name = (NULL == file_name) ? "" : file_name;
-        msg->function_name = (NULL == function_name) ? "" : function_name;
+        header.line_number = line_number;
+        header.file_name = (NULL == file_name) ? "" : file_name;
+        header.function_name = (NULL == function_name) ? "" : function_name;
     }
 
     /* Set log level, tag, flags and time stamp format */
-    msg->tag = logger_name;
-    msg->options.raw = inst->options.raw;
-    msg->options.option.level = LOG_LEVEL_MASK & level;
+    header.tag = logger_name;
+    header.options.raw = inst->options.raw;
+    header.options.option.level = LOG_LEVEL_MASK & level;
 
     /* Re-stamp log time */
-    logger_time_update(&msg->log_time);
+    logger_time_update(&header.log_time);
 
+    /* Each stream object gets its own copy of the message, because
+     * streams can handle messages with different speed */
     struct logger_list_node *it;
-    struct logger_stream_message *msg_copy = NULL;
-
-    /* When more than one stream object present in the list,
-     * processing other stream objects with new copy message, because
-     * other streams can handle message with different speed */
     for (it = inst->stream_list.first; NULL != it; it = it->next) {
-        if (NULL != it->next) {
-            msg_copy = logger_memory_alloc(size);
-            if (NULL != msg_copy) {
-                memcpy_s(msg_copy, size, msg, size);
-            } else {
-                logger_memory_free(msg);
-                return;
-            }
-        }
-
-        err = logger_stream_add_message(it->object,
-                msg, LOGGER_MESSAGE_STREAM_WRITE);
-        if (err) {
-            logger_memory_free(msg);
-            logger_memory_free(msg_copy);
+        if (LOGGER_SUCCESS != logger_stream_add_write(it->object,
+                &header, message, message_length)) {
             return;
         }
-
-        msg = msg_copy;
-        msg_copy = NULL;
     }
 }
 
@@ -219,24 +208,31 @@ static void __vlog_write(
     va_list args_copy;
     va_copy(args_copy, args);
 
-    /* Get how much bytes to allocate for message string */
-    int message_length = vsnprintf(NULL, 0, fmt, args_copy);
+    /* Short messages are formatted on the stack */
+    char buffer[LOGGER_FORMAT_BUFFER_SIZE];
+    int message_length = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    if (message_length < 0) {
+        va_end(args_copy);
+        return;
+    }
+
+    char *message = buffer;
+    if ((size_t)message_length >= sizeof(buffer)) {
+        message = logger_memory_alloc((size_t)message_length + 1);
+        if (NULL == message) {
+            va_end(args_copy);
+            return;
+        }
+        vsnprintf(message, (size_t)message_length + 1, fmt, args_copy);
+    }
     va_end(args_copy);
-    if (message_length < 0) return;
 
-    /* Create logger message object extended with message string */
-    size_t size =  sizeof(struct logger_stream_message)
-        + (size_t)message_length + 1;
-    struct logger_stream_message *msg = logger_memory_alloc(size);
-    if (NULL == msg) return;
+    __log_write(inst, logger_name, level, file_name, function_name, line_number,
+            message, (size_t)message_length);
 
-    /* Put formatted string to logger message object */
-    if (vsnprintf(msg->message, (size_t)message_length, fmt, args) < 0) {
-        logger_memory_free(msg);
-        return;
+    if (message != buffer) {
+        logger_memory_free(message);
     }
-
-    __log_write(inst, logger_name, level, file_name, function_name, line_number, msg, size);
 }
 
 void _log_write(
@@ -251,18 +247,8 @@ void _log_write(
     logger_assert(NULL != inst);
     logger_assert(NULL != message);
 
-    size_t message_length = strnlen_s(message, RSIZE_MAX_STR);
-    size_t size =  sizeof(struct logger_stream_message) + message_length + 1;
-
-    struct logger_stream_message *msg = logger_memory_alloc(size);
-    if (NULL == msg) {
-        return;
-    }
-
-    memcpy_s(msg->message, message_length, message, message_length);
-    msg->message[message_length] = '\0';
-
-    __log_write(inst, logger_name, level, file_name, function_name, line_number, msg, size);
+    __log_write(inst, logger_name, level, file_name, function_name, line_number,
+            message, strnlen_s(message, RSIZE_MAX_STR));
 }
 
 void _log_vwrite(
@@ -20,8 +20,97 @@
 #include "logger/logger.hpp"
 #include "logger/stream.hpp"
 
+namespace {
+
+/*! Buffers bigger than that are released after use */
+constexpr std::size_t MAX_RETAINED_CAPACITY = 16 * 1024;
+
+}
+
 namespace logger_cpp {
 
+/*! @brief Stream buffer appending to reused string */
+class MessageStream::Buffer final : public std::streambuf {
+public:
+    const char* c_str() const {
+        return m_data.c_str();
+    }
+
+    void reset() {
+        if (m_data.capacity() > MAX_RETAINED_CAPACITY) {
+            std::string{}.swap(m_data);
+        }
+        else {
+            m_data.clear();
+        }
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            m_data.push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* str, std::streamsize count) override {
+        m_data.append(str, static_cast<std::size_t>(count));
+        return count;
+    }
+
+private:
+    std::string m_data{};
+};
+
+/*! @brief Stream with its buffer */
+struct MessageStream::Entry final {
+    Entry() : stream(&buffer) { }
+
+    Buffer buffer{};
+    std::ostream stream;
+};
+
+/*! @brief Streams of the thread, one for each nesting level */
+struct MessageStream::ThreadStreams final {
+    std::vector<std::unique_ptr<Entry>> entries{};
+    std::size_t depth{0};
+};
+
+MessageStream::ThreadStreams& MessageStream::get_thread_streams() {
+    static thread_local ThreadStreams streams{};
+    return streams;
+}
+
+MessageStream::MessageStream() :
+    m_entry([]() -> Entry& {
+        auto& streams = get_thread_streams();
+        if (streams.entries.size() <= streams.depth) {
+            streams.entries.emplace_back(new Entry());
+        }
+        return *streams.entries[streams.depth++];
+    }()) {
+
+    /* Restore default formatting, previous message might change it */
+    m_entry.stream.clear();
+    m_entry.stream.flags(std::ios_base::skipws | std::ios_base::dec);
+    m_entry.stream.fill(' ');
+    m_entry.stream.precision(6);
+    m_entry.stream.width(0);
+}
+
+MessageStream::~MessageStream() {
+    m_entry.buffer.reset();
+    get_thread_streams().depth--;
+}
+
+std::ostream& MessageStream::get_stream() {
+    return m_entry.stream;
+}
+
+const char* MessageStream::c_str() const {
+    return m_entry.buffer.c_str();
+}
+
 Logger::Logger(const char* tag, const Options& options) :
     m_streams{} {
     union logger_options opt;
@@ -84,12 +173,24 @@ void Logger::write(
     unsigned int line_number,
     const std::string& str) {
 
+    write(logger_name, level, file_name, function_name, line_number, str.c_str());
+}
+
+
+void Logger::write(
+    const char* logger_name,
+    enum Level level,
+    const char* file_name,
+    const char* function_name,
+    unsigned int line_number,
+    const char* str) {
+
     _log_write(
         m_impl,
         logger_name,
         static_cast<unsigned int>(level),
         file_name, function_name, line_number,
-        str.c_str()
+        str
     );
 }
 
@@ -0,0 +1,246 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_binary.c
+ *
+ * @brief Binary log file decoder implementation
+ * */
+
+#include "logger/binary.h"
+#include "logger/logger.h"
+
+#include "logger_memory.h"
+
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*!
+ * @struct logger_binary_definition
+ * @brief Tag or call site definition found in the file
+ *
+ * @var logger_binary_definition::name
+ * Tag or file name
+ *
+ * @var logger_binary_definition::function_name
+ * Function name, NULL for tags
+ *
+ * @var logger_binary_definition::line_number
+ * Line number, 0 for tags
+ * */
+struct logger_binary_definition {
+    const char *name;
+    const char *function_name;
+    unsigned int line_number;
+};
+
+/*!
+ * @struct logger_binary_definitions
+ * @brief Definitions indexed by id
+ *
+ * @var logger_binary_definitions::items
+ * Definitions
+ *
+ * @var logger_binary_definitions::size
+ * Number of allocated definitions
+ * */
+struct logger_binary_definitions {
+    struct logger_binary_definition *items;
+    size_t size;
+};
+
+static bool logger_binary_define(struct logger_binary_definitions *defs,
+        uint32_t id, const struct logger_binary_definition *definition) {
+    if (id >= defs->size) {
+        size_t size = (0 == defs->size) ? 256 : defs->size;
+        while (size <= id) {
+            size *= 2;
+        }
+        struct logger_binary_definition *items =
+            logger_memory_alloc(size * sizeof(*items));
+        if (NULL == items) {
+            return false;
+        }
+        memset(items, 0, size * sizeof(*items));
+        if (NULL != defs->items) {
+            memcpy(items, defs->items, defs->size * sizeof(*items));
+            logger_memory_free(defs->items);
+        }
+        defs->items = items;
+        defs->size = size;
+    }
+    defs->items[id] = *definition;
+    return true;
+}
+
+static const struct logger_binary_definition *logger_binary_find(
+        const struct logger_binary_definitions *defs, uint32_t id) {
+    if ((0 == id) || (id >= defs->size) || (NULL == defs->items[id].name)) {
+        return NULL;
+    }
+    return &defs->items[id];
+}
+
+/* Get NUL terminated string within the record, NULL if it's not terminated */
+static const char *logger_binary_string(const char *data, size_t *offset,
+        size_t end) {
+    const char *str = &data[*offset];
+    const char *nul = memchr(str, '\0', end - *offset);
+    if (NULL == nul) {
+        return NULL;
+    }
+    *offset = (size_t)(nul - data) + 1;
+    return str;
+}
+
+static long logger_binary_decode_data(const char *data, size_t size,
+        logger_binary_callback_t callback, void *context) {
+    struct logger_binary_file_header header;
+    struct logger_binary_record_header record;
+    struct logger_binary_definitions defs = {NULL, 0};
+    long count = 0;
+
+    memcpy(&header, data, sizeof(header));
+    if ((0 != memcmp(header.magic, LOGGER_BINARY_MAGIC, sizeof(header.magic)))
+            || (LOGGER_BINARY_VERSION != header.version)
+            || (header.header_size < sizeof(header))
+            || (header.header_size > size)
+            || (0 != header.header_size % LOGGER_BINARY_ALIGNMENT)) {
+        return LOGGER_ERROR_TYPE;
+    }
+
+    /* Each definition takes more than alignment, bigger ids are malformed */
+    const size_t max_id = size / LOGGER_BINARY_ALIGNMENT;
+    size_t position = header.header_size;
+
+    while (position + sizeof(record) <= size) {
+        memcpy(&record, &data[position], sizeof(record));
+        if ((0 == record.size) || (0 != record.size % LOGGER_BINARY_ALIGNMENT)
+                || (record.size < sizeof(record))
+                || (record.size > size - position)) {
+            break;
+        }
+        const size_t end = position + record.size;
+        size_t offset = position + sizeof(record);
+        uint32_t values[2];
+        struct logger_binary_definition definition = {NULL, NULL, 0};
+
+        if (LOGGER_BINARY_RECORD_TAG == record.type) {
+            if (end - offset < sizeof(values[0])) break;
+            memcpy(values, &data[offset], sizeof(values[0]));
+            offset += sizeof(values[0]);
+            definition.name = logger_binary_string(data, &offset, end);
+            if ((NULL == definition.name) || (0 == values[0])
+                    || (values[0] > max_id)
+                    || !logger_binary_define(&defs, values[0], &definition)) {
+                break;
+            }
+        }
+        else if (LOGGER_BINARY_RECORD_CALL_SITE == record.type) {
+            if (end - offset < sizeof(values)) break;
+            memcpy(values, &data[offset], sizeof(values));
+            offset += sizeof(values);
+            definition.line_number = values[1];
+            definition.name = logger_binary_string(data, &offset, end);
+            if (NULL == definition.name) break;
+            definition.function_name = logger_binary_string(data, &offset, end);
+            if ((NULL == definition.function_name) || (0 == values[0])
+                    || (values[0] > max_id)
+                    || !logger_binary_define(&defs, values[0], &definition)) {
+                break;
+            }
+        }
+        else if (LOGGER_BINARY_RECORD_MESSAGE == record.type) {
+            struct logger_binary_message body;
+            if (end - offset < sizeof(body)) break;
+            memcpy(&body, &data[offset], sizeof(body));
+            offset += sizeof(body);
+            if (body.length > end - offset) break;
+
+            const struct logger_binary_definition *tag =
+                logger_binary_find(&defs, body.tag_id);
+            const struct logger_binary_definition *call_site =
+                logger_binary_find(&defs, body.call_site_id);
+
+            struct logger_binary_entry entry = {
+                .seconds = body.seconds,
+                .nanoseconds = body.nanoseconds,
+                .level = body.level,
+                .tag = (NULL != tag) ? tag->name : NULL,
+                .file_name = (NULL != call_site) ? call_site->name : NULL,
+                .function_name = (NULL != call_site) ?
+                    call_site->function_name : NULL,
+                .line_number = (NULL != call_site) ? call_site->line_number : 0,
+                .message = &data[offset],
+                .length = body.length
+            };
+            count++;
+            if (0 != callback(context, &entry)) {
+                break;
+            }
+        }
+        /* Records of unknown types are skipped */
+
+        position = end;
+    }
+
+    logger_memory_free(defs.items);
+    return count;
+}
+
+long logger_binary_decode(const char *file_name,
+        logger_binary_callback_t callback, void *context) {
+    if ((NULL == file_name) || (NULL == callback)) {
+        return LOGGER_ERROR_NULL;
+    }
+
+    int fd = open(file_name, O_RDONLY | O_CLOEXEC);
+    if (0 > fd) {
+        return LOGGER_ERROR;
+    }
+
+    struct stat file_stat;
+    if (0 != fstat(fd, &file_stat)) {
+        close(fd);
+        return LOGGER_ERROR;
+    }
+    if ((size_t)file_stat.st_size < sizeof(struct logger_binary_file_header)) {
+        close(fd);
+        return LOGGER_ERROR_TYPE;
+    }
+
+    size_t size = (size_t)file_stat.st_size;
+    void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == data) {
+        return LOGGER_ERROR;
+    }
+
+    long count = logger_binary_decode_data(data, size, callback, context);
+
+    munmap(data, size);
+    return count;
+}
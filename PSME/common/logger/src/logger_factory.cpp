@@ -76,6 +76,16 @@ const char* LoggerFactory::g_main_logger_name = nullptr;
 LoggerSPtr LoggerFactory::g_global_logger{nullptr};
 StreamSPtr LoggerFactory::g_global_stream{nullptr};
 
+/* handles with generation 0 are never valid */
+std::atomic<unsigned> LoggerFactory::g_generation{1};
+
+namespace {
+
+/*! Handles are updated one by one */
+std::mutex g_handle_mutex{};
+
+}
+
 LoggerFactory& LoggerFactory::instance() {
     if (!g_logger_factory) {
         g_logger_factory = new LoggerFactory{};
@@ -99,6 +109,7 @@ std::vector<LoggerSPtr> LoggerFactory::get_loggers() const {
 
 void LoggerFactory::set_loggers(const LoggerFactory::loggers_t& loggers) {
     m_loggers = loggers;
+    next_generation();
 }
 
 
@@ -171,14 +182,38 @@ void LoggerFactory::cleanup() {
         delete g_logger_factory;
         g_logger_factory = nullptr;
     }
+    next_generation();
 }
 
 void LoggerFactory::set_main_logger_name(const char* name) {
     g_main_logger_name = name;
+    next_generation();
 }
 
 const char* LoggerFactory::get_main_logger_name() {
     return !g_main_logger_name ? GLOBAL_LOGGER_NAME : g_main_logger_name;
 }
 
+void LoggerFactory::next_generation() {
+    unsigned generation = g_generation.load(std::memory_order_relaxed) + 1;
+    /* skip 0, it is the generation of never updated handles */
+    g_generation.store(0 == generation ? 1 : generation, std::memory_order_release);
+}
+
+Logger* LoggerHandle::update(const char* name) {
+    /* generation is read first, logger found later is never older */
+    const unsigned generation = LoggerFactory::get_generation();
+    Logger* logger = LoggerFactory::instance().get_logger(name).get();
+
+    std::lock_guard<std::mutex> lock(g_handle_mutex);
+    const unsigned sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_name.store(name, std::memory_order_relaxed);
+    m_logger.store(logger, std::memory_order_relaxed);
+    m_generation.store(generation, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+    return logger;
+}
+
 }
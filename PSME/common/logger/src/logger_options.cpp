@@ -100,4 +100,12 @@ void Options::enable_more_debug(bool enable) {
     m_raw = options.raw;
 }
 
+
+void Options::enable_drop_on_full(bool enable) {
+    union logger_options options;
+    options.raw = m_raw;
+    options.option.drop_on_full = enable;
+    m_raw = options.raw;
+}
+
 }
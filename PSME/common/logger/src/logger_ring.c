@@ -0,0 +1,153 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_ring.c
+ *
+ * @brief Logger message ring implementation
+ * */
+
+#include "logger_ring.h"
+
+#include "logger_assert.h"
+#include "logger_memory.h"
+
+#include <stdint.h>
+
+#define LOGGER_RING_MASK                (LOGGER_RING_SIZE - 1)
+
+static inline bool logger_ring_is_stored_in_place(struct logger_ring_slot *slot) {
+    return (void*)slot->msg == (void*)slot->storage;
+}
+
+int logger_ring_init(struct logger_ring *ring) {
+    logger_assert(NULL != ring);
+
+    ring->slots = logger_memory_alloc(LOGGER_RING_SIZE * sizeof(struct logger_ring_slot));
+    if (NULL == ring->slots) {
+        return LOGGER_ERROR_MEMORY_OUT;
+    }
+
+    for (size_t i = 0; i < LOGGER_RING_SIZE; i++) {
+        atomic_init(&ring->slots[i].sequence, i);
+        ring->slots[i].position = 0;
+        ring->slots[i].msg = NULL;
+    }
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->dropped, 0);
+    ring->head = 0;
+
+    return LOGGER_SUCCESS;
+}
+
+void logger_ring_destroy(struct logger_ring *ring) {
+    logger_assert(NULL != ring);
+
+    if (NULL == ring->slots) {
+        return;
+    }
+
+    struct logger_stream_message *msg;
+    while (logger_ring_peek(ring, &msg)) {
+        logger_ring_release(ring);
+    }
+
+    logger_memory_free(ring->slots);
+    ring->slots = NULL;
+}
+
+struct logger_ring_slot *logger_ring_claim(struct logger_ring *ring,
+        size_t size) {
+    logger_assert(NULL != ring);
+
+    struct logger_ring_slot *slot;
+    size_t position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    for (;;) {
+        slot = &ring->slots[position & LOGGER_RING_MASK];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)sequence - (intptr_t)position;
+
+        if (0 == diff) {
+            /* Slot is free, try to take it */
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &position,
+                    position + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Slot still occupied by a message from the previous lap */
+            return NULL;
+        } else {
+            position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        }
+    }
+
+    slot->position = position;
+    if (size <= LOGGER_RING_SLOT_SIZE) {
+        slot->msg = (struct logger_stream_message*)slot->storage;
+    } else {
+        slot->msg = logger_memory_alloc(size);
+    }
+    return slot;
+}
+
+void logger_ring_publish(struct logger_ring_slot *slot) {
+    logger_assert(NULL != slot);
+
+    atomic_store_explicit(&slot->sequence, slot->position + 1, memory_order_release);
+}
+
+bool logger_ring_peek(struct logger_ring *ring,
+        struct logger_stream_message **pmsg) {
+    logger_assert(NULL != ring);
+    logger_assert(NULL != pmsg);
+
+    struct logger_ring_slot *slot = &ring->slots[ring->head & LOGGER_RING_MASK];
+    size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+    if (sequence != ring->head + 1) {
+        return false;
+    }
+
+    *pmsg = slot->msg;
+    return true;
+}
+
+void logger_ring_release(struct logger_ring *ring) {
+    logger_assert(NULL != ring);
+
+    struct logger_ring_slot *slot = &ring->slots[ring->head & LOGGER_RING_MASK];
+    if (!logger_ring_is_stored_in_place(slot)) {
+        logger_memory_free(slot->msg);
+    }
+    slot->msg = NULL;
+
+    /* Slot is free for the producer in the next lap */
+    atomic_store_explicit(&slot->sequence, ring->head + LOGGER_RING_SIZE, memory_order_release);
+    ring->head++;
+}
+
+bool logger_ring_empty(struct logger_ring *ring) {
+    logger_assert(NULL != ring);
+
+    struct logger_ring_slot *slot = &ring->slots[ring->head & LOGGER_RING_MASK];
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) != ring->head + 1;
+}
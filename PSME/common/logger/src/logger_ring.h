@@ -0,0 +1,160 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_ring.h
+ *
+ * @brief Logger message ring interface
+ *
+ * Bounded multiple producers/single consumer queue of log messages. Producers
+ * claim slots with a single atomic operation, messages which fit in the slot
+ * are stored in place, so no memory is allocated and no lock is taken.
+ * */
+
+#ifndef LOGGER_RING_H
+#define LOGGER_RING_H
+
+#include "logger_stream_message.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+/*!
+ * @def LOGGER_RING_SIZE
+ * Number of slots in the ring, must be power of two
+ *
+ * @def LOGGER_RING_SLOT_SIZE
+ * Size of the message (with the header) stored in place. Longer messages
+ * are allocated dynamically
+ * */
+#define LOGGER_RING_SIZE                1024
+#define LOGGER_RING_SLOT_SIZE           512
+
+/*!
+ * @struct logger_ring_slot
+ * @brief Single message slot
+ *
+ * @var logger_ring_slot::sequence
+ * Slot is free for position equal to sequence, contains message published at
+ * position when sequence is one more
+ *
+ * @var logger_ring_slot::position
+ * Position the slot was claimed for
+ *
+ * @var logger_ring_slot::msg
+ * Published message, either in storage or allocated. NULL if allocation failed
+ *
+ * @var logger_ring_slot::storage
+ * Storage for in place messages
+ * */
+struct logger_ring_slot {
+    atomic_size_t sequence;
+    size_t position;
+    struct logger_stream_message *msg;
+    alignas(max_align_t) char storage[LOGGER_RING_SLOT_SIZE];
+};
+
+/*!
+ * @struct logger_ring
+ * @brief Logger message ring
+ *
+ * @var logger_ring::slots
+ * All slots
+ *
+ * @var logger_ring::tail
+ * Next position to be claimed by producers
+ *
+ * @var logger_ring::head
+ * Next position to be read by the consumer
+ *
+ * @var logger_ring::dropped
+ * Number of messages dropped because the ring was full
+ * */
+struct logger_ring {
+    struct logger_ring_slot *slots;
+    alignas(64) atomic_size_t tail;
+    alignas(64) size_t head;
+    atomic_size_t dropped;
+};
+
+/*!
+ * @brief Allocate ring slots
+ *
+ * @param[in]   ring    Ring object
+ * @return      LOGGER_SUCCESS or LOGGER_ERROR_MEMORY_OUT when allocation failed
+ * */
+int logger_ring_init(struct logger_ring *ring);
+
+/*!
+ * @brief Free all pending messages and ring slots
+ *
+ * @param[in]   ring    Ring object
+ * */
+void logger_ring_destroy(struct logger_ring *ring);
+
+/*!
+ * @brief Claim slot for the message. Called by producers
+ *
+ * Slot must be published with logger_ring_publish(), consumer doesn't read
+ * messages published after the claimed one until then.
+ *
+ * @param[in]   ring    Ring object
+ * @param[in]   size    Message size (with the header)
+ * @return      Claimed slot with msg ready to be filled or NULL if ring is full
+ * */
+struct logger_ring_slot *logger_ring_claim(struct logger_ring *ring,
+        size_t size);
+
+/*!
+ * @brief Publish filled message to the consumer
+ *
+ * @param[in]   slot    Slot returned by logger_ring_claim()
+ * */
+void logger_ring_publish(struct logger_ring_slot *slot);
+
+/*!
+ * @brief Get oldest published message. Called by the consumer
+ *
+ * @param[in]   ring    Ring object
+ * @param[out]  pmsg    Message (might be NULL if allocation failed)
+ * @return      true if a message was published
+ * */
+bool logger_ring_peek(struct logger_ring *ring,
+        struct logger_stream_message **pmsg);
+
+/*!
+ * @brief Release slot of the message returned by logger_ring_peek()
+ *
+ * @param[in]   ring    Ring object
+ * */
+void logger_ring_release(struct logger_ring *ring);
+
+/*!
+ * @brief Check if there is a published message to be read
+ *
+ * @param[in]   ring    Ring object
+ * @return      true if there is no message to be read
+ * */
+bool logger_ring_empty(struct logger_ring *ring);
+
+#endif /* LOGGER_RING_H */
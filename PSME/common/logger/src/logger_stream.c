@@ -73,6 +73,12 @@ static struct timespec g_wake_up_time = {
     .tv_nsec = 0
 };
 
+/*! Producer waits that long for free space when stream queue is full */
+static const struct timespec g_full_wait_time = {
+    .tv_sec = 0,
+    .tv_nsec = 100000
+};
+
 static const union logger_options g_logger_stream_default_options = {
     .option = {
         .level = LOG_DEBUG,
@@ -124,6 +130,10 @@ static void logger_stream_write_message(struct logger_stream *inst,
 
 static int logger_stream_flush(struct logger_stream *inst);
 
+static bool logger_stream_ring_empty(struct logger_stream *inst);
+
+static void logger_stream_process_ring(struct logger_stream *inst);
+
 struct logger_stream *logger_stream_create(enum logger_stream_type type,
         const char* tag, union logger_options *options) {
 
@@ -165,12 +175,25 @@ struct logger_stream *logger_stream_create(enum logger_stream_type type,
             return NULL;
         }
 
+        /* Direct stream writes messages immediately, no queue needed */
+        if (LOGGER_STREAM_DIRECT != type) {
+            err = logger_ring_init(&inst->ring);
+            if (LOGGER_SUCCESS != err) {
+                mtx_destroy(&inst->mutex);
+                cnd_destroy(&inst->cond);
+                logger_memory_free(inst);
+                return NULL;
+            }
+        }
+        atomic_init(&inst->is_waiting, false);
+
         if (NULL != inst->handler.create) {
             inst->handler.create(inst);
         }
 
         err = logger_stream_start(inst);
         if (thrd_success != err) {
+            logger_ring_destroy(&inst->ring);
             mtx_destroy(&inst->mutex);
             cnd_destroy(&inst->cond);
             logger_memory_free(inst);
@@ -201,7 +224,12 @@ int logger_stream_destroy(struct logger_stream *inst) {
             logger_stream_message_handle(inst, msg_object, msg_id);
         }
 
+        while (!logger_stream_ring_empty(inst)) {
+            logger_stream_process_ring(inst);
+        }
+
         logger_stream_flush(inst);
+        logger_ring_destroy(&inst->ring);
         mtx_destroy(&inst->mutex);
         cnd_destroy(&inst->cond);
 
@@ -288,6 +316,78 @@ int logger_stream_add_message(struct logger_stream *inst,
     return LOGGER_SUCCESS;
 }
 
+static void logger_stream_wake_up(struct logger_stream *inst) {
+    /* Pairs with the fence in logger_stream_task(): either the stream thread
+     * sees published message or it is seen waiting here */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&inst->is_waiting, memory_order_relaxed)) {
+        mtx_lock(&inst->mutex);
+        cnd_signal(&inst->cond);
+        mtx_unlock(&inst->mutex);
+    }
+}
+
+static void logger_stream_copy_message(struct logger_stream_message *msg,
+        const struct logger_stream_message *header,
+        const char *message, size_t length) {
+    *msg = *header;
+    memcpy(msg->message, message, length);
+    msg->message[length] = '\0';
+}
+
+int logger_stream_add_write(struct logger_stream *inst,
+        const struct logger_stream_message *header,
+        const char *message, size_t length) {
+    logger_assert(NULL != inst);
+    logger_assert(NULL != header);
+    logger_assert(NULL != message);
+
+    size_t size = sizeof(struct logger_stream_message) + length + 1;
+
+    if (LOGGER_STREAM_DIRECT == inst->type) {
+        /* Short messages are built on the stack */
+        alignas(max_align_t) char buffer[LOGGER_RING_SLOT_SIZE];
+        struct logger_stream_message *msg = (struct logger_stream_message*)buffer;
+        if (size > sizeof(buffer)) {
+            msg = logger_memory_alloc(size);
+            if (NULL == msg) {
+                return LOGGER_ERROR_MEMORY_OUT;
+            }
+        }
+        logger_stream_copy_message(msg, header, message, length);
+
+        int err = mtx_lock(&inst->mutex);
+        if (thrd_success == err) {
+            logger_stream_write_message(inst, msg);
+            logger_stream_flush(inst);
+            mtx_unlock(&inst->mutex);
+        }
+        if ((void*)msg != (void*)buffer) {
+            logger_memory_free(msg);
+        }
+        return err;
+    }
+
+    struct logger_ring_slot *slot;
+    while (NULL == (slot = logger_ring_claim(&inst->ring, size))) {
+        if (inst->options.option.drop_on_full || !inst->is_running) {
+            /* Reported by the stream thread */
+            atomic_fetch_add_explicit(&inst->ring.dropped, 1, memory_order_relaxed);
+            return LOGGER_SUCCESS;
+        }
+        logger_stream_wake_up(inst);
+        thrd_sleep(&g_full_wait_time, NULL);
+    }
+
+    if (NULL != slot->msg) {
+        logger_stream_copy_message(slot->msg, header, message, length);
+    }
+    logger_ring_publish(slot);
+    logger_stream_wake_up(inst);
+
+    return LOGGER_SUCCESS;
+}
+
 static inline bool logger_is_newline_found(const char *str) {
     if (NULL == str) return false;
 
@@ -314,6 +414,12 @@ static void logger_stream_write_message(struct logger_stream *inst,
     logger_assert(NULL != inst);
     logger_assert(NULL != msg);
 
+    /* Stream stores messages in its own format */
+    if (NULL != inst->handler.write) {
+        inst->handler.write(inst, msg);
+        return;
+    }
+
     int err;
     struct tm *timeval;
     const char *color;
@@ -451,6 +557,11 @@ static void logger_stream_write_message(struct logger_stream *inst,
 static int logger_stream_flush(struct logger_stream *inst) {
     logger_assert(NULL != inst);
 
+    /* Stream writing messages on its own doesn't use the buffer */
+    if ((NULL != inst->handler.write) && (NULL != inst->handler.flush)) {
+        return inst->handler.flush(inst);
+    }
+
     if ((NULL == inst->buffer) || (0 == inst->buffer_size)) {
         return LOGGER_SUCCESS;
     }
@@ -552,6 +663,51 @@ static void logger_stream_message_handle(struct logger_stream *inst,
     }
 }
 
+static bool logger_stream_ring_empty(struct logger_stream *inst) {
+    return (NULL == inst->ring.slots) || logger_ring_empty(&inst->ring);
+}
+
+static void logger_stream_write_dropped(struct logger_stream *inst,
+        size_t dropped) {
+    alignas(max_align_t) char buffer[sizeof(struct logger_stream_message) + LOGGER_BUFFER_SIZE];
+    struct logger_stream_message *msg = (struct logger_stream_message*)buffer;
+
+    memset(msg, 0, sizeof(struct logger_stream_message));
+    msg->tag = inst->tag;
+    msg->options.raw = inst->options.raw;
+    msg->options.option.level = LOG_WARNING;
+    msg->options.option.more_debug = false;
+    logger_time_update(&msg->log_time);
+    snprintf(msg->message, LOGGER_BUFFER_SIZE,
+            "%zu log messages dropped, stream queue full", dropped);
+
+    logger_stream_write_message(inst, msg);
+}
+
+static void logger_stream_process_ring(struct logger_stream *inst) {
+    if (NULL == inst->ring.slots) {
+        return;
+    }
+
+    /* Process at most one lap, control messages cannot wait forever */
+    struct logger_stream_message *msg;
+    for (size_t i = 0; i < LOGGER_RING_SIZE; i++) {
+        if (!logger_ring_peek(&inst->ring, &msg)) {
+            break;
+        }
+        if (NULL != msg) {
+            logger_stream_write_message(inst, msg);
+        }
+        logger_ring_release(&inst->ring);
+    }
+
+    size_t dropped = atomic_exchange_explicit(&inst->ring.dropped, 0,
+            memory_order_relaxed);
+    if (0 != dropped) {
+        logger_stream_write_dropped(inst, dropped);
+    }
+}
+
 static void logger_stream_wait_for_signal(struct logger_stream *inst) {
     /* Auto wake-up */
 
@@ -578,8 +734,13 @@ static void* logger_stream_task(void *pobj) {
         mtx_lock(&inst->mutex);
         /* Wait for signal (or timeout) that will wake-up this thread */
         if (logger_list_empty(&inst->msg_list)) {
+            atomic_store_explicit(&inst->is_waiting, true, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
             /* Thread go sleep only when there is no jobs to do */
-            logger_stream_wait_for_signal(inst);
+            if (logger_stream_ring_empty(inst)) {
+                logger_stream_wait_for_signal(inst);
+            }
+            atomic_store_explicit(&inst->is_waiting, false, memory_order_relaxed);
         }
         /* Move background list to foreground list. Thread safe */
         logger_list_move(&msg_list, &inst->msg_list);
@@ -596,6 +757,9 @@ static void* logger_stream_task(void *pobj) {
             /* Create log message and write to the stream */
             logger_stream_message_handle(inst, msg_object, msg_id);
         }
+
+        /* Process messages written by loggers */
+        logger_stream_process_ring(inst);
     }
 
     /* Before exit, flush all logs */
@@ -52,6 +52,12 @@ void Stream::open_file(const char* file_name) {
             file_name);
 }
 
+void Stream::open_binary(const char* file_name, std::size_t file_size,
+        unsigned file_count) {
+    logger_stream_open_binary(static_cast<struct logger_stream*>(m_impl),
+            file_name, file_size, file_count);
+}
+
 void Stream::open_udp(const char* ip_address, uint16_t port) {
     logger_stream_open_udp(static_cast<struct logger_stream*>(m_impl),
             ip_address, port);
@@ -31,12 +31,17 @@
 
 #include "logger/stream.h"
 #include "logger_stream_message.h"
+#include "logger_ring.h"
 
 #include "threads.h"
 
 /*! Stream handler */
 typedef int (*stream_handler_t)(struct logger_stream *inst);
 
+/*! Stream message handler */
+typedef int (*stream_message_handler_t)(struct logger_stream *inst,
+        const struct logger_stream_message *msg);
+
 /*!
  * @struct logger_stream_handler
  * @brief Contains logger stream handlers for different actions based on
@@ -50,11 +55,16 @@ typedef int (*stream_handler_t)(struct logger_stream *inst);
  *
  * @var logger_stream_handler::flush
  * Flush all data stored in buffers
+ *
+ * @var logger_stream_handler::write
+ * Write log message without text formatting. When NULL, messages are
+ * formatted into the stream buffer
  * */
 struct logger_stream_handler {
     stream_handler_t create;
     stream_handler_t destroy;
     stream_handler_t flush;
+    stream_message_handler_t write;
 };
 
 /*!
@@ -72,7 +82,11 @@ struct logger_stream_handler {
  * Stream handlers
  *
  * @var logger_stream::msg_list
- * Message list collected from #logger object for #logger_stream
+ * Control messages (and write messages for direct stream) collected from
+ * #logger object for #logger_stream
+ *
+ * @var logger_stream::ring
+ * Write messages collected from #logger object for #logger_stream
  *
  * @var logger_stream::thread
  * Thread instance for stream
@@ -100,6 +114,9 @@ struct logger_stream_handler {
  *
  * @var logger_stream::is_running
  * Flag indicated that #logger_stream thread is running
+ *
+ * @var logger_stream::is_waiting
+ * Flag indicated that #logger_stream thread waits for a signal
  * */
 struct logger_stream {
     char *buffer;
@@ -107,6 +124,7 @@ struct logger_stream {
     void *settings;
     struct logger_stream_handler handler;
     struct logger_list msg_list;
+    struct logger_ring ring;
     thrd_t thread;
     cnd_t cond;
     mtx_t mutex;
@@ -115,6 +133,7 @@ struct logger_stream {
     size_t buffer_size;
     volatile union logger_options options;
     volatile bool is_running;
+    atomic_bool is_waiting;
 };
 
 #endif /* LOGGER_STREAM_INSTANCE_H */
@@ -103,4 +103,20 @@ struct logger_stream_message {
 int logger_stream_add_message(struct logger_stream *inst,
         void *msg, enum logger_stream_message_type type);
 
+/*!
+ * @brief Add log message to logger stream queue. Private method for library
+ *
+ * Message is copied into the queue, the caller keeps its ownership.
+ *
+ * @param[in]   inst        Logger stream instance
+ * @param[in]   header      Message header (message string is not used)
+ * @param[in]   message     Message string
+ * @param[in]   length      Message string length
+ * @return      When success return #LOGGER_SUCCESS otherwise a negative
+ *              error code
+ * */
+int logger_stream_add_write(struct logger_stream *inst,
+        const struct logger_stream_message *header,
+        const char *message, size_t length);
+
 #endif /* LOGGER_STREAM_MESSAGE_H */
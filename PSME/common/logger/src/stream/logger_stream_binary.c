@@ -0,0 +1,636 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_stream_binary.c
+ *
+ * @brief Logger stream binary file implementation
+ * */
+
+#include "logger_stream_binary.h"
+
+#include "logger/binary.h"
+#include "logger_alloc.h"
+#include "logger_assert.h"
+#include "logger_memory.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*!
+ * @def LOGGER_BINARY_FILE_MODE
+ * File mode
+ *
+ * @def LOGGER_BINARY_FILE_PRIV
+ * File privileges setting after creating file
+ *
+ * @def LOGGER_BINARY_MIN_FILE_SIZE
+ * Smallest allowed file size
+ *
+ * @def LOGGER_BINARY_NAME_MAX
+ * Longer tags and call site names are truncated
+ *
+ * @def LOGGER_BINARY_TABLE_SIZE
+ * Size of tag and call site tables, must be power of two
+ *
+ * @def LOGGER_BINARY_TABLE_LIMIT
+ * Table is cleared when it has that many entries, definitions of cleared
+ * entries are written again with new ids
+ * */
+#define LOGGER_BINARY_FILE_MODE     (O_CREAT | O_RDWR | O_CLOEXEC)
+#define LOGGER_BINARY_FILE_PRIV     (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH)
+#define LOGGER_BINARY_MIN_FILE_SIZE 4096
+#define LOGGER_BINARY_NAME_MAX      1024
+#define LOGGER_BINARY_TABLE_SIZE    1024
+#define LOGGER_BINARY_TABLE_MASK    (LOGGER_BINARY_TABLE_SIZE - 1)
+#define LOGGER_BINARY_TABLE_LIMIT   (LOGGER_BINARY_TABLE_SIZE * 3 / 4)
+
+/*! Size of the message record without the message string */
+#define LOGGER_BINARY_MESSAGE_SIZE  (sizeof(struct logger_binary_record_header) \
+                                     + sizeof(struct logger_binary_message))
+
+/*!
+ * @struct logger_binary_tag_entry
+ * @brief Tag already defined in the file
+ *
+ * @var logger_binary_tag_entry::name
+ * Tag string stored in the mapped file
+ *
+ * @var logger_binary_tag_entry::hash
+ * Hash of the tag string
+ *
+ * @var logger_binary_tag_entry::id
+ * Tag id, 0 for free entry
+ * */
+struct logger_binary_tag_entry {
+    const char *name;
+    uint32_t hash;
+    uint32_t id;
+};
+
+/*!
+ * @struct logger_binary_call_site_entry
+ * @brief Call site already defined in the file. Names are constant strings
+ * (__FILE__, __func__) so call sites are identified by their addresses
+ *
+ * @var logger_binary_call_site_entry::file_name
+ * File name
+ *
+ * @var logger_binary_call_site_entry::function_name
+ * Function name
+ *
+ * @var logger_binary_call_site_entry::line_number
+ * Line number
+ *
+ * @var logger_binary_call_site_entry::id
+ * Call site id, 0 for free entry
+ * */
+struct logger_binary_call_site_entry {
+    const char *file_name;
+    const char *function_name;
+    unsigned int line_number;
+    uint32_t id;
+};
+
+/*!
+ * @struct logger_stream_setting_binary
+ * @brief Settings and state of binary stream
+ *
+ * @var logger_stream_setting_binary::file_name
+ * Current file name, rotated files get ".N" suffix
+ *
+ * @var logger_stream_setting_binary::file_size
+ * Size of the mapped file
+ *
+ * @var logger_stream_setting_binary::file_count
+ * Number of rotated files kept
+ *
+ * @var logger_stream_setting_binary::fd
+ * Descriptor of the current file
+ *
+ * @var logger_stream_setting_binary::data
+ * Mapped file
+ *
+ * @var logger_stream_setting_binary::position
+ * Position of the next record
+ *
+ * @var logger_stream_setting_binary::next_id
+ * Next tag or call site id
+ *
+ * @var logger_stream_setting_binary::tags_used
+ * Number of used entries in tags table
+ *
+ * @var logger_stream_setting_binary::call_sites_used
+ * Number of used entries in call sites table
+ *
+ * @var logger_stream_setting_binary::tags
+ * Tags defined in the current file
+ *
+ * @var logger_stream_setting_binary::call_sites
+ * Call sites defined in the current file
+ * */
+struct logger_stream_setting_binary {
+    char *file_name;
+    size_t file_size;
+    unsigned int file_count;
+    int fd;
+    char *data;
+    size_t position;
+    uint32_t next_id;
+    unsigned int tags_used;
+    unsigned int call_sites_used;
+    struct logger_binary_tag_entry tags[LOGGER_BINARY_TABLE_SIZE];
+    struct logger_binary_call_site_entry call_sites[LOGGER_BINARY_TABLE_SIZE];
+};
+
+static inline size_t binary_align(size_t size) {
+    return (size + LOGGER_BINARY_ALIGNMENT - 1) &
+        ~(size_t)(LOGGER_BINARY_ALIGNMENT - 1);
+}
+
+static inline uint32_t binary_hash_string(const char *str, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)str[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static inline uint32_t binary_hash_call_site(const char *file_name,
+        const char *function_name, unsigned int line_number) {
+    uint64_t hash = (uint64_t)(uintptr_t)file_name * 0x9e3779b97f4a7c15ull;
+    hash ^= (uint64_t)(uintptr_t)function_name + (hash << 6) + (hash >> 2);
+    hash ^= (uint64_t)line_number * 0xff51afd7ed558ccdull;
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+static void binary_reset_tables(struct logger_stream_setting_binary *binary) {
+    memset(binary->tags, 0, sizeof(binary->tags));
+    memset(binary->call_sites, 0, sizeof(binary->call_sites));
+    binary->tags_used = 0;
+    binary->call_sites_used = 0;
+}
+
+/* Find position of the last complete record and the highest used id */
+static void binary_scan(struct logger_stream_setting_binary *binary) {
+    struct logger_binary_record_header record;
+    size_t position = sizeof(struct logger_binary_file_header);
+    uint32_t id;
+
+    binary->next_id = 1;
+    while (position + sizeof(record) <= binary->file_size) {
+        memcpy(&record, &binary->data[position], sizeof(record));
+        if ((0 == record.size) || (0 != record.size % LOGGER_BINARY_ALIGNMENT)
+                || (record.size < sizeof(record) + sizeof(id))
+                || (record.size > binary->file_size - position)) {
+            break;
+        }
+        if ((LOGGER_BINARY_RECORD_TAG == record.type) ||
+                (LOGGER_BINARY_RECORD_CALL_SITE == record.type)) {
+            memcpy(&id, &binary->data[position + sizeof(record)], sizeof(id));
+            if (id >= binary->next_id) {
+                binary->next_id = id + 1;
+            }
+        }
+        position += record.size;
+    }
+    binary->position = position;
+
+    /* Cut off record torn by a crash */
+    if (position + sizeof(record) <= binary->file_size) {
+        memset(&binary->data[position], 0, sizeof(record));
+    }
+}
+
+static bool binary_is_valid_file(int fd, size_t file_size) {
+    struct logger_binary_file_header header;
+
+    if (file_size < sizeof(header)) {
+        return false;
+    }
+    if ((ssize_t)sizeof(header) != pread(fd, &header, sizeof(header), 0)) {
+        return false;
+    }
+    return (0 == memcmp(header.magic, LOGGER_BINARY_MAGIC,
+                sizeof(header.magic))) &&
+        (LOGGER_BINARY_VERSION == header.version) &&
+        (sizeof(header) == header.header_size);
+}
+
+static void binary_unmap(struct logger_stream_setting_binary *binary) {
+    if (NULL != binary->data) {
+        munmap(binary->data, binary->file_size);
+        binary->data = NULL;
+    }
+    if (0 <= binary->fd) {
+        /* Unused part of the file is not kept */
+        if (0 != ftruncate(binary->fd, (off_t)binary->position)) {
+            /* File keeps its size, unused part is zeroed */
+        }
+        close(binary->fd);
+        binary->fd = -1;
+    }
+}
+
+static void binary_shift_files(struct logger_stream_setting_binary *binary) {
+    size_t size = strlen(binary->file_name) + 16;
+    char *old_name = logger_memory_alloc(size);
+    char *new_name = logger_memory_alloc(size);
+
+    if ((NULL != old_name) && (NULL != new_name) && (0 < binary->file_count)) {
+        for (unsigned int i = binary->file_count - 1; i > 0; i--) {
+            snprintf(old_name, size, "%s.%u", binary->file_name, i);
+            snprintf(new_name, size, "%s.%u", binary->file_name, i + 1);
+            rename(old_name, new_name);
+        }
+        snprintf(new_name, size, "%s.1", binary->file_name);
+        rename(binary->file_name, new_name);
+    } else {
+        unlink(binary->file_name);
+    }
+
+    logger_memory_free(old_name);
+    logger_memory_free(new_name);
+}
+
+static int binary_map(struct logger_stream_setting_binary *binary) {
+    struct stat file_stat;
+    bool append = false;
+
+    binary->fd = open(binary->file_name, LOGGER_BINARY_FILE_MODE,
+            LOGGER_BINARY_FILE_PRIV);
+    if (0 > binary->fd) {
+        return LOGGER_ERROR;
+    }
+
+    if (0 != fstat(binary->fd, &file_stat)) {
+        close(binary->fd);
+        binary->fd = -1;
+        return LOGGER_ERROR;
+    }
+
+    /* Existing log is appended. Other files are moved aside, not overwritten */
+    if (0 < file_stat.st_size) {
+        append = ((size_t)file_stat.st_size <= binary->file_size) &&
+            binary_is_valid_file(binary->fd, (size_t)file_stat.st_size);
+        if (!append) {
+            close(binary->fd);
+            binary_shift_files(binary);
+            binary->fd = open(binary->file_name, LOGGER_BINARY_FILE_MODE,
+                    LOGGER_BINARY_FILE_PRIV);
+            if (0 > binary->fd) {
+                return LOGGER_ERROR;
+            }
+        }
+    }
+
+    if (0 != ftruncate(binary->fd, (off_t)binary->file_size)) {
+        close(binary->fd);
+        binary->fd = -1;
+        return LOGGER_ERROR;
+    }
+
+    void *data = mmap(NULL, binary->file_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, binary->fd, 0);
+    if (MAP_FAILED == data) {
+        close(binary->fd);
+        binary->fd = -1;
+        return LOGGER_ERROR;
+    }
+    binary->data = data;
+
+    if (append) {
+        binary_scan(binary);
+    } else {
+        struct logger_binary_file_header header;
+        memcpy(header.magic, LOGGER_BINARY_MAGIC, sizeof(header.magic));
+        header.version = LOGGER_BINARY_VERSION;
+        header.header_size = sizeof(header);
+        memcpy(binary->data, &header, sizeof(header));
+        binary->position = sizeof(header);
+        binary->next_id = 1;
+    }
+    binary_reset_tables(binary);
+
+    return LOGGER_SUCCESS;
+}
+
+static int binary_rotate(struct logger_stream_setting_binary *binary) {
+    binary_unmap(binary);
+    binary_shift_files(binary);
+    return binary_map(binary);
+}
+
+/*!
+ * @brief Append record. Caller checks there is enough space
+ *
+ * Record size is written as the very last, so the record is either complete
+ * or not visible at all when the process crashes.
+ * */
+static void binary_append(struct logger_stream_setting_binary *binary,
+        enum logger_binary_record_type type,
+        const void *body, size_t body_size,
+        const char *str1, size_t str1_size,
+        const char *str2, size_t str2_size) {
+    struct logger_binary_record_header record = {
+        .size = 0,
+        .type = (uint16_t)type,
+        .reserved = 0
+    };
+    char *ptr = &binary->data[binary->position];
+    size_t size = sizeof(record) + body_size + str1_size + str2_size;
+    size_t aligned_size = binary_align(size);
+
+    memcpy(ptr, &record, sizeof(record));
+    memcpy(ptr + sizeof(record), body, body_size);
+    memcpy(ptr + sizeof(record) + body_size, str1, str1_size);
+    memcpy(ptr + sizeof(record) + body_size + str1_size, str2, str2_size);
+    memset(ptr + size, 0, aligned_size - size);
+
+    binary->position += aligned_size;
+    /* End of data marker, the file might contain a torn record there */
+    if (binary->position + sizeof(record) <= binary->file_size) {
+        memset(&binary->data[binary->position], 0, sizeof(record));
+    }
+
+    atomic_signal_fence(memory_order_release);
+    record.size = (uint32_t)aligned_size;
+    memcpy(ptr, &record.size, sizeof(record.size));
+}
+
+static struct logger_binary_tag_entry *binary_find_tag(
+        struct logger_stream_setting_binary *binary,
+        const char *tag, size_t length, uint32_t hash) {
+
+    if (binary->tags_used >= LOGGER_BINARY_TABLE_LIMIT) {
+        memset(binary->tags, 0, sizeof(binary->tags));
+        binary->tags_used = 0;
+    }
+
+    size_t index = hash & LOGGER_BINARY_TABLE_MASK;
+    for (;;) {
+        struct logger_binary_tag_entry *entry = &binary->tags[index];
+        if ((0 == entry->id) || ((hash == entry->hash) &&
+                    (0 == strncmp(entry->name, tag, length)) &&
+                    ('\0' == entry->name[length]))) {
+            return entry;
+        }
+        index = (index + 1) & LOGGER_BINARY_TABLE_MASK;
+    }
+}
+
+static struct logger_binary_call_site_entry *binary_find_call_site(
+        struct logger_stream_setting_binary *binary,
+        const struct logger_stream_message *msg) {
+
+    if (binary->call_sites_used >= LOGGER_BINARY_TABLE_LIMIT) {
+        memset(binary->call_sites, 0, sizeof(binary->call_sites));
+        binary->call_sites_used = 0;
+    }
+
+    size_t index = binary_hash_call_site(msg->file_name, msg->function_name,
+            msg->line_number) & LOGGER_BINARY_TABLE_MASK;
+    for (;;) {
+        struct logger_binary_call_site_entry *entry = &binary->call_sites[index];
+        if ((0 == entry->id) || ((msg->file_name == entry->file_name) &&
+                    (msg->function_name == entry->function_name) &&
+                    (msg->line_number == entry->line_number))) {
+            return entry;
+        }
+        index = (index + 1) & LOGGER_BINARY_TABLE_MASK;
+    }
+}
+
+int logger_stream_open_binary(struct logger_stream *inst,
+        const char *file_name, size_t file_size, unsigned int file_count) {
+    logger_assert(NULL != inst);
+    if (LOGGER_STREAM_BINARY != inst->type) return LOGGER_ERROR_TYPE;
+
+    int err;
+    struct logger_stream_setting_binary *binary =
+        logger_memory_alloc(sizeof(struct logger_stream_setting_binary));
+
+    if (NULL == binary) {
+        return LOGGER_ERROR_NULL;
+    }
+    memset(binary, 0, sizeof(struct logger_stream_setting_binary));
+
+    binary->file_name = logger_alloc_copy_string(file_name);
+    if (NULL == binary->file_name) {
+        logger_memory_free(binary);
+        return LOGGER_ERROR_NULL;
+    }
+
+    if (0 == file_size) {
+        file_size = LOGGER_DEFAULT_BINARY_FILE_SIZE;
+    } else if (file_size < LOGGER_BINARY_MIN_FILE_SIZE) {
+        file_size = LOGGER_BINARY_MIN_FILE_SIZE;
+    }
+    binary->file_size = binary_align(file_size);
+    binary->file_count = file_count;
+    binary->fd = -1;
+
+    err = logger_stream_add_message(inst, binary, LOGGER_MESSAGE_OPEN);
+    if (LOGGER_SUCCESS != err) {
+        logger_memory_free(binary->file_name);
+        logger_memory_free(binary);
+        return err;
+    }
+
+    return LOGGER_SUCCESS;
+}
+
+int logger_stream_binary_create(struct logger_stream *inst) {
+    logger_assert(NULL != inst);
+    if (NULL == inst->settings) return LOGGER_ERROR_NULL;
+
+    return binary_map(inst->settings);
+}
+
+int logger_stream_binary_destroy(struct logger_stream *inst) {
+    logger_assert(NULL != inst);
+
+    struct logger_stream_setting_binary *binary = inst->settings;
+
+    if (NULL != binary) {
+        binary_unmap(binary);
+        logger_memory_free(binary->file_name);
+        binary->file_name = NULL;
+    }
+    logger_memory_free(binary);
+    inst->settings = NULL;
+
+    return LOGGER_SUCCESS;
+}
+
+int logger_stream_binary_flush(struct logger_stream *inst) {
+    logger_assert(NULL != inst);
+
+    struct logger_stream_setting_binary *binary = inst->settings;
+
+    if ((NULL == binary) || (NULL == binary->data)) {
+        return LOGGER_ERROR_NULL;
+    }
+
+    /* Data is in the page cache already, just don't wait for write back */
+    if (0 != msync(binary->data, binary->position, MS_ASYNC)) {
+        return LOGGER_ERROR;
+    }
+
+    return LOGGER_SUCCESS;
+}
+
+int logger_stream_binary_write(struct logger_stream *inst,
+        const struct logger_stream_message *msg) {
+    logger_assert(NULL != inst);
+    logger_assert(NULL != msg);
+
+    struct logger_stream_setting_binary *binary = inst->settings;
+
+    if ((NULL == binary) || (NULL == binary->data)) {
+        return LOGGER_ERROR_NULL;
+    }
+
+    union logger_options options = {.raw = 0};
+    options.raw = inst->options.raw & msg->options.raw;
+
+    const char *tag = options.option.tagging ? msg->tag : NULL;
+    const bool has_call_site = options.option.more_debug &&
+        (NULL != msg->file_name) && (NULL != msg->function_name);
+
+    size_t tag_length = 0;
+    uint32_t tag_hash = 0;
+    size_t file_length = 0;
+    size_t function_length = 0;
+    size_t length = strnlen(msg->message, binary->file_size);
+
+    if (NULL != tag) {
+        tag_length = strnlen(tag, LOGGER_BINARY_NAME_MAX);
+        tag_hash = binary_hash_string(tag, tag_length);
+    }
+    if (has_call_site) {
+        file_length = strnlen(msg->file_name, LOGGER_BINARY_NAME_MAX);
+        function_length = strnlen(msg->function_name, LOGGER_BINARY_NAME_MAX);
+    }
+
+    struct logger_binary_tag_entry *tag_entry = NULL;
+    struct logger_binary_call_site_entry *call_site_entry = NULL;
+    bool rotated = false;
+
+    for (;;) {
+        size_t definitions = 0;
+        if (NULL != tag) {
+            tag_entry = binary_find_tag(binary, tag, tag_length, tag_hash);
+            if (0 == tag_entry->id) {
+                definitions += binary_align(
+                        sizeof(struct logger_binary_record_header)
+                        + sizeof(uint32_t) + tag_length + 1);
+            }
+        }
+        if (has_call_site) {
+            call_site_entry = binary_find_call_site(binary, msg);
+            if (0 == call_site_entry->id) {
+                definitions += binary_align(
+                        sizeof(struct logger_binary_record_header)
+                        + 2 * sizeof(uint32_t)
+                        + file_length + 1 + function_length + 1);
+            }
+        }
+
+        size_t space = binary->file_size - binary->position;
+        if (definitions + binary_align(LOGGER_BINARY_MESSAGE_SIZE + length)
+                <= space) {
+            break;
+        }
+        if (rotated) {
+            /* Message doesn't fit even in the empty file */
+            if (definitions + LOGGER_BINARY_MESSAGE_SIZE > space) {
+                return LOGGER_ERROR;
+            }
+            length = (space - definitions - LOGGER_BINARY_MESSAGE_SIZE) &
+                ~(size_t)(LOGGER_BINARY_ALIGNMENT - 1);
+            break;
+        }
+
+        int err = binary_rotate(binary);
+        if (LOGGER_SUCCESS != err) {
+            return err;
+        }
+        rotated = true;
+    }
+
+    struct logger_binary_message body;
+    memset(&body, 0, sizeof(body));
+
+    if (NULL != tag_entry) {
+        if (0 == tag_entry->id) {
+            uint32_t id = binary->next_id++;
+            tag_entry->id = id;
+            tag_entry->hash = tag_hash;
+            /* Tag string is stored right after the id */
+            tag_entry->name = &binary->data[binary->position
+                + sizeof(struct logger_binary_record_header) + sizeof(id)];
+            binary->tags_used++;
+            binary_append(binary, LOGGER_BINARY_RECORD_TAG,
+                    &id, sizeof(id), tag, tag_length, "", 1);
+        }
+        body.tag_id = tag_entry->id;
+    }
+
+    if (NULL != call_site_entry) {
+        if (0 == call_site_entry->id) {
+            uint32_t ids[2] = {binary->next_id++, msg->line_number};
+            call_site_entry->id = ids[0];
+            call_site_entry->file_name = msg->file_name;
+            call_site_entry->function_name = msg->function_name;
+            call_site_entry->line_number = msg->line_number;
+            binary->call_sites_used++;
+
+            /* File and function names are separated by NUL */
+            char names[2 * LOGGER_BINARY_NAME_MAX + 2];
+            memcpy(names, msg->file_name, file_length);
+            names[file_length] = '\0';
+            memcpy(&names[file_length + 1], msg->function_name,
+                    function_length);
+            names[file_length + 1 + function_length] = '\0';
+            binary_append(binary, LOGGER_BINARY_RECORD_CALL_SITE,
+                    ids, sizeof(ids), names,
+                    file_length + 1 + function_length + 1, "", 0);
+        }
+        body.call_site_id = call_site_entry->id;
+    }
+
+    body.seconds = (int64_t)msg->log_time.ts.tv_sec;
+    body.nanoseconds = (uint32_t)msg->log_time.ts.tv_nsec;
+    body.level = msg->options.option.level;
+    body.length = (uint32_t)length;
+    binary_append(binary, LOGGER_BINARY_RECORD_MESSAGE,
+            &body, sizeof(body), msg->message, length, "", 0);
+
+    return LOGGER_SUCCESS;
+}
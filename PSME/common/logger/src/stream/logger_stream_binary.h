@@ -0,0 +1,75 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_stream_binary.h
+ *
+ * @brief Logger stream binary file interface
+ *
+ * Messages are not formatted, they are stored as binary records (see
+ * logger/binary.h) directly in the memory mapped file.
+ */
+
+#ifndef LOGGER_STREAM_BINARY_H
+#define LOGGER_STREAM_BINARY_H
+
+#include "logger_stream_config.h"
+
+/*!
+ * @brief Create binary stream, map the file
+ *
+ * @param[in] inst  Logger stream instance
+ * @return          When success return #LOGGER_SUCCESS, otherwise a negative
+ *                  error code
+ * */
+int logger_stream_binary_create(struct logger_stream *inst);
+
+/*!
+ * @brief Destroy binary stream, unmap the file
+ *
+ * @param[in] inst  Logger stream instance
+ * @return          When success return #LOGGER_SUCCESS, otherwise a negative
+ *                  error code
+ * */
+int logger_stream_binary_destroy(struct logger_stream *inst);
+
+/*!
+ * @brief Schedule write back of the mapped file
+ *
+ * @param[in] inst  Logger stream instance
+ * @return          When success return #LOGGER_SUCCESS, otherwise a negative
+ *                  error code
+ * */
+int logger_stream_binary_flush(struct logger_stream *inst);
+
+/*!
+ * @brief Store message in the mapped file
+ *
+ * @param[in] inst  Logger stream instance
+ * @param[in] msg   Message to store
+ * @return          When success return #LOGGER_SUCCESS, otherwise a negative
+ *                  error code
+ * */
+int logger_stream_binary_write(struct logger_stream *inst,
+        const struct logger_stream_message *msg);
+
+#endif /* LOGGER_STREAM_BINARY_H */
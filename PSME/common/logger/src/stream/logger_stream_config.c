@@ -31,6 +31,7 @@
 #include "logger_stream_standard.h"
 #include "logger_stream_file.h"
 #include "logger_stream_socket.h"
+#include "logger_stream_binary.h"
 
 /*!
  * @struct logger_stream_config
@@ -53,7 +54,8 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_standard_create,
             logger_stream_standard_destroy,
-            logger_stream_standard_output_flush
+            logger_stream_standard_output_flush,
+            NULL
         }
     },
     {
@@ -61,7 +63,8 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_standard_create,
             logger_stream_standard_destroy,
-            logger_stream_standard_error_flush
+            logger_stream_standard_error_flush,
+            NULL
         }
     },
     {
@@ -69,7 +72,8 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_file_create,
             logger_stream_file_destroy,
-            logger_stream_file_flush
+            logger_stream_file_flush,
+            NULL
         }
     },
     {
@@ -77,7 +81,8 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_socket_create,
             logger_stream_socket_destroy,
-            logger_stream_socket_udp_flush
+            logger_stream_socket_udp_flush,
+            NULL
         }
     },
     {
@@ -85,7 +90,8 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_socket_create,
             logger_stream_socket_destroy,
-            logger_stream_socket_tcp_flush
+            logger_stream_socket_tcp_flush,
+            NULL
         }
     },
     {
@@ -93,7 +99,17 @@ static const struct logger_stream_config gconfig[] = {
         .handler = {
             logger_stream_standard_create,
             logger_stream_standard_destroy,
-            logger_stream_standard_output_flush
+            logger_stream_standard_output_flush,
+            NULL
+        }
+    },
+    {
+        .type = LOGGER_STREAM_BINARY,
+        .handler = {
+            logger_stream_binary_create,
+            logger_stream_binary_destroy,
+            logger_stream_binary_flush,
+            logger_stream_binary_write
         }
     }
 };
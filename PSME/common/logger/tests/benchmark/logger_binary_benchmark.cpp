@@ -0,0 +1,186 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file logger_binary_benchmark.cpp
+ *
+ * @brief Benchmark of the binary logger stream and its decoder.
+ *
+ * The same messages are logged to a text file stream and to a binary stream.
+ * Logging (including writing of all queued messages), size of the files and
+ * decoding of the binary file are measured.
+ *
+ * Usage: logger-binary-benchmark [--messages=N]
+ * */
+
+#include "logger/logger_factory.hpp"
+
+extern "C" {
+#include "logger/binary.h"
+}
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace logger_cpp;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchmarkOptions {
+    unsigned messages{200000};
+};
+
+std::string make_file_name() {
+    char name[] = "/tmp/logger_binary_benchmark_XXXXXX";
+    int fd = mkstemp(name);
+    if (0 > fd) {
+        throw std::runtime_error("Cannot create temporary file");
+    }
+    close(fd);
+    /* Stream creates the file */
+    std::remove(name);
+    return name;
+}
+
+Options make_options() {
+    Options options{};
+    options.set_level(Level::DEBUG);
+    options.enable_color(false);
+    options.enable_more_debug(true);
+    return options;
+}
+
+std::size_t file_size(const std::string& file_name) {
+    struct stat file_stat{};
+    return (0 == stat(file_name.c_str(), &file_stat)) ? std::size_t(file_stat.st_size) : 0;
+}
+
+double elapsed_s(Clock::time_point since) {
+    return std::chrono::duration<double>(Clock::now() - since).count();
+}
+
+/*! Time of logging all messages to the stream, until all queued messages are written */
+double log_messages(std::shared_ptr<Stream> stream, const BenchmarkOptions& options) {
+    auto logger = std::make_shared<Logger>("binary-benchmark", make_options());
+    logger->add_stream(stream);
+    LoggerFactory::instance().set_loggers({{"binary-benchmark", logger}});
+    stream.reset();
+    logger.reset();
+
+    const auto start = Clock::now();
+    for (unsigned i = 0; i < options.messages; ++i) {
+        log_info(GET_LOGGER("binary-benchmark"), "message " << i << " of the benchmark");
+    }
+    /* all queued messages are written when the stream is destroyed */
+    LoggerFactory::instance().set_loggers({});
+    return elapsed_s(start);
+}
+
+BenchmarkOptions parse_options(int argc, const char* argv[]) {
+    BenchmarkOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--messages" == name) {
+            options.messages = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.messages) {
+        throw std::invalid_argument("Invalid number of messages");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--messages=200000]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    BenchmarkOptions options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::string text_name{};
+    std::string binary_name{};
+    int result = EXIT_SUCCESS;
+    try {
+        text_name = make_file_name();
+        binary_name = make_file_name();
+
+        auto text_stream = std::make_shared<Stream>(Stream::Type::FILE, "binary-benchmark", make_options());
+        text_stream->open_file(text_name.c_str());
+        const auto text = log_messages(std::move(text_stream), options);
+
+        auto binary_stream = std::make_shared<Stream>(Stream::Type::BINARY, "binary-benchmark", make_options());
+        binary_stream->open_binary(binary_name.c_str(), 64 * 1024 * 1024);
+        const auto binary = log_messages(std::move(binary_stream), options);
+
+        long decoded_messages{0};
+        const auto start = Clock::now();
+        const auto decoded = logger_binary_decode(binary_name.c_str(),
+            [](void* context, const struct logger_binary_entry*) -> int {
+                ++*static_cast<long*>(context);
+                return 0;
+            }, &decoded_messages);
+        const auto decoding = elapsed_s(start);
+        if (decoded != long(options.messages) || decoded != decoded_messages) {
+            throw std::runtime_error("Only " + std::to_string(decoded) + " messages decoded");
+        }
+
+        std::cout << options.messages << " messages" << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "Text stream:    " << std::setw(12) << options.messages / text << " lines/s, "
+                  << std::setw(6) << double(file_size(text_name)) / options.messages << " B/line" << std::endl;
+        std::cout << "Binary stream:  " << std::setw(12) << options.messages / binary << " lines/s, "
+                  << std::setw(6) << double(file_size(binary_name)) / options.messages << " B/line" << std::endl;
+        std::cout << "Decoding:       " << std::setw(12) << options.messages / decoding << " lines/s" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        result = EXIT_FAILURE;
+    }
+
+    std::remove(text_name.c_str());
+    std::remove(binary_name.c_str());
+    return result;
+}
@@ -0,0 +1,156 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file logger_queue_benchmark.cpp
+ *
+ * @brief Benchmark of the logging fast path and stream queues.
+ *
+ * Messages are logged to /dev/null from many threads at once. Calls with
+ * a disabled level, logging of enabled messages (queued by the callers) and
+ * writing of all queued messages are timed.
+ *
+ * Usage: logger-queue-benchmark [--threads=N] [--messages=N]
+ * */
+
+#include "logger/logger_factory.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace logger_cpp;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchmarkOptions {
+    unsigned threads{16};
+    unsigned messages{50000};
+};
+
+/*! @brief Create logger "queue-benchmark" writing to /dev/null */
+void set_null_logger() {
+    Options logger_options{};
+    logger_options.set_level(Level::INFO);
+    logger_options.enable_color(false);
+
+    auto stream = std::make_shared<Stream>(Stream::Type::FILE, "queue-benchmark", logger_options);
+    stream->open_file("/dev/null");
+
+    auto logger = std::make_shared<Logger>("queue-benchmark", logger_options);
+    logger->add_stream(stream);
+
+    LoggerFactory::instance().set_loggers({{"queue-benchmark", logger}});
+}
+
+double elapsed_s(Clock::time_point since) {
+    return std::chrono::duration<double>(Clock::now() - since).count();
+}
+
+BenchmarkOptions parse_options(int argc, const char* argv[]) {
+    BenchmarkOptions options{};
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto eq = arg.find('=');
+        const auto name = arg.substr(0, eq);
+        if (std::string::npos == eq) {
+            throw std::invalid_argument("Invalid option: " + arg);
+        }
+        const auto value = static_cast<unsigned>(std::stoul(arg.substr(eq + 1)));
+        if ("--threads" == name) {
+            options.threads = value;
+        }
+        else if ("--messages" == name) {
+            options.messages = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown option: " + name);
+        }
+    }
+    if (0 == options.threads || 0 == options.messages) {
+        throw std::invalid_argument("Invalid number of threads or messages");
+    }
+    return options;
+}
+
+void print_usage(const char* name) {
+    std::cerr << "Usage: " << name << " [--threads=16] [--messages=50000]" << std::endl;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+    BenchmarkOptions options{};
+    try {
+        options = parse_options(argc, argv);
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        const double total = double(options.threads) * options.messages;
+        set_null_logger();
+
+        /* single thread, the cost isn't hidden by other threads */
+        auto start = Clock::now();
+        for (unsigned i = 0; i < options.threads * options.messages; ++i) {
+            log_debug(GET_LOGGER("queue-benchmark"), "message " << i << " of the benchmark");
+        }
+        const auto disabled = elapsed_s(start);
+
+        start = Clock::now();
+        std::vector<std::thread> threads{};
+        for (unsigned t = 0; t < options.threads; ++t) {
+            threads.emplace_back([&options, t]() {
+                for (unsigned i = 0; i < options.messages; ++i) {
+                    log_info(GET_LOGGER("queue-benchmark"), "message " << t << " " << i << " of the benchmark");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const auto enabled = elapsed_s(start);
+
+        /* all queued messages are written when the stream is destroyed */
+        start = Clock::now();
+        LoggerFactory::instance().set_loggers({});
+        const auto written = elapsed_s(start);
+
+        std::cout << total << " messages from " << options.threads << " threads" << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "Logged:          " << std::setw(14) << total / enabled << " lines/s" << std::endl;
+        std::cout << "Written:         " << std::setw(14) << total / (enabled + written) << " lines/s" << std::endl;
+        std::cout << "Disabled level:  " << std::setw(14) << disabled * 1e9 / total << " ns/call" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
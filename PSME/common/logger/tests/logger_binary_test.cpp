@@ -0,0 +1,251 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @brief Tests of binary logger stream and its decoder
+ * */
+
+#include "gtest/gtest.h"
+#include "logger/logger_factory.hpp"
+
+extern "C" {
+#include "logger/binary.h"
+}
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace logger_cpp;
+
+namespace {
+
+std::string make_file_name() {
+    char name[] = "/tmp/logger_binary_XXXXXX";
+    int fd = mkstemp(name);
+    if (0 <= fd) {
+        close(fd);
+    }
+    /* Stream creates the file */
+    std::remove(name);
+    return name;
+}
+
+void remove_files(const std::string& file_name, unsigned count) {
+    std::remove(file_name.c_str());
+    for (unsigned i = 1; i <= count; ++i) {
+        std::remove((file_name + "." + std::to_string(i)).c_str());
+    }
+}
+
+Options make_options() {
+    Options options{};
+    options.set_level(Level::DEBUG);
+    options.enable_color(false);
+    options.enable_more_debug(true);
+    return options;
+}
+
+/*! @brief Create loggers "binary-a" and "binary-b" writing to given stream */
+void set_loggers(std::shared_ptr<Stream> stream) {
+    auto logger_a = std::make_shared<Logger>("binary-a", make_options());
+    logger_a->add_stream(stream);
+    auto logger_b = std::make_shared<Logger>("binary-b", make_options());
+    logger_b->add_stream(stream);
+
+    LoggerFactory::instance().set_loggers({{"binary-a", logger_a}, {"binary-b", logger_b}});
+}
+
+void set_binary_loggers(const std::string& file_name, std::size_t size = 0, unsigned count = 1) {
+    auto stream = std::make_shared<Stream>(Stream::Type::BINARY, "binary-test", make_options());
+    stream->open_binary(file_name.c_str(), size, count);
+    set_loggers(stream);
+}
+
+/*! @brief Remove all loggers, streams are destroyed (and all queued messages written) */
+void reset_loggers() {
+    LoggerFactory::instance().set_loggers({});
+}
+
+struct Entry {
+    unsigned level;
+    std::string tag;
+    std::string file_name;
+    std::string function_name;
+    unsigned line_number;
+    std::string message;
+    std::int64_t seconds;
+};
+
+long decode(const std::string& file_name, std::vector<Entry>& entries) {
+    return logger_binary_decode(file_name.c_str(),
+        [](void* context, const struct logger_binary_entry* entry) -> int {
+            static_cast<std::vector<Entry>*>(context)->push_back({
+                entry->level,
+                entry->tag ? entry->tag : "",
+                entry->file_name ? entry->file_name : "",
+                entry->function_name ? entry->function_name : "",
+                entry->line_number,
+                std::string(entry->message, entry->length),
+                entry->seconds
+            });
+            return 0;
+        }, &entries);
+}
+
+std::size_t file_size(const std::string& file_name) {
+    struct stat file_stat{};
+    return (0 == stat(file_name.c_str(), &file_stat)) ? std::size_t(file_stat.st_size) : 0;
+}
+
+}
+
+
+TEST(LoggerBinaryTest, MessagesDecoded) {
+    const auto file_name = make_file_name();
+    set_binary_loggers(file_name);
+
+    const auto now = std::time(nullptr);
+    const unsigned first_line = __LINE__ + 2;
+    for (unsigned i = 0; i < 3; ++i) {
+        log_info(GET_LOGGER("binary-a"), "message " << i);
+        log_error(GET_LOGGER("binary-b"), "multi\nline " << i);
+    }
+    log_debug(GET_LOGGER("binary-a"), "");
+    reset_loggers();
+
+    std::vector<Entry> entries{};
+    ASSERT_EQ(7, decode(file_name, entries));
+    for (unsigned i = 0; i < 3; ++i) {
+        const auto& a = entries[2 * i];
+        ASSERT_EQ(unsigned(Level::INFO), a.level);
+        ASSERT_EQ("binary-a", a.tag);
+        ASSERT_EQ("message " + std::to_string(i), a.message);
+        ASSERT_EQ(first_line, a.line_number);
+        ASSERT_FALSE(a.file_name.empty());
+        ASSERT_NE(std::string::npos, a.function_name.find("TestBody"));
+        ASSERT_LE(now, a.seconds);
+
+        const auto& b = entries[2 * i + 1];
+        ASSERT_EQ(unsigned(Level::ERROR), b.level);
+        ASSERT_EQ("binary-b", b.tag);
+        ASSERT_EQ("multi\nline " + std::to_string(i), b.message);
+        ASSERT_EQ(first_line + 1, b.line_number);
+    }
+    ASSERT_EQ(unsigned(Level::DEBUG), entries[6].level);
+    ASSERT_EQ("", entries[6].message);
+
+    remove_files(file_name, 0);
+}
+
+
+TEST(LoggerBinaryTest, FileAppendedWhenReopened) {
+    const auto file_name = make_file_name();
+
+    set_binary_loggers(file_name);
+    log_info(GET_LOGGER("binary-a"), "first");
+    reset_loggers();
+
+    set_binary_loggers(file_name);
+    log_info(GET_LOGGER("binary-a"), "second");
+    log_info(GET_LOGGER("binary-b"), "third");
+    reset_loggers();
+
+    std::vector<Entry> entries{};
+    ASSERT_EQ(3, decode(file_name, entries));
+    ASSERT_EQ("first", entries[0].message);
+    ASSERT_EQ("second", entries[1].message);
+    ASSERT_EQ("binary-a", entries[1].tag);
+    ASSERT_EQ("third", entries[2].message);
+    ASSERT_EQ("binary-b", entries[2].tag);
+
+    remove_files(file_name, 0);
+}
+
+
+TEST(LoggerBinaryTest, FilesRotated) {
+    constexpr unsigned MESSAGES = 1000;
+    constexpr unsigned FILES = 2;
+    const auto file_name = make_file_name();
+    set_binary_loggers(file_name, 4096, FILES);
+
+    for (unsigned i = 0; i < MESSAGES; ++i) {
+        log_info(GET_LOGGER("binary-a"), "message " << i);
+    }
+    /* doesn't fit in the file, it is truncated */
+    log_info(GET_LOGGER("binary-a"), std::string(5000, 'x'));
+    reset_loggers();
+
+    /* Each file is decoded on its own, newest messages are kept in order */
+    std::vector<Entry> entries{};
+    for (unsigned i = FILES; i > 0; --i) {
+        const auto rotated = file_name + "." + std::to_string(i);
+        ASSERT_GE(4096, file_size(rotated));
+        std::vector<Entry> file_entries{};
+        ASSERT_LT(0, decode(rotated, file_entries));
+        for (const auto& entry : file_entries) {
+            ASSERT_EQ("binary-a", entry.tag);
+            ASSERT_NE(0, entry.line_number);
+        }
+        entries.insert(entries.end(), file_entries.begin(), file_entries.end());
+    }
+    ASSERT_LT(0, decode(file_name, entries));
+    ASSERT_GE(4096, file_size(file_name));
+    ASSERT_EQ(-1, access((file_name + "." + std::to_string(FILES + 1)).c_str(), F_OK));
+
+    ASSERT_LT(2, entries.size());
+    ASSERT_LT(3000, entries.back().message.size());
+    ASSERT_GT(5000, entries.back().message.size());
+    ASSERT_EQ("message " + std::to_string(MESSAGES - 1), entries[entries.size() - 2].message);
+    const auto first = unsigned(std::stoul(entries.front().message.substr(8)));
+    for (unsigned i = 0; i + 1 < entries.size(); ++i) {
+        ASSERT_EQ("message " + std::to_string(first + i), entries[i].message);
+    }
+
+    remove_files(file_name, FILES);
+}
+
+
+TEST(LoggerBinaryTest, NotBinaryFile) {
+    const auto file_name = make_file_name();
+    {
+        std::ofstream file(file_name);
+        file << "2017-01-01 00:00:00.000000000 - INFO - text log" << std::endl;
+    }
+    std::vector<Entry> entries{};
+    ASSERT_GT(0, decode(file_name, entries));
+    ASSERT_GT(0, decode(file_name + ".missing", entries));
+
+    /* Stream doesn't overwrite other files */
+    set_binary_loggers(file_name);
+    log_info(GET_LOGGER("binary-a"), "message");
+    reset_loggers();
+    ASSERT_EQ(1, decode(file_name, entries));
+    ASSERT_GT(0, decode(file_name + ".1", entries));
+
+    remove_files(file_name, 1);
+}
+
@@ -0,0 +1,208 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @brief Tests of the logging fast path and stream queues
+ * */
+
+#include "gtest/gtest.h"
+#include "logger/logger_factory.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <unistd.h>
+
+using namespace logger_cpp;
+
+namespace {
+
+constexpr unsigned THREADS = 16;
+
+std::string make_file_name() {
+    char name[] = "/tmp/logger_queue_XXXXXX";
+    int fd = mkstemp(name);
+    if (0 <= fd) {
+        close(fd);
+    }
+    return name;
+}
+
+/*! @brief Create logger "queue-test" writing to given file */
+void set_file_logger(const std::string& file_name, bool drop_on_full, Level level = Level::INFO) {
+    Options options{};
+    options.set_level(level);
+    options.enable_color(false);
+    options.enable_drop_on_full(drop_on_full);
+
+    auto stream = std::make_shared<Stream>(Stream::Type::FILE, "queue-test", options);
+    stream->open_file(file_name.c_str());
+
+    auto logger = std::make_shared<Logger>("queue-test", options);
+    logger->add_stream(stream);
+
+    LoggerFactory::instance().set_loggers({{"queue-test", logger}});
+}
+
+/*! @brief Remove all loggers, streams are destroyed (and all queued messages written) */
+void reset_loggers() {
+    LoggerFactory::instance().set_loggers({});
+}
+
+struct FileContents {
+    unsigned lines{0};
+    unsigned messages{0};
+    unsigned dropped{0};
+};
+
+FileContents read_file(const std::string& file_name) {
+    FileContents contents{};
+    std::ifstream file(file_name);
+    std::string line{};
+    while (std::getline(file, line)) {
+        contents.lines++;
+        if (std::string::npos != line.find("message ")) {
+            contents.messages++;
+        }
+        const auto pos = line.find(" log messages dropped");
+        if (std::string::npos != pos) {
+            contents.dropped += unsigned(std::stoul(line.substr(line.rfind(' ', pos - 1) + 1)));
+        }
+    }
+    return contents;
+}
+
+template <typename Function>
+double run_threads(Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads{};
+    for (unsigned t = 0; t < THREADS; ++t) {
+        threads.emplace_back(function, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*! @brief Value logging another message while formatted */
+struct Nested {
+    int value;
+};
+
+std::ostream& operator<<(std::ostream& os, const Nested& nested) {
+    log_info(GET_LOGGER("queue-test"), "nested message " << nested.value);
+    return os << std::hex << nested.value;
+}
+
+}
+
+
+TEST(LoggerQueueTest, AllMessagesWrittenWhenBlocking) {
+    constexpr unsigned MESSAGES = 5000;
+    const auto file_name = make_file_name();
+    set_file_logger(file_name, false);
+
+    run_threads([](unsigned t) {
+        for (unsigned i = 0; i < MESSAGES; ++i) {
+            log_info(GET_LOGGER("queue-test"), "message " << t << " " << i);
+        }
+    });
+    reset_loggers();
+
+    const auto contents = read_file(file_name);
+    ASSERT_EQ(THREADS * MESSAGES, contents.messages);
+    ASSERT_EQ(0, contents.dropped);
+    std::remove(file_name.c_str());
+}
+
+
+TEST(LoggerQueueTest, DroppedMessagesReported) {
+    constexpr unsigned MESSAGES = 5000;
+    const auto file_name = make_file_name();
+    set_file_logger(file_name, true);
+
+    run_threads([](unsigned t) {
+        for (unsigned i = 0; i < MESSAGES; ++i) {
+            log_info(GET_LOGGER("queue-test"), "message " << t << " " << i);
+        }
+    });
+    reset_loggers();
+
+    const auto contents = read_file(file_name);
+    ASSERT_EQ(THREADS * MESSAGES, contents.messages + contents.dropped);
+    std::cout << "Dropped " << contents.dropped << " of " << THREADS * MESSAGES << " messages" << std::endl;
+    std::remove(file_name.c_str());
+}
+
+
+TEST(LoggerQueueTest, LongAndNestedMessages) {
+    const auto file_name = make_file_name();
+    set_file_logger(file_name, false);
+
+    /* longer than messages stored in place */
+    const std::string long_text(1000, 'x');
+    log_info(GET_LOGGER("queue-test"), "message long " << long_text);
+    /* formatting flags don't leak to the next message */
+    log_info(GET_LOGGER("queue-test"), "message outer " << Nested{26} << " " << 26);
+    log_info(GET_LOGGER("queue-test"), "message next " << 26);
+    reset_loggers();
+
+    std::ifstream file(file_name);
+    std::string line{};
+    std::vector<std::string> lines{};
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(4, lines.size());
+    ASSERT_NE(std::string::npos, lines[0].find(long_text));
+    ASSERT_NE(std::string::npos, lines[1].find("nested message 26"));
+    ASSERT_NE(std::string::npos, lines[2].find("message outer 1a 1a"));
+    ASSERT_NE(std::string::npos, lines[3].find("message next 26"));
+    std::remove(file_name.c_str());
+}
+
+
+TEST(LoggerQueueTest, HandleFollowsConfiguration) {
+    const auto first = make_file_name();
+    const auto second = make_file_name();
+
+    auto log = [](unsigned i) {
+        log_info(GET_LOGGER("queue-test"), "message " << i);
+    };
+
+    set_file_logger(first, false);
+    log(1);
+    set_file_logger(second, false);
+    log(2);
+    log(3);
+    reset_loggers();
+
+    ASSERT_EQ(1, read_file(first).messages);
+    ASSERT_EQ(2, read_file(second).messages);
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+}
+
@@ -0,0 +1,83 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ *
+ * @file logger_decode.c
+ *
+ * @brief Print messages stored by binary logger streams as text, in the
+ * same format as text streams use. Rotated files should be given oldest first
+ * */
+
+#include "logger/binary.h"
+#include "logger/logger.h"
+
+#include "logger_level.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static int print_entry(void *context, const struct logger_binary_entry *entry) {
+    FILE *out = context;
+    char time_buffer[64];
+    struct tm time_value;
+    time_t seconds = (time_t)entry->seconds;
+
+    if ((NULL == localtime_r(&seconds, &time_value)) ||
+            (0 == strftime(time_buffer, sizeof(time_buffer), "%F %T",
+                           &time_value))) {
+        time_buffer[0] = '\0';
+    }
+
+    fprintf(out, "%s.%09u - %s - ", time_buffer, entry->nanoseconds,
+            logger_level_get_string(entry->level));
+    if (NULL != entry->tag) {
+        fprintf(out, "%s - ", entry->tag);
+    }
+    fwrite(entry->message, 1, entry->length, out);
+    if (NULL != entry->file_name) {
+        fprintf(out, " [%s:%s:%u]", entry->file_name, entry->function_name,
+                entry->line_number);
+    }
+    fputc('\n', out);
+
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int status = EXIT_SUCCESS;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s FILE...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (int i = 1; i < argc; i++) {
+        long count = logger_binary_decode(argv[i], print_entry, stdout);
+        if (0 > count) {
+            fprintf(stderr, "%s: cannot decode %s\n", argv[0], argv[i]);
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,54 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file datagram.hpp
+ *
+ * @brief Datagrams for batch I/O
+ * */
+
+#pragma once
+
+#include "socket_address.hpp"
+
+#include <vector>
+
+namespace net {
+
+/*! Buffer for a datagram received by batch receive */
+struct ReceivedDatagram {
+    /*! Received data, longer datagrams are truncated to its size */
+    std::vector<char> data{};
+    /*! Number of received bytes */
+    std::size_t length{0};
+    /*! Address of the sender */
+    SocketAddress sender{};
+};
+
+/*! Datagram to be sent by batch send, data are not copied */
+struct OutgoingDatagram {
+    /*! Data to be sent */
+    const void* data;
+    /*! Length of data */
+    std::size_t length;
+    /*! Address of the target */
+    SocketAddress receiver;
+};
+
+}
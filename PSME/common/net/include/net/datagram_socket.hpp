@@ -26,6 +26,7 @@
 #pragma once
 
 #include "socket.hpp"
+#include "datagram.hpp"
 
 namespace net {
 
@@ -141,6 +142,24 @@ public:
      */
     long receive_from(void* buffer, size_t length, SocketAddress& address, int flags = 0);
 
+    /*!
+     * @brief Sends datagrams with sendmmsg system calls.
+     *
+     * @param datagrams Datagrams to be send.
+     * @param flags Optional flags.
+     * @return The number of datagrams send, less than requested if the socket would block.
+     */
+    std::size_t send_batch(const std::vector<OutgoingDatagram>& datagrams, int flags = 0);
+
+    /*!
+     * @brief Receives multiple datagrams with a single recvmmsg system call.
+     *
+     * @param datagrams Buffers for received datagrams.
+     * @param flags Optional flags, MSG_DONTWAIT is needed on blocking socket.
+     * @return The number of datagrams received.
+     */
+    std::size_t receive_batch(std::vector<ReceivedDatagram>& datagrams, int flags = 0);
+
     /*!
      * @brief Sets the value of the SO_BROADCAST socket option.
      * Setting this option allows sending packets to the broadcast address.
@@ -27,6 +27,7 @@
 
 #include "net/network_change_notifier.hpp"
 #include "net/ipaddress.hpp"
+#include "net/reactor.hpp"
 
 #include <atomic>
 #include <map>
@@ -74,8 +75,7 @@ private:
 
     int m_netlink_fd{-1};
     void close_descriptors();
-    int m_shutdown_fd[2] = {-1,-1}; // self-pipe trick
-    void send_shutdown_msg();
+    Reactor m_reactor{};
 
     using Change = std::tuple<unsigned, NetworkChangeNotifier::ChangeType>;
     using ChangeList = std::vector<Change>;
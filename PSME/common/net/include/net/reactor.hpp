@@ -0,0 +1,171 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file reactor.hpp
+ *
+ * @brief Reactor interface
+ * */
+
+#pragma once
+
+#include "socket.hpp"
+#include "paired_socket.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+
+namespace net {
+
+/*!
+ * @brief epoll based event loop.
+ *
+ * Dispatches readiness of registered descriptors and expired timers to handlers.
+ * Unlike Socket::select, the number and values of descriptors are not limited
+ * by FD_SETSIZE. Registration and timer methods have to be called from the thread
+ * running the loop (or before it is started), only wakeup() and stop() may be called
+ * from other threads.
+ */
+class Reactor final {
+public:
+    /*! Registration flag, handler is called only on state changes (EPOLLET) */
+    static constexpr int EDGE_TRIGGERED = 8;
+
+    /*! Handler of descriptor events, gets Socket::SelectMode flags of the events */
+    using Handler = std::function<void(int mode)>;
+
+    /*! Timer identifier */
+    using TimerId = std::uint64_t;
+
+    /*! Handler of expired timer */
+    using TimerHandler = std::function<void()>;
+
+    /*! @brief Constructor, throws NetException if epoll instance cannot be created */
+    Reactor();
+
+    /*! @brief Destructor */
+    ~Reactor();
+
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    /*!
+     * @brief Registers descriptor
+     * @param[in] fd Descriptor to be watched
+     * @param[in] mode Socket::SelectMode flags, optionally with EDGE_TRIGGERED
+     * @param[in] handler Handler called when descriptor is ready
+     */
+    void add(net_socket_t fd, int mode, Handler handler);
+
+    /*!
+     * @brief Registers socket
+     * @param[in] socket Socket to be watched
+     * @param[in] mode Socket::SelectMode flags, optionally with EDGE_TRIGGERED
+     * @param[in] handler Handler called when socket is ready
+     */
+    void add(const Socket& socket, int mode, Handler handler);
+
+    /*!
+     * @brief Changes events watched on registered descriptor
+     * @param[in] fd Registered descriptor
+     * @param[in] mode Socket::SelectMode flags, optionally with EDGE_TRIGGERED
+     */
+    void modify(net_socket_t fd, int mode);
+
+    /*!
+     * @brief Changes events watched on registered socket
+     * @param[in] socket Registered socket
+     * @param[in] mode Socket::SelectMode flags, optionally with EDGE_TRIGGERED
+     */
+    void modify(const Socket& socket, int mode);
+
+    /*!
+     * @brief Unregisters descriptor. May be called from a handler.
+     * @param[in] fd Registered descriptor
+     */
+    void remove(net_socket_t fd);
+
+    /*!
+     * @brief Unregisters socket. May be called from a handler.
+     * @param[in] socket Registered socket
+     */
+    void remove(const Socket& socket);
+
+    /*!
+     * @brief Adds timer
+     * @param[in] delay Time after which timer expires
+     * @param[in] handler Handler called when timer expires
+     * @param[in] period Period of repeated timer, zero for single shot timer
+     * @return Timer identifier
+     */
+    TimerId add_timer(const Duration& delay, TimerHandler handler, const Duration& period = Duration::zero());
+
+    /*!
+     * @brief Cancels timer. May be called from a handler.
+     * @param[in] id Timer identifier
+     */
+    void cancel_timer(TimerId id);
+
+    /*!
+     * @brief Waits for events and dispatches them.
+     * @param[in] timeout Maximum wait time, shortened to the first timer expiration
+     * @return Number of dispatched descriptor events and timers
+     */
+    std::size_t run_once(const Duration& timeout);
+
+    /*!
+     * @brief Dispatches events until stop() is called.
+     * Returns immediately if stop() was called before.
+     */
+    void run();
+
+    /*! @brief Makes run() return, thread safe */
+    void stop();
+
+    /*! @brief Interrupts waiting for events, thread safe */
+    void wakeup();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Timer {
+        Clock::time_point expiration;
+        Duration period;
+        TimerHandler handler;
+    };
+
+    void control(int operation, net_socket_t fd, int mode);
+    int get_wait_timeout(const Duration& timeout) const;
+    std::size_t dispatch_timers();
+
+    int m_epoll_fd{-1};
+    PairedSockets m_wakeup_pipe;
+    std::atomic<bool> m_stopped{false};
+    std::unordered_map<net_socket_t, std::shared_ptr<Handler>> m_handlers{};
+    std::map<TimerId, Timer> m_timers{};
+    std::set<std::pair<Clock::time_point, TimerId>> m_timer_queue{};
+    TimerId m_next_timer_id{0};
+};
+
+}
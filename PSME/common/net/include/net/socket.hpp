@@ -427,6 +427,8 @@ protected:
     net_socket_t sockfd() const;
 
 private:
+    friend class Reactor;
+
     std::shared_ptr<SocketImpl> m_impl{};
 };
 
@@ -27,6 +27,7 @@
 
 #include "socket.hpp"
 #include "socket_address.hpp"
+#include "datagram.hpp"
 
 #include <chrono>
 
@@ -189,6 +190,27 @@ public:
      */
     virtual long receive_from(void* buffer, size_t length, SocketAddress& address, int flags = 0);
 
+    /*!
+     * Sends datagrams to their receivers using as few sendmmsg calls as possible.
+     *
+     * @param datagrams Datagrams to be send.
+     * @param flags Optional flags.
+     * @return The number of datagrams send. Less than size of datagrams
+     * if the socket would block or sending of a datagram failed.
+     * Failure of the first datagram is reported with an exception.
+     */
+    virtual std::size_t send_batch(const std::vector<OutgoingDatagram>& datagrams, int flags = 0);
+
+    /*!
+     * Receives up to datagrams.size() datagrams with a single recvmmsg call.
+     * Use MSG_DONTWAIT on blocking sockets, otherwise the call waits for all datagrams.
+     *
+     * @param datagrams Buffers for datagrams, length and sender are updated.
+     * @param flags Optional flags.
+     * @return The number of datagrams received.
+     */
+    virtual std::size_t receive_batch(std::vector<ReceivedDatagram>& datagrams, int flags = 0);
+
     /*!
      * Sends one byte of urgent data through the socket.
      * The preferred way for a socket to receive urgent data
@@ -207,7 +229,7 @@ public:
 
     /*!
      * Determines the I/O operation readiness for this Socket.
-     * Uses a select system call.
+     * Uses a poll system call.
      *
      * @param[in] timeout Interval that poll() should block waiting
      * for a Socket to become ready.
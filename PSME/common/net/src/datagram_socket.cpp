@@ -83,6 +83,14 @@ long DatagramSocket::receive_from(void* buffer, size_t length, SocketAddress& rA
     return impl()->receive_from(buffer, length, rAddress, flags);
 }
 
+std::size_t DatagramSocket::send_batch(const std::vector<OutgoingDatagram>& datagrams, int flags) {
+    return impl()->send_batch(datagrams, flags);
+}
+
+std::size_t DatagramSocket::receive_batch(std::vector<ReceivedDatagram>& datagrams, int flags) {
+    return impl()->receive_batch(datagrams, flags);
+}
+
 void DatagramSocket::set_broadcast(bool flag) {
     impl()->set_broadcast(flag);
 }
@@ -26,6 +26,7 @@
 #include "net/network_change_notifier_impl.hpp"
 
 #include "net/ipaddress.hpp"
+#include "net/socket.hpp"
 #include "logger/logger_factory.hpp"
 #include <safe-string/safe_lib.hpp>
 
@@ -125,18 +126,6 @@ bool get_ipaddress(const struct nlmsghdr* header, IpAddress& ip_address, bool* i
     return true;
 }
 
-void init_shutdown_pipe(int fds[2]) {
-    if (pipe(fds) < 0) {
-        throw NetworkChangeNotifierException("Could not create pipe");
-    }
-    if (fcntl(fds[0], F_SETFL, O_NONBLOCK) < 0) {
-        throw NetworkChangeNotifierException("Could not set non-blocking mode on pipe read end");
-    }
-    if (fcntl(fds[1], F_SETFL, O_NONBLOCK) < 0) {
-        throw NetworkChangeNotifierException("Could not set non-blocking mode on pipe write end");
-    }
-}
-
 int create_netlink_socket() {
     int fd = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
     if (fd < 0) {
@@ -165,7 +154,7 @@ void NetworkChangeNotifierImpl::start() {
 
 void NetworkChangeNotifierImpl::stop() {
     if (m_is_running) {
-        send_shutdown_msg();
+        m_reactor.stop();
         m_is_running = false;
         if (m_thread.joinable()) {
             m_thread.join();
@@ -173,71 +162,36 @@ void NetworkChangeNotifierImpl::stop() {
     }
 }
 
-void NetworkChangeNotifierImpl::send_shutdown_msg() {
-    if (m_shutdown_fd[1] != -1) {
-        const uint8_t b[1] = {0};
-        if (write(m_shutdown_fd[1], b, sizeof (b)) < 0) {
-            log_error(GET_LOGGER("net"), "Failed to notify NetworkChangeNotifier to close.");
-        }
-    }
-}
-
 void NetworkChangeNotifierImpl::execute() {
     log_info(GET_LOGGER("net"), "NetworkChangeNotifier started.");
-    while (m_is_running) {
-        fd_set read_set;
-        FD_ZERO(&read_set);
-        int max_fd = 0;
-        if (m_netlink_fd != -1) {
-            FD_SET(m_netlink_fd, &read_set);
-            if (m_netlink_fd > max_fd) {
-                max_fd = m_netlink_fd;
-            }
-        }
-        else {
-            log_warning(GET_LOGGER("net"), "NetworkChangeNotifier - no NETLINK socket to monitor.");
-            m_is_running = false;
-            close_descriptors();
-            break;
-        }
-        if (m_shutdown_fd[0] != -1) {
-            FD_SET(m_shutdown_fd[0], &read_set);
-            if (m_shutdown_fd[0] > max_fd) {
-                max_fd = m_shutdown_fd[0];
-            }
-        }
-        auto rc = ::select(max_fd + 1, &read_set, nullptr, nullptr, nullptr);
-        if (rc > 0) {
-            if (m_netlink_fd != -1 && FD_ISSET(m_netlink_fd, &read_set)) {
-                try {
-                    process_netlink_messages_and_notify();
-                }
-                catch(...) {
-                    log_error(GET_LOGGER("net"), "NetworkChangeNotifier - Unknown error");
-                }
+    if (m_netlink_fd == -1) {
+        log_warning(GET_LOGGER("net"), "NetworkChangeNotifier - no NETLINK socket to monitor.");
+        m_is_running = false;
+        close_descriptors();
+        return;
+    }
+    try {
+        m_reactor.add(m_netlink_fd, Socket::SELECT_READ, [this](int) {
+            try {
+                process_netlink_messages_and_notify();
             }
-            if (m_shutdown_fd[0] != -1 && FD_ISSET(m_shutdown_fd[0], &read_set)) {
-                uint8_t b[1];
-                auto ret = read(m_shutdown_fd[0], b, sizeof(b));
-                if (ret < 0) {
-                    log_error(GET_LOGGER("net"), "NetworkChangeNotifier - Failed to read notification.");
-                }
-                m_is_running = false;
-                break;
+            catch(...) {
+                log_error(GET_LOGGER("net"), "NetworkChangeNotifier - Unknown error");
             }
-        }
-        else if (rc < 0 && EINTR != errno) {
-            log_debug(GET_LOGGER("net"),
-                      "NetworkChangeNotifier - select error: " << strerror(errno));
-        }
+        });
+        // returns when stop() is called
+        m_reactor.run();
+        m_reactor.remove(m_netlink_fd);
+    }
+    catch (const std::exception& e) {
+        log_error(GET_LOGGER("net"), "NetworkChangeNotifier - " << e.what());
+        m_is_running = false;
     }
     log_debug(GET_LOGGER("net"), "NetworkChangeNotifier stopped.");
 }
 
 void NetworkChangeNotifierImpl::init() {
 
-    init_shutdown_pipe(m_shutdown_fd);
-
     m_netlink_fd = create_netlink_socket();
 
     // Register for notifications.
@@ -415,14 +369,6 @@ void NetworkChangeNotifierImpl::close_descriptors() {
         log_error(GET_LOGGER("net"), "Could not close NETLINK socket.");
     }
     m_netlink_fd = -1;
-    if (m_shutdown_fd[0] >= 0) {
-        close(m_shutdown_fd[0]);
-        m_shutdown_fd[0] = -1;
-    }
-    if (m_shutdown_fd[1] >= 0) {
-        close(m_shutdown_fd[1]);
-        m_shutdown_fd[1] = -1;
-    }
 }
 
 }
@@ -0,0 +1,249 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file reactor.cpp
+ *
+ * @brief Reactor implementation
+ * */
+
+#include "net/reactor.hpp"
+#include "net/net_exception.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+
+extern "C" {
+#include <sys/epoll.h>
+#include <unistd.h>
+}
+
+namespace net {
+
+constexpr int Reactor::EDGE_TRIGGERED;
+
+namespace {
+
+constexpr int MAX_EVENTS = 64;
+
+std::uint32_t to_epoll_events(int mode) {
+    std::uint32_t events{0};
+    if (mode & Socket::SELECT_READ) {
+        events |= EPOLLIN;
+    }
+    if (mode & Socket::SELECT_WRITE) {
+        events |= EPOLLOUT;
+    }
+    if (mode & Socket::SELECT_ERROR) {
+        events |= EPOLLPRI;
+    }
+    if (mode & Reactor::EDGE_TRIGGERED) {
+        events |= EPOLLET;
+    }
+    return events;
+}
+
+int to_mode(std::uint32_t events) {
+    int mode{0};
+    if (events & EPOLLIN) {
+        mode |= Socket::SELECT_READ;
+    }
+    if (events & EPOLLOUT) {
+        mode |= Socket::SELECT_WRITE;
+    }
+    if (events & (EPOLLPRI | EPOLLERR | EPOLLHUP)) {
+        mode |= Socket::SELECT_ERROR;
+    }
+    return mode;
+}
+
+}
+
+Reactor::Reactor() : m_wakeup_pipe(PairedSocket::create_socket_pair()) {
+    m_epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll_fd < 0) {
+        throw NetException(std::string("Failed to create epoll instance: ") + std::strerror(errno), errno);
+    }
+    try {
+        // the handler is never called, wakeup messages are drained in run_once
+        add(m_wakeup_pipe.second, Socket::SELECT_READ, nullptr);
+    }
+    catch (...) {
+        ::close(m_epoll_fd);
+        throw;
+    }
+}
+
+Reactor::~Reactor() {
+    ::close(m_epoll_fd);
+}
+
+void Reactor::control(int operation, net_socket_t fd, int mode) {
+    struct epoll_event event{};
+    event.events = to_epoll_events(mode);
+    event.data.fd = fd;
+    if (0 != ::epoll_ctl(m_epoll_fd, operation, fd, &event)) {
+        throw NetException(std::string("epoll_ctl failed: ") + std::strerror(errno), errno);
+    }
+}
+
+void Reactor::add(net_socket_t fd, int mode, Handler handler) {
+    if (NET_INVALID_SOCKET == fd) {
+        throw InvalidSocketException();
+    }
+    control(EPOLL_CTL_ADD, fd, mode);
+    m_handlers[fd] = std::make_shared<Handler>(std::move(handler));
+}
+
+void Reactor::add(const Socket& socket, int mode, Handler handler) {
+    add(socket.sockfd(), mode, std::move(handler));
+}
+
+void Reactor::modify(net_socket_t fd, int mode) {
+    control(EPOLL_CTL_MOD, fd, mode);
+}
+
+void Reactor::modify(const Socket& socket, int mode) {
+    modify(socket.sockfd(), mode);
+}
+
+void Reactor::remove(net_socket_t fd) {
+    if (0 != m_handlers.erase(fd)) {
+        // descriptor could have been closed already, it is removed from epoll set then
+        ::epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+    }
+}
+
+void Reactor::remove(const Socket& socket) {
+    remove(socket.sockfd());
+}
+
+Reactor::TimerId Reactor::add_timer(const Duration& delay, TimerHandler handler, const Duration& period) {
+    const auto id = ++m_next_timer_id;
+    const auto expiration = Clock::now() + delay;
+    m_timers.emplace(id, Timer{expiration, period, std::move(handler)});
+    m_timer_queue.emplace(expiration, id);
+    return id;
+}
+
+void Reactor::cancel_timer(TimerId id) {
+    const auto it = m_timers.find(id);
+    if (m_timers.end() != it) {
+        m_timer_queue.erase(std::make_pair(it->second.expiration, id));
+        m_timers.erase(it);
+    }
+}
+
+int Reactor::get_wait_timeout(const Duration& timeout) const {
+    auto wait = timeout;
+    if (!m_timer_queue.empty()) {
+        const auto until_expiration = m_timer_queue.cbegin()->first - Clock::now();
+        if (until_expiration < wait) {
+            wait = std::max(until_expiration, Duration::zero());
+        }
+    }
+    if (Duration::max() == wait) {
+        return -1;
+    }
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(wait);
+    if (ms < wait) {
+        // round up, waking up before expiration would spin
+        ++ms;
+    }
+    return ms.count() > INT_MAX ? INT_MAX : static_cast<int>(ms.count());
+}
+
+std::size_t Reactor::run_once(const Duration& timeout) {
+    struct epoll_event events[MAX_EVENTS];
+    int count{0};
+    do {
+        count = ::epoll_wait(m_epoll_fd, events, MAX_EVENTS, get_wait_timeout(timeout));
+    } while (count < 0 && EINTR == errno);
+    if (count < 0) {
+        throw NetException(std::string("epoll_wait failed: ") + std::strerror(errno), errno);
+    }
+
+    std::size_t dispatched{0};
+    const auto wakeup_fd = m_wakeup_pipe.second.sockfd();
+    for (int i = 0; i < count; ++i) {
+        const auto fd = events[i].data.fd;
+        if (wakeup_fd == fd) {
+            char buffer[64];
+            while (m_wakeup_pipe.second.receive_bytes(buffer, sizeof(buffer)) > 0) { }
+            continue;
+        }
+        // handler could have been removed by a handler called before
+        const auto it = m_handlers.find(fd);
+        if (m_handlers.end() != it && *it->second) {
+            const auto handler = it->second;
+            (*handler)(to_mode(events[i].events));
+            ++dispatched;
+        }
+    }
+    return dispatched + dispatch_timers();
+}
+
+std::size_t Reactor::dispatch_timers() {
+    std::size_t dispatched{0};
+    const auto now = Clock::now();
+    while (!m_timer_queue.empty() && m_timer_queue.cbegin()->first <= now) {
+        const auto id = m_timer_queue.cbegin()->second;
+        m_timer_queue.erase(m_timer_queue.cbegin());
+        auto it = m_timers.find(id);
+        auto handler = it->second.handler;
+        if (Duration::zero() < it->second.period) {
+            // expirations missed by a busy loop are not repeated
+            auto& timer = it->second;
+            timer.expiration = std::max(timer.expiration + timer.period, now + Duration(1));
+            m_timer_queue.emplace(timer.expiration, id);
+        }
+        else {
+            m_timers.erase(it);
+        }
+        handler();
+        ++dispatched;
+    }
+    return dispatched;
+}
+
+void Reactor::run() {
+    while (!m_stopped) {
+        run_once(Duration::max());
+    }
+    m_stopped = false;
+}
+
+void Reactor::stop() {
+    m_stopped = true;
+    wakeup();
+}
+
+void Reactor::wakeup() {
+    const char byte{0};
+    try {
+        m_wakeup_pipe.first.send_bytes(&byte, sizeof(byte));
+    }
+    catch (const NetException&) {
+        // socket buffer is full, the loop is woken up anyway
+    }
+}
+
+}
@@ -28,16 +28,21 @@
 #include "net/stream_socket_impl.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <cstring>
 
+extern "C" {
+#include <poll.h>
+}
+
 namespace {
 template<typename Duration>
-timeval to_timeval(Duration&& d) {
-    timeval tv;
-    std::chrono::seconds const sec = std::chrono::duration_cast<std::chrono::seconds>(d);
-    tv.tv_sec = long(sec.count());
-    tv.tv_usec = long(std::chrono::duration_cast<std::chrono::microseconds>(d - sec).count());
-    return tv;
+int to_poll_timeout(Duration&& d) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(d);
+    if (ms < d) {
+        ++ms;
+    }
+    return ms.count() > INT_MAX ? INT_MAX : int(ms.count());
 }
 }
 
@@ -62,50 +67,29 @@ bool Socket::supports_ipv6() {
 }
 
 int Socket::select(List& read_list, List& write_list, List& except_list, const Duration& timeout) {
-    fd_set read_set;
-    fd_set write_set;
-    fd_set except_set;
-    int max_fd = 0;
-    FD_ZERO(&read_set);
-    for (const auto& read_socket: read_list) {
-        const auto& fd = read_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd) {
-            if (fd > max_fd) {
-                max_fd = fd;
-            }
-            FD_SET(fd, &read_set);
-        }
-    }
-    FD_ZERO(&write_set);
-    for (const auto& write_socket: write_list) {
-        const auto& fd = write_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd) {
-            if (fd > max_fd) {
-                max_fd = fd;
-            }
-            FD_SET(fd, &write_set);
-        }
-    }
-    FD_ZERO(&except_set);
-    for (const auto& except_socket: except_list) {
-        const auto& fd = except_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd) {
-            if (fd > max_fd) {
-                max_fd = fd;
+    // poll() is used as select() cannot watch descriptors >= FD_SETSIZE
+    std::vector<pollfd> fds{};
+    fds.reserve(read_list.size() + write_list.size() + except_list.size());
+    auto add = [&fds](const List& list, short events) {
+        for (const auto& socket: list) {
+            const auto fd = socket.sockfd();
+            if (NET_INVALID_SOCKET != fd) {
+                fds.push_back(pollfd{fd, events, 0});
             }
-            FD_SET(fd, &except_set);
         }
-    }
+    };
+    add(read_list, POLLIN);
+    add(write_list, POLLOUT);
+    add(except_list, POLLPRI);
 
-    if (max_fd == 0) {
+    if (fds.empty()) {
         return 0;
     }
     Duration remaining_time(timeout);
     int rc;
     do {
-        auto tv = to_timeval(remaining_time);
         auto start = std::chrono::steady_clock::now();
-        rc = ::select(max_fd + 1, &read_set, &write_set, &except_set, &tv);
+        rc = ::poll(fds.data(), fds.size(), to_poll_timeout(remaining_time));
         if (rc < 0 && EINTR == SocketImpl::last_error()) {
             auto end = std::chrono::steady_clock::now();
             Duration elapsed = end - start;
@@ -121,31 +105,25 @@ int Socket::select(List& read_list, List& write_list, List& except_list, const D
         SocketImpl::throw_error();
     }
 
-    List read_ready;
-    for (const auto& read_socket: read_list) {
-        const auto& fd = read_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd && FD_ISSET(fd, &read_set)) {
-            read_ready.emplace_back(read_socket);
-        }
-    }
-    std::swap(read_list, read_ready);
-    List write_ready;
-    for (const auto& write_socket: read_list) {
-        const auto& fd = write_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd && FD_ISSET(fd, &write_set)) {
-            write_ready.emplace_back(write_socket);
-        }
-    }
-    std::swap(write_list, write_ready);
-    List except_ready;
-    for (const auto& except_socket: except_list) {
-        const auto& fd = except_socket.sockfd();
-        if (NET_INVALID_SOCKET != fd && FD_ISSET(fd, &write_set)) {
-            except_ready.emplace_back(except_socket);
+    // descriptors are in fds in the order they were added
+    auto it = fds.cbegin();
+    auto select_ready = [&it](List& list, short ready_events) {
+        List ready{};
+        for (const auto& socket: list) {
+            if (NET_INVALID_SOCKET != socket.sockfd()) {
+                if (it->revents & ready_events) {
+                    ready.emplace_back(socket);
+                }
+                ++it;
+            }
         }
-    }
-    std::swap(except_list, except_ready);
-    return rc;
+        std::swap(list, ready);
+    };
+    // select() reports hang up and errors as read/write readiness
+    select_ready(read_list, POLLIN | POLLHUP | POLLERR);
+    select_ready(write_list, POLLOUT | POLLHUP | POLLERR);
+    select_ready(except_list, POLLPRI);
+    return int(read_list.size() + write_list.size() + except_list.size());
 }
 
 bool Socket::operator==(const Socket& socket) const {
@@ -26,8 +26,13 @@
 #include "net/socket_impl.hpp"
 #include "net/stream_socket_impl.hpp"
 #include <chrono>
+#include <climits>
 #include <cstring>
 
+extern "C" {
+#include <poll.h>
+}
+
 namespace {
 template<typename Duration>
 timeval to_timeval(Duration&& d) {
@@ -37,6 +42,15 @@ timeval to_timeval(Duration&& d) {
     tv.tv_usec = long(std::chrono::duration_cast<std::chrono::microseconds>(d - sec).count());
     return tv;
 }
+
+template<typename Duration>
+int to_poll_timeout(Duration&& d) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(d);
+    if (ms < d) {
+        ++ms;
+    }
+    return ms.count() > INT_MAX ? INT_MAX : int(ms.count());
+}
 }
 
 namespace net {
@@ -285,6 +299,78 @@ long SocketImpl::receive_from(void* buffer, size_t length, SocketAddress& addres
     return rc;
 }
 
+std::size_t SocketImpl::send_batch(const std::vector<OutgoingDatagram>& datagrams, int flags) {
+    if (NET_INVALID_SOCKET == m_sockfd) {
+        throw InvalidSocketException();
+    }
+    std::vector<iovec> iovecs(datagrams.size());
+    std::vector<mmsghdr> headers(datagrams.size());
+    for (std::size_t i = 0; i < datagrams.size(); ++i) {
+        iovecs[i].iov_base = const_cast<void*>(datagrams[i].data);
+        iovecs[i].iov_len = datagrams[i].length;
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+        headers[i].msg_hdr.msg_name = const_cast<struct sockaddr*>(datagrams[i].receiver.addr());
+        headers[i].msg_hdr.msg_namelen = datagrams[i].receiver.length();
+    }
+    std::size_t sent{0};
+    while (sent < datagrams.size()) {
+        // sendmmsg stops on the first failed datagram, its error is returned by the next call
+        const auto rc = ::sendmmsg(m_sockfd, headers.data() + sent, unsigned(datagrams.size() - sent), flags);
+        if (rc < 0) {
+            const auto err = last_error();
+            if (EINTR == err) {
+                continue;
+            }
+            if (0 == sent && EAGAIN != err && EWOULDBLOCK != err) {
+                throw_error(err);
+            }
+            break;
+        }
+        sent += std::size_t(rc);
+    }
+    return sent;
+}
+
+std::size_t SocketImpl::receive_batch(std::vector<ReceivedDatagram>& datagrams, int flags) {
+    if (NET_INVALID_SOCKET == m_sockfd) {
+        throw InvalidSocketException();
+    }
+    std::vector<SockaddrStorage> addresses(datagrams.size());
+    std::vector<iovec> iovecs(datagrams.size());
+    std::vector<mmsghdr> headers(datagrams.size());
+    for (std::size_t i = 0; i < datagrams.size(); ++i) {
+        iovecs[i].iov_base = datagrams[i].data.data();
+        iovecs[i].iov_len = datagrams[i].data.size();
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+        headers[i].msg_hdr.msg_name = addresses[i].addr;
+        headers[i].msg_hdr.msg_namelen = addresses[i].addr_len;
+    }
+    int rc{0};
+    do {
+        rc = ::recvmmsg(m_sockfd, headers.data(), unsigned(headers.size()), flags, nullptr);
+    } while (rc < 0 && last_error() == EINTR);
+    if (rc < 0) {
+        const auto err = last_error();
+        if ((EAGAIN == err || EWOULDBLOCK == err) && (!m_blocking || (flags & MSG_DONTWAIT))) {
+            return 0;
+        }
+        else if (EAGAIN == err || ETIMEDOUT == err) {
+            throw TimeoutException("Timeout", err);
+        }
+        else {
+            throw_error(err);
+        }
+    }
+    for (std::size_t i = 0; i < std::size_t(rc); ++i) {
+        addresses[i].addr_len = headers[i].msg_hdr.msg_namelen;
+        datagrams[i].length = headers[i].msg_len;
+        datagrams[i].sender = SocketAddress(addresses[i]);
+    }
+    return std::size_t(rc);
+}
+
 void SocketImpl::send_urgent(unsigned char data) {
     if (NET_INVALID_SOCKET == m_sockfd ) {
         throw InvalidSocketException();
@@ -307,28 +393,23 @@ bool SocketImpl::poll(const Duration& timeout, int mode) {
         throw InvalidSocketException();
     }
 
-    fd_set read_set;
-    fd_set write_set;
-    fd_set except_set;
-    FD_ZERO(&read_set);
-    FD_ZERO(&write_set);
-    FD_ZERO(&except_set);
+    // poll() is used as select() cannot watch descriptors >= FD_SETSIZE
+    pollfd fd{socketfd, 0, 0};
     if (mode & Socket::SELECT_READ) {
-        FD_SET(socketfd, &read_set);
+        fd.events |= POLLIN;
     }
     if (mode & Socket::SELECT_WRITE) {
-        FD_SET(socketfd, &write_set);
+        fd.events |= POLLOUT;
     }
     if (mode & Socket::SELECT_ERROR) {
-        FD_SET(socketfd, &except_set);
+        fd.events |= POLLPRI;
     }
     Duration remaining_time(timeout);
     int error_code = NET_ENOERR;
     int rc;
     do {
-        auto tv = to_timeval(remaining_time);
         auto start = std::chrono::steady_clock::now();
-        rc = ::select(socketfd + 1, &read_set, &write_set, &except_set, &tv);
+        rc = ::poll(&fd, 1, to_poll_timeout(remaining_time));
         if (rc < 0 && EINTR == (error_code = last_error())) {
             auto end = std::chrono::steady_clock::now();
             Duration elapsed = end - start;
@@ -0,0 +1,192 @@
+/*!
+ * @section LICENSE
+ *
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @section DESCRIPTION
+ * */
+
+#include "net/reactor.hpp"
+#include "net/socket_impl.hpp"
+#include "gtest/gtest.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace net;
+
+namespace {
+
+constexpr std::chrono::milliseconds WAIT{200};
+
+void send(PairedSocket& socket) {
+    const char byte{1};
+    socket.send_bytes(&byte, sizeof(byte));
+}
+
+void drain(PairedSocket& socket) {
+    char buffer[16];
+    while (socket.receive_bytes(buffer, sizeof(buffer)) > 0) { }
+}
+
+}
+
+TEST(ReactorTest, ReadHandler) {
+    Reactor reactor{};
+    auto pair = PairedSocket::create_socket_pair();
+    int calls{0};
+    reactor.add(pair.second, Socket::SELECT_READ, [&](int mode) {
+        EXPECT_TRUE(mode & Socket::SELECT_READ);
+        drain(pair.second);
+        ++calls;
+    });
+
+    EXPECT_EQ(0, reactor.run_once(std::chrono::milliseconds(10)));
+    send(pair.first);
+    EXPECT_EQ(1, reactor.run_once(WAIT));
+    EXPECT_EQ(1, calls);
+
+    reactor.remove(pair.second);
+    send(pair.first);
+    EXPECT_EQ(0, reactor.run_once(std::chrono::milliseconds(10)));
+    EXPECT_EQ(1, calls);
+}
+
+TEST(ReactorTest, LevelAndEdgeTriggered) {
+    Reactor reactor{};
+    auto level = PairedSocket::create_socket_pair();
+    auto edge = PairedSocket::create_socket_pair();
+    int level_calls{0};
+    int edge_calls{0};
+    reactor.add(level.second, Socket::SELECT_READ, [&](int) { ++level_calls; });
+    reactor.add(edge.second, Socket::SELECT_READ | Reactor::EDGE_TRIGGERED, [&](int) { ++edge_calls; });
+    send(level.first);
+    send(edge.first);
+
+    // data is not read, level triggered handler is called again
+    reactor.run_once(WAIT);
+    reactor.run_once(std::chrono::milliseconds(10));
+    EXPECT_EQ(2, level_calls);
+    EXPECT_EQ(1, edge_calls);
+
+    send(edge.first);
+    reactor.run_once(WAIT);
+    EXPECT_EQ(2, edge_calls);
+}
+
+TEST(ReactorTest, WriteHandler) {
+    Reactor reactor{};
+    auto pair = PairedSocket::create_socket_pair();
+    int calls{0};
+    reactor.add(pair.first, Socket::SELECT_READ, [&](int) { ++calls; });
+    EXPECT_EQ(0, reactor.run_once(Duration::zero()));
+    reactor.modify(pair.first, Socket::SELECT_WRITE);
+    EXPECT_EQ(1, reactor.run_once(WAIT));
+    EXPECT_EQ(1, calls);
+}
+
+TEST(ReactorTest, Timers) {
+    Reactor reactor{};
+    int single{0};
+    int periodic{0};
+    int cancelled{0};
+    reactor.add_timer(std::chrono::milliseconds(5), [&]() { ++single; });
+    const auto periodic_id = reactor.add_timer(Duration::zero(), [&]() { ++periodic; },
+                                               std::chrono::milliseconds(10));
+    const auto cancelled_id = reactor.add_timer(std::chrono::milliseconds(5), [&]() { ++cancelled; });
+    reactor.cancel_timer(cancelled_id);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(55)) {
+        // wait is shortened to the first expiration
+        reactor.run_once(std::chrono::seconds(10));
+    }
+    reactor.cancel_timer(periodic_id);
+    EXPECT_EQ(0, reactor.run_once(std::chrono::milliseconds(20)));
+
+    EXPECT_EQ(1, single);
+    EXPECT_LE(5, periodic);
+    EXPECT_GE(7, periodic);
+    EXPECT_EQ(0, cancelled);
+}
+
+TEST(ReactorTest, StopFromOtherThread) {
+    Reactor reactor{};
+    std::thread thread([&reactor]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        reactor.stop();
+    });
+    const auto start = std::chrono::steady_clock::now();
+    reactor.run();
+    thread.join();
+    EXPECT_GT(std::chrono::seconds(5), std::chrono::steady_clock::now() - start);
+
+    // stop requested before run
+    reactor.stop();
+    reactor.run();
+}
+
+TEST(ReactorTest, DescriptorsAboveSelectLimit) {
+    constexpr rlim_t DESCRIPTORS = 2 * FD_SETSIZE + 64;
+    rlimit limit{};
+    ASSERT_EQ(0, getrlimit(RLIMIT_NOFILE, &limit));
+    if (limit.rlim_cur < DESCRIPTORS) {
+        limit.rlim_cur = std::min(DESCRIPTORS, limit.rlim_max);
+        ASSERT_EQ(0, setrlimit(RLIMIT_NOFILE, &limit));
+    }
+    if (limit.rlim_cur < DESCRIPTORS) {
+        std::cout << "RLIMIT_NOFILE is too low, test not run" << std::endl;
+        return;
+    }
+
+    std::vector<PairedSockets> pairs{};
+    while (pairs.size() * 2 < FD_SETSIZE + 32) {
+        pairs.emplace_back(PairedSocket::create_socket_pair());
+    }
+    auto& last = pairs.back();
+    ASSERT_LE(FD_SETSIZE, last.second.impl()->sockfd());
+
+    Reactor reactor{};
+    std::vector<int> calls(pairs.size(), 0);
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        reactor.add(pairs[i].second, Socket::SELECT_READ, [&pairs, &calls, i](int) {
+            drain(pairs[i].second);
+            ++calls[i];
+        });
+    }
+    send(last.first);
+    send(pairs.front().first);
+    EXPECT_EQ(2, reactor.run_once(WAIT));
+    EXPECT_EQ(1, calls.back());
+    EXPECT_EQ(1, calls.front());
+
+    // select and poll of Socket work with such descriptors too
+    send(last.first);
+    EXPECT_TRUE(last.second.poll(WAIT, Socket::SELECT_READ));
+    Socket::List readable{last.second, pairs.front().second};
+    Socket::List writable{last.first};
+    Socket::List except{};
+    EXPECT_EQ(2, Socket::select(readable, writable, except, WAIT));
+    ASSERT_EQ(1, readable.size());
+    EXPECT_TRUE(last.second == readable.front());
+    EXPECT_EQ(1, writable.size());
+}
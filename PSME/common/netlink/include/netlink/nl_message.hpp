@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include "netlink/nl_socket_pool.hpp"
+
 #include <linux/netlink.h>
 #include <exception>
+#include <vector>
 
 /*! forward declarations */
 struct sockaddr_nl;
@@ -57,6 +60,9 @@ public:
         USER  = NETLINK_USERSOCK
     };
 
+    /*! List of messages sent at once */
+    using Messages = std::vector<NlMessage*>;
+
     /*!
      * @brief Default constructor.
      *
@@ -93,10 +99,23 @@ public:
     void set_nlhdr_flags(int flags) { m_flags = flags; }
 
     /*!
-     * @brief Send the message.
+     * @brief Send the message and process the reply.
      */
     void send();
 
+    /*!
+     * @brief Send all messages before processing any reply.
+     *
+     * Messages are sent over the socket of the first message, replies
+     * are processed in order. A limited number of requests is sent ahead
+     * of the processed reply. All messages must use the same protocol.
+     * Processing stops on the first error, the following messages may
+     * have been applied already.
+     *
+     * @param[in] messages Messages to be sent
+     */
+    static void send(const Messages& messages);
+
     /*!
      * @brief Default destructor.
      */
@@ -114,19 +133,26 @@ protected:
     virtual void prepare_message(struct nl_msg*) { }
 
     /*!
-     * @brief Prepare message to be sent.
+     * @brief Get socket the message is sent with, taken from the socket pool.
      */
-    struct nl_sock *get_sock() { return mp_sock; }
+    struct nl_sock *get_sock();
 
 private:
     static int valid_message_handler(struct nl_msg*, void*);
     static int finish_message_handler(struct nl_msg* , void*);
+    static int ack_message_handler(struct nl_msg* , void*);
     static int error_message_handler(struct sockaddr_nl*,
                                         struct nlmsgerr*, void*);
+    void install_handlers(struct nl_sock*);
+    void send_message(struct nl_sock*);
+    void receive_reply(struct nl_sock*);
+
     /* class members */
     std::exception_ptr m_handler_exception{};
-    struct nl_sock* mp_sock;
+    NlSocket m_sock{};
     int m_proto;
+    bool m_wait_for_ack{};
+    bool m_completed{};
     int m_type{};
     int m_flags{};
 };
@@ -0,0 +1,130 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nl_socket_pool.hpp
+ *
+ * @brief Pool of connected Netlink sockets
+ * */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*! forward declarations */
+struct nl_sock;
+
+namespace netlink_base {
+
+/*!
+ * @brief Returns Netlink socket to the pool
+ */
+struct NlSocketReleaser {
+    /*!
+     * @brief Constructor
+     *
+     * @param[in] proto Netlink protocol the socket is connected with
+     */
+    explicit NlSocketReleaser(int proto = 0) : protocol{proto} { }
+
+    /*! Netlink protocol the socket is connected with */
+    int protocol;
+
+    /*!
+     * @brief Return socket to the pool
+     *
+     * @param[in] sock Netlink socket
+     */
+    void operator()(struct nl_sock* sock) const;
+};
+
+/*! Netlink socket taken from the pool, returned when released */
+using NlSocket = std::unique_ptr<struct nl_sock, NlSocketReleaser>;
+
+/*!
+ * @brief Pool of connected Netlink sockets.
+ *
+ * Sockets are pooled per protocol. Socket options changed by the user are
+ * kept when the socket is returned, so all users of a protocol have to set
+ * up sockets the same way. Sockets which may still hold unread replies must
+ * be discarded instead of returned.
+ */
+class NlSocketPool final {
+public:
+    /*! Maximum number of idle sockets kept per protocol */
+    static constexpr std::size_t MAX_IDLE_SOCKETS = 8;
+
+    /*!
+     * @brief Get pool instance
+     *
+     * @return Netlink socket pool
+     */
+    static NlSocketPool& get_instance();
+
+    /*!
+     * @brief Take connected socket from the pool, a new one is
+     * connected when there is no idle socket.
+     *
+     * @param[in] protocol Netlink protocol
+     *
+     * @return Netlink socket
+     */
+    NlSocket acquire(int protocol);
+
+    /*!
+     * @brief Free socket instead of returning it to the pool
+     *
+     * @param[in] sock Netlink socket
+     */
+    static void discard(NlSocket& sock);
+
+    /*!
+     * @brief Get number of idle sockets
+     *
+     * @param[in] protocol Netlink protocol
+     *
+     * @return Number of idle sockets of the protocol
+     */
+    std::size_t get_idle_count(int protocol) const;
+
+    /*!
+     * @brief Free all idle sockets
+     */
+    void clear();
+
+    /*! @brief Destructor */
+    ~NlSocketPool();
+
+private:
+    friend struct NlSocketReleaser;
+
+    NlSocketPool() = default;
+    NlSocketPool(const NlSocketPool&) = delete;
+    NlSocketPool& operator=(const NlSocketPool&) = delete;
+
+    void release(int protocol, struct nl_sock* sock);
+
+    mutable std::mutex m_mutex{};
+    std::map<int, std::vector<struct nl_sock*>> m_idle{};
+};
+
+}
@@ -38,28 +38,41 @@ namespace {
         }
     };
     using NlMsg = std::unique_ptr<struct nl_msg, NlMsgDeleter>;
+
+    /* maximum number of requests sent before reading their replies */
+    constexpr std::size_t MAX_PENDING_MESSAGES = 16;
 }
 
 using namespace netlink_base;
 
-NlMessage::NlMessage(NlMessage::Protocol proto) :
-        m_proto{int(proto)}, mp_sock{nl_socket_alloc()} {
-    /* connect to the socket */
-    if (0 != nl_connect(mp_sock, m_proto)) {
-        throw NlException("Failed to connect to the Netlink socket");
+NlMessage::NlMessage(NlMessage::Protocol proto) : m_proto{int(proto)} { }
+
+struct nl_sock* NlMessage::get_sock() {
+    if (!m_sock) {
+        m_sock = NlSocketPool::get_instance().acquire(m_proto);
     }
+    return m_sock.get();
+}
+
+void NlMessage::install_handlers(struct nl_sock* sock) {
+    /* pooled sockets are shared, callbacks have to be set for each message */
     /* setup valid message callback */
-    if (0 != nl_socket_modify_cb(mp_sock, NL_CB_VALID, NL_CB_CUSTOM,
+    if (0 != nl_socket_modify_cb(sock, NL_CB_VALID, NL_CB_CUSTOM,
                         NlMessage::valid_message_handler, this)) {
         throw NlException("Failed to setup the valid message cb");
     }
     /* setup finish message callback */
-    if (0 != nl_socket_modify_cb(mp_sock, NL_CB_FINISH, NL_CB_CUSTOM,
-                        NlMessage::finish_message_handler, nullptr)) {
+    if (0 != nl_socket_modify_cb(sock, NL_CB_FINISH, NL_CB_CUSTOM,
+                        NlMessage::finish_message_handler, this)) {
         throw NlException("Failed to setup the finish message cb");
     }
+    /* setup ack message callback */
+    if (0 != nl_socket_modify_cb(sock, NL_CB_ACK, NL_CB_CUSTOM,
+                        NlMessage::ack_message_handler, this)) {
+        throw NlException("Failed to setup the ack message cb");
+    }
     /* setup error message callback */
-    if (0 != nl_socket_modify_err_cb(mp_sock, NL_CB_CUSTOM,
+    if (0 != nl_socket_modify_err_cb(sock, NL_CB_CUSTOM,
                         NlMessage::error_message_handler, this)) {
         throw NlException("Failed to setup the error message cb");
     }
@@ -82,17 +95,24 @@ int NlMessage::valid_message_handler(struct nl_msg* msg, void* arg) {
     return NL_OK;
 }
 
-int NlMessage::finish_message_handler(struct nl_msg*, void*) {
+int NlMessage::finish_message_handler(struct nl_msg*, void* arg) {
+    static_cast<NlMessage*>(arg)->m_completed = true;
     /* skip Netlink DONE message */
     return NL_SKIP;
 }
 
+int NlMessage::ack_message_handler(struct nl_msg*, void* arg) {
+    static_cast<NlMessage*>(arg)->m_completed = true;
+    /* ack is the last message of the reply */
+    return NL_STOP;
+}
+
 int NlMessage::error_message_handler(struct sockaddr_nl*,
         struct nlmsgerr*, void*) {
     return NL_STOP;
 }
 
-void NlMessage::send() {
+void NlMessage::send_message(struct nl_sock* sock) {
     int nl_error{};
     /* allocate new message */
     NlMsg msg{static_cast<NlMsg::pointer>(nlmsg_alloc_simple(m_type, m_flags))};
@@ -101,25 +121,76 @@ void NlMessage::send() {
     }
     /* prepare and send the message */
     prepare_message(msg.get());
-    if (0 > (nl_error = nl_send_auto(mp_sock, (msg.get())))) {
+    if (0 > (nl_error = nl_send_auto(sock, (msg.get())))) {
         throw NlException(nl_geterror(nl_error));
     }
-    nl_error = nl_recvmsgs_default(mp_sock);
-    if (NLE_MAX < abs(nl_error)) {
-        /* throw process handler exception to caller */
-        std::rethrow_exception(m_handler_exception);
+    /* ack follows the reply, it has to be read before the socket is reused */
+    m_wait_for_ack = (0 != (nlmsg_hdr(msg.get())->nlmsg_flags & NLM_F_ACK));
+    m_completed = false;
+}
+
+void NlMessage::receive_reply(struct nl_sock* sock) {
+    install_handlers(sock);
+    do {
+        int nl_error = nl_recvmsgs_default(sock);
+        if (NLE_MAX < abs(nl_error)) {
+            /* throw process handler exception to caller */
+            std::rethrow_exception(m_handler_exception);
+        }
+        else if (0 > nl_error) {
+            /* Netlink error message reported back from kernel */
+            switch (abs(nl_error)) {
+                case NLE_INVAL:
+                    /* thru invalid input exception for caller */
+                    throw NlExceptionInvalidInput();
+                default:
+                    /* thru default netlink exception */
+                    throw NlException(nl_geterror(nl_error));
+            }
+        }
+    } while (m_wait_for_ack && !m_completed);
+}
+
+void NlMessage::send() {
+    auto sock = get_sock();
+    try {
+        send_message(sock);
+        receive_reply(sock);
+    }
+    catch (...) {
+        /* unread replies may be left in the socket */
+        NlSocketPool::discard(m_sock);
+        throw;
     }
-    else if (0 > nl_error) {
-        /* Netlink error message reported back from kernel */
-        switch (abs(nl_error)) {
-            case NLE_INVAL:
-                /* thru invalid input exception for caller */
-                throw NlExceptionInvalidInput();
-            default:
-                /* thru default netlink exception */
-                throw NlException(nl_geterror(nl_error));
+}
+
+void NlMessage::send(const Messages& messages) {
+    if (messages.empty()) {
+        return;
+    }
+    auto& first = *messages.front();
+    auto sock = first.get_sock();
+    try {
+        for (auto message : messages) {
+            if (message->m_proto != first.m_proto) {
+                throw NlException("Cannot send messages of different protocols at once");
+            }
         }
+        /* number of unanswered requests is limited,
+         * so the replies do not overflow the socket buffer */
+        std::size_t sent = 0;
+        for (std::size_t received = 0; received < messages.size(); ++received) {
+            while (sent < messages.size() && sent - received < MAX_PENDING_MESSAGES) {
+                messages[sent++]->send_message(sock);
+            }
+            messages[received]->receive_reply(sock);
+        }
+    }
+    catch (...) {
+        /* unread replies may be left in the socket */
+        NlSocketPool::discard(first.m_sock);
+        throw;
     }
 }
 
-NlMessage::~NlMessage() { nl_socket_free(mp_sock); }
+NlMessage::~NlMessage() { }
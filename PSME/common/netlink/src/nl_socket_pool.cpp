@@ -0,0 +1,100 @@
+/*!
+ * @copyright
+ * Copyright (c) 2017 Intel Corporation
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file nl_socket_pool.cpp
+ *
+ * @brief Pool of connected Netlink sockets
+ * */
+
+#include "netlink/nl_socket_pool.hpp"
+#include "netlink/nl_exception.hpp"
+
+#include <netlink/netlink.h>
+#include <netlink/socket.h>
+
+using namespace netlink_base;
+
+constexpr std::size_t NlSocketPool::MAX_IDLE_SOCKETS;
+
+void NlSocketReleaser::operator()(struct nl_sock* sock) const {
+    NlSocketPool::get_instance().release(protocol, sock);
+}
+
+NlSocketPool& NlSocketPool::get_instance() {
+    static NlSocketPool pool{};
+    return pool;
+}
+
+NlSocket NlSocketPool::acquire(int protocol) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto& idle = m_idle[protocol];
+        if (!idle.empty()) {
+            NlSocket sock{idle.back(), NlSocketReleaser{protocol}};
+            idle.pop_back();
+            return sock;
+        }
+    }
+    /* connect new socket */
+    struct nl_sock* sock = nl_socket_alloc();
+    if (nullptr == sock) {
+        throw NlException("Failed to allocate the Netlink socket");
+    }
+    if (0 != nl_connect(sock, protocol)) {
+        nl_socket_free(sock);
+        throw NlException("Failed to connect to the Netlink socket");
+    }
+    return NlSocket{sock, NlSocketReleaser{protocol}};
+}
+
+void NlSocketPool::discard(NlSocket& sock) {
+    nl_socket_free(sock.release());
+}
+
+void NlSocketPool::release(int protocol, struct nl_sock* sock) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        auto& idle = m_idle[protocol];
+        if (idle.size() < MAX_IDLE_SOCKETS) {
+            idle.push_back(sock);
+            return;
+        }
+    }
+    nl_socket_free(sock);
+}
+
+std::size_t NlSocketPool::get_idle_count(int protocol) const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto it = m_idle.find(protocol);
+    return (m_idle.end() != it) ? it->second.size() : 0;
+}
+
+void NlSocketPool::clear() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto& idle : m_idle) {
+        for (auto sock : idle.second) {
+            nl_socket_free(sock);
+        }
+    }
+    m_idle.clear();
+}
+
+NlSocketPool::~NlSocketPool() {
+    clear();
+}
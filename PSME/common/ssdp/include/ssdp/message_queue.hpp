@@ -29,8 +29,10 @@
 #include "net/socket_address.hpp"
 
 #include <memory>
+#include <algorithm>
 #include <chrono>
 #include <map>
+#include <vector>
 
 namespace ssdp {
 
@@ -110,6 +112,15 @@ public:
      */
     long try_send();
 
+    /*
+     * Sends messages of one sender with sendmmsg.
+     * Stops at the first message which cannot be send, it should be retried with try_send().
+     * @param[in] messages Messages with the same sender.
+     * @param[in] first Index of first message to be send.
+     * @return Number of messages send.
+     */
+    static std::size_t try_send_batch(const std::vector<ScheduledMessage*>& messages, std::size_t first);
+
 private:
     State m_state{State::SCHEDULED};
     MulticastSocket m_sender;
@@ -212,28 +223,56 @@ void MessageQueue<Message>::select_ready_messages(Socket::List& writable,
 
 template<class Message>
 void MessageQueue<Message>::send_ready_messages(const Socket::List& writable) {
-    auto it = m_scheduled_msgs.begin();
-    auto end = m_scheduled_msgs.end();
-
-    while (it != end) {
-        auto& msg = it->second;
-        if (msg.is_ready_to_send(writable)) {
-            if (msg.try_send()) {
-                it = m_scheduled_msgs.erase(it);
-            }
-            else {
-                // send postponed, skip message and proceed with next one
-                ++it;
-            }
+    using Iterator = typename Queue::iterator;
+    std::vector<Iterator> ready{};
+    for (auto it = m_scheduled_msgs.begin(); it != m_scheduled_msgs.end(); ++it) {
+        if (it->second.is_ready_to_send(writable)) {
+            ready.push_back(it);
         }
-        else if (msg.is_scheduled()) {
+        else if (it->second.is_scheduled()) {
             // messages are sorted by time, when we encounter
             // one in SCHEDULED state, we can stop iteration
             break;
         }
-        else {
-            ++it;
+    }
+
+    // messages of one sender (e.g. responses to a burst of M-SEARCHes) are send together
+    auto group = ready.begin();
+    while (group != ready.end()) {
+        const auto sender = (*group)->second.get_sender();
+        const auto group_end = std::stable_partition(group, ready.end(),
+            [&sender](const Iterator& it) { return it->second.get_sender() == sender; });
+        std::vector<Message*> messages{};
+        for (auto it = group; it != group_end; ++it) {
+            messages.push_back(&(*it)->second);
+        }
+
+        std::size_t index{0};
+        while (index < messages.size()) {
+            if (messages.size() - index > 1) {
+                const auto sent = Message::try_send_batch(messages, index);
+                for (auto i = index; i < index + sent; ++i) {
+                    m_scheduled_msgs.erase(group[std::ptrdiff_t(i)]);
+                }
+                index += sent;
+                if (index == messages.size()) {
+                    break;
+                }
+            }
+            // message is send alone, errors are logged and the state is updated by try_send
+            if (messages[index]->try_send()) {
+                m_scheduled_msgs.erase(group[std::ptrdiff_t(index)]);
+                ++index;
+            }
+            else {
+                // send postponed, remaining messages of the sender would be postponed too
+                for (auto i = index + 1; i < messages.size(); ++i) {
+                    messages[i]->update_state(messages[index]->get_state());
+                }
+                break;
+            }
         }
+        group = group_end;
     }
 }
 
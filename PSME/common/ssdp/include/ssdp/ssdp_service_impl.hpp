@@ -33,8 +33,11 @@
 #include "net/network_interface.hpp"
 #include "net/multicast_socket.hpp"
 #include "net/paired_socket.hpp"
+#include "net/reactor.hpp"
 
+#include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <unordered_map>
 #include <chrono>
@@ -83,7 +86,7 @@ public:
 private:
     friend class SsdpServiceImplTest;
 
-    SsdpPacket receive_packet(SocketAddress& sender);
+    void process_ssdp_packet(const net::ReceivedDatagram& datagram);
 
     void execute();
 
@@ -117,6 +120,14 @@ private:
 
     std::string get_debug_network_status_info() const;
 
+    /*! Packets serialized for one address of SSDP enabled interface */
+    struct Payloads {
+        std::shared_ptr<const std::string> alive;
+        std::shared_ptr<const std::string> search_response;
+    };
+    const Payloads& get_payloads(const IpAddress& address);
+    void prune_pending_searches();
+
     std::atomic<bool> m_is_running{false};
     net::PairedSockets m_notification_pipe; // self-pipe trick
     std::thread m_thread{};
@@ -129,7 +140,16 @@ private:
     MulticastSocket m_listen_socket{};
 
     using Ms = MessageQueue<ScheduledMessage>::Ms;
+    using Timepoint = MessageQueue<ScheduledMessage>::Timepoint;
     MessageQueue<ScheduledMessage> m_queue{};
+    /*! Packets cache, cleared on network change */
+    std::map<IpAddress, Payloads> m_payloads{};
+    /*! Requesters with scheduled responses and end of their MX window */
+    std::map<SocketAddress, Timepoint> m_pending_searches{};
+    std::vector<net::ReceivedDatagram> m_receive_buffers{};
+    std::minstd_rand m_random{};
+    /*! Event loop of SSDP thread */
+    net::Reactor m_reactor{};
 };
 
 }
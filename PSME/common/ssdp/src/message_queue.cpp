@@ -75,3 +75,21 @@ long ScheduledMessage::try_send() {
     }
     return rc;
 }
+
+std::size_t ScheduledMessage::try_send_batch(const std::vector<ScheduledMessage*>& messages, std::size_t first) {
+    std::vector<net::OutgoingDatagram> datagrams{};
+    datagrams.reserve(messages.size() - first);
+    for (auto i = first; i < messages.size(); ++i) {
+        const auto& payload = *messages[i]->m_payload;
+        datagrams.push_back(net::OutgoingDatagram{payload.data(), payload.size(), messages[i]->m_receiver});
+    }
+    try {
+        const auto sent = messages[first]->m_sender.send_batch(datagrams);
+        log_debug(GET_LOGGER("ssdp"), "send " << sent << " of " << datagrams.size() << " messages");
+        return sent;
+    }
+    catch (const net::NetException&) {
+        // the message is retried alone, try_send logs the error
+        return 0;
+    }
+}
@@ -31,6 +31,7 @@
 #include "logger/logger_factory.hpp"
 
 #include <algorithm>
+#include <random>
 #include <set>
 #include <sstream>
 
@@ -40,6 +41,8 @@ namespace {
 
 constexpr const char SSDP_ALL_STR[] = "ssdp:all";
 constexpr const int PACKET_SIZE = 1536;
+/*! Maximum number of datagrams read by a single recvmmsg */
+constexpr std::size_t RECEIVE_BATCH = 32;
 
 bool supports_mcast_address(const SocketAddress& ssdp_address, const NetworkInterface& iface) {
     if (AF_INET == ssdp_address.af()) {
@@ -86,7 +89,7 @@ constexpr unsigned long MAX_MX = 5;
 constexpr uint DELAY_INCREMENT = 50;
 constexpr uint SCHEDULED_DELAY = 250;
 
-std::chrono::milliseconds calculate_delay(const std::string& mx_str) {
+unsigned long get_mx(const std::string& mx_str) {
     unsigned long mx{1};
     try {
         auto mx_val = std::stoul(mx_str);
@@ -95,8 +98,12 @@ std::chrono::milliseconds calculate_delay(const std::string& mx_str) {
         }
     }
     catch(...) {/*ignore*/}
+    return mx;
+}
 
-    return std::chrono::milliseconds(std::rand() / (1 + RAND_MAX / (1000 * mx)));
+std::chrono::milliseconds calculate_delay(unsigned long mx, std::minstd_rand& random) {
+    std::uniform_int_distribution<long> distribution(0, long(1000 * mx) - 1);
+    return std::chrono::milliseconds(distribution(random));
 }
 
 std::chrono::milliseconds get_check_interval(const SsdpServiceConfig& config) {
@@ -190,14 +197,18 @@ void SsdpServiceImpl::process_ssdp_m_search(const SsdpPacket& packet,
     const auto& st_header = packet.get_header(SsdpPacket::ST);
 
     if (st_header == SSDP_ALL_STR || st_header == m_config->get_service_urn()) {
-        auto delay = calculate_delay(packet.get_header(SsdpPacket::MX));
-        auto search_response = m_ssdp_packet_factory.create_ssdp_packet(
-                                            SsdpPacket::Type::SEARCH_RESPONSE);
-        URI service_uri{m_config->get_service_url()};
-        service_uri.set_host(lan_address.to_string());
-        search_response.set_header(SsdpPacket::AL, service_uri.to_string());
-        ScheduledMessage msg(m_listen_socket, sender,
-                std::make_shared<const std::string>(search_response.to_string()));
+        const auto mx = get_mx(packet.get_header(SsdpPacket::MX));
+        const auto now = std::chrono::time_point_cast<Ms>(std::chrono::steady_clock::now());
+        // retransmitted search is answered by responses already scheduled for the requester
+        auto pending = m_pending_searches.find(sender);
+        if (m_pending_searches.end() != pending && pending->second > now) {
+            log_debug(GET_LOGGER("ssdp"), "ignoring repeated M-SEARCH from " << sender);
+            return;
+        }
+        m_pending_searches[sender] = now + std::chrono::seconds(mx);
+
+        auto delay = calculate_delay(mx, m_random);
+        ScheduledMessage msg(m_listen_socket, sender, get_payloads(lan_address).search_response);
         m_queue.send_or_enqueue(msg, delay);
         m_queue.send_or_enqueue(msg, delay + Ms(DELAY_INCREMENT));
     }
@@ -215,15 +226,9 @@ void SsdpServiceImpl::send_alive() {
 
     log_debug(GET_LOGGER("ssdp"), "sending ssdp notifies");
 
-    auto ssdp_alive_packet = m_ssdp_packet_factory.create_ssdp_packet(
-                                                     SsdpPacket::Type::NOTIFY);
-    URI service_uri{ssdp_alive_packet.get_header(SsdpPacket::AL)};
-
     for (auto& sock: m_notify_sockets) {
-        service_uri.set_host(sock.get_address().get_host().to_string());
-        ssdp_alive_packet.set_header(SsdpPacket::AL, service_uri.to_string());
         ScheduledMessage msg(sock, SsdpService::SSDP_MCAST_ADDRESS,
-                std::make_shared<const std::string>(ssdp_alive_packet.to_string()));
+                get_payloads(sock.get_address().get_host()).alive);
         m_queue.send_or_enqueue(msg);
         m_queue.send_or_enqueue(msg, Ms(SCHEDULED_DELAY));
     }
@@ -265,9 +270,24 @@ void SsdpServiceImpl::send_byebye() {
 }
 
 void SsdpServiceImpl::process_ssdp_request() {
+    std::size_t received{0};
+    try {
+        received = m_listen_socket.receive_batch(m_receive_buffers, MSG_DONTWAIT);
+    }
+    catch (const std::exception& e) {
+        log_error(GET_LOGGER("ssdp"), "Failed to receive SSDP packets: " << e.what());
+        return;
+    }
+    for (std::size_t i = 0; i < received; ++i) {
+        process_ssdp_packet(m_receive_buffers[i]);
+    }
+}
+
+void SsdpServiceImpl::process_ssdp_packet(const net::ReceivedDatagram& datagram) {
     try {
-        SocketAddress sender;
-        auto packet = receive_packet(sender);
+        const auto& sender = datagram.sender;
+        SsdpPacketParser<std::vector<char>> parser(datagram.data, datagram.length);
+        auto packet = parser.parse();
 
         log_debug(GET_LOGGER("ssdp"), "from:" << sender << " packet:\n"
                 << packet.to_string());
@@ -292,7 +312,7 @@ void SsdpServiceImpl::process_ssdp_request() {
 
         process_ssdp_m_search(packet, sender, lan_address);
     }
-    catch (std::exception e) {
+    catch (const std::exception& e) {
         log_error(GET_LOGGER("ssdp"), e.what());
     }
     catch (...) {
@@ -300,13 +320,33 @@ void SsdpServiceImpl::process_ssdp_request() {
     }
 }
 
-SsdpPacket SsdpServiceImpl::receive_packet(SocketAddress& sender) {
-    static std::vector<char> buffer(PACKET_SIZE);
-    std::fill(buffer.begin(), buffer.end(), 0);
+const SsdpServiceImpl::Payloads& SsdpServiceImpl::get_payloads(const IpAddress& address) {
+    auto it = m_payloads.find(address);
+    if (m_payloads.end() == it) {
+        URI service_uri{m_config->get_service_url()};
+        service_uri.set_host(address.to_string());
 
-    auto n = m_listen_socket.receive_from(buffer.data(), buffer.size(), sender);
-    SsdpPacketParser<decltype(buffer)> parser(buffer, n);
-    return parser.parse();
+        auto alive = m_ssdp_packet_factory.create_ssdp_packet(SsdpPacket::Type::NOTIFY);
+        alive.set_header(SsdpPacket::AL, service_uri.to_string());
+        auto search_response = m_ssdp_packet_factory.create_ssdp_packet(SsdpPacket::Type::SEARCH_RESPONSE);
+        search_response.set_header(SsdpPacket::AL, service_uri.to_string());
+
+        it = m_payloads.emplace(address, Payloads{std::make_shared<const std::string>(alive.to_string()),
+            std::make_shared<const std::string>(search_response.to_string())}).first;
+    }
+    return it->second;
+}
+
+void SsdpServiceImpl::prune_pending_searches() {
+    const auto now = std::chrono::time_point_cast<Ms>(std::chrono::steady_clock::now());
+    for (auto it = m_pending_searches.begin(); it != m_pending_searches.end();) {
+        if (it->second <= now) {
+            it = m_pending_searches.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
 }
 
 void SsdpServiceImpl::init() {
@@ -337,7 +377,11 @@ void SsdpServiceImpl::init() {
 
     log_info(GET_LOGGER("ssdp"), get_debug_network_status_info());
 
-    std::srand(uint(std::time(0)));
+    m_receive_buffers.resize(RECEIVE_BATCH);
+    for (auto& buffer : m_receive_buffers) {
+        buffer.data.resize(PACKET_SIZE);
+    }
+    m_random.seed(std::random_device{}());
 }
 
 void SsdpServiceImpl::start() {
@@ -372,8 +416,9 @@ void SsdpServiceImpl::link_update(NetworkInterfaceMap::iterator it, const Networ
         }
         leave_or_join_mcast_group(m_listen_socket, SsdpService::SSDP_MCAST_ADDRESS, cached_iface, updated_iface);
 
-        // update cache
+        // update cache, packets are serialized again for the new addresses
         cached_iface = updated_iface;
+        m_payloads.clear();
     }
 }
 
@@ -475,45 +520,37 @@ void SsdpServiceImpl::execute() {
         return;
     }
 
-    Socket::List readable{}, writable{}, except{};
-
     const auto check_interval = get_check_interval(*m_config);
-    Ms timeout = check_interval;
-    auto last_announce_time =
-        std::chrono::time_point_cast<Ms>(std::chrono::steady_clock::now())
-            - check_interval;
-
     auto& notification_socket = m_notification_pipe.second;
+    net::Reactor::TimerId announce_timer{};
+    net::Reactor::TimerId prune_timer{};
+    try {
+        m_reactor.add(m_listen_socket, Socket::SELECT_READ, [this](int) { process_ssdp_request(); });
+        m_reactor.add(notification_socket, Socket::SELECT_READ, [this](int) { process_notification(); });
+        // first announcement is sent right away
+        announce_timer = m_reactor.add_timer(Ms::zero(), [this]() { send_alive(); }, check_interval);
+        prune_timer = m_reactor.add_timer(std::chrono::seconds(MAX_MX), [this]() { prune_pending_searches(); },
+                                          std::chrono::seconds(MAX_MX));
+    }
+    catch (const std::exception& e) {
+        log_error(GET_LOGGER("ssdp"), "Failed to start SSDP event loop: " << e.what());
+        return;
+    }
+
+    Socket::List readable{}, writable{}, except{};
     while (is_running()) {
         try {
-            readable.clear();
             writable.clear();
-            except.clear();
 
-            timeout = check_interval;
+            Ms timeout = check_interval;
             auto now = std::chrono::time_point_cast<Ms>(std::chrono::steady_clock::now());
-            auto elapsed = now - last_announce_time;
-            if (elapsed >= check_interval) {
-                send_alive();
-                last_announce_time += elapsed;
-            }
-            else {
-                timeout -= elapsed;
-            }
-
             m_queue.select_ready_messages(writable, now, timeout);
-            readable.push_back(m_listen_socket);
-            readable.push_back(notification_socket);
-
-            if (Socket::select(readable, writable, except, timeout)) {
-                for (const auto& socket : readable) {
-                    if (socket == m_listen_socket) {
-                        process_ssdp_request();
-                    }
-                    else if (socket == notification_socket) {
-                        process_notification();
-                    }
-                }
+
+            m_reactor.run_once(timeout);
+
+            // senders of postponed messages (rare), timeout was zero for them
+            if (!writable.empty()) {
+                Socket::select(readable, writable, except, Ms::zero());
             }
             m_queue.send_ready_messages(writable);
         }
@@ -526,6 +563,10 @@ void SsdpServiceImpl::execute() {
                     << "\n" << get_debug_network_status_info());
         }
     }
+    m_reactor.cancel_timer(prune_timer);
+    m_reactor.cancel_timer(announce_timer);
+    m_reactor.remove(notification_socket);
+    m_reactor.remove(m_listen_socket);
 
     send_byebye();
     log_info(GET_LOGGER("ssdp"), "SSDP service stopped.");
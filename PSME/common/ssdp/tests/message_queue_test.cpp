@@ -143,3 +143,31 @@ TEST_F(MessageQueueScheduledMessageTest, SendReadyMessages) {
     queue.send_ready_messages(writable_list);
     ASSERT_TRUE(internal_queue().empty());
 }
+
+TEST(MessageQueueBatchTest, SendReadyMessagesOfOneSender) {
+    using Ms = MessageQueue<ScheduledMessage>::Ms;
+    net::DatagramSocket receiver(SocketAddress("127.0.0.1", 0));
+    receiver.set_blocking(false);
+    MulticastSocket sender(SocketAddress("127.0.0.1", 0));
+    sender.set_blocking(false);
+
+    MessageQueue<ScheduledMessage> queue{};
+    for (const auto& payload : {"first", "second", "third"}) {
+        queue.send_or_enqueue(ScheduledMessage(sender, receiver.get_address(),
+            std::make_shared<const std::string>(payload)), Ms(1));
+    }
+    Socket::List writable{};
+    auto timeout = Ms(1000);
+    queue.select_ready_messages(writable, std::chrono::time_point_cast<Ms>(
+        std::chrono::steady_clock::now()) + Ms(10), timeout);
+    queue.send_ready_messages(writable);
+
+    std::vector<net::ReceivedDatagram> datagrams(4);
+    for (auto& datagram : datagrams) {
+        datagram.data.resize(16);
+    }
+    ASSERT_EQ(3, receiver.receive_batch(datagrams));
+    ASSERT_EQ("first", std::string(datagrams[0].data.data(), datagrams[0].length));
+    ASSERT_EQ("third", std::string(datagrams[2].data.data(), datagrams[2].length));
+    ASSERT_EQ(sender.get_address(), datagrams[1].sender);
+}